@@ -15,6 +15,19 @@
 extern "C" {
 #endif
 
+/**
+ * Statistics of the compressed frame queue, collected since the start of the
+ * current encoding or decoding operation.
+ */
+struct codecStats {
+    uint32_t frames;    ///< Frames passed through the queue
+    uint32_t overruns;  ///< Frames dropped because the queue was full
+    uint32_t underruns; ///< Frames of silence played because the queue was empty
+    uint8_t depth;      ///< Maximum number of frames in the queue
+    uint8_t level;      ///< Current number of frames in the queue
+    uint8_t highWater;  ///< Highest number of frames reached in the queue
+};
+
 /**
  * Initialise audio codec manager, allocating data buffers.
  *
@@ -65,6 +78,16 @@ void codec_stop(const pathId path);
  */
 bool codec_running();
 
+/**
+ * Check if the codec thread is active and has been started for a given audio
+ * path. The frame queue has a single producer: only the owner of the codec is
+ * allowed to push frames to it.
+ *
+ * @param path: audio path.
+ * @return true if the codec thread is active on the given path.
+ */
+bool codec_runningOnPath(const pathId path);
+
 /**
  * Get a compressed audio frame from the internal queue. Each frame is composed
  * of 8 bytes.
@@ -90,6 +113,32 @@ int codec_popFrame(uint8_t *frame, const bool blocking);
  */
 int codec_pushFrame(const uint8_t *frame, const bool blocking);
 
+/**
+ * Set the maximum number of frames held by the internal queue, trading
+ * latency for robustness against jitter of the producer or of the consumer.
+ * The value is clamped between one and the queue capacity, set at compile
+ * time by CONFIG_CODEC2_QUEUE_SIZE.
+ *
+ * @param frames: queue depth, in frames.
+ */
+void codec_setQueueDepth(const uint8_t frames);
+
+/**
+ * Get the statistics of the internal frame queue. Overruns are counted when
+ * the encoder or a non-blocking codec_pushFrame() find the queue full, while
+ * underruns are counted when the decoder finds the queue empty after having
+ * started playing. Statistics are reset when an encoding or decoding
+ * operation starts.
+ *
+ * @param stats: pointer to the destination structure.
+ */
+void codec_getStats(struct codecStats *stats);
+
+/**
+ * Reset the statistics of the internal frame queue.
+ */
+void codec_resetStats();
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,7 +40,8 @@ typedef int32_t pathId;
  * @param source: identifier of the input audio peripheral.
  * @param sink: identifier of the output audio peripheral.
  * @param prio: priority of the requester.
- * @return a unique identifier of the opened path or -1 if path is already in use.
+ * @return a unique identifier of the opened path or -1 if path is already in use
+ * or the maximum number of paths has been reached.
  */
 pathId audioPath_request(enum AudioSource source, enum AudioSink sink,
                          enum AudioPriority prio);
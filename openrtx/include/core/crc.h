@@ -14,6 +14,9 @@
 extern "C" {
 #endif
 
+#define CRC_M17_INIT   0xFFFF  ///< Initial value of the M17 CRC
+#define CRC_CCITT_INIT 0x0000  ///< Initial value of the CCITT CRC
+
 /**
  * @brief Compute the M17 16-bit CRC over a given block of data.
  *
@@ -26,12 +29,27 @@ extern "C" {
  *  - ReflectOut    = False
  *  - Algorithm     = table-driven
  *
+ * The lookup tables are generated at compile time, the number of tables used
+ * is set by CONFIG_CRC_SLICES (one, four or eight).
+ *
  * @param data: input data.
  * @param len: data length, in bytes.
  * @return A uint16_t M17 CRC.
  */
 uint16_t crc_m17(const void *data, const size_t len);
 
+/**
+ * Update the M17 16-bit CRC with a new block of data, allowing to compute the
+ * CRC of data split in multiple chunks. The computation has to be started with
+ * CRC_M17_INIT as initial CRC value.
+ *
+ * @param crc: current CRC value.
+ * @param data: input data.
+ * @param len: data length, in bytes.
+ * @return updated M17 CRC.
+ */
+uint16_t crc_m17_update(const uint16_t crc, const void *data, const size_t len);
+
 /**
  * Compute the CCITT 16-bit CRC over a given block of data.
  *
@@ -41,6 +59,19 @@ uint16_t crc_m17(const void *data, const size_t len);
  */
 uint16_t crc_ccitt(const void *data, const size_t len);
 
+/**
+ * Update the CCITT 16-bit CRC with a new block of data, allowing to compute
+ * the CRC of data split in multiple chunks. The computation has to be started
+ * with CRC_CCITT_INIT as initial CRC value.
+ *
+ * @param crc: current CRC value.
+ * @param data: input data.
+ * @param len: data length, in bytes.
+ * @return updated CCITT CRC.
+ */
+uint16_t crc_ccitt_update(const uint16_t crc, const void *data,
+                          const size_t len);
+
 #ifdef __cplusplus
 }
 #endif
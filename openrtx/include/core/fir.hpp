@@ -14,6 +14,8 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <utility>
 
 /**
  * Class for FIR filter with configurable coefficients.
@@ -71,6 +73,20 @@ public:
         return acc;
     }
 
+    /**
+     * Filter a block of samples. Input and output buffers may coincide, in
+     * which case the block is filtered in-place.
+     *
+     * @param input: pointer to the input samples.
+     * @param output: pointer to the destination buffer for filtered samples.
+     * @param length: number of samples to be processed.
+     */
+    void process(const float *input, float *output, const size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+            output[i] = (*this)(input[i]);
+    }
+
     /**
      * Reset FIR history, clearing the memory of past values.
      */
@@ -87,4 +103,235 @@ private:
     size_t                        pos;     ///< Current position in history.
 };
 
+/**
+ * Convert a floating point value to Q15 fixed point format, with rounding
+ * and saturation.
+ *
+ * @param value: floating point value.
+ * @return Q15 representation of the value.
+ */
+constexpr int16_t floatToQ15(const float value)
+{
+    return (value >=  (32767.0f / 32768.0f)) ? INT16_MAX :
+           (value <= -1.0f)                  ? INT16_MIN :
+           static_cast< int16_t >(value * 32768.0f + ((value >= 0.0f) ? 0.5f : -0.5f));
+}
+
+template < size_t N, size_t... I >
+constexpr std::array< int16_t, N > firTapsToQ15(const std::array< float, N >& taps,
+                                                std::index_sequence< I... >)
+{
+    return {{ floatToQ15(taps[I])... }};
+}
+
+/**
+ * Convert, at compile time, a set of floating point FIR coefficients to Q15
+ * fixed point format.
+ *
+ * @param taps: floating point FIR coefficients.
+ * @return std::array containing the Q15 FIR coefficients.
+ */
+template < size_t N >
+constexpr std::array< int16_t, N > firTapsToQ15(const std::array< float, N >& taps)
+{
+    return firTapsToQ15(taps, std::make_index_sequence< N >());
+}
+
+/**
+ * Class for fixed point FIR filter with configurable coefficients, operating on
+ * 16-bit samples and Q15 coefficients.
+ * On targets having the ARM DSP extension the multiply-accumulate loop uses
+ * the SMLAD instruction, performing two 16-bit MACs per cycle.
+ *
+ * The accumulator is 32 bit wide: to avoid overflows, the sum of the absolute
+ * values of the coefficients multiplied by the maximum absolute input value
+ * must stay below 65536. The output is saturated to the int16_t range.
+ */
+template < size_t N >
+class FirQ15
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param taps: reference to a std::array of Q15 values representing the
+     * FIR filter coefficients.
+     */
+    FirQ15(const std::array< int16_t, N >& taps) : taps(taps), pos(0)
+    {
+        reset();
+    }
+
+    /**
+     * Destructor.
+     */
+    ~FirQ15() { }
+
+    /**
+     * Perform one step of the FIR filter, computing a new output value given
+     * the input value and the history of previous input values.
+     *
+     * @param input: FIR input value for the current time step.
+     * @return FIR output as a function of the current and past input values.
+     */
+    int16_t operator()(const int16_t input)
+    {
+        pos = (pos == 0 ? N - 1 : pos - 1);
+        hist[pos] = input;
+        hist[pos + N] = input;
+
+        int32_t acc = dot(&hist[pos]) >> 15;
+        if (acc > INT16_MAX)
+            acc = INT16_MAX;
+        if (acc < INT16_MIN)
+            acc = INT16_MIN;
+
+        return static_cast< int16_t >(acc);
+    }
+
+    /**
+     * Filter a block of samples. Input and output buffers may coincide, in
+     * which case the block is filtered in-place.
+     *
+     * @param input: pointer to the input samples.
+     * @param output: pointer to the destination buffer for filtered samples.
+     * @param length: number of samples to be processed.
+     */
+    void process(const int16_t *input, int16_t *output, const size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+            output[i] = (*this)(input[i]);
+    }
+
+    /**
+     * Reset FIR history, clearing the memory of past values.
+     */
+    void reset()
+    {
+        hist.fill(0);
+        pos = 0;
+    }
+
+private:
+
+    /**
+     * Compute the dot product between the filter coefficients and N samples,
+     * rounding included.
+     *
+     * @param x: pointer to the first sample.
+     * @return dot product, in Q15 format.
+     */
+    int32_t dot(const int16_t *x)
+    {
+        int32_t acc = 1 << 14;
+        size_t i = 0;
+
+        #ifdef __ARM_FEATURE_DSP
+        // Dual 16-bit MAC, unaligned 32-bit loads are fine on Cortex-M4/M7
+        for (; i < (N & ~size_t(1)); i += 2) {
+            uint32_t xs, ts;
+            memcpy(&xs, &x[i], sizeof(xs));
+            memcpy(&ts, &taps[i], sizeof(ts));
+            asm("smlad %0, %1, %2, %0" : "+r"(acc) : "r"(xs), "r"(ts));
+        }
+        #else
+        // Unroll loop by 4
+        for (; i < (N & ~size_t(3)); i += 4) {
+            acc += static_cast< int32_t >(x[i])     * taps[i];
+            acc += static_cast< int32_t >(x[i + 1]) * taps[i + 1];
+            acc += static_cast< int32_t >(x[i + 2]) * taps[i + 2];
+            acc += static_cast< int32_t >(x[i + 3]) * taps[i + 3];
+        }
+        #endif
+
+        // Remaining taps
+        for (; i < N; i++)
+            acc += static_cast< int32_t >(x[i]) * taps[i];
+
+        return acc;
+    }
+
+    const std::array< int16_t, N >& taps;    ///< FIR filter coefficients.
+    std::array< int16_t, 2 * N >    hist;    ///< History of past inputs.
+    size_t                          pos;     ///< Current position in history.
+};
+
+/**
+ * Class for polyphase FIR interpolator with configurable coefficients.
+ * The interpolator is equivalent to a Fir filter fed with the input samples
+ * spaced by L - 1 zeroes, but it skips all the multiplications by zero:
+ * the filter taps are split in L sub-filters (phases), each one producing one
+ * of the L output samples corresponding to an input sample.
+ */
+template < size_t N, size_t L >
+class FirInterpolator
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param taps: reference to a std::array of floating point values representing
+     * the coefficients of the equivalent FIR filter.
+     */
+    FirInterpolator(const std::array< float, N >& taps) : pos(0)
+    {
+        for (size_t p = 0; p < L; p++) {
+            for (size_t j = 0; j < PHASE_TAPS; j++) {
+                size_t idx = p + (j * L);
+                phases[p][j] = (idx < N) ? taps[idx] : 0.0f;
+            }
+        }
+
+        reset();
+    }
+
+    /**
+     * Destructor.
+     */
+    ~FirInterpolator() { }
+
+    /**
+     * Perform one step of the interpolator, computing L output values given
+     * the input value and the history of previous input values.
+     *
+     * @param input: interpolator input value for the current time step.
+     * @param output: pointer to a buffer of L elements where to store the
+     * interpolated values.
+     */
+    void operator()(const float& input, float *output)
+    {
+        pos = (pos == 0 ? PHASE_TAPS - 1 : pos - 1);
+        hist[pos] = input;
+        hist[pos + PHASE_TAPS] = input;
+
+        for (size_t p = 0; p < L; p++) {
+            float acc = 0.0f;
+
+            for (size_t j = 0; j < PHASE_TAPS; j++)
+                acc += hist[pos + j] * phases[p][j];
+
+            output[p] = acc;
+        }
+    }
+
+    /**
+     * Reset interpolator history, clearing the memory of past values.
+     */
+    void reset()
+    {
+        hist.fill(0);
+        pos = 0;
+    }
+
+private:
+
+    static constexpr size_t PHASE_TAPS = (N + L - 1) / L;   ///< Taps per phase.
+
+    std::array< std::array< float, PHASE_TAPS >, L > phases; ///< Sub-filter coefficients.
+    std::array< float, 2 * PHASE_TAPS >              hist;   ///< History of past inputs.
+    size_t                                           pos;    ///< Current position in history.
+};
+
 #endif /* DSP_H */
@@ -110,7 +110,8 @@ void gfx_terminate();
  * Copy a given section, between two given rows, of framebuffer content to the
  * display.
  * @param startRow: first row of the framebuffer section to be copied
- * @param endRow: last row of the framebuffer section to be copied
+ * @param endRow: row following the last one of the framebuffer section to be
+ * copied
  */
 void gfx_renderRows(uint8_t startRow, uint8_t endRow);
 
@@ -121,12 +122,42 @@ void gfx_renderRows(uint8_t startRow, uint8_t endRow);
  */
 void gfx_render();
 
+/**
+ * Copy to the display only the framebuffer rows touched by the drawing
+ * functions since they were last sent to it. When CONFIG_GFX_SHADOW_BUFFER is
+ * defined, the touched rows are also compared against a copy of their previous
+ * content: redrawing a screen from scratch sends only the rows actually
+ * different. Rows close to each other are sent together, in a single transfer.
+ *
+ * When CONFIG_GFX_DOUBLE_BUFFER is defined, the changed rows are copied to a
+ * transfer buffer and sent in background: this function returns without
+ * waiting for the end of the transfer, and drawing can go on in the meantime.
+ *
+ * @return number of rows sent to the display.
+ */
+uint16_t gfx_flush();
+
+/**
+ * Check if the display is still receiving the rows sent by gfx_flush(). Always
+ * false when CONFIG_GFX_DOUBLE_BUFFER is not defined.
+ *
+ * @return true if a transfer to the display is in progress.
+ */
+bool gfx_renderingInProgress();
+
+/**
+ * Block the caller until the display received the rows sent by gfx_flush().
+ * Returns immediately when CONFIG_GFX_DOUBLE_BUFFER is not defined.
+ */
+void gfx_waitRender();
+
 /**
  * Clears a portion of the screen content
  * This results in a black screen on color displays
  * And a white screen on B/W displays
  * @param startRow: first row of the framebuffer section to be cleared
- * @param endRow: last row of the framebuffer section to be cleared
+ * @param endRow: row following the last one of the framebuffer section to be
+ * cleared
  */
 void gfx_clearRows(uint8_t startRow, uint8_t endRow);
 
@@ -68,6 +68,20 @@ public:
         return accNum;
     }
 
+    /**
+     * Filter a block of samples. Input and output buffers may coincide, in
+     * which case the block is filtered in-place.
+     *
+     * @param input: pointer to the input samples.
+     * @param output: pointer to the destination buffer for filtered samples.
+     * @param length: number of samples to be processed.
+     */
+    void process(const float *input, float *output, const size_t length)
+    {
+        for(size_t i = 0; i < length; i++)
+            output[i] = (*this)(input[i]);
+    }
+
     /**
      * Reset IIR history, clearing the memory of past values.
      */
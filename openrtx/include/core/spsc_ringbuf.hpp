@@ -0,0 +1,459 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef SPSC_RINGBUF_H
+#define SPSC_RINGBUF_H
+
+#ifndef __cplusplus
+#error This header is C++ only!
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MIOSIX)
+#include <kernel/scheduler/scheduler.h>
+#include <miosix.h>
+#elif defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <pthread.h>
+#endif
+
+/**
+ * Size used to keep the indices of the producer and of the consumer on
+ * separate cache lines.
+ */
+#if defined(__arm__)
+#define SPSC_CACHE_LINE 32
+#else
+#define SPSC_CACHE_LINE 64
+#endif
+
+/**
+ * Wait queue for the blocking calls of SpscRingBuffer: a thread waits for an
+ * index of the ring buffer to move away from a given value. The wait is done
+ * on a futex on Linux, on the Miosix scheduler on Miosix targets and on a
+ * condition variable elsewhere. Only one thread at a time can wait, which is
+ * always the case with a single producer and a single consumer. When nobody
+ * is sleeping, waking costs a single atomic operation.
+ */
+class SpscWaiter
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    SpscWaiter() : sleeping(false)
+    {
+        #if defined(_MIOSIX)
+        waiting = nullptr;
+        #elif !defined(__linux__)
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&cond, NULL);
+        #endif
+    }
+
+    /**
+     * Destructor.
+     */
+    ~SpscWaiter()
+    {
+        #if !defined(_MIOSIX) && !defined(__linux__)
+        pthread_mutex_destroy(&mutex);
+        pthread_cond_destroy(&cond);
+        #endif
+    }
+
+    /**
+     * Block the calling thread until the index changes from the given value,
+     * spurious wakeups are possible.
+     *
+     * @param index: index to be watched.
+     * @param value: value of the index the caller wants to leave.
+     */
+    void wait(std::atomic< uint32_t >& index, const uint32_t value)
+    {
+        // Announce the sleep before checking the index for the last time: the
+        // other side either sees the flag or has already moved the index.
+        sleeping.store(true, std::memory_order_seq_cst);
+
+        #if defined(_MIOSIX)
+        {
+            miosix::FastInterruptDisableLock dLock;
+            if(index.load(std::memory_order_seq_cst) == value)
+            {
+                waiting = miosix::Thread::IRQgetCurrentThread();
+                miosix::Thread::IRQwait();
+                {
+                    miosix::FastInterruptEnableLock eLock(dLock);
+                    miosix::Thread::yield();
+                }
+            }
+        }
+        #elif defined(__linux__)
+        // The kernel puts the thread to sleep only if the index still has the
+        // given value, a wakeup issued in the meantime is not lost.
+        if(index.load(std::memory_order_seq_cst) == value)
+        {
+            syscall(SYS_futex, &index, FUTEX_WAIT_PRIVATE, value,
+                    NULL, NULL, 0);
+        }
+        #else
+        pthread_mutex_lock(&mutex);
+        if(index.load(std::memory_order_seq_cst) == value)
+            pthread_cond_wait(&cond, &mutex);
+        pthread_mutex_unlock(&mutex);
+        #endif
+
+        sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * Wake the thread waiting on an index, to be called after having updated
+     * the index. Not callable from interrupt context.
+     *
+     * @param index: index being updated.
+     */
+    void wake(std::atomic< uint32_t >& index)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(sleeping.load(std::memory_order_relaxed) == false)
+            return;
+
+        if(sleeping.exchange(false, std::memory_order_acq_rel) == false)
+            return;
+
+        #if defined(_MIOSIX)
+        (void) index;
+        bool preempt = false;
+        {
+            miosix::FastInterruptDisableLock dLock;
+            if(waiting != nullptr)
+            {
+                waiting->IRQwakeup();
+                preempt = waiting->IRQgetPriority() >
+                          miosix::Thread::IRQgetCurrentThread()->IRQgetPriority();
+                waiting = nullptr;
+            }
+        }
+
+        // The scheduler can be invoked directly only from interrupt context,
+        // from a thread yield to let the woken one run.
+        if(preempt)
+            miosix::Thread::yield();
+        #elif defined(__linux__)
+        syscall(SYS_futex, &index, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        #else
+        (void) index;
+        pthread_mutex_lock(&mutex);
+        pthread_cond_signal(&cond);
+        pthread_mutex_unlock(&mutex);
+        #endif
+    }
+
+    #if defined(_MIOSIX)
+    /**
+     * Wake the thread waiting on an index, to be called from an interrupt
+     * handler after having updated the index.
+     */
+    void IRQwake()
+    {
+        if(sleeping.load(std::memory_order_relaxed) == false)
+            return;
+
+        sleeping.store(false, std::memory_order_relaxed);
+        if(waiting == nullptr)
+            return;
+
+        waiting->IRQwakeup();
+        if(waiting->IRQgetPriority() >
+           miosix::Thread::IRQgetCurrentThread()->IRQgetPriority())
+            miosix::Scheduler::IRQfindNextThread();
+
+        waiting = nullptr;
+    }
+    #endif
+
+private:
+
+    std::atomic< bool > sleeping;       ///< A thread is about to sleep or sleeping.
+
+    #if defined(_MIOSIX)
+    miosix::Thread  *waiting;           ///< Thread waiting on the index.
+    #elif !defined(__linux__)
+    pthread_mutex_t  mutex;             ///< Mutex protecting the condition.
+    pthread_cond_t   cond;              ///< Index changed condition.
+    #endif
+};
+
+/**
+ * Class implementing a statically allocated, lock-free circular buffer for a
+ * single producer and a single consumer. The producer only writes the head
+ * index and the consumer only writes the tail one, making the non-blocking
+ * functions wait-free and safe to be used concurrently from two threads or
+ * between a thread and an interrupt handler. The blocking functions suspend
+ * the caller only when the buffer is full (push) or empty (pop).
+ *
+ * The interface mirrors the one of RingBuffer, with the exception of reset()
+ * which is not thread safe.
+ *
+ * @tparam T: type of the elements.
+ * @tparam N: buffer capacity, must be a power of two.
+ */
+template < typename T, size_t N >
+class SpscRingBuffer
+{
+    static_assert((N >= 2) && ((N & (N - 1)) == 0),
+                  "SpscRingBuffer capacity must be a power of two");
+    static_assert(N <= (UINT32_MAX / 2) + 1, "SpscRingBuffer too large");
+
+public:
+
+    /**
+     * Constructor.
+     */
+    SpscRingBuffer() : head(0), tail(0) { }
+
+    /**
+     * Destructor.
+     */
+    ~SpscRingBuffer() { }
+
+    /**
+     * Push an element to the buffer, producer side.
+     *
+     * @param elem: element to be pushed.
+     * @param blocking: if set to true, when the buffer is full this function
+     * blocks the execution flow until at least one empty slot is available.
+     * @return true if the element has been successfully pushed to the queue,
+     * false if the queue is full.
+     */
+    bool push(const T& elem, bool blocking)
+    {
+        return pushN(&elem, 1, blocking) == 1;
+    }
+
+    /**
+     * Pop an element from the buffer, consumer side.
+     *
+     * @param elem: place where to store the popped element.
+     * @param blocking: if set to true, when the buffer is empty this function
+     * blocks the execution flow until at least one element is available.
+     * @return true if the element has been successfully popped from the queue,
+     * false if the queue is empty.
+     */
+    bool pop(T& elem, bool blocking)
+    {
+        return popN(&elem, 1, blocking) == 1;
+    }
+
+    /**
+     * Push a batch of elements to the buffer, producer side. The indices are
+     * updated, and the consumer woken up, once per contiguous group of slots.
+     *
+     * @param elems: elements to be pushed.
+     * @param count: number of elements to be pushed.
+     * @param blocking: if set to true, this function blocks the execution flow
+     * until all the elements have been pushed.
+     * @return number of elements pushed.
+     */
+    size_t pushN(const T *elems, const size_t count, bool blocking)
+    {
+        size_t done = 0;
+
+        while(done < count)
+        {
+            uint32_t h    = head.load(std::memory_order_relaxed);
+            uint32_t t    = tail.load(std::memory_order_acquire);
+            size_t   free = N - (h - t);
+
+            if(free == 0)
+            {
+                if(blocking == false)
+                    break;
+
+                notFull.wait(tail, t);
+                continue;
+            }
+
+            size_t num = count - done;
+            if(num > free)
+                num = free;
+
+            for(size_t i = 0; i < num; i++)
+                data[(h + i) & MASK] = elems[done + i];
+
+            head.store(h + num, std::memory_order_release);
+            notEmpty.wake(head);
+            done += num;
+        }
+
+        return done;
+    }
+
+    /**
+     * Pop a batch of elements from the buffer, consumer side.
+     *
+     * @param elems: place where to store the popped elements.
+     * @param count: maximum number of elements to be popped.
+     * @param blocking: if set to true, when the buffer is empty this function
+     * blocks the execution flow until at least one element is available.
+     * @return number of elements popped.
+     */
+    size_t popN(T *elems, const size_t count, bool blocking)
+    {
+        if(count == 0)
+            return 0;
+
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+
+        while(h == t)
+        {
+            if(blocking == false)
+                return 0;
+
+            notEmpty.wait(head, h);
+            h = head.load(std::memory_order_acquire);
+        }
+
+        size_t num = h - t;
+        if(num > count)
+            num = count;
+
+        for(size_t i = 0; i < num; i++)
+            elems[i] = data[(t + i) & MASK];
+
+        tail.store(t + num, std::memory_order_release);
+        notFull.wake(tail);
+
+        return num;
+    }
+
+    #if defined(_MIOSIX)
+    /**
+     * Non-blocking push, callable from interrupt context. Wakes up a thread
+     * waiting to pop an element.
+     *
+     * @param elem: element to be pushed.
+     * @return true if the element has been successfully pushed to the queue,
+     * false if the queue is full.
+     */
+    bool IRQpush(const T& elem)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        if((h - t) >= N)
+            return false;
+
+        data[h & MASK] = elem;
+        head.store(h + 1, std::memory_order_release);
+        notEmpty.IRQwake();
+
+        return true;
+    }
+
+    /**
+     * Non-blocking pop, callable from interrupt context. Wakes up a thread
+     * waiting to push an element.
+     *
+     * @param elem: place where to store the popped element.
+     * @return true if the element has been successfully popped from the queue,
+     * false if the queue is empty.
+     */
+    bool IRQpop(T& elem)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        if(h == t)
+            return false;
+
+        elem = data[t & MASK];
+        tail.store(t + 1, std::memory_order_release);
+        notFull.IRQwake();
+
+        return true;
+    }
+    #endif
+
+    /**
+     * Check if the buffer is empty.
+     *
+     * @return true if the buffer is empty.
+     */
+    bool empty()
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Check if the buffer is full.
+     *
+     * @return true if the buffer is full.
+     */
+    bool full()
+    {
+        return size() >= N;
+    }
+
+    /**
+     * Get the number of elements currently stored in the buffer. The value
+     * is exact only when called by the producer or by the consumer.
+     *
+     * @return number of elements in the buffer.
+     */
+    size_t size()
+    {
+        uint32_t t = tail.load(std::memory_order_acquire);
+        uint32_t h = head.load(std::memory_order_acquire);
+
+        return h - t;
+    }
+
+    /**
+     * Discard one element from the buffer's tail, creating a new empty slot.
+     * Consumer side.
+     */
+    void eraseElement()
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        if(h == t)
+            return;
+
+        tail.store(t + 1, std::memory_order_release);
+        notFull.wake(tail);
+    }
+
+    /**
+     * Reset the buffer to its empty state discarding all the elements stored.
+     * Must not be called while the producer or the consumer are active.
+     */
+    void reset()
+    {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+private:
+
+    static constexpr uint32_t MASK = N - 1;
+
+    alignas(SPSC_CACHE_LINE) std::atomic< uint32_t > head;  ///< Write index, owned by the producer.
+    alignas(SPSC_CACHE_LINE) std::atomic< uint32_t > tail;  ///< Read index, owned by the consumer.
+    alignas(SPSC_CACHE_LINE) T data[N];                     ///< Data storage.
+
+    SpscWaiter notEmpty;    ///< Consumer waiting for data.
+    SpscWaiter notFull;     ///< Producer waiting for free slots.
+};
+
+#endif  // SPSC_RINGBUF_H
@@ -0,0 +1,194 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/FreeSans10pt7b.h
+
+static const uint8_t FreeSans10pt7bData[] = {
+  0x0C, 0x81, 0x10, 0x22, 0x04, 0xC7, 0xFE, 0xFF, 0xC4, 0x40, 0x88, 0x11,
+  0x1F, 0xF8, 0xCC, 0x19, 0x02, 0x20, 0x44, 0x00, 0x00, 0x10, 0x78, 0x20,
+  0xCC, 0x20, 0x84, 0x40, 0x84, 0x40, 0xCC, 0x80, 0x79, 0x80, 0x01, 0x00,
+  0x03, 0x3E, 0x02, 0x62, 0x06, 0x63, 0x04, 0x63, 0x0C, 0x62, 0x08, 0x3E,
+  0x1E, 0x07, 0xE0, 0x8C, 0x10, 0x83, 0x30, 0x3C, 0x07, 0x01, 0xE2, 0x66,
+  0x58, 0x7B, 0x06, 0x60, 0xCE, 0x3C, 0xFC, 0xC0, 0xFF, 0x80, 0x25, 0x7E,
+  0xE5, 0x80, 0x41, 0x81, 0x81, 0x81, 0x49, 0x41, 0x81, 0x81, 0x81, 0x40,
+  0xF5, 0x80, 0xF8, 0xF0, 0x08, 0x42, 0x21, 0x08, 0x84, 0x22, 0x10, 0x8C,
+  0x40, 0x1C, 0x3F, 0x18, 0xD8, 0x2C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x26, 0x31, 0xF0, 0x08, 0xCF, 0xF1, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0x8C, 0x25, 0x37, 0x12, 0x54, 0x54, 0x52, 0x72, 0x62, 0x53, 0x53,
+  0x43, 0x62, 0x62, 0x7F, 0x30, 0x3C, 0x3F, 0xB0, 0xD8, 0x2C, 0x10, 0x18,
+  0x78, 0x3E, 0x01, 0x80, 0xE0, 0x78, 0x3E, 0x33, 0xF0, 0x02, 0x03, 0x03,
+  0x83, 0xC1, 0x61, 0xB1, 0x98, 0x8C, 0xC6, 0x7F, 0xFF, 0xE0, 0xC0, 0x60,
+  0x30, 0x7F, 0x3F, 0x90, 0x08, 0x04, 0x07, 0xF3, 0x9D, 0x83, 0x01, 0x80,
+  0xC0, 0x78, 0x3E, 0x33, 0xF0, 0x1E, 0x1F, 0x98, 0x58, 0x3C, 0x06, 0x63,
+  0xFD, 0xC7, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x31, 0xF0, 0x0F, 0x37, 0x26,
+  0x27, 0x17, 0x26, 0x27, 0x26, 0x27, 0x27, 0x17, 0x27, 0x27, 0x25, 0x3C,
+  0x3F, 0xB0, 0xD8, 0x3C, 0x13, 0x18, 0xF8, 0xEE, 0xC1, 0xE0, 0xE0, 0x78,
+  0x3E, 0x33, 0xF0, 0x3C, 0x3F, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F, 0x06, 0xCF,
+  0x3D, 0x80, 0xC0, 0x78, 0x66, 0x33, 0xF0, 0x04, 0xC4, 0x02, 0x93, 0x94,
+  0x84, 0x92, 0x54, 0x43, 0x44, 0x62, 0x80, 0x96, 0x12, 0x34, 0x53, 0x52,
+  0x62, 0x52, 0x52, 0x52, 0x62, 0x61, 0xF8, 0x17, 0x14, 0x0E, 0x00, 0xE0,
+  0x1B, 0x01, 0xB0, 0x19, 0x03, 0x18, 0x31, 0x82, 0x08, 0x7F, 0xC7, 0xFC,
+  0x60, 0x6C, 0x06, 0xC0, 0x68, 0x03, 0xFF, 0x20, 0xE8, 0x0A, 0x03, 0x80,
+  0xA0, 0x6F, 0xF2, 0x0E, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0xFF, 0xBF, 0xC0,
+  0xF0, 0x74, 0x24, 0x32, 0x26, 0x22, 0x18, 0x4A, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x28, 0x21, 0x27, 0x21, 0x26, 0x32, 0x33, 0x34, 0x72, 0x08, 0x32, 0x43,
+  0x22, 0x62, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x12,
+  0x62, 0x19, 0x28, 0x30, 0x0C, 0x82, 0x82, 0x82, 0x82, 0x89, 0x12, 0x82,
+  0x82, 0x82, 0x82, 0x8F, 0x50, 0x0B, 0x72, 0x72, 0x72, 0x72, 0x78, 0x12,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x70, 0xF1, 0x84, 0x34, 0x32, 0x27,
+  0x22, 0x19, 0x4B, 0x2B, 0x25, 0x85, 0x89, 0x49, 0x21, 0x28, 0x21, 0x27,
+  0x32, 0x34, 0x43, 0x72, 0x10, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x8E,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x0F, 0xD0, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC1, 0xC3, 0xC3, 0x63, 0x7E, 0x80,
+  0xD0, 0x32, 0x0C, 0x43, 0x08, 0xC1, 0x30, 0x2F, 0x07, 0x60, 0xC6, 0x10,
+  0x62, 0x0C, 0x40, 0xC8, 0x0D, 0x01, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xE0, 0x1F, 0xC0,
+  0x7F, 0x03, 0xF4, 0x0F, 0xD8, 0x2F, 0x61, 0xBC, 0x86, 0xF3, 0x13, 0xCC,
+  0xCF, 0x13, 0x3C, 0x68, 0xF1, 0xE3, 0xC3, 0x8F, 0x0C, 0x30, 0xE0, 0x3F,
+  0x03, 0xF0, 0x3D, 0x83, 0xCC, 0x3C, 0xC3, 0xC6, 0x3C, 0x63, 0xC3, 0x3C,
+  0x1B, 0xC1, 0xBC, 0x0F, 0xC0, 0x7C, 0x07, 0xF2, 0x76, 0x34, 0x33, 0x27,
+  0x22, 0x29, 0x21, 0x29, 0x21, 0x2A, 0x11, 0x2A, 0x4A, 0x4A, 0x11, 0x29,
+  0x21, 0x29, 0x22, 0x27, 0x24, 0x34, 0x35, 0x74, 0x09, 0x12, 0x52, 0x12,
+  0x64, 0x64, 0x64, 0x6B, 0x18, 0x22, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80,
+  0xF2, 0x76, 0x34, 0x33, 0x27, 0x22, 0x29, 0x21, 0x29, 0x21, 0x2A, 0x11,
+  0x2A, 0x4A, 0x4A, 0x11, 0x29, 0x21, 0x26, 0x12, 0x22, 0x25, 0x44, 0x33,
+  0x45, 0xAD, 0x11, 0xFF, 0x98, 0x3B, 0x01, 0xE0, 0x3C, 0x07, 0x81, 0xBF,
+  0xE7, 0xFC, 0xC0, 0xD8, 0x0B, 0x01, 0x60, 0x2C, 0x07, 0x80, 0xC0, 0xD7,
+  0x32, 0x52, 0x21, 0x71, 0x12, 0x75, 0x93, 0x96, 0x85, 0x95, 0x74, 0x74,
+  0x72, 0x13, 0x42, 0x37, 0x20, 0x0C, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x50, 0x01, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x74, 0x62, 0x13, 0x43, 0x37,
+  0x20, 0xC0, 0x78, 0x0D, 0x81, 0xB0, 0x66, 0x0C, 0x61, 0x8C, 0x61, 0x8C,
+  0x19, 0x83, 0x60, 0x6C, 0x07, 0x80, 0xE0, 0x0C, 0x00, 0xC1, 0x81, 0xE0,
+  0xE0, 0xF0, 0x70, 0x58, 0x68, 0x66, 0x36, 0x33, 0x13, 0x19, 0x99, 0x88,
+  0xCC, 0x4C, 0x36, 0x36, 0x1A, 0x1B, 0x0F, 0x05, 0x07, 0x83, 0x81, 0xC1,
+  0xC0, 0xC0, 0xE0, 0xC0, 0x6C, 0x18, 0xC7, 0x18, 0xC1, 0xB0, 0x1C, 0x03,
+  0x80, 0x70, 0x1B, 0x03, 0x30, 0xC6, 0x30, 0x6E, 0x0F, 0x80, 0xC0, 0xC0,
+  0x7C, 0x0D, 0x83, 0x18, 0x63, 0x18, 0x36, 0x03, 0xC0, 0x70, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x00, 0x0A, 0x82, 0x73, 0x63, 0x72,
+  0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x73, 0x7F, 0x50, 0x84, 0x10, 0x84,
+  0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x0B, 0x08, 0x3F, 0xB0, 0xD8, 0x20,
+  0x31, 0xFB, 0xC5, 0x82, 0xC3, 0x63, 0x9F, 0x60, 0xC0, 0x60, 0x30, 0x19,
+  0x8F, 0xF7, 0x1B, 0x07, 0x83, 0xC0, 0xE0, 0x70, 0x78, 0x3E, 0x37, 0xF0,
+  0x08, 0x7E, 0xE3, 0xC3, 0x80, 0x80, 0x80, 0x81, 0xC3, 0xE3, 0x7E, 0x72,
+  0x72, 0x72, 0x32, 0x22, 0x1B, 0x35, 0x53, 0x63, 0x63, 0x63, 0x64, 0x46,
+  0x33, 0x18, 0x08, 0x1F, 0x18, 0xD8, 0x3C, 0x1F, 0xFE, 0x01, 0x80, 0xC1,
+  0xB1, 0x8F, 0x80, 0x39, 0x88, 0x4F, 0x90, 0x84, 0x21, 0x08, 0x42, 0x10,
+  0x18, 0x3E, 0xF8, 0xF8, 0x78, 0x1C, 0x0E, 0x07, 0x03, 0xC3, 0xF1, 0xDF,
+  0x60, 0x2C, 0x16, 0x19, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x8D, 0xF7, 0x1B,
+  0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0C, 0x04, 0x4F, 0x50,
+  0x6C, 0x06, 0xDB, 0x6D, 0xB6, 0xDB, 0x7C, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0x66, 0x63, 0x61, 0xF0, 0xF8, 0x66, 0x31, 0x98, 0xCC, 0x36, 0x0C, 0x0C,
+  0x33, 0xFB, 0xEE, 0x38, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0,
+  0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xC0, 0x04, 0x6F, 0xB8, 0xD8, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x60, 0x08, 0x3F, 0x18, 0xD8,
+  0x3C, 0x1C, 0x0E, 0x07, 0x83, 0xC1, 0xB1, 0x9F, 0x80, 0x0C, 0x7F, 0xB8,
+  0xD8, 0x3C, 0x1E, 0x07, 0x03, 0x83, 0xC1, 0xF1, 0xBF, 0xD8, 0x0C, 0x06,
+  0x03, 0x00, 0x32, 0x5B, 0x35, 0x53, 0x63, 0x63, 0x63, 0x64, 0x55, 0x33,
+  0x15, 0x12, 0x72, 0x72, 0x72, 0x72, 0x0E, 0xF9, 0x8C, 0x63, 0x18, 0xC6,
+  0x30, 0x18, 0x7E, 0xC6, 0xC3, 0xC0, 0x7C, 0x1E, 0x03, 0x83, 0xC3, 0x7E,
+  0x21, 0x09, 0xF2, 0x10, 0x84, 0x21, 0x08, 0x43, 0x80, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0x7D, 0xC1, 0xB0, 0xD8, 0x44, 0x63,
+  0x31, 0x90, 0x58, 0x3C, 0x1C, 0x06, 0x00, 0xC3, 0x0D, 0x0C, 0x26, 0x79,
+  0x99, 0xE6, 0x24, 0x90, 0x92, 0x43, 0xCF, 0x0F, 0x3C, 0x18, 0x60, 0x61,
+  0x80, 0xC3, 0x66, 0x6C, 0x3C, 0x18, 0x38, 0x3C, 0x66, 0xC6, 0xC3, 0x83,
+  0xC3, 0xC2, 0x46, 0x66, 0x64, 0x2C, 0x3C, 0x38, 0x18, 0x10, 0x30, 0x30,
+  0xE0, 0xFF, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xC0, 0xFF, 0x0F,
+  0x30 };
+
+static const packedGlyph_t FreeSans10pt7bGlyphs[] = {
+  {     0,   0,   1,   5,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,  11,  14,  11,    0,  -13, GLYPH_RAW },   // 0x23 '#'
+  {    20,  16,  14,  17,    1,  -13, GLYPH_RAW },   // 0x25 '%'
+  {    48,  11,  14,  13,    1,  -13, GLYPH_RAW },   // 0x26 '&'
+  {    68,   2,   5,   4,    1,  -13, GLYPH_RAW },   // 0x27 '\''
+  {    70,   5,   5,   8,    1,  -13, GLYPH_RAW },   // 0x2A '*'
+  {    74,   9,   9,  11,    1,   -8, GLYPH_RLE },   // 0x2B '+'
+  {    84,   2,   5,   5,    2,   -1, GLYPH_RAW },   // 0x2C ','
+  {    86,   5,   1,   7,    1,   -5, GLYPH_RAW },   // 0x2D '-'
+  {    87,   2,   2,   5,    2,   -1, GLYPH_RAW },   // 0x2E '.'
+  {    88,   5,  14,   5,    0,  -13, GLYPH_RAW },   // 0x2F '/'
+  {    97,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x30 '0'
+  {   113,   5,  14,  11,    2,  -13, GLYPH_RAW },   // 0x31 '1'
+  {   122,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x32 '2'
+  {   137,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x33 '3'
+  {   153,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x34 '4'
+  {   169,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x35 '5'
+  {   185,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x36 '6'
+  {   201,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x37 '7'
+  {   215,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x38 '8'
+  {   231,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x39 '9'
+  {   247,   2,  10,   5,    2,   -9, GLYPH_RLE },   // 0x3A ':'
+  {   249,  10,   9,  11,    1,   -8, GLYPH_RLE },   // 0x3E '>'
+  {   259,   8,  15,  11,    2,  -14, GLYPH_RLE },   // 0x3F '?'
+  {   273,  12,  14,  13,    1,  -13, GLYPH_RAW },   // 0x41 'A'
+  {   294,  10,  14,  13,    2,  -13, GLYPH_RAW },   // 0x42 'B'
+  {   312,  12,  15,  14,    1,  -14, GLYPH_RLE },   // 0x43 'C'
+  {   333,  11,  14,  14,    2,  -13, GLYPH_RLE },   // 0x44 'D'
+  {   352,  10,  14,  13,    2,  -13, GLYPH_RLE },   // 0x45 'E'
+  {   365,   9,  14,  12,    2,  -13, GLYPH_RLE },   // 0x46 'F'
+  {   379,  13,  15,  15,    1,  -14, GLYPH_RLE },   // 0x47 'G'
+  {   401,  11,  14,  14,    2,  -13, GLYPH_RLE },   // 0x48 'H'
+  {   415,   2,  14,   5,    2,  -13, GLYPH_RLE },   // 0x49 'I'
+  {   417,   8,  14,  10,    0,  -13, GLYPH_RAW },   // 0x4A 'J'
+  {   431,  11,  14,  13,    2,  -13, GLYPH_RAW },   // 0x4B 'K'
+  {   451,   8,  14,  11,    2,  -13, GLYPH_RAW },   // 0x4C 'L'
+  {   465,  14,  14,  16,    1,  -13, GLYPH_RAW },   // 0x4D 'M'
+  {   490,  12,  14,  14,    1,  -13, GLYPH_RAW },   // 0x4E 'N'
+  {   511,  14,  15,  15,    1,  -14, GLYPH_RLE },   // 0x4F 'O'
+  {   536,  10,  14,  13,    2,  -13, GLYPH_RLE },   // 0x50 'P'
+  {   552,  14,  16,  15,    1,  -14, GLYPH_RLE },   // 0x51 'Q'
+  {   579,  11,  14,  14,    2,  -13, GLYPH_RAW },   // 0x52 'R'
+  {   599,  11,  15,  13,    1,  -14, GLYPH_RLE },   // 0x53 'S'
+  {   617,  12,  14,  12,    0,  -13, GLYPH_RLE },   // 0x54 'T'
+  {   632,  11,  14,  14,    2,  -13, GLYPH_RLE },   // 0x55 'U'
+  {   649,  11,  14,  13,    1,  -13, GLYPH_RAW },   // 0x56 'V'
+  {   669,  17,  14,  18,    1,  -13, GLYPH_RAW },   // 0x57 'W'
+  {   699,  11,  14,  13,    1,  -13, GLYPH_RAW },   // 0x58 'X'
+  {   719,  11,  14,  13,    1,  -13, GLYPH_RAW },   // 0x59 'Y'
+  {   739,  10,  14,  12,    1,  -13, GLYPH_RLE },   // 0x5A 'Z'
+  {   753,   5,  14,   5,    0,  -13, GLYPH_RAW },   // 0x5C '\\'
+  {   762,  11,   1,  11,    0,    3, GLYPH_RLE },   // 0x5F '_'
+  {   763,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x61 'a'
+  {   776,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x62 'b'
+  {   792,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x63 'c'
+  {   803,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x64 'd'
+  {   818,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x65 'e'
+  {   831,   5,  14,   5,    0,  -13, GLYPH_RAW },   // 0x66 'f'
+  {   840,   9,  15,  11,    1,  -10, GLYPH_RAW },   // 0x67 'g'
+  {   857,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x68 'h'
+  {   873,   2,  14,   4,    1,  -13, GLYPH_RLE },   // 0x69 'i'
+  {   876,   3,  18,   4,    0,  -13, GLYPH_RAW },   // 0x6A 'j'
+  {   883,   9,  14,  10,    1,  -13, GLYPH_RAW },   // 0x6B 'k'
+  {   415,   2,  14,   4,    1,  -13, GLYPH_RLE },   // 0x6C 'l'
+  {   899,  14,  11,  16,    1,  -10, GLYPH_RAW },   // 0x6D 'm'
+  {   919,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x6E 'n'
+  {   932,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x6F 'o'
+  {   945,   9,  15,  11,    1,  -10, GLYPH_RAW },   // 0x70 'p'
+  {   962,   9,  15,  11,    1,  -10, GLYPH_RLE },   // 0x71 'q'
+  {   978,   5,  11,   7,    1,  -10, GLYPH_RAW },   // 0x72 'r'
+  {   985,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x73 's'
+  {   996,   5,  13,   5,    0,  -12, GLYPH_RAW },   // 0x74 't'
+  {  1005,   8,  10,  11,    1,   -9, GLYPH_RAW },   // 0x75 'u'
+  {  1015,   9,  10,  10,    0,   -9, GLYPH_RAW },   // 0x76 'v'
+  {  1027,  14,  10,  14,    0,   -9, GLYPH_RAW },   // 0x77 'w'
+  {  1045,   8,  10,  10,    1,   -9, GLYPH_RAW },   // 0x78 'x'
+  {  1055,   8,  14,  10,    1,   -9, GLYPH_RAW },   // 0x79 'y'
+  {  1069,   8,  10,  10,    1,   -9, GLYPH_RAW },   // 0x7A 'z'
+  {  1079,   1,  18,   5,    2,  -13, GLYPH_RLE } }; // 0x7C '|'
+
+static const uint8_t FreeSans10pt7bIndex[] = {
+    0,   0,   0,   1,   0,   2,   3,   4,   0,   0,   5,   6,
+    7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+   19,  20,  21,   0,   0,   0,  22,  23,   0,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+   39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,   0,
+   50,   0,   0,  51,   0,  52,  53,  54,  55,  56,  57,  58,
+   59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+   71,  72,  73,  74,  75,  76,  77,   0,  78,   0,   0 };
+
+static const packedFont_t FreeSans10pt7b = {
+  FreeSans10pt7bData,
+  FreeSans10pt7bGlyphs,
+  FreeSans10pt7bIndex,
+  0x20, 0x7E, 33 };
+
+// 79 glyphs, 1081 bytes of glyph data
@@ -0,0 +1,228 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/FreeSans12pt7b.h
+
+static const uint8_t FreeSans12pt7bData[] = {
+  0x06, 0x30, 0x31, 0x03, 0x18, 0x18, 0xC7, 0xFF, 0xBF, 0xFC, 0x31, 0x03,
+  0x18, 0x18, 0xC7, 0xFF, 0xBF, 0xFC, 0x31, 0x01, 0x18, 0x18, 0xC0, 0xC6,
+  0x06, 0x30, 0xD2, 0x74, 0x71, 0x76, 0x52, 0x63, 0x23, 0x41, 0x72, 0x42,
+  0x32, 0x72, 0x42, 0x31, 0x83, 0x23, 0x22, 0x96, 0x22, 0xB4, 0x31, 0xF3,
+  0x23, 0x5A, 0x13, 0x78, 0x22, 0x33, 0x37, 0x13, 0x25, 0x26, 0x23, 0x25,
+  0x26, 0x14, 0x33, 0x35, 0x16, 0x76, 0x17, 0x52, 0x0F, 0x00, 0x7E, 0x03,
+  0x9C, 0x0C, 0x30, 0x30, 0xC0, 0xE7, 0x01, 0xF8, 0x03, 0x80, 0x3E, 0x01,
+  0xCC, 0x6E, 0x19, 0xB0, 0x7C, 0xC0, 0xF3, 0x03, 0xCE, 0x1F, 0x9F, 0xE6,
+  0x1E, 0x1C, 0xFF, 0xA0, 0x10, 0x23, 0x5B, 0xE3, 0x8D, 0x91, 0x00, 0x42,
+  0x82, 0x82, 0x82, 0x4F, 0x54, 0x28, 0x28, 0x28, 0x28, 0x24, 0xF5, 0x60,
+  0x0C, 0xF0, 0x02, 0x0C, 0x10, 0x20, 0xC1, 0x02, 0x0C, 0x10, 0x20, 0xC1,
+  0x02, 0x0C, 0x10, 0x20, 0xC1, 0x00, 0x35, 0x57, 0x33, 0x33, 0x22, 0x52,
+  0x13, 0x55, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x63, 0x12, 0x52,
+  0x23, 0x33, 0x37, 0x55, 0x30, 0x08, 0xCF, 0xFF, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0x8C, 0x63, 0x18, 0x35, 0x49, 0x22, 0x43, 0x12, 0x65, 0x72, 0x92,
+  0x92, 0x83, 0x73, 0x64, 0x54, 0x63, 0x72, 0x91, 0x92, 0x9F, 0x70, 0x26,
+  0x48, 0x23, 0x43, 0x12, 0x62, 0x12, 0x62, 0x92, 0x83, 0x55, 0x65, 0xA2,
+  0xA2, 0x94, 0x74, 0x72, 0x12, 0x43, 0x28, 0x55, 0x30, 0x01, 0x80, 0x70,
+  0x0E, 0x03, 0xC0, 0xD8, 0x1B, 0x06, 0x61, 0x8C, 0x21, 0x8C, 0x33, 0x06,
+  0x7F, 0xFF, 0xFE, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x28, 0x29, 0x22,
+  0x92, 0x92, 0x92, 0x14, 0x48, 0x23, 0x43, 0x93, 0x92, 0x92, 0x92, 0x94,
+  0x66, 0x43, 0x28, 0x55, 0x30, 0x0F, 0x07, 0xF9, 0xC3, 0x30, 0x74, 0x01,
+  0x80, 0x33, 0xC7, 0xFE, 0xF0, 0xDC, 0x1F, 0x01, 0xE0, 0x3C, 0x06, 0xC1,
+  0xDC, 0x71, 0xFC, 0x1F, 0x00, 0x0F, 0x79, 0x19, 0x28, 0x29, 0x19, 0x28,
+  0x29, 0x28, 0x29, 0x29, 0x19, 0x29, 0x29, 0x28, 0x29, 0x27, 0x1F, 0x07,
+  0xF1, 0xC7, 0x30, 0x66, 0x0C, 0xC1, 0x8C, 0x61, 0xFC, 0x3F, 0x8E, 0x3B,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xD8, 0x31, 0xFC, 0x1F, 0x00, 0x1F, 0x07,
+  0xF1, 0xC7, 0x70, 0x6C, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0x61, 0xEF, 0xFC,
+  0x79, 0x80, 0x30, 0x05, 0x81, 0x98, 0x73, 0xFC, 0x1E, 0x00, 0x04, 0xF3,
+  0x40, 0xC3, 0xA4, 0xA5, 0x95, 0xA4, 0x93, 0x74, 0x54, 0x64, 0x64, 0x81,
+  0xB0, 0x35, 0x38, 0x13, 0x42, 0x12, 0x64, 0x62, 0x82, 0x82, 0x72, 0x73,
+  0x63, 0x63, 0x72, 0x82, 0x82, 0xFD, 0x28, 0x24, 0x54, 0xA4, 0xA4, 0x96,
+  0x82, 0x22, 0x82, 0x22, 0x73, 0x23, 0x62, 0x42, 0x62, 0x42, 0x53, 0x43,
+  0x42, 0x62, 0x4A, 0x3C, 0x22, 0x73, 0x22, 0x82, 0x13, 0x85, 0xA4, 0xA2,
+  0x0A, 0x3B, 0x22, 0x72, 0x22, 0x82, 0x12, 0x82, 0x12, 0x82, 0x12, 0x82,
+  0x12, 0x72, 0x2A, 0x3B, 0x22, 0x82, 0x12, 0x94, 0x94, 0x94, 0x94, 0x82,
+  0x1C, 0x1A, 0x30, 0x56, 0x7A, 0x43, 0x63, 0x23, 0x82, 0x22, 0xA2, 0x12,
+  0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xE2, 0xA2, 0x12, 0xA2, 0x13, 0x82,
+  0x34, 0x53, 0x4A, 0x76, 0x40, 0x09, 0x5B, 0x32, 0x73, 0x22, 0x83, 0x12,
+  0x92, 0x12, 0x95, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x95, 0x92, 0x12,
+  0x83, 0x12, 0x73, 0x2B, 0x3A, 0x40, 0x0F, 0xBA, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x2A, 0xB1, 0xB1, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xF9, 0x0F, 0x99,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0xA1, 0xA1, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x57, 0x7B, 0x44, 0x54, 0x23, 0x92, 0x22, 0xB5, 0xD2,
+  0xE2, 0xE2, 0x79, 0x79, 0xC4, 0xC2, 0x12, 0xB2, 0x12, 0xA3, 0x22, 0x84,
+  0x24, 0x55, 0x3A, 0x12, 0x56, 0x41, 0x02, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x9F, 0xF0, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92,
+  0x0F, 0xF6, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x74, 0x54, 0x54, 0x55, 0x33, 0x17, 0x35, 0x20, 0xC0, 0x3E, 0x03,
+  0xB0, 0x39, 0x83, 0x8C, 0x38, 0x63, 0x83, 0x38, 0x19, 0xC0, 0xDE, 0x07,
+  0xB8, 0x38, 0xE1, 0x83, 0x0C, 0x1C, 0x60, 0x73, 0x01, 0x98, 0x0E, 0xC0,
+  0x3E, 0x00, 0xC0, 0x02, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8F, 0x50, 0xE0, 0x07, 0xE0,
+  0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xD0, 0x0F, 0xD8, 0x1B, 0xD8, 0x1B, 0xD8,
+  0x1B, 0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0xC6, 0x63, 0xC6, 0x63, 0xC6,
+  0x63, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC1, 0x83, 0x03, 0x85, 0x86,
+  0x76, 0x74, 0x12, 0x64, 0x13, 0x54, 0x22, 0x54, 0x23, 0x44, 0x32, 0x44,
+  0x42, 0x34, 0x43, 0x24, 0x52, 0x24, 0x53, 0x14, 0x62, 0x14, 0x76, 0x76,
+  0x85, 0x83, 0x65, 0x9A, 0x64, 0x54, 0x42, 0x92, 0x32, 0xB2, 0x22, 0xB2,
+  0x12, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD2, 0x12, 0xB2, 0x22, 0xB2, 0x32,
+  0x92, 0x44, 0x54, 0x5B, 0x87, 0x50, 0x09, 0x3B, 0x12, 0x72, 0x12, 0x84,
+  0x84, 0x84, 0x84, 0x7E, 0x1A, 0x22, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA0, 0x65, 0x9A, 0x64, 0x54, 0x42, 0x92, 0x32, 0xB2, 0x22, 0xB2,
+  0x12, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD2, 0x12, 0xB2, 0x22, 0x72, 0x22,
+  0x32, 0x66, 0x34, 0x54, 0x5D, 0x67, 0x22, 0xF1, 0x11, 0xFF, 0xC3, 0xFF,
+  0xCC, 0x03, 0xB0, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x01, 0xB0, 0x0C, 0xFF,
+  0xE3, 0xFF, 0xCC, 0x03, 0xB0, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x01, 0xB0,
+  0x06, 0xC0, 0x1B, 0x00, 0x70, 0x47, 0x69, 0x43, 0x53, 0x23, 0x73, 0x12,
+  0x92, 0x12, 0xC2, 0xC4, 0xB7, 0x98, 0xA5, 0xC5, 0xA4, 0xA5, 0x92, 0x14,
+  0x53, 0x3A, 0x67, 0x30, 0x0F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x25, 0x02, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x95, 0x73, 0x13, 0x53, 0x39, 0x65, 0x40, 0x02, 0xA4, 0x96, 0x82, 0x22,
+  0x82, 0x22, 0x73, 0x23, 0x62, 0x42, 0x62, 0x42, 0x53, 0x43, 0x42, 0x62,
+  0x42, 0x62, 0x33, 0x63, 0x22, 0x82, 0x22, 0x82, 0x13, 0x85, 0xA4, 0xA4,
+  0xA3, 0x60, 0xE0, 0x30, 0x1D, 0x80, 0xE0, 0x76, 0x07, 0x81, 0xD8, 0x1E,
+  0x06, 0x70, 0x7C, 0x18, 0xC1, 0xB0, 0xE3, 0x0C, 0xC3, 0x8C, 0x33, 0x0C,
+  0x38, 0xC6, 0x30, 0x67, 0x18, 0xC1, 0x98, 0x67, 0x06, 0x61, 0xD8, 0x1D,
+  0x83, 0x60, 0x3C, 0x0D, 0x80, 0xF0, 0x3E, 0x03, 0xC0, 0x70, 0x0F, 0x01,
+  0xC0, 0x18, 0x07, 0x00, 0x03, 0x83, 0x12, 0x73, 0x23, 0x62, 0x43, 0x43,
+  0x52, 0x42, 0x63, 0x22, 0x86, 0x94, 0xA3, 0xB4, 0x95, 0x92, 0x22, 0x73,
+  0x23, 0x53, 0x42, 0x52, 0x53, 0x33, 0x63, 0x13, 0x82, 0x12, 0x93, 0x02,
+  0xA5, 0x83, 0x12, 0x73, 0x23, 0x62, 0x43, 0x43, 0x52, 0x42, 0x63, 0x23,
+  0x72, 0x22, 0x94, 0xA4, 0xB2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+  0x60, 0x0F, 0xBA, 0x39, 0x39, 0x3A, 0x2A, 0x39, 0x39, 0x3A, 0x2A, 0x39,
+  0x39, 0x3A, 0x2A, 0x39, 0x3A, 0xFB, 0x81, 0x81, 0x02, 0x06, 0x04, 0x08,
+  0x18, 0x10, 0x20, 0x60, 0x40, 0x81, 0x81, 0x02, 0x06, 0x04, 0xFF, 0xFE,
+  0x3F, 0x07, 0xF8, 0xE1, 0xCC, 0x0C, 0x00, 0xC0, 0x1C, 0x3F, 0xCF, 0x8C,
+  0xC0, 0xCC, 0x0C, 0xE3, 0xC7, 0xEF, 0x3C, 0x70, 0x02, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0x25, 0x32, 0x17, 0x24, 0x43, 0x13, 0x65, 0x84, 0x84, 0x84,
+  0x84, 0x85, 0x62, 0x14, 0x43, 0x12, 0x17, 0x22, 0x25, 0x30, 0x1F, 0x0F,
+  0xE7, 0x1B, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x38, 0x37, 0x1C,
+  0xFE, 0x1F, 0x00, 0x92, 0x92, 0x92, 0x92, 0x92, 0x34, 0x22, 0x29, 0x13,
+  0x37, 0x55, 0x74, 0x74, 0x74, 0x74, 0x75, 0x53, 0x13, 0x34, 0x26, 0x12,
+  0x34, 0x22, 0x35, 0x57, 0x33, 0x33, 0x13, 0x64, 0x7F, 0xB9, 0x29, 0x36,
+  0x21, 0x34, 0x23, 0x84, 0x53, 0x3B, 0xD8, 0xC6, 0x7F, 0xEC, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x63, 0x00, 0x34, 0x22, 0x29, 0x13, 0x37, 0x55, 0x74,
+  0x74, 0x74, 0x74, 0x75, 0x53, 0x13, 0x34, 0x26, 0x12, 0x34, 0x22, 0x92,
+  0x85, 0x53, 0x29, 0x36, 0x30, 0x02, 0x82, 0x82, 0x82, 0x82, 0x82, 0x24,
+  0x22, 0x16, 0x14, 0x36, 0x54, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x62, 0x04, 0x6F, 0xB0, 0x33, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x3F, 0xE0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+  0x6C, 0x33, 0x18, 0xCC, 0x37, 0x0F, 0xC3, 0xB8, 0xC6, 0x31, 0xCC, 0x3B,
+  0x06, 0xC1, 0xF0, 0x30, 0xCF, 0x1F, 0x6F, 0xDF, 0xFC, 0x78, 0xFC, 0x18,
+  0x3C, 0x0C, 0x1E, 0x06, 0x0F, 0x03, 0x07, 0x81, 0x83, 0xC0, 0xC1, 0xE0,
+  0x60, 0xF0, 0x30, 0x78, 0x18, 0x3C, 0x0C, 0x18, 0x02, 0x24, 0x22, 0x16,
+  0x14, 0x36, 0x54, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62,
+  0x35, 0x57, 0x33, 0x33, 0x13, 0x55, 0x74, 0x74, 0x74, 0x74, 0x75, 0x53,
+  0x13, 0x33, 0x37, 0x55, 0x30, 0x02, 0x25, 0x32, 0x17, 0x24, 0x43, 0x13,
+  0x62, 0x12, 0x84, 0x84, 0x84, 0x84, 0x85, 0x67, 0x43, 0x1A, 0x22, 0x25,
+  0x32, 0xA2, 0xA2, 0xA2, 0xA0, 0x34, 0x22, 0x29, 0x13, 0x37, 0x55, 0x74,
+  0x74, 0x74, 0x74, 0x75, 0x53, 0x13, 0x34, 0x29, 0x34, 0x22, 0x92, 0x92,
+  0x92, 0x92, 0xCF, 0x7F, 0x38, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0,
+  0x25, 0x48, 0x13, 0x42, 0x12, 0x82, 0x84, 0x77, 0x65, 0x85, 0x65, 0x43,
+  0x18, 0x35, 0x30, 0x63, 0x19, 0xFF, 0xB1, 0x8C, 0x63, 0x18, 0xC6, 0x31,
+  0xE7, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x56,
+  0x34, 0x16, 0x12, 0x24, 0x22, 0xE0, 0x6C, 0x0D, 0x81, 0xB8, 0x63, 0x0C,
+  0x61, 0x8E, 0x60, 0xCC, 0x19, 0x83, 0xE0, 0x3C, 0x07, 0x00, 0xE0, 0xC1,
+  0xC1, 0xB0, 0xE1, 0xD8, 0x70, 0xCC, 0x2C, 0x66, 0x36, 0x31, 0x9B, 0x18,
+  0xCD, 0x98, 0x64, 0x6C, 0x16, 0x36, 0x0F, 0x1A, 0x07, 0x8F, 0x03, 0x83,
+  0x80, 0xC1, 0xC0, 0xC1, 0xF8, 0x66, 0x30, 0xCC, 0x3E, 0x07, 0x00, 0xC0,
+  0x78, 0x36, 0x0C, 0xC6, 0x3B, 0x06, 0xC0, 0xC0, 0xE0, 0x6C, 0x0D, 0x83,
+  0x38, 0x63, 0x0C, 0x63, 0x0E, 0x60, 0xCC, 0x1B, 0x03, 0x60, 0x3C, 0x07,
+  0x00, 0xE0, 0x18, 0x03, 0x00, 0xE0, 0x78, 0x0E, 0x00, 0x0F, 0x57, 0x27,
+  0x27, 0x36, 0x36, 0x37, 0x27, 0x27, 0x27, 0x37, 0xF5, 0x0F, 0xFF, 0x10 };
+
+static const packedGlyph_t FreeSans12pt7bGlyphs[] = {
+  {     0,   0,   0,   6,    0,    1, GLYPH_RAW },   // 0x20 ' '
+  {     0,  13,  16,  13,    0,  -15, GLYPH_RAW },   // 0x23 '#'
+  {    26,  20,  17,  21,    1,  -16, GLYPH_RLE },   // 0x25 '%'
+  {    68,  14,  17,  16,    1,  -16, GLYPH_RAW },   // 0x26 '&'
+  {    98,   2,   6,   5,    1,  -16, GLYPH_RAW },   // 0x27 '\''
+  {   100,   7,   7,   9,    1,  -17, GLYPH_RAW },   // 0x2A '*'
+  {   107,  10,  11,  14,    2,  -10, GLYPH_RLE },   // 0x2B '+'
+  {   118,   2,   6,   7,    2,   -1, GLYPH_RAW },   // 0x2C ','
+  {   120,   6,   2,   8,    1,   -7, GLYPH_RLE },   // 0x2D '-'
+  {   121,   2,   2,   6,    2,   -1, GLYPH_RAW },   // 0x2E '.'
+  {   122,   7,  18,   7,    0,  -17, GLYPH_RAW },   // 0x2F '/'
+  {   138,  11,  17,  13,    1,  -16, GLYPH_RLE },   // 0x30 '0'
+  {   161,   5,  17,  13,    3,  -16, GLYPH_RAW },   // 0x31 '1'
+  {   172,  11,  17,  13,    1,  -16, GLYPH_RLE },   // 0x32 '2'
+  {   191,  11,  17,  13,    1,  -16, GLYPH_RLE },   // 0x33 '3'
+  {   213,  11,  17,  13,    1,  -16, GLYPH_RAW },   // 0x34 '4'
+  {   237,  11,  17,  13,    1,  -16, GLYPH_RLE },   // 0x35 '5'
+  {   257,  11,  17,  13,    1,  -16, GLYPH_RAW },   // 0x36 '6'
+  {   281,  11,  17,  13,    1,  -16, GLYPH_RLE },   // 0x37 '7'
+  {   298,  11,  17,  13,    1,  -16, GLYPH_RAW },   // 0x38 '8'
+  {   322,  11,  17,  13,    1,  -16, GLYPH_RAW },   // 0x39 '9'
+  {   346,   2,  13,   6,    2,  -12, GLYPH_RLE },   // 0x3A ':'
+  {   349,  12,  12,  14,    1,  -11, GLYPH_RLE },   // 0x3E '>'
+  {   361,  10,  18,  13,    2,  -17, GLYPH_RLE },   // 0x3F '?'
+  {   380,  14,  18,  16,    1,  -17, GLYPH_RLE },   // 0x41 'A'
+  {   408,  13,  18,  16,    2,  -17, GLYPH_RLE },   // 0x42 'B'
+  {   435,  15,  18,  17,    1,  -17, GLYPH_RLE },   // 0x43 'C'
+  {   461,  14,  18,  17,    2,  -17, GLYPH_RLE },   // 0x44 'D'
+  {   486,  12,  18,  15,    2,  -17, GLYPH_RLE },   // 0x45 'E'
+  {   502,  11,  18,  14,    2,  -17, GLYPH_RLE },   // 0x46 'F'
+  {   519,  16,  18,  18,    1,  -17, GLYPH_RLE },   // 0x47 'G'
+  {   546,  13,  18,  17,    2,  -17, GLYPH_RLE },   // 0x48 'H'
+  {   564,   2,  18,   7,    2,  -17, GLYPH_RLE },   // 0x49 'I'
+  {   566,   9,  18,  13,    1,  -17, GLYPH_RLE },   // 0x4A 'J'
+  {   585,  13,  18,  16,    2,  -17, GLYPH_RAW },   // 0x4B 'K'
+  {   615,  10,  18,  14,    2,  -17, GLYPH_RLE },   // 0x4C 'L'
+  {   633,  16,  18,  20,    2,  -17, GLYPH_RAW },   // 0x4D 'M'
+  {   669,  13,  18,  18,    2,  -17, GLYPH_RLE },   // 0x4E 'N'
+  {   698,  17,  18,  19,    1,  -17, GLYPH_RLE },   // 0x4F 'O'
+  {   726,  12,  18,  16,    2,  -17, GLYPH_RLE },   // 0x50 'P'
+  {   746,  17,  19,  19,    1,  -17, GLYPH_RLE },   // 0x51 'Q'
+  {   777,  14,  18,  17,    2,  -17, GLYPH_RAW },   // 0x52 'R'
+  {   809,  14,  18,  16,    1,  -17, GLYPH_RLE },   // 0x53 'S'
+  {   832,  12,  18,  15,    1,  -17, GLYPH_RLE },   // 0x54 'T'
+  {   850,  13,  18,  17,    2,  -17, GLYPH_RLE },   // 0x55 'U'
+  {   871,  14,  18,  15,    1,  -17, GLYPH_RLE },   // 0x56 'V'
+  {   902,  22,  18,  22,    0,  -17, GLYPH_RAW },   // 0x57 'W'
+  {   952,  14,  18,  16,    1,  -17, GLYPH_RLE },   // 0x58 'X'
+  {   983,  14,  18,  16,    1,  -17, GLYPH_RLE },   // 0x59 'Y'
+  {  1009,  13,  18,  15,    1,  -17, GLYPH_RLE },   // 0x5A 'Z'
+  {  1026,   7,  18,   7,    0,  -17, GLYPH_RAW },   // 0x5C '\\'
+  {  1042,  15,   1,  13,   -1,    4, GLYPH_RAW },   // 0x5F '_'
+  {  1044,  12,  13,  13,    1,  -12, GLYPH_RAW },   // 0x61 'a'
+  {  1064,  12,  18,  13,    1,  -17, GLYPH_RLE },   // 0x62 'b'
+  {  1090,  10,  13,  12,    1,  -12, GLYPH_RAW },   // 0x63 'c'
+  {  1107,  11,  18,  13,    1,  -17, GLYPH_RLE },   // 0x64 'd'
+  {  1130,  11,  13,  13,    1,  -12, GLYPH_RLE },   // 0x65 'e'
+  {  1145,   5,  18,   7,    1,  -17, GLYPH_RAW },   // 0x66 'f'
+  {  1157,  11,  18,  13,    1,  -12, GLYPH_RLE },   // 0x67 'g'
+  {  1181,  10,  18,  13,    1,  -17, GLYPH_RLE },   // 0x68 'h'
+  {  1202,   2,  18,   5,    2,  -17, GLYPH_RLE },   // 0x69 'i'
+  {  1205,   4,  23,   6,    0,  -17, GLYPH_RAW },   // 0x6A 'j'
+  {  1217,  10,  18,  12,    1,  -17, GLYPH_RAW },   // 0x6B 'k'
+  {   564,   2,  18,   5,    1,  -17, GLYPH_RLE },   // 0x6C 'l'
+  {  1240,  17,  13,  19,    1,  -12, GLYPH_RAW },   // 0x6D 'm'
+  {  1268,  10,  13,  13,    1,  -12, GLYPH_RLE },   // 0x6E 'n'
+  {  1284,  11,  13,  13,    1,  -12, GLYPH_RLE },   // 0x6F 'o'
+  {  1301,  12,  17,  13,    1,  -12, GLYPH_RLE },   // 0x70 'p'
+  {  1325,  11,  17,  13,    1,  -12, GLYPH_RLE },   // 0x71 'q'
+  {  1346,   6,  13,   8,    1,  -12, GLYPH_RAW },   // 0x72 'r'
+  {  1356,  10,  13,  12,    1,  -12, GLYPH_RLE },   // 0x73 's'
+  {  1371,   5,  16,   7,    1,  -15, GLYPH_RAW },   // 0x74 't'
+  {  1381,  10,  13,  13,    1,  -12, GLYPH_RLE },   // 0x75 'u'
+  {  1397,  11,  13,  12,    0,  -12, GLYPH_RAW },   // 0x76 'v'
+  {  1415,  17,  13,  17,    0,  -12, GLYPH_RAW },   // 0x77 'w'
+  {  1443,  10,  13,  11,    1,  -12, GLYPH_RAW },   // 0x78 'x'
+  {  1460,  11,  18,  11,    0,  -12, GLYPH_RAW },   // 0x79 'y'
+  {  1485,  10,  13,  12,    1,  -12, GLYPH_RLE },   // 0x7A 'z'
+  {  1497,   2,  23,   6,    2,  -17, GLYPH_RLE } }; // 0x7C '|'
+
+static const uint8_t FreeSans12pt7bIndex[] = {
+    0,   0,   0,   1,   0,   2,   3,   4,   0,   0,   5,   6,
+    7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+   19,  20,  21,   0,   0,   0,  22,  23,   0,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+   39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,   0,
+   50,   0,   0,  51,   0,  52,  53,  54,  55,  56,  57,  58,
+   59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+   71,  72,  73,  74,  75,  76,  77,   0,  78,   0,   0 };
+
+static const packedFont_t FreeSans12pt7b = {
+  FreeSans12pt7bData,
+  FreeSans12pt7bGlyphs,
+  FreeSans12pt7bIndex,
+  0x20, 0x7E, 29 };
+
+// 79 glyphs, 1500 bytes of glyph data
@@ -0,0 +1,283 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/FreeSans16pt7b.h
+
+static const uint8_t FreeSans16pt7bData[] = {
+  0x63, 0x42, 0x83, 0x42, 0x82, 0x43, 0x82, 0x43, 0x82, 0x42, 0x92, 0x42,
+  0x5F, 0x02, 0xF0, 0x52, 0x43, 0x82, 0x42, 0x92, 0x42, 0x83, 0x42, 0x83,
+  0x42, 0x82, 0x43, 0x4F, 0x11, 0xF1, 0x43, 0x42, 0x83, 0x42, 0x83, 0x33,
+  0x82, 0x43, 0x82, 0x42, 0x92, 0x42, 0x83, 0x42, 0x60, 0xF3, 0x28, 0x69,
+  0x28, 0x88, 0x27, 0x34, 0x36, 0x28, 0x26, 0x26, 0x28, 0x26, 0x34, 0x29,
+  0x26, 0x33, 0x39, 0x26, 0x24, 0x2B, 0x24, 0x33, 0x2C, 0x84, 0x2D, 0x64,
+  0x2F, 0x92, 0xF8, 0x25, 0x5E, 0x24, 0x7C, 0x24, 0x33, 0x3B, 0x23, 0x35,
+  0x39, 0x24, 0x27, 0x28, 0x34, 0x27, 0x28, 0x25, 0x35, 0x37, 0x27, 0x25,
+  0x28, 0x27, 0x97, 0x29, 0x78, 0x2C, 0x15, 0x55, 0xB9, 0x93, 0x33, 0x83,
+  0x52, 0x83, 0x53, 0x73, 0x53, 0x82, 0x43, 0x93, 0x24, 0xA7, 0xB5, 0xD5,
+  0xB7, 0xA4, 0x23, 0x33, 0x23, 0x53, 0x23, 0x23, 0x63, 0x12, 0x32, 0x76,
+  0x32, 0x85, 0x32, 0x93, 0x43, 0x75, 0x34, 0x57, 0x3B, 0x14, 0x38, 0x44,
+  0x44, 0xA0, 0xFF, 0xB6, 0xD8, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x3C,
+  0x66, 0x66, 0x62, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x7F, 0xF0, 0x62,
+  0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x70, 0xFF, 0x92, 0xF0, 0xFF, 0xFF, 0x09,
+  0x72, 0x71, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72, 0x71, 0x72, 0x72, 0x71,
+  0x72, 0x72, 0x71, 0x72, 0x72, 0x71, 0x72, 0x72, 0x71, 0x72, 0x72, 0x72,
+  0x70, 0x56, 0x79, 0x54, 0x34, 0x43, 0x53, 0x33, 0x73, 0x23, 0x73, 0x23,
+  0x82, 0x22, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x12, 0x93, 0x12,
+  0x93, 0x13, 0x82, 0x23, 0x73, 0x23, 0x73, 0x33, 0x53, 0x5A, 0x67, 0xA3,
+  0x60, 0x62, 0x53, 0x53, 0x3F, 0x65, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x47, 0x7A,
+  0x44, 0x35, 0x24, 0x63, 0x23, 0x83, 0x13, 0x83, 0x12, 0x93, 0x12, 0x93,
+  0xC3, 0xB3, 0xB3, 0xA5, 0x85, 0x94, 0x95, 0x94, 0xA4, 0xB3, 0xC2, 0xCF,
+  0xFF, 0x00, 0x47, 0x6B, 0x44, 0x34, 0x33, 0x73, 0x23, 0x73, 0x22, 0x83,
+  0x13, 0x83, 0xC3, 0xB4, 0x77, 0x85, 0xA7, 0xC4, 0xC4, 0xC3, 0xC6, 0x96,
+  0x93, 0x13, 0x73, 0x24, 0x54, 0x3B, 0x59, 0x93, 0x60, 0x93, 0xC3, 0xB4,
+  0xA5, 0xA5, 0x96, 0x83, 0x13, 0x73, 0x23, 0x72, 0x33, 0x63, 0x33, 0x53,
+  0x43, 0x43, 0x53, 0x43, 0x53, 0x33, 0x63, 0x3F, 0xFF, 0x09, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x33, 0x2C, 0x3C, 0x3C, 0x33, 0xC2, 0xD2, 0xD2, 0xC3, 0x32,
+  0x7B, 0x4C, 0x34, 0x54, 0x23, 0x73, 0xD3, 0xC3, 0xC3, 0xC3, 0xC6, 0x93,
+  0x13, 0x73, 0x24, 0x54, 0x3B, 0x59, 0x84, 0x60, 0x56, 0x89, 0x54, 0x24,
+  0x43, 0x63, 0x32, 0x82, 0x23, 0x83, 0x13, 0xC2, 0xD2, 0x34, 0x53, 0x18,
+  0x3D, 0x25, 0x63, 0x14, 0x87, 0x86, 0x93, 0x12, 0x93, 0x12, 0x93, 0x13,
+  0x83, 0x13, 0x73, 0x33, 0x54, 0x4A, 0x68, 0x93, 0x60, 0x0F, 0xFF, 0x0C,
+  0x2C, 0x3B, 0x3C, 0x2C, 0x3C, 0x2C, 0x3B, 0x3C, 0x3B, 0x3C, 0x3C, 0x2C,
+  0x3C, 0x3C, 0x2C, 0x3C, 0x3C, 0x3B, 0x39, 0x47, 0x79, 0x54, 0x34, 0x34,
+  0x63, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x33, 0x53, 0x59,
+  0x78, 0x5B, 0x34, 0x63, 0x23, 0x86, 0x96, 0x96, 0x96, 0x93, 0x13, 0x74,
+  0x14, 0x54, 0x3B, 0x59, 0x93, 0x60, 0x47, 0x79, 0x54, 0x34, 0x33, 0x73,
+  0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96, 0x96, 0x84, 0x13, 0x74, 0x15,
+  0x36, 0x29, 0x13, 0x46, 0x23, 0xC3, 0xC2, 0xC3, 0x23, 0x73, 0x23, 0x72,
+  0x34, 0x53, 0x4A, 0x68, 0x94, 0x60, 0x0C, 0xFF, 0xAC, 0xF0, 0x3C, 0x5C,
+  0x5C, 0x6B, 0x6C, 0x6B, 0x4A, 0x58, 0x57, 0x67, 0x66, 0x69, 0x4B, 0x1E,
+  0x47, 0x5A, 0x35, 0x34, 0x23, 0x64, 0x12, 0x86, 0x86, 0x83, 0xB3, 0xA3,
+  0xA4, 0x94, 0x94, 0x94, 0xA3, 0xB2, 0xC2, 0xC2, 0xFF, 0xF9, 0x2C, 0x2C,
+  0x26, 0x84, 0xE5, 0xE5, 0xD3, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xB3, 0x33,
+  0xA3, 0x33, 0xA3, 0x33, 0x93, 0x53, 0x83, 0x53, 0x83, 0x53, 0x73, 0x73,
+  0x63, 0x73, 0x6D, 0x5F, 0x04, 0x39, 0x33, 0x49, 0x42, 0x3B, 0x32, 0x3B,
+  0x31, 0x4B, 0x7D, 0x6D, 0x30, 0x0C, 0x6E, 0x4F, 0x03, 0x39, 0x42, 0x3A,
+  0x32, 0x3B, 0x22, 0x3B, 0x31, 0x3A, 0x32, 0x3A, 0x32, 0x39, 0x33, 0xE4,
+  0xF0, 0x3F, 0x12, 0x3A, 0x41, 0x3B, 0x31, 0x3C, 0x21, 0x3C, 0x6B, 0x31,
+  0x3B, 0x31, 0x3A, 0x41, 0xF1, 0x2F, 0x03, 0xE4, 0x78, 0xAC, 0x75, 0x36,
+  0x54, 0x83, 0x44, 0xA3, 0x33, 0xB3, 0x23, 0xD3, 0x13, 0xF2, 0x3F, 0x23,
+  0xF2, 0x2F, 0x23, 0xF2, 0x3F, 0x32, 0xF3, 0x3F, 0x23, 0xD3, 0x13, 0xD3,
+  0x14, 0xB4, 0x23, 0xB3, 0x43, 0x94, 0x45, 0x64, 0x6D, 0x9A, 0xC5, 0x70,
+  0x0B, 0x7E, 0x4F, 0x03, 0x38, 0x52, 0x3A, 0x32, 0x3B, 0x31, 0x3B, 0x31,
+  0x3B, 0x31, 0x3C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x21, 0x3B,
+  0x31, 0x3B, 0x31, 0x3A, 0x32, 0x39, 0x42, 0xF0, 0x3E, 0x4C, 0x60, 0x0F,
+  0xFF, 0x6D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0xF0, 0x1F, 0x01, 0xF0,
+  0x13, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xDF, 0xFF, 0x30, 0x0F, 0xFF,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xE1, 0xE1, 0xE1, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x79, 0xAD, 0x76, 0x36,
+  0x54, 0x84, 0x44, 0xB3, 0x33, 0xC3, 0x23, 0xE3, 0x13, 0xF3, 0x3F, 0x32,
+  0xF3, 0x3F, 0x33, 0x9C, 0x9C, 0x99, 0x13, 0xF0, 0x21, 0x3E, 0x31, 0x3E,
+  0x31, 0x4D, 0x32, 0x3C, 0x43, 0x3A, 0x53, 0x57, 0x31, 0x24, 0xD2, 0x26,
+  0xA3, 0x29, 0x48, 0x03, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xBF, 0xFF, 0xCB, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+  0x6B, 0x30, 0x0F, 0xFF, 0xF9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x96, 0x66, 0x66, 0x66,
+  0x67, 0x44, 0x1A, 0x38, 0x64, 0x40, 0x03, 0xB7, 0xA4, 0x13, 0x94, 0x23,
+  0x84, 0x33, 0x74, 0x43, 0x64, 0x53, 0x63, 0x63, 0x53, 0x73, 0x43, 0x83,
+  0x33, 0x93, 0x25, 0x83, 0x17, 0x76, 0x23, 0x75, 0x43, 0x64, 0x54, 0x53,
+  0x73, 0x53, 0x83, 0x43, 0x84, 0x33, 0x93, 0x33, 0xA3, 0x23, 0xA4, 0x13,
+  0xB7, 0xC3, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xCF, 0xFF,
+  0x00, 0x05, 0xD9, 0xCA, 0xCB, 0xBB, 0xA9, 0x12, 0xA9, 0x13, 0x92, 0x16,
+  0x13, 0x83, 0x16, 0x22, 0x83, 0x16, 0x23, 0x72, 0x26, 0x23, 0x63, 0x26,
+  0x32, 0x63, 0x26, 0x33, 0x52, 0x36, 0x33, 0x43, 0x36, 0x42, 0x43, 0x36,
+  0x43, 0x32, 0x46, 0x43, 0x23, 0x46, 0x52, 0x23, 0x46, 0x53, 0x12, 0x56,
+  0x56, 0x56, 0x65, 0x56, 0x64, 0x66, 0x64, 0x63, 0x04, 0xB7, 0xB8, 0xA9,
+  0x99, 0x96, 0x13, 0x86, 0x14, 0x76, 0x23, 0x76, 0x33, 0x66, 0x34, 0x56,
+  0x43, 0x56, 0x53, 0x46, 0x53, 0x46, 0x63, 0x36, 0x73, 0x26, 0x73, 0x26,
+  0x83, 0x16, 0x8A, 0x99, 0xA8, 0xA8, 0xB7, 0xC3, 0x78, 0xCC, 0x96, 0x27,
+  0x64, 0x85, 0x44, 0xB3, 0x43, 0xD3, 0x23, 0xE3, 0x23, 0xF0, 0x7F, 0x06,
+  0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x13, 0x13, 0xF0, 0x31,
+  0x3E, 0x41, 0x4D, 0x33, 0x3C, 0x43, 0x4A, 0x45, 0x56, 0x57, 0xEA, 0xBE,
+  0x58, 0x0C, 0x4E, 0x2F, 0x01, 0x39, 0x7A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69,
+  0x78, 0x41, 0xF0, 0x1D, 0x33, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xD3, 0xD0, 0x78, 0xCC, 0x96, 0x27, 0x64, 0x85, 0x44, 0xB3, 0x43,
+  0xD3, 0x23, 0xE3, 0x23, 0xF0, 0x7F, 0x06, 0xF1, 0x6F, 0x16, 0xF1, 0x6F,
+  0x16, 0xF1, 0x6F, 0x13, 0x13, 0xF0, 0x31, 0x3E, 0x32, 0x48, 0x23, 0x33,
+  0x38, 0x31, 0x43, 0x48, 0x65, 0x56, 0x57, 0xF1, 0x8A, 0x23, 0xA4, 0x63,
+  0xF5, 0x11, 0x0D, 0x5F, 0x03, 0xF1, 0x23, 0xA4, 0x13, 0xB3, 0x13, 0xB3,
+  0x13, 0xB3, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xA4, 0x13, 0x85, 0x2E, 0x4F,
+  0x03, 0x39, 0x42, 0x3A, 0x41, 0x3B, 0x31, 0x3B, 0x31, 0x3B, 0x31, 0x3B,
+  0x31, 0x3B, 0x31, 0x3B, 0x31, 0x3B, 0x31, 0x3C, 0x30, 0x49, 0x6C, 0x46,
+  0x44, 0x33, 0x84, 0x14, 0x93, 0x13, 0xB6, 0xB6, 0xE4, 0xE6, 0xC9, 0xAA,
+  0xA9, 0xC5, 0xE4, 0xE5, 0xC5, 0xC6, 0xB7, 0xA3, 0x14, 0x74, 0x3D, 0x5B,
+  0x94, 0x70, 0x0F, 0xFF, 0x97, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0x80, 0x03,
+  0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB7, 0x94, 0x14, 0x74, 0x3D, 0x5B,
+  0x94, 0x70, 0x03, 0xD7, 0xC3, 0x13, 0xB3, 0x23, 0xB3, 0x33, 0xA3, 0x33,
+  0x93, 0x43, 0x93, 0x53, 0x83, 0x53, 0x73, 0x63, 0x73, 0x73, 0x63, 0x73,
+  0x53, 0x83, 0x53, 0x93, 0x43, 0x93, 0x33, 0xA3, 0x33, 0xB3, 0x23, 0xB3,
+  0x13, 0xD2, 0x13, 0xD6, 0xD5, 0xF0, 0x4F, 0x03, 0x80, 0x03, 0x94, 0x96,
+  0x94, 0x96, 0x94, 0x84, 0x13, 0x75, 0x83, 0x23, 0x76, 0x73, 0x23, 0x76,
+  0x73, 0x23, 0x72, 0x13, 0x64, 0x33, 0x53, 0x23, 0x53, 0x43, 0x53, 0x23,
+  0x53, 0x43, 0x52, 0x33, 0x53, 0x43, 0x43, 0x42, 0x43, 0x63, 0x33, 0x43,
+  0x33, 0x63, 0x33, 0x43, 0x33, 0x63, 0x32, 0x53, 0x33, 0x63, 0x23, 0x62,
+  0x32, 0x82, 0x23, 0x63, 0x13, 0x83, 0x13, 0x63, 0x13, 0x83, 0x12, 0x82,
+  0x13, 0x86, 0x85, 0xA5, 0x85, 0xA4, 0x95, 0xA4, 0xA4, 0xA4, 0xA3, 0x60,
+  0x04, 0xB4, 0x14, 0xA3, 0x33, 0x93, 0x44, 0x74, 0x54, 0x63, 0x73, 0x53,
+  0x93, 0x34, 0x94, 0x23, 0xB3, 0x13, 0xD6, 0xD5, 0xF0, 0x3F, 0x05, 0xD3,
+  0x13, 0xC3, 0x13, 0xB3, 0x33, 0x94, 0x34, 0x74, 0x54, 0x63, 0x73, 0x54,
+  0x74, 0x34, 0x94, 0x23, 0xB3, 0x14, 0xB4, 0x03, 0xD7, 0xB4, 0x13, 0xB3,
+  0x33, 0x94, 0x34, 0x83, 0x53, 0x73, 0x64, 0x54, 0x73, 0x53, 0x93, 0x34,
+  0x94, 0x23, 0xB3, 0x13, 0xD6, 0xD5, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+  0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0x80, 0x1F, 0x11,
+  0xF1, 0x1F, 0x1D, 0x4C, 0x4C, 0x4D, 0x3D, 0x4C, 0x4C, 0x4D, 0x3D, 0x3D,
+  0x4C, 0x4C, 0x4D, 0x3D, 0x4C, 0x4C, 0x4D, 0x3D, 0xFF, 0xF6, 0x02, 0x72,
+  0x72, 0x82, 0x72, 0x72, 0x81, 0x82, 0x72, 0x81, 0x82, 0x72, 0x81, 0x82,
+  0x72, 0x81, 0x82, 0x72, 0x81, 0x82, 0x72, 0x72, 0x82, 0x72, 0x0F, 0xF8,
+  0x56, 0x8A, 0x5B, 0x43, 0x73, 0x33, 0x73, 0xD3, 0xD3, 0xA6, 0x5B, 0x47,
+  0x23, 0x34, 0x63, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x33, 0x55, 0x3F,
+  0x02, 0x82, 0x44, 0x36, 0x21, 0x02, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+  0x35, 0x42, 0x19, 0x22, 0x1A, 0x14, 0x63, 0x13, 0x77, 0x86, 0x85, 0xA4,
+  0xA4, 0xA4, 0xA5, 0x86, 0x87, 0x69, 0x44, 0x1C, 0x22, 0x18, 0x84, 0x50,
+  0x55, 0x79, 0x4B, 0x24, 0x53, 0x23, 0x72, 0x13, 0x86, 0xB3, 0xB3, 0xB3,
+  0xB3, 0xB3, 0x86, 0x83, 0x13, 0x73, 0x14, 0x53, 0x3A, 0x58, 0x84, 0x50,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x54, 0x33, 0x38, 0x13, 0x2D, 0x14,
+  0x55, 0x13, 0x77, 0x87, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x84, 0x13,
+  0x74, 0x14, 0x55, 0x2D, 0x38, 0x13, 0x54, 0x60, 0x55, 0x89, 0x5B, 0x43,
+  0x63, 0x23, 0x73, 0x23, 0x86, 0x96, 0x9F, 0xF6, 0xC3, 0xD2, 0x93, 0x13,
+  0x73, 0x33, 0x54, 0x3B, 0x59, 0x94, 0x50, 0x0E, 0x7C, 0xF1, 0x83, 0x06,
+  0x0C, 0x7F, 0xFE, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0C, 0x00, 0x54, 0x88, 0x12, 0x2C, 0x14, 0x54, 0x13, 0x76,
+  0x86, 0x86, 0x95, 0x95, 0x95, 0x95, 0x86, 0x83, 0x13, 0x73, 0x14, 0x54,
+  0x29, 0x12, 0x37, 0x22, 0x53, 0x42, 0xB3, 0x12, 0x83, 0x13, 0x63, 0x25,
+  0x25, 0x3A, 0x66, 0x40, 0x03, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x34,
+  0x33, 0x18, 0x16, 0x29, 0x67, 0x66, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x82, 0x09, 0xCF, 0xFF, 0x30, 0x1C, 0x71,
+  0xC0, 0x00, 0x00, 0x07, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xDF, 0xFB, 0xC0, 0x02, 0xB2, 0xB2,
+  0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x64, 0x12, 0x54, 0x22, 0x44, 0x32, 0x34,
+  0x42, 0x24, 0x52, 0x14, 0x68, 0x58, 0x54, 0x23, 0x43, 0x34, 0x32, 0x53,
+  0x32, 0x63, 0x22, 0x64, 0x12, 0x73, 0x12, 0x85, 0x83, 0x55, 0x54, 0x33,
+  0x17, 0x28, 0x16, 0x19, 0x14, 0x14, 0x55, 0x56, 0x73, 0x66, 0x72, 0x76,
+  0x72, 0x76, 0x72, 0x76, 0x72, 0x76, 0x72, 0x76, 0x72, 0x76, 0x72, 0x76,
+  0x72, 0x76, 0x72, 0x76, 0x72, 0x76, 0x72, 0x76, 0x72, 0x73, 0x64, 0x33,
+  0x18, 0x16, 0x29, 0x67, 0x66, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x82, 0x55, 0x89, 0x5B, 0x34, 0x54, 0x23, 0x73,
+  0x22, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x12, 0x93, 0x13, 0x73,
+  0x24, 0x54, 0x3B, 0x59, 0x84, 0x60, 0x55, 0x42, 0x19, 0x2C, 0x24, 0x63,
+  0x13, 0x77, 0x86, 0x85, 0xA4, 0xA4, 0xA4, 0xA5, 0x86, 0x87, 0x69, 0x44,
+  0x12, 0x19, 0x22, 0x27, 0x32, 0x43, 0x52, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+  0xC0, 0x54, 0x98, 0x13, 0x2D, 0x14, 0x55, 0x13, 0x77, 0x87, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x84, 0x13, 0x74, 0x14, 0x55, 0x2D, 0x38, 0x13,
+  0x54, 0x33, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x56, 0x1F, 0x23, 0x44,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x46, 0x59, 0x3B, 0x23, 0x53, 0x13, 0x76, 0xB3, 0xA6, 0x88, 0x78, 0x95,
+  0xA6, 0x85, 0x77, 0x63, 0x1B, 0x39, 0x74, 0x40, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x1F, 0x1F, 0x0F, 0x03, 0x76, 0x76, 0x76, 0x76, 0x76,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x64, 0x19, 0x12, 0x18,
+  0x22, 0x34, 0x60, 0xE0, 0x1F, 0x80, 0x6E, 0x03, 0x9C, 0x0E, 0x70, 0x31,
+  0xC1, 0xC3, 0x87, 0x0E, 0x18, 0x38, 0xE0, 0x73, 0x01, 0xDC, 0x03, 0x70,
+  0x0F, 0x80, 0x3E, 0x00, 0x78, 0x01, 0xC0, 0xE0, 0x78, 0x1D, 0xC1, 0xE0,
+  0x77, 0x07, 0x83, 0x9C, 0x1F, 0x0E, 0x30, 0xFC, 0x38, 0xE3, 0x30, 0xC3,
+  0x8C, 0xE7, 0x0E, 0x33, 0x9C, 0x19, 0xCE, 0x70, 0x77, 0x19, 0x81, 0xD8,
+  0x7E, 0x03, 0x61, 0xF8, 0x0F, 0x87, 0xC0, 0x3E, 0x0F, 0x00, 0x70, 0x3C,
+  0x01, 0xC0, 0xF0, 0xE0, 0x3B, 0x83, 0x8E, 0x1C, 0x31, 0xC1, 0xDC, 0x07,
+  0xE0, 0x1E, 0x00, 0xE0, 0x07, 0x80, 0x7C, 0x07, 0x70, 0x31, 0xC3, 0x8E,
+  0x38, 0x39, 0xC0, 0xFC, 0x07, 0x03, 0x86, 0x73, 0x22, 0x73, 0x23, 0x63,
+  0x23, 0x53, 0x42, 0x53, 0x43, 0x42, 0x53, 0x33, 0x62, 0x33, 0x63, 0x22,
+  0x73, 0x13, 0x82, 0x13, 0x85, 0x95, 0xA4, 0xA3, 0xB3, 0xB2, 0xB3, 0xB3,
+  0x85, 0x94, 0xA3, 0xA0, 0x1C, 0x1C, 0x93, 0x94, 0x93, 0x93, 0x93, 0x93,
+  0x93, 0x94, 0x93, 0x93, 0x93, 0x93, 0xAF, 0xB0, 0x0F, 0xFF, 0xF0 };
+
+static const packedGlyph_t FreeSans16pt7bGlyphs[] = {
+  {     0,   0,   1,   9,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,  17,  23,  17,    0,  -21, GLYPH_RLE },   // 0x23 '#'
+  {    45,  26,  23,  28,    1,  -21, GLYPH_RLE },   // 0x25 '%'
+  {   103,  18,  23,  21,    2,  -21, GLYPH_RLE },   // 0x26 '&'
+  {   146,   3,   7,   6,    1,  -21, GLYPH_RAW },   // 0x27 '\''
+  {   149,   8,   9,  12,    2,  -22, GLYPH_RAW },   // 0x2A '*'
+  {   158,  15,  15,  18,    2,  -14, GLYPH_RLE },   // 0x2B '+'
+  {   174,   3,   8,   9,    3,   -2, GLYPH_RAW },   // 0x2C ','
+  {   177,   8,   2,  10,    1,   -9, GLYPH_RAW },   // 0x2D '-'
+  {   179,   3,   3,   9,    3,   -2, GLYPH_RLE },   // 0x2E '.'
+  {   180,   9,  24,   9,    0,  -22, GLYPH_RLE },   // 0x2F '/'
+  {   205,  15,  23,  17,    1,  -21, GLYPH_RLE },   // 0x30 '0'
+  {   241,   8,  22,  17,    3,  -21, GLYPH_RLE },   // 0x31 '1'
+  {   262,  15,  22,  17,    1,  -21, GLYPH_RLE },   // 0x32 '2'
+  {   290,  15,  23,  17,    1,  -21, GLYPH_RLE },   // 0x33 '3'
+  {   321,  15,  22,  17,    1,  -21, GLYPH_RLE },   // 0x34 '4'
+  {   351,  15,  23,  17,    1,  -21, GLYPH_RLE },   // 0x35 '5'
+  {   380,  15,  23,  17,    1,  -21, GLYPH_RLE },   // 0x36 '6'
+  {   417,  15,  22,  17,    1,  -21, GLYPH_RLE },   // 0x37 '7'
+  {   439,  15,  23,  17,    1,  -21, GLYPH_RLE },   // 0x38 '8'
+  {   474,  15,  23,  17,    1,  -21, GLYPH_RLE },   // 0x39 '9'
+  {   510,   4,  16,   9,    3,  -15, GLYPH_RLE },   // 0x3A ':'
+  {   513,  15,  15,  18,    2,  -14, GLYPH_RLE },   // 0x3E '>'
+  {   528,  14,  23,  17,    2,  -22, GLYPH_RLE },   // 0x3F '?'
+  {   553,  19,  23,  21,    1,  -22, GLYPH_RLE },   // 0x41 'A'
+  {   593,  18,  23,  21,    2,  -22, GLYPH_RLE },   // 0x42 'B'
+  {   632,  20,  24,  23,    1,  -22, GLYPH_RLE },   // 0x43 'C'
+  {   672,  18,  23,  23,    3,  -22, GLYPH_RLE },   // 0x44 'D'
+  {   707,  16,  23,  21,    3,  -22, GLYPH_RLE },   // 0x45 'E'
+  {   730,  15,  23,  19,    3,  -22, GLYPH_RLE },   // 0x46 'F'
+  {   752,  21,  24,  24,    1,  -22, GLYPH_RLE },   // 0x47 'G'
+  {   795,  17,  23,  23,    3,  -22, GLYPH_RLE },   // 0x48 'H'
+  {   818,   3,  23,   9,    3,  -22, GLYPH_RLE },   // 0x49 'I'
+  {   821,  12,  24,  16,    1,  -22, GLYPH_RLE },   // 0x4A 'J'
+  {   846,  18,  23,  21,    2,  -22, GLYPH_RLE },   // 0x4B 'K'
+  {   890,  15,  23,  17,    2,  -22, GLYPH_RLE },   // 0x4C 'L'
+  {   913,  22,  23,  26,    2,  -22, GLYPH_RLE },   // 0x4D 'M'
+  {   968,  18,  23,  23,    2,  -22, GLYPH_RLE },   // 0x4E 'N'
+  {  1004,  22,  24,  24,    1,  -22, GLYPH_RLE },   // 0x4F 'O'
+  {  1045,  16,  23,  21,    3,  -22, GLYPH_RLE },   // 0x50 'P'
+  {  1071,  22,  25,  24,    1,  -22, GLYPH_RLE },   // 0x51 'Q'
+  {  1118,  18,  23,  23,    3,  -22, GLYPH_RLE },   // 0x52 'R'
+  {  1161,  17,  24,  21,    2,  -22, GLYPH_RLE },   // 0x53 'S'
+  {  1190,  18,  23,  19,    1,  -22, GLYPH_RLE },   // 0x54 'T'
+  {  1223,  17,  24,  23,    3,  -22, GLYPH_RLE },   // 0x55 'U'
+  {  1250,  19,  23,  21,    1,  -22, GLYPH_RLE },   // 0x56 'V'
+  {  1293,  28,  23,  30,    1,  -22, GLYPH_RLE },   // 0x57 'W'
+  {  1368,  19,  23,  21,    1,  -22, GLYPH_RLE },   // 0x58 'X'
+  {  1411,  19,  23,  21,    1,  -22, GLYPH_RLE },   // 0x59 'Y'
+  {  1450,  17,  23,  19,    1,  -22, GLYPH_RLE },   // 0x5A 'Z'
+  {  1474,   9,  24,   9,    0,  -22, GLYPH_RLE },   // 0x5C '\\'
+  {  1498,  19,   2,  17,   -1,    5, GLYPH_RLE },   // 0x5F '_'
+  {  1500,  16,  18,  17,    1,  -16, GLYPH_RLE },   // 0x61 'a'
+  {  1529,  14,  24,  17,    2,  -22, GLYPH_RLE },   // 0x62 'b'
+  {  1560,  14,  18,  16,    1,  -16, GLYPH_RLE },   // 0x63 'c'
+  {  1584,  15,  24,  17,    1,  -22, GLYPH_RLE },   // 0x64 'd'
+  {  1616,  15,  18,  17,    1,  -16, GLYPH_RLE },   // 0x65 'e'
+  {  1639,   7,  23,   9,    1,  -22, GLYPH_RAW },   // 0x66 'f'
+  {  1660,  14,  24,  17,    1,  -16, GLYPH_RLE },   // 0x67 'g'
+  {  1696,  13,  23,  17,    2,  -22, GLYPH_RLE },   // 0x68 'h'
+  {  1722,   3,  23,   7,    2,  -22, GLYPH_RLE },   // 0x69 'i'
+  {  1726,   6,  30,   7,   -1,  -22, GLYPH_RAW },   // 0x6A 'j'
+  {  1749,  13,  23,  16,    2,  -22, GLYPH_RLE },   // 0x6B 'k'
+  {   818,   3,  23,   7,    2,  -22, GLYPH_RLE },   // 0x6C 'l'
+  {  1785,  22,  17,  26,    2,  -16, GLYPH_RLE },   // 0x6D 'm'
+  {  1822,  13,  17,  17,    2,  -16, GLYPH_RLE },   // 0x6E 'n'
+  {  1841,  15,  18,  17,    1,  -16, GLYPH_RLE },   // 0x6F 'o'
+  {  1866,  14,  24,  17,    2,  -16, GLYPH_RLE },   // 0x70 'p'
+  {  1897,  15,  24,  17,    1,  -16, GLYPH_RLE },   // 0x71 'q'
+  {  1928,   8,  17,  10,    2,  -16, GLYPH_RLE },   // 0x72 'r'
+  {  1944,  13,  18,  16,    1,  -16, GLYPH_RLE },   // 0x73 's'
+  {  1964,   8,  22,   9,    0,  -20, GLYPH_RAW },   // 0x74 't'
+  {  1986,  13,  17,  17,    2,  -15, GLYPH_RLE },   // 0x75 'u'
+  {  2007,  14,  16,  16,    1,  -15, GLYPH_RAW },   // 0x76 'v'
+  {  2035,  22,  16,  23,    0,  -15, GLYPH_RAW },   // 0x77 'w'
+  {  2079,  13,  16,  16,    1,  -15, GLYPH_RAW },   // 0x78 'x'
+  {  2105,  14,  23,  16,    1,  -15, GLYPH_RLE },   // 0x79 'y'
+  {  2140,  13,  16,  16,    1,  -15, GLYPH_RLE },   // 0x7A 'z'
+  {  2156,   2,  30,   8,    3,  -22, GLYPH_RLE } }; // 0x7C '|'
+
+static const uint8_t FreeSans16pt7bIndex[] = {
+    0,   0,   0,   1,   0,   2,   3,   4,   0,   0,   5,   6,
+    7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+   19,  20,  21,   0,   0,   0,  22,  23,   0,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+   39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,   0,
+   50,   0,   0,  51,   0,  52,  53,  54,  55,  56,  57,  58,
+   59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+   71,  72,  73,  74,  75,  76,  77,   0,  78,   0,   0 };
+
+static const packedFont_t FreeSans16pt7b = {
+  FreeSans16pt7bData,
+  FreeSans16pt7bGlyphs,
+  FreeSans16pt7bIndex,
+  0x20, 0x7E, 53 };
+
+// 79 glyphs, 2159 bytes of glyph data
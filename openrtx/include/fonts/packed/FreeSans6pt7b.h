@@ -0,0 +1,151 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/FreeSans6pt7b.h
+
+static const uint8_t FreeSans6pt7bData[] = {
+  0xF8, 0x80, 0xF0, 0x00, 0x24, 0xA7, 0xCA, 0x4B, 0xF5, 0x14, 0x23, 0xAB,
+  0x4E, 0x1C, 0xB5, 0xF1, 0x00, 0x61, 0x24, 0x89, 0x21, 0x90, 0x05, 0x82,
+  0x90, 0xA4, 0x46, 0x71, 0x05, 0x18, 0xB6, 0x68, 0xBD, 0xC0, 0x29, 0x49,
+  0x24, 0x48, 0x80, 0x89, 0x12, 0x49, 0x4A, 0x00, 0x5D, 0x50, 0x21, 0x3F,
+  0xF2, 0x10, 0xA0, 0x80, 0x04, 0x84, 0x84, 0x80, 0x74, 0x63, 0x18, 0xC6,
+  0x2E, 0x3C, 0x92, 0x49, 0x74, 0x62, 0x32, 0x62, 0x1F, 0xF4, 0x42, 0x61,
+  0x86, 0x3E, 0x08, 0x62, 0x92, 0x4B, 0xF0, 0x82, 0xFC, 0x21, 0xE0, 0x86,
+  0x3E, 0x74, 0x61, 0xE8, 0xC6, 0x2E, 0xF8, 0x84, 0x42, 0x21, 0x08, 0x74,
+  0x62, 0xE8, 0xC6, 0x2E, 0x74, 0x63, 0x17, 0x86, 0x7E, 0x84, 0xC0, 0x36,
+  0x00, 0xD9, 0x06, 0x0C, 0xF8, 0x3E, 0x06, 0x0C, 0x13, 0x60, 0x74, 0xE2,
+  0x11, 0x10, 0x80, 0x20, 0x07, 0x02, 0x18, 0x81, 0xA7, 0x54, 0x93, 0x22,
+  0x64, 0x4A, 0x7E, 0x60, 0x06, 0x00, 0x38, 0x00, 0x18, 0x18, 0x18, 0x24,
+  0x24, 0x7E, 0x42, 0x42, 0xC3, 0xF2, 0x38, 0x61, 0xFA, 0x18, 0x61, 0xF8,
+  0x38, 0x8A, 0x0C, 0x08, 0x10, 0x20, 0xA2, 0x38, 0xF1, 0x1A, 0x14, 0x18,
+  0x30, 0x61, 0xC2, 0xF8, 0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0xFC, 0xFE,
+  0x08, 0x20, 0xFA, 0x08, 0x20, 0x80, 0x38, 0x8A, 0x0C, 0x08, 0xF0, 0x60,
+  0xA1, 0x3C, 0x86, 0x18, 0x61, 0xFE, 0x18, 0x61, 0x84, 0x09, 0x08, 0x42,
+  0x10, 0x86, 0x31, 0x70, 0x87, 0x1A, 0x65, 0x8F, 0x1A, 0x26, 0x44, 0x84,
+  0x84, 0x21, 0x08, 0x42, 0x10, 0xF8, 0xC3, 0xC3, 0xC3, 0xE7, 0xA5, 0xA5,
+  0xBD, 0x99, 0x99, 0x83, 0x87, 0x0D, 0x1B, 0x32, 0x62, 0xC7, 0x86, 0x1C,
+  0x11, 0x10, 0x58, 0x38, 0x0C, 0x07, 0x06, 0xC6, 0x3E, 0x00, 0xF2, 0x38,
+  0x61, 0xFA, 0x08, 0x20, 0x80, 0x1C, 0x11, 0x90, 0x48, 0x3C, 0x0E, 0x05,
+  0x04, 0xCE, 0x3D, 0x80, 0x00, 0xF9, 0x0A, 0x1C, 0x3F, 0xD0, 0xA1, 0x42,
+  0x86, 0x73, 0x38, 0x60, 0x70, 0x38, 0x61, 0xF8, 0xFE, 0x20, 0x40, 0x81,
+  0x02, 0x04, 0x08, 0x10, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x61, 0xC2, 0x7C,
+  0xC3, 0x42, 0x42, 0x66, 0x24, 0x24, 0x18, 0x18, 0x18, 0x84, 0x28, 0x8D,
+  0x29, 0x25, 0x24, 0xA4, 0x56, 0x8E, 0x61, 0x8C, 0x11, 0x00, 0x87, 0x34,
+  0x8C, 0x30, 0xC4, 0xB3, 0x84, 0xC3, 0x42, 0x66, 0x24, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0xFE, 0x0C, 0x10, 0x41, 0x04, 0x10, 0x40, 0xFE, 0xEA, 0xAA,
+  0xAC, 0x92, 0x24, 0x89, 0x20, 0xD5, 0x55, 0x5C, 0x66, 0x99, 0xFE, 0xD0,
+  0xF4, 0x4F, 0x99, 0xF4, 0x84, 0x21, 0xE8, 0xC6, 0x31, 0xF0, 0x7A, 0x61,
+  0x04, 0xBC, 0x04, 0x10, 0x5F, 0x46, 0x18, 0x51, 0x7C, 0x79, 0x1F, 0xF0,
+  0x45, 0xE0, 0x29, 0x74, 0x92, 0x40, 0x79, 0x38, 0x61, 0x4D, 0xD0, 0x52,
+  0x30, 0x84, 0x21, 0xE8, 0xC6, 0x31, 0x88, 0xDF, 0x80, 0x51, 0x55, 0x56,
+  0x84, 0x21, 0x2A, 0x72, 0x92, 0x98, 0xB7, 0xD9, 0x91, 0x91, 0x91, 0x91,
+  0xBE, 0x63, 0x18, 0xC4, 0x7A, 0x18, 0x61, 0x85, 0xE0, 0xF4, 0x63, 0x18,
+  0xFA, 0x10, 0x80, 0x7D, 0x18, 0x61, 0x45, 0xF0, 0x41, 0x04, 0xBA, 0x49,
+  0x00, 0x7E, 0x58, 0x38, 0xBC, 0x4B, 0xA4, 0x93, 0x8C, 0x63, 0x19, 0xF4,
+  0x85, 0x24, 0x92, 0x30, 0xC0, 0x99, 0x99, 0xDB, 0x5A, 0x66, 0x24, 0x99,
+  0x66, 0x99, 0x8A, 0x52, 0xA3, 0x18, 0x84, 0x40, 0xF8, 0x44, 0x44, 0x7C,
+  0x29, 0x25, 0x22, 0x48, 0x80, 0x0B, 0x89, 0x24, 0x4A, 0x4A, 0x00, 0xEC,
+  0xC0 };
+
+static const packedGlyph_t FreeSans6pt7bGlyphs[] = {
+  {     0,   0,   1,   3,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,   1,   9,   3,    1,   -8, GLYPH_RAW },   // 0x21 '!'
+  {     2,   3,   3,   4,    1,   -7, GLYPH_RAW },   // 0x22 '"'
+  {     4,   6,   8,   7,    0,   -7, GLYPH_RAW },   // 0x23 '#'
+  {    10,   5,  10,   7,    1,   -8, GLYPH_RAW },   // 0x24 '$'
+  {    17,  10,   8,  10,    0,   -7, GLYPH_RAW },   // 0x25 '%'
+  {    27,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x26 '&'
+  {    33,   1,   3,   2,    1,   -7, GLYPH_RAW },   // 0x27 '\''
+  {    34,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x28 '('
+  {    39,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x29 ')'
+  {    44,   3,   4,   5,    1,   -8, GLYPH_RAW },   // 0x2A '*'
+  {    46,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x2B '+'
+  {    50,   1,   3,   3,    1,    0, GLYPH_RAW },   // 0x2C ','
+  {    33,   2,   1,   4,    1,   -3, GLYPH_RAW },   // 0x2D '-'
+  {    51,   1,   1,   3,    1,    0, GLYPH_RAW },   // 0x2E '.'
+  {    52,   3,   9,   3,    0,   -8, GLYPH_RAW },   // 0x2F '/'
+  {    56,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x30 '0'
+  {    61,   3,   8,   7,    1,   -7, GLYPH_RAW },   // 0x31 '1'
+  {    64,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x32 '2'
+  {    69,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x33 '3'
+  {    74,   6,   8,   7,    0,   -7, GLYPH_RAW },   // 0x34 '4'
+  {    80,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x35 '5'
+  {    85,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x36 '6'
+  {    90,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x37 '7'
+  {    95,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x38 '8'
+  {   100,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x39 '9'
+  {   105,   1,   6,   3,    1,   -5, GLYPH_RAW },   // 0x3A ':'
+  {   106,   2,   8,   3,    1,   -5, GLYPH_RAW },   // 0x3B ';'
+  {   108,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x3C '<'
+  {   112,   5,   3,   7,    1,   -3, GLYPH_RAW },   // 0x3D '='
+  {   114,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x3E '>'
+  {   118,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x3F '?'
+  {   124,  11,  11,  12,    0,   -8, GLYPH_RAW },   // 0x40 '@'
+  {   140,   8,   9,   8,    0,   -8, GLYPH_RAW },   // 0x41 'A'
+  {   149,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x42 'B'
+  {   156,   7,   9,   8,    1,   -8, GLYPH_RAW },   // 0x43 'C'
+  {   164,   7,   9,   8,    1,   -8, GLYPH_RAW },   // 0x44 'D'
+  {   172,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x45 'E'
+  {   179,   6,   9,   7,    1,   -8, GLYPH_RAW },   // 0x46 'F'
+  {   186,   7,   9,   9,    1,   -8, GLYPH_RAW },   // 0x47 'G'
+  {   194,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x48 'H'
+  {   201,   1,   9,   3,    1,   -8, GLYPH_RLE },   // 0x49 'I'
+  {   202,   5,   9,   6,    0,   -8, GLYPH_RAW },   // 0x4A 'J'
+  {   208,   7,   9,   8,    1,   -8, GLYPH_RAW },   // 0x4B 'K'
+  {   216,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x4C 'L'
+  {   222,   8,   9,  10,    1,   -8, GLYPH_RAW },   // 0x4D 'M'
+  {   231,   7,   9,   8,    1,   -8, GLYPH_RAW },   // 0x4E 'N'
+  {   239,   9,   9,   9,    0,   -8, GLYPH_RAW },   // 0x4F 'O'
+  {   250,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x50 'P'
+  {   257,   9,  10,   9,    0,   -8, GLYPH_RAW },   // 0x51 'Q'
+  {   269,   7,   9,   8,    1,   -8, GLYPH_RAW },   // 0x52 'R'
+  {   277,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x53 'S'
+  {   284,   7,   9,   7,    0,   -8, GLYPH_RAW },   // 0x54 'T'
+  {   292,   7,   9,   8,    1,   -8, GLYPH_RAW },   // 0x55 'U'
+  {   300,   8,   9,   8,    0,   -8, GLYPH_RAW },   // 0x56 'V'
+  {   309,  11,   9,  11,    0,   -8, GLYPH_RAW },   // 0x57 'W'
+  {   322,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x58 'X'
+  {   329,   8,   9,   8,    0,   -8, GLYPH_RAW },   // 0x59 'Y'
+  {   338,   7,   9,   7,    0,   -8, GLYPH_RAW },   // 0x5A 'Z'
+  {   346,   2,  11,   3,    1,   -8, GLYPH_RAW },   // 0x5B '['
+  {   349,   3,   9,   3,    0,   -8, GLYPH_RAW },   // 0x5C '\\'
+  {   353,   2,  11,   3,    0,   -8, GLYPH_RAW },   // 0x5D ']'
+  {   356,   4,   4,   6,    1,   -7, GLYPH_RAW },   // 0x5E '^'
+  {   358,   7,   1,   7,    0,    2, GLYPH_RAW },   // 0x5F '_'
+  {   359,   2,   2,   4,    0,   -8, GLYPH_RAW },   // 0x60 '`'
+  {   360,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x61 'a'
+  {   364,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x62 'b'
+  {   370,   5,   6,   6,    0,   -5, GLYPH_RAW },   // 0x63 'c'
+  {   374,   6,   9,   7,    0,   -8, GLYPH_RAW },   // 0x64 'd'
+  {   381,   6,   6,   7,    0,   -5, GLYPH_RAW },   // 0x65 'e'
+  {   386,   3,   9,   3,    0,   -8, GLYPH_RAW },   // 0x66 'f'
+  {   390,   6,   9,   7,    0,   -5, GLYPH_RAW },   // 0x67 'g'
+  {   397,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x68 'h'
+  {   403,   1,   9,   3,    1,   -8, GLYPH_RAW },   // 0x69 'i'
+  {   405,   2,  12,   3,    0,   -8, GLYPH_RAW },   // 0x6A 'j'
+  {   408,   5,   9,   6,    1,   -8, GLYPH_RAW },   // 0x6B 'k'
+  {   201,   1,   9,   3,    1,   -8, GLYPH_RLE },   // 0x6C 'l'
+  {   414,   8,   6,  10,    1,   -5, GLYPH_RAW },   // 0x6D 'm'
+  {   420,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x6E 'n'
+  {   424,   6,   6,   7,    0,   -5, GLYPH_RAW },   // 0x6F 'o'
+  {   429,   5,   9,   7,    1,   -5, GLYPH_RAW },   // 0x70 'p'
+  {   435,   6,   9,   7,    0,   -5, GLYPH_RAW },   // 0x71 'q'
+  {   442,   3,   6,   4,    1,   -5, GLYPH_RAW },   // 0x72 'r'
+  {   445,   5,   6,   6,    0,   -5, GLYPH_RAW },   // 0x73 's'
+  {   449,   3,   8,   3,    0,   -7, GLYPH_RAW },   // 0x74 't'
+  {   452,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x75 'u'
+  {   456,   6,   6,   6,    0,   -5, GLYPH_RAW },   // 0x76 'v'
+  {   461,   8,   6,   8,    0,   -5, GLYPH_RAW },   // 0x77 'w'
+  {   467,   4,   6,   6,    1,   -5, GLYPH_RAW },   // 0x78 'x'
+  {   470,   5,   9,   6,    0,   -5, GLYPH_RAW },   // 0x79 'y'
+  {   476,   5,   6,   6,    0,   -5, GLYPH_RAW },   // 0x7A 'z'
+  {   480,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x7B '{'
+  {   485,   1,  11,   3,    1,   -8, GLYPH_RLE },   // 0x7C '|'
+  {   486,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x7D '}'
+  {   491,   5,   2,   7,    1,   -4, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t FreeSans6pt7b = {
+  FreeSans6pt7bData,
+  FreeSans6pt7bGlyphs,
+  NULL,
+  0x20, 0x7E, 20 };
+
+// 95 glyphs, 493 bytes of glyph data
@@ -0,0 +1,177 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/FreeSans8pt7b.h
+
+static const uint8_t FreeSans8pt7bData[] = {
+  0xFF, 0x60, 0xBB, 0x98, 0x13, 0x09, 0x04, 0x8F, 0xF3, 0x21, 0x30, 0x91,
+  0xFE, 0x24, 0x12, 0x19, 0x00, 0x10, 0xFA, 0x54, 0x99, 0x1A, 0x1F, 0x0B,
+  0x13, 0x26, 0x5F, 0xE1, 0x02, 0x00, 0x30, 0x42, 0x42, 0x31, 0x20, 0x89,
+  0x07, 0x90, 0x18, 0x80, 0x09, 0xC0, 0x99, 0x04, 0x88, 0x44, 0x42, 0x1E,
+  0x3C, 0x32, 0x11, 0x0D, 0x83, 0x83, 0xC3, 0x25, 0x1E, 0x86, 0x63, 0x9F,
+  0x60, 0xF0, 0x25, 0x2D, 0x24, 0x99, 0x22, 0x40, 0x91, 0x26, 0x49, 0x2D,
+  0x29, 0x00, 0x0F, 0x69, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0xF5,
+  0xE0, 0x11, 0x12, 0x22, 0x44, 0x48, 0x80, 0x38, 0xDB, 0x1C, 0x18, 0x30,
+  0x60, 0xC1, 0xC6, 0xD8, 0xE0, 0x2F, 0x92, 0x49, 0x24, 0x80, 0x7D, 0x8E,
+  0x08, 0x10, 0x61, 0x86, 0x18, 0x61, 0x83, 0xF8, 0x7D, 0x8E, 0x08, 0x30,
+  0xC7, 0x03, 0x03, 0x83, 0x8D, 0xF0, 0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6,
+  0x86, 0xFF, 0x06, 0x06, 0x06, 0x7D, 0x83, 0x06, 0x0F, 0xD8, 0xC0, 0x81,
+  0x83, 0x8D, 0xF0, 0x3C, 0xCF, 0x0C, 0x0B, 0x9D, 0xB1, 0xC1, 0x83, 0x8D,
+  0xF0, 0xFE, 0x04, 0x18, 0x60, 0x83, 0x04, 0x18, 0x20, 0x41, 0x80, 0x7D,
+  0x8E, 0x0E, 0x36, 0xCF, 0xB1, 0xC1, 0x83, 0x8D, 0xF0, 0x79, 0x9A, 0x1C,
+  0x38, 0x79, 0xDE, 0x81, 0x87, 0x99, 0xE0, 0xC3, 0xC3, 0x40, 0x06, 0x39,
+  0xC6, 0x07, 0x03, 0x81, 0x80, 0x0E, 0x7E, 0xC0, 0xE0, 0x70, 0x31, 0xCE,
+  0x30, 0x00, 0x18, 0xFB, 0x1E, 0x10, 0x61, 0x86, 0x08, 0x10, 0x00, 0x40,
+  0x80, 0x07, 0x80, 0x7F, 0x83, 0x03, 0x18, 0x06, 0xC7, 0xEE, 0x33, 0x39,
+  0x84, 0x66, 0x33, 0x98, 0x8A, 0x66, 0x6C, 0xEF, 0x18, 0x00, 0x30, 0x00,
+  0x7F, 0x00, 0x0E, 0x03, 0x81, 0xA0, 0x6C, 0x11, 0x0C, 0x63, 0xF8, 0xFE,
+  0x61, 0x90, 0x3C, 0x0C, 0xFE, 0x61, 0xB0, 0x58, 0x6C, 0x67, 0xFB, 0x0F,
+  0x83, 0xC1, 0xE1, 0xBF, 0x80, 0x0C, 0x0F, 0xC6, 0x1B, 0x03, 0x80, 0x20,
+  0x08, 0x02, 0x00, 0x80, 0xF0, 0x26, 0x18, 0xFC, 0xFF, 0x60, 0xF0, 0x78,
+  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC1, 0xE1, 0xBF, 0x80, 0x0A, 0x62, 0x62,
+  0x62, 0x6A, 0x62, 0x62, 0x62, 0x68, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0C, 0x0F, 0xE6, 0x0B, 0x03, 0x80, 0x20,
+  0x08, 0x7E, 0x01, 0xC0, 0x70, 0x36, 0x1C, 0xFD, 0x02, 0x63, 0x63, 0x63,
+  0x63, 0x6C, 0x63, 0x63, 0x63, 0x63, 0x61, 0x0B, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0xE3, 0xC7, 0x89, 0xF0, 0xC3, 0x63, 0x31, 0x19, 0x0D, 0x87,
+  0xC3, 0x31, 0x8C, 0xC3, 0x60, 0xB0, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0xF8, 0xE0, 0x7C, 0x1F, 0xC2, 0xF8, 0xDD, 0x1B,
+  0xB2, 0x76, 0xCE, 0x59, 0xCE, 0x39, 0xC7, 0x10, 0x80, 0xC0, 0xF0, 0x7C,
+  0x3A, 0x1D, 0x8E, 0x67, 0x13, 0x8D, 0xC2, 0xE0, 0xF0, 0x60, 0x1F, 0x06,
+  0x31, 0x83, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x6C, 0x18,
+  0xC6, 0x0F, 0x80, 0xFF, 0x60, 0xF0, 0x78, 0x3C, 0x37, 0xF3, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x00, 0x0C, 0x07, 0xF1, 0x82, 0x60, 0x68, 0x05, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x58, 0x59, 0x86, 0x1F, 0xE0, 0x04, 0x08, 0x12,
+  0x54, 0x63, 0x63, 0x5A, 0x12, 0x54, 0x63, 0x63, 0x63, 0x61, 0x18, 0x3F,
+  0x30, 0x58, 0x2C, 0x03, 0x80, 0x78, 0x06, 0x81, 0xC0, 0xF0, 0x4F, 0xC0,
+  0x09, 0x42, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x30,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xB0, 0xCF,
+  0xC0, 0x81, 0xC1, 0x41, 0x43, 0x62, 0x22, 0x26, 0x34, 0x14, 0x1C, 0x18,
+  0x86, 0x0C, 0x38, 0xF1, 0x47, 0x8A, 0x34, 0xD9, 0x24, 0x49, 0xA2, 0xCF,
+  0x16, 0x38, 0xE1, 0x83, 0x0C, 0x18, 0xC1, 0xB1, 0x8D, 0x83, 0x81, 0x80,
+  0xC0, 0x70, 0x6C, 0x63, 0x60, 0xE0, 0x20, 0xC1, 0xE1, 0x98, 0xC4, 0xC3,
+  0x40, 0xE0, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x18, 0x72, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x72, 0x79, 0xF2, 0x49, 0x24, 0x92, 0x49,
+  0xC0, 0x88, 0x44, 0x42, 0x22, 0x11, 0x10, 0xE4, 0x92, 0x49, 0x24, 0x93,
+  0xC0, 0x21, 0xC5, 0x12, 0x8A, 0x30, 0x09, 0xCC, 0x80, 0x7D, 0x88, 0x11,
+  0xEC, 0x50, 0xA1, 0x7F, 0x81, 0x02, 0x07, 0xEC, 0x70, 0x60, 0xC1, 0x83,
+  0x8F, 0xF0, 0x3E, 0xC5, 0x0E, 0x0C, 0x08, 0x58, 0x9F, 0x03, 0x03, 0x03,
+  0x3F, 0x63, 0x43, 0xC3, 0xC3, 0x43, 0x63, 0x3D, 0x7D, 0x8E, 0x0F, 0xF8,
+  0x10, 0x31, 0xBE, 0x36, 0x6F, 0x66, 0x66, 0x66, 0x60, 0x3F, 0x63, 0x43,
+  0xC3, 0xC3, 0x43, 0x63, 0x3F, 0x03, 0x42, 0x7E, 0x81, 0x02, 0x05, 0xEC,
+  0x78, 0xE1, 0xC3, 0x87, 0x0E, 0x18, 0x9F, 0xE0, 0x41, 0x55, 0x55, 0x70,
+  0x81, 0x02, 0x04, 0x69, 0x96, 0x3C, 0x6C, 0x89, 0x1A, 0x18, 0xBF, 0xF8,
+  0xCE, 0x10, 0xC2, 0x18, 0x43, 0x08, 0x61, 0x0C, 0x21, 0xBD, 0xCF, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x7D, 0x8E, 0x0C, 0x18, 0x30, 0x71, 0xBE, 0xBD,
+  0x8E, 0x0C, 0x18, 0x30, 0x71, 0xFE, 0x81, 0x02, 0x00, 0x3D, 0x63, 0x43,
+  0xC3, 0xC3, 0x43, 0x63, 0x3F, 0x03, 0x03, 0x03, 0xBC, 0xC8, 0x88, 0x88,
+  0xFA, 0x38, 0x3C, 0x1C, 0x18, 0x7E, 0x66, 0xF6, 0x66, 0x66, 0x67, 0x87,
+  0x0E, 0x1C, 0x38, 0x70, 0xF1, 0xBF, 0xC2, 0x85, 0x9B, 0x22, 0x47, 0x06,
+  0x0C, 0xC6, 0x69, 0xCD, 0x29, 0x35, 0x26, 0xBC, 0x73, 0x0C, 0x61, 0x8C,
+  0x85, 0x27, 0x0C, 0x31, 0xEC, 0xE1, 0x86, 0x3C, 0x92, 0x59, 0xC3, 0x0C,
+  0x20, 0x8C, 0x00, 0x7E, 0x08, 0x30, 0xC3, 0x04, 0x10, 0x7F, 0x69, 0x24,
+  0xB6, 0x49, 0x24, 0xC0, 0x0E, 0xE2, 0x22, 0x22, 0x33, 0x22, 0x22, 0x2E,
+  0x61, 0x34, 0x30 };
+
+static const packedGlyph_t FreeSans8pt7bGlyphs[] = {
+  {     0,   0,   1,   4,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,   1,  11,   4,    2,  -10, GLYPH_RAW },   // 0x21 '!'
+  {     2,   4,   4,   6,    1,  -10, GLYPH_RAW },   // 0x22 '"'
+  {     4,   9,  11,   9,    0,  -10, GLYPH_RAW },   // 0x23 '#'
+  {    17,   7,  14,   9,    1,  -11, GLYPH_RAW },   // 0x24 '$'
+  {    30,  13,  11,  14,    0,  -10, GLYPH_RAW },   // 0x25 '%'
+  {    48,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x26 '&'
+  {    61,   1,   4,   3,    1,  -10, GLYPH_RAW },   // 0x27 '\''
+  {    62,   3,  14,   5,    1,  -10, GLYPH_RAW },   // 0x28 '('
+  {    68,   3,  14,   5,    1,  -10, GLYPH_RAW },   // 0x29 ')'
+  {    74,   4,   4,   6,    1,  -10, GLYPH_RAW },   // 0x2A '*'
+  {    76,   7,   7,   9,    1,   -6, GLYPH_RAW },   // 0x2B '+'
+  {    83,   2,   4,   4,    1,   -1, GLYPH_RAW },   // 0x2C ','
+  {    84,   3,   1,   5,    1,   -4, GLYPH_RAW },   // 0x2D '-'
+  {    61,   2,   2,   4,    1,   -1, GLYPH_RAW },   // 0x2E '.'
+  {    85,   4,  11,   4,    0,  -10, GLYPH_RAW },   // 0x2F '/'
+  {    91,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x30 '0'
+  {   101,   3,  11,   9,    2,  -10, GLYPH_RAW },   // 0x31 '1'
+  {   106,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x32 '2'
+  {   116,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x33 '3'
+  {   126,   8,  11,   9,    0,  -10, GLYPH_RAW },   // 0x34 '4'
+  {   137,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x35 '5'
+  {   147,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x36 '6'
+  {   157,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x37 '7'
+  {   167,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x38 '8'
+  {   177,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x39 '9'
+  {   187,   1,   8,   4,    2,   -7, GLYPH_RAW },   // 0x3A ':'
+  {   188,   1,  10,   4,    2,   -7, GLYPH_RAW },   // 0x3B ';'
+  {   190,   7,   7,   9,    1,   -6, GLYPH_RAW },   // 0x3C '<'
+  {   197,   7,   5,   9,    1,   -5, GLYPH_RLE },   // 0x3D '='
+  {   199,   7,   7,   9,    1,   -6, GLYPH_RAW },   // 0x3E '>'
+  {   206,   7,  12,   9,    1,  -11, GLYPH_RAW },   // 0x3F '?'
+  {   217,  14,  14,  16,    1,  -11, GLYPH_RAW },   // 0x40 '@'
+  {   242,  10,  11,  10,    0,  -10, GLYPH_RAW },   // 0x41 'A'
+  {   256,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x42 'B'
+  {   269,  10,  12,  11,    1,  -11, GLYPH_RAW },   // 0x43 'C'
+  {   284,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x44 'D'
+  {   297,   8,  11,  10,    1,  -10, GLYPH_RLE },   // 0x45 'E'
+  {   306,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x46 'F'
+  {   317,  10,  12,  12,    1,  -11, GLYPH_RAW },   // 0x47 'G'
+  {   332,   9,  11,  11,    1,  -10, GLYPH_RLE },   // 0x48 'H'
+  {   343,   1,  11,   4,    2,  -10, GLYPH_RLE },   // 0x49 'I'
+  {   344,   7,  11,   8,    0,  -10, GLYPH_RAW },   // 0x4A 'J'
+  {   354,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x4B 'K'
+  {   367,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x4C 'L'
+  {   377,  11,  11,  13,    1,  -10, GLYPH_RAW },   // 0x4D 'M'
+  {   393,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x4E 'N'
+  {   406,  11,  12,  12,    1,  -11, GLYPH_RAW },   // 0x4F 'O'
+  {   423,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x50 'P'
+  {   436,  11,  13,  12,    1,  -11, GLYPH_RAW },   // 0x51 'Q'
+  {   454,   9,  11,  11,    1,  -10, GLYPH_RLE },   // 0x52 'R'
+  {   466,   9,  12,  10,    1,  -11, GLYPH_RAW },   // 0x53 'S'
+  {   480,   9,  11,  10,    0,  -10, GLYPH_RLE },   // 0x54 'T'
+  {   492,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x55 'U'
+  {   505,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x56 'V'
+  {   516,  13,  11,  15,    1,  -10, GLYPH_RAW },   // 0x57 'W'
+  {   534,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x58 'X'
+  {   547,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x59 'Y'
+  {   560,   9,  11,  10,    0,  -10, GLYPH_RLE },   // 0x5A 'Z'
+  {   571,   3,  14,   4,    1,  -10, GLYPH_RAW },   // 0x5B '['
+  {   577,   4,  11,   4,    0,  -10, GLYPH_RAW },   // 0x5C '\\'
+  {   583,   3,  14,   4,    0,  -10, GLYPH_RAW },   // 0x5D ']'
+  {   589,   6,   6,   7,    1,  -10, GLYPH_RAW },   // 0x5E '^'
+  {   594,   9,   1,   9,    0,    3, GLYPH_RLE },   // 0x5F '_'
+  {   595,   3,   3,   5,    0,  -11, GLYPH_RAW },   // 0x60 '`'
+  {   597,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x61 'a'
+  {   604,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x62 'b'
+  {   614,   7,   8,   8,    0,   -7, GLYPH_RAW },   // 0x63 'c'
+  {   621,   8,  11,   9,    0,  -10, GLYPH_RAW },   // 0x64 'd'
+  {   632,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x65 'e'
+  {   639,   4,  11,   4,    0,  -10, GLYPH_RAW },   // 0x66 'f'
+  {   645,   8,  11,   9,    0,   -7, GLYPH_RAW },   // 0x67 'g'
+  {   656,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x68 'h'
+  {   666,   1,  11,   3,    1,  -10, GLYPH_RAW },   // 0x69 'i'
+  {   668,   2,  14,   3,    0,  -10, GLYPH_RAW },   // 0x6A 'j'
+  {   672,   7,  11,   8,    1,  -10, GLYPH_RAW },   // 0x6B 'k'
+  {   343,   1,  11,   3,    1,  -10, GLYPH_RLE },   // 0x6C 'l'
+  {   682,  11,   8,  13,    1,   -7, GLYPH_RAW },   // 0x6D 'm'
+  {   693,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x6E 'n'
+  {   700,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x6F 'o'
+  {   707,   7,  11,   9,    1,   -7, GLYPH_RAW },   // 0x70 'p'
+  {   717,   8,  11,   9,    0,   -7, GLYPH_RAW },   // 0x71 'q'
+  {   728,   4,   8,   5,    1,   -7, GLYPH_RAW },   // 0x72 'r'
+  {   732,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x73 's'
+  {   738,   4,  10,   4,    0,   -9, GLYPH_RAW },   // 0x74 't'
+  {   743,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x75 'u'
+  {   750,   7,   8,   8,    0,   -7, GLYPH_RAW },   // 0x76 'v'
+  {   757,  11,   8,  11,    0,   -7, GLYPH_RAW },   // 0x77 'w'
+  {   768,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x78 'x'
+  {   774,   6,  11,   8,    1,   -7, GLYPH_RAW },   // 0x79 'y'
+  {   783,   7,   8,   8,    0,   -7, GLYPH_RAW },   // 0x7A 'z'
+  {   790,   3,  14,   5,    1,  -10, GLYPH_RAW },   // 0x7B '{'
+  {   796,   1,  14,   4,    2,  -10, GLYPH_RLE },   // 0x7C '|'
+  {   797,   4,  14,   5,    0,  -10, GLYPH_RAW },   // 0x7D '}'
+  {   804,   7,   3,   9,    1,   -6, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t FreeSans8pt7b = {
+  FreeSans8pt7bData,
+  FreeSans8pt7bGlyphs,
+  NULL,
+  0x20, 0x7E, 26 };
+
+// 95 glyphs, 807 bytes of glyph data
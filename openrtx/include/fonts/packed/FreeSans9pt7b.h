@@ -0,0 +1,201 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/FreeSans9pt7b.h
+
+static const uint8_t FreeSans9pt7bData[] = {
+  0x0F, 0x63, 0x20, 0xDE, 0xF7, 0x20, 0x09, 0x86, 0x41, 0x91, 0xFF, 0x13,
+  0x04, 0xC3, 0x20, 0xC8, 0xFF, 0x89, 0x82, 0x61, 0x90, 0x10, 0x1F, 0x14,
+  0xDA, 0x3D, 0x1E, 0x83, 0x40, 0x78, 0x17, 0x08, 0xF4, 0x7A, 0x35, 0x33,
+  0xF0, 0x40, 0x20, 0x38, 0x10, 0xEC, 0x20, 0xC6, 0x20, 0xC6, 0x40, 0xC6,
+  0x40, 0x6C, 0x80, 0x39, 0x00, 0x01, 0x3C, 0x02, 0x77, 0x02, 0x63, 0x04,
+  0x63, 0x04, 0x77, 0x08, 0x3C, 0x0E, 0x0C, 0xC3, 0x30, 0xCC, 0x1E, 0x03,
+  0x03, 0xC1, 0x9B, 0xC2, 0xF0, 0xEC, 0x19, 0x8F, 0x3C, 0x40, 0xFE, 0x13,
+  0x26, 0x6C, 0xCC, 0xCC, 0xC4, 0x66, 0x23, 0x10, 0x8C, 0x46, 0x63, 0x33,
+  0x33, 0x32, 0x66, 0x4C, 0x80, 0x25, 0x7E, 0xA5, 0x00, 0x30, 0xC3, 0x3F,
+  0x30, 0xC3, 0x0C, 0xD6, 0xF0, 0xC0, 0x08, 0x44, 0x21, 0x10, 0x84, 0x42,
+  0x11, 0x08, 0x00, 0x3C, 0x66, 0x42, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0x42, 0x66, 0x3C, 0x11, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x30, 0x3E,
+  0x31, 0xB0, 0x78, 0x30, 0x18, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x10, 0x08,
+  0x07, 0xF8, 0x3C, 0x66, 0xC3, 0xC3, 0x03, 0x06, 0x1C, 0x07, 0x03, 0xC3,
+  0xC3, 0x66, 0x3C, 0x0C, 0x18, 0x71, 0x62, 0xC9, 0xA3, 0x46, 0xFE, 0x18,
+  0x30, 0x60, 0xC0, 0x7F, 0x20, 0x10, 0x08, 0x08, 0x07, 0xF3, 0x8C, 0x03,
+  0x01, 0x80, 0xF0, 0x6C, 0x63, 0xE0, 0x1E, 0x31, 0x98, 0x78, 0x0C, 0x06,
+  0xF3, 0x8D, 0x83, 0xC1, 0xE0, 0xD0, 0x6C, 0x63, 0xE0, 0xFF, 0x03, 0x02,
+  0x06, 0x04, 0x0C, 0x08, 0x18, 0x18, 0x18, 0x10, 0x30, 0x30, 0x3E, 0x31,
+  0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8, 0xC6, 0xC1, 0xE0, 0xF0, 0x6C, 0x63,
+  0xE0, 0x3C, 0x66, 0xC2, 0xC3, 0xC3, 0xC3, 0x67, 0x3B, 0x03, 0x03, 0xC2,
+  0x66, 0x3C, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x64, 0xA0, 0x81, 0x63,
+  0x34, 0x33, 0x52, 0x74, 0x83, 0x83, 0x82, 0x09, 0xF3, 0x90, 0x93, 0x83,
+  0x83, 0x92, 0x53, 0x43, 0x33, 0x61, 0x80, 0x25, 0x32, 0x32, 0x12, 0x54,
+  0x52, 0x72, 0x62, 0x53, 0x62, 0x62, 0x72, 0xFA, 0x24, 0x03, 0xF0, 0x06,
+  0x0E, 0x06, 0x01, 0x86, 0x00, 0x66, 0x1D, 0xBB, 0x31, 0xCF, 0x18, 0xC7,
+  0x98, 0x63, 0xCC, 0x31, 0xE6, 0x11, 0xB3, 0x99, 0xCC, 0xF7, 0x86, 0x00,
+  0x01, 0x80, 0x00, 0x70, 0x40, 0x0F, 0xE0, 0x06, 0x00, 0xF0, 0x0F, 0x00,
+  0x90, 0x19, 0x81, 0x98, 0x10, 0x83, 0x0C, 0x3F, 0xC2, 0x04, 0x60, 0x66,
+  0x06, 0xC0, 0x30, 0xFF, 0x18, 0x33, 0x03, 0x60, 0x6C, 0x0D, 0x83, 0x3F,
+  0xC6, 0x06, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x6F, 0xF8, 0x1F, 0x86, 0x19,
+  0x81, 0xA0, 0x3C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x68, 0x0D, 0x83,
+  0x18, 0x61, 0xF0, 0xFF, 0x18, 0x33, 0x03, 0x60, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0x60, 0xCF, 0xF0, 0x0B, 0x72, 0x72,
+  0x72, 0x72, 0x78, 0x12, 0x72, 0x72, 0x72, 0x72, 0x79, 0xFF, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0F, 0x83,
+  0x0E, 0x60, 0x66, 0x03, 0xC0, 0x0C, 0x00, 0xC1, 0xFC, 0x03, 0xC0, 0x36,
+  0x03, 0x60, 0x73, 0x0F, 0x0F, 0x10, 0x02, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x7F, 0x07, 0x47, 0x47, 0x47, 0x47, 0x47, 0x20, 0x0F, 0xB0, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x8F, 0x1E, 0x27, 0x80, 0xC0, 0xF0,
+  0x6C, 0x33, 0x18, 0xCC, 0x37, 0x0F, 0xC3, 0x98, 0xC3, 0x30, 0xCC, 0x1B,
+  0x03, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0x3F, 0x01, 0xFC, 0x1F, 0xE0, 0xFD, 0x05,
+  0xEC, 0x6F, 0x63, 0x79, 0x13, 0xCD, 0x9E, 0x6C, 0xF1, 0x47, 0x8E, 0x3C,
+  0x71, 0x80, 0xE0, 0x7C, 0x0F, 0xC1, 0xE8, 0x3D, 0x87, 0x98, 0xF1, 0x1E,
+  0x33, 0xC3, 0x78, 0x6F, 0x07, 0xE0, 0x7C, 0x0E, 0x45, 0x62, 0x52, 0x32,
+  0x72, 0x22, 0x72, 0x12, 0x94, 0x94, 0x94, 0x94, 0x92, 0x12, 0x72, 0x22,
+  0x72, 0x32, 0x52, 0x65, 0x40, 0x08, 0x22, 0x52, 0x12, 0x64, 0x64, 0x64,
+  0x52, 0x18, 0x22, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x0F, 0x81, 0x83,
+  0x18, 0x0C, 0xC0, 0x6C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1B,
+  0x01, 0x98, 0x6C, 0x60, 0xC0, 0xFB, 0x00, 0x08, 0xFF, 0x8C, 0x0E, 0xC0,
+  0x6C, 0x06, 0xC0, 0x6C, 0x0C, 0xFF, 0x8C, 0x0E, 0xC0, 0x6C, 0x06, 0xC0,
+  0x6C, 0x06, 0xC0, 0x70, 0x26, 0x32, 0x42, 0x12, 0x64, 0x64, 0x94, 0x85,
+  0x83, 0x94, 0x64, 0x62, 0x12, 0x42, 0x36, 0x20, 0x09, 0x42, 0x72, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x30, 0x02, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x12, 0x52,
+  0x45, 0x30, 0xC0, 0x6C, 0x0D, 0x81, 0x10, 0x63, 0x0C, 0x61, 0x04, 0x60,
+  0xCC, 0x19, 0x01, 0x60, 0x3C, 0x07, 0x00, 0x60, 0xC1, 0x81, 0x61, 0xC3,
+  0x61, 0xC3, 0x61, 0x43, 0x62, 0x62, 0x22, 0x66, 0x32, 0x26, 0x36, 0x26,
+  0x14, 0x34, 0x14, 0x34, 0x1C, 0x1C, 0x18, 0x1C, 0x08, 0x18, 0xC0, 0xD8,
+  0x66, 0x18, 0xCC, 0x1E, 0x07, 0x00, 0xC0, 0x78, 0x32, 0x0C, 0xC6, 0x1B,
+  0x07, 0xC0, 0xC0, 0xC0, 0x36, 0x06, 0x30, 0xC3, 0x0C, 0x19, 0x81, 0xD8,
+  0x0F, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x0A,
+  0x72, 0x72, 0x82, 0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x82, 0x72, 0x8A,
+  0xFB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xE0, 0x84, 0x10, 0x84, 0x10, 0x84,
+  0x10, 0x84, 0x10, 0x80, 0xED, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0xE0, 0x30,
+  0x60, 0xA2, 0x44, 0xD8, 0xA1, 0x80, 0x0A, 0xC6, 0x30, 0x7E, 0x71, 0xB0,
+  0xC0, 0x60, 0xF3, 0xDB, 0x0D, 0x86, 0xC7, 0x3D, 0xC0, 0xC0, 0x60, 0x30,
+  0x1B, 0xCE, 0x36, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x7C, 0x6D, 0xE0,
+  0x3C, 0x66, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x66, 0x3C, 0x03, 0x03,
+  0x03, 0x3B, 0x67, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x67, 0x3B, 0x3C,
+  0x66, 0xC3, 0xC3, 0xFF, 0xC0, 0xC0, 0xC3, 0x66, 0x3C, 0x36, 0x6F, 0x66,
+  0x66, 0x66, 0x66, 0x60, 0x3B, 0x67, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0x67, 0x3B, 0x03, 0x03, 0xC6, 0x7C, 0xC0, 0xC0, 0xC0, 0xDE, 0xE3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x02, 0x4F, 0x50, 0x30, 0x03,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE0, 0xC0, 0xC0, 0xC0, 0xC2, 0xC4,
+  0xCC, 0xD8, 0xF8, 0xEC, 0xC4, 0xC6, 0xC3, 0xC3, 0xDE, 0xF7, 0x1C, 0xF0,
+  0xC7, 0x86, 0x3C, 0x31, 0xE1, 0x8F, 0x0C, 0x78, 0x63, 0xC3, 0x1E, 0x18,
+  0xC0, 0xDE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C,
+  0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0xDE, 0x71, 0xB0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xE3, 0x6F, 0x30, 0x18, 0x0C, 0x00,
+  0x3B, 0x67, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x67, 0x3B, 0x03, 0x03,
+  0x03, 0xDF, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x00, 0x3E, 0xE3, 0xC0, 0xC0,
+  0xE0, 0x3C, 0x07, 0xC3, 0xE3, 0x7E, 0x66, 0xF6, 0x66, 0x66, 0x66, 0x67,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B, 0xC1, 0xA0,
+  0x98, 0xCC, 0x42, 0x21, 0xB0, 0xD0, 0x28, 0x1C, 0x0C, 0x00, 0xC6, 0x1E,
+  0x38, 0x91, 0xC4, 0xCA, 0x66, 0xD3, 0x16, 0xD0, 0xA6, 0x87, 0x1C, 0x38,
+  0xC0, 0xC6, 0x00, 0x87, 0x89, 0xB1, 0xC3, 0x07, 0x1E, 0x26, 0xC5, 0x0C,
+  0xC1, 0x43, 0x63, 0x62, 0x26, 0x36, 0x34, 0x1C, 0x1C, 0x18, 0x18, 0x18,
+  0x10, 0x60, 0xFE, 0x0C, 0x30, 0xC1, 0x86, 0x18, 0x20, 0xC1, 0xFC, 0x36,
+  0x66, 0x66, 0x6E, 0xCE, 0x66, 0x66, 0x66, 0x30, 0x0F, 0xF4, 0xC6, 0x66,
+  0x66, 0x67, 0x37, 0x66, 0x66, 0x66, 0xC0, 0x61, 0x24, 0x38 };
+
+static const packedGlyph_t FreeSans9pt7bGlyphs[] = {
+  {     0,   0,   0,   5,    0,    1, GLYPH_RAW },   // 0x20 ' '
+  {     0,   2,  13,   6,    2,  -12, GLYPH_RLE },   // 0x21 '!'
+  {     3,   5,   4,   6,    1,  -12, GLYPH_RAW },   // 0x22 '"'
+  {     6,  10,  12,  10,    0,  -11, GLYPH_RAW },   // 0x23 '#'
+  {    21,   9,  16,  10,    1,  -13, GLYPH_RAW },   // 0x24 '$'
+  {    39,  16,  13,  16,    1,  -12, GLYPH_RAW },   // 0x25 '%'
+  {    65,  10,  13,  12,    1,  -12, GLYPH_RAW },   // 0x26 '&'
+  {    82,   2,   4,   4,    1,  -12, GLYPH_RAW },   // 0x27 '\''
+  {    83,   4,  17,   6,    1,  -12, GLYPH_RAW },   // 0x28 '('
+  {    92,   4,  17,   6,    1,  -12, GLYPH_RAW },   // 0x29 ')'
+  {   101,   5,   5,   7,    1,  -12, GLYPH_RAW },   // 0x2A '*'
+  {   105,   6,   8,  11,    3,   -7, GLYPH_RAW },   // 0x2B '+'
+  {   111,   2,   4,   5,    2,    0, GLYPH_RAW },   // 0x2C ','
+  {   112,   4,   1,   6,    1,   -4, GLYPH_RAW },   // 0x2D '-'
+  {   113,   2,   1,   5,    1,    0, GLYPH_RAW },   // 0x2E '.'
+  {   114,   5,  13,   5,    0,  -12, GLYPH_RAW },   // 0x2F '/'
+  {   123,   8,  13,  10,    1,  -12, GLYPH_RAW },   // 0x30 '0'
+  {   136,   4,  13,  10,    3,  -12, GLYPH_RAW },   // 0x31 '1'
+  {   143,   9,  13,  10,    1,  -12, GLYPH_RAW },   // 0x32 '2'
+  {   158,   8,  13,  10,    1,  -12, GLYPH_RAW },   // 0x33 '3'
+  {   171,   7,  13,  10,    2,  -12, GLYPH_RAW },   // 0x34 '4'
+  {   183,   9,  13,  10,    1,  -12, GLYPH_RAW },   // 0x35 '5'
+  {   198,   9,  13,  10,    1,  -12, GLYPH_RAW },   // 0x36 '6'
+  {   213,   8,  13,  10,    0,  -12, GLYPH_RAW },   // 0x37 '7'
+  {   226,   9,  13,  10,    1,  -12, GLYPH_RAW },   // 0x38 '8'
+  {   241,   8,  13,  10,    1,  -12, GLYPH_RAW },   // 0x39 '9'
+  {   254,   2,  10,   5,    1,   -9, GLYPH_RAW },   // 0x3A ':'
+  {   257,   3,  12,   5,    1,   -8, GLYPH_RAW },   // 0x3B ';'
+  {   262,   9,   9,  11,    1,   -8, GLYPH_RLE },   // 0x3C '<'
+  {   271,   9,   4,  11,    1,   -5, GLYPH_RLE },   // 0x3D '='
+  {   274,   9,   9,  11,    1,   -8, GLYPH_RLE },   // 0x3E '>'
+  {   283,   9,  13,  10,    1,  -12, GLYPH_RLE },   // 0x3F '?'
+  {   297,  17,  16,  18,    1,  -12, GLYPH_RAW },   // 0x40 '@'
+  {   331,  12,  13,  12,    0,  -12, GLYPH_RAW },   // 0x41 'A'
+  {   351,  11,  13,  12,    1,  -12, GLYPH_RAW },   // 0x42 'B'
+  {   369,  11,  13,  13,    1,  -12, GLYPH_RAW },   // 0x43 'C'
+  {   387,  11,  13,  13,    1,  -12, GLYPH_RAW },   // 0x44 'D'
+  {   405,   9,  13,  11,    1,  -12, GLYPH_RLE },   // 0x45 'E'
+  {   417,   8,  13,  11,    1,  -12, GLYPH_RAW },   // 0x46 'F'
+  {   430,  12,  13,  14,    1,  -12, GLYPH_RAW },   // 0x47 'G'
+  {   450,  11,  13,  13,    1,  -12, GLYPH_RLE },   // 0x48 'H'
+  {   464,   2,  13,   5,    2,  -12, GLYPH_RLE },   // 0x49 'I'
+  {   466,   7,  13,  10,    1,  -12, GLYPH_RAW },   // 0x4A 'J'
+  {   478,  10,  13,  12,    1,  -12, GLYPH_RAW },   // 0x4B 'K'
+  {   495,   8,  13,  10,    1,  -12, GLYPH_RAW },   // 0x4C 'L'
+  {   508,  13,  13,  15,    1,  -12, GLYPH_RAW },   // 0x4D 'M'
+  {   530,  11,  13,  13,    1,  -12, GLYPH_RAW },   // 0x4E 'N'
+  {   548,  13,  13,  14,    1,  -12, GLYPH_RLE },   // 0x4F 'O'
+  {   569,  10,  13,  12,    1,  -12, GLYPH_RLE },   // 0x50 'P'
+  {   585,  13,  14,  14,    1,  -12, GLYPH_RAW },   // 0x51 'Q'
+  {   608,  12,  13,  13,    1,  -12, GLYPH_RAW },   // 0x52 'R'
+  {   628,  10,  13,  12,    1,  -12, GLYPH_RLE },   // 0x53 'S'
+  {   644,   9,  13,  11,    1,  -12, GLYPH_RLE },   // 0x54 'T'
+  {   658,  11,  13,  13,    1,  -12, GLYPH_RLE },   // 0x55 'U'
+  {   674,  11,  13,  12,    0,  -12, GLYPH_RAW },   // 0x56 'V'
+  {   692,  16,  13,  17,    0,  -12, GLYPH_RAW },   // 0x57 'W'
+  {   718,  10,  13,  12,    1,  -12, GLYPH_RAW },   // 0x58 'X'
+  {   735,  12,  13,  12,    0,  -12, GLYPH_RAW },   // 0x59 'Y'
+  {   755,  10,  13,  11,    1,  -12, GLYPH_RLE },   // 0x5A 'Z'
+  {   768,   3,  17,   5,    1,  -12, GLYPH_RAW },   // 0x5B '['
+  {   775,   5,  13,   5,    0,  -12, GLYPH_RAW },   // 0x5C '\\'
+  {   784,   3,  17,   5,    0,  -12, GLYPH_RAW },   // 0x5D ']'
+  {   791,   7,   7,   8,    1,  -12, GLYPH_RAW },   // 0x5E '^'
+  {   798,  10,   1,  10,    0,    3, GLYPH_RLE },   // 0x5F '_'
+  {   799,   4,   3,   5,    0,  -12, GLYPH_RAW },   // 0x60 '`'
+  {   801,   9,  10,  10,    1,   -9, GLYPH_RAW },   // 0x61 'a'
+  {   813,   9,  13,  10,    1,  -12, GLYPH_RAW },   // 0x62 'b'
+  {   828,   8,  10,   9,    1,   -9, GLYPH_RAW },   // 0x63 'c'
+  {   838,   8,  13,  10,    1,  -12, GLYPH_RAW },   // 0x64 'd'
+  {   851,   8,  10,  10,    1,   -9, GLYPH_RAW },   // 0x65 'e'
+  {   861,   4,  13,   5,    1,  -12, GLYPH_RAW },   // 0x66 'f'
+  {   868,   8,  14,  10,    1,   -9, GLYPH_RAW },   // 0x67 'g'
+  {   882,   8,  13,  10,    1,  -12, GLYPH_RAW },   // 0x68 'h'
+  {   895,   2,  13,   4,    1,  -12, GLYPH_RLE },   // 0x69 'i'
+  {   898,   4,  17,   4,    0,  -12, GLYPH_RAW },   // 0x6A 'j'
+  {   907,   8,  13,   9,    1,  -12, GLYPH_RAW },   // 0x6B 'k'
+  {   464,   2,  13,   4,    1,  -12, GLYPH_RLE },   // 0x6C 'l'
+  {   920,  13,  10,  15,    1,   -9, GLYPH_RAW },   // 0x6D 'm'
+  {   937,   8,  10,  10,    1,   -9, GLYPH_RAW },   // 0x6E 'n'
+  {   947,   8,  10,  10,    1,   -9, GLYPH_RAW },   // 0x6F 'o'
+  {   957,   9,  13,  10,    1,   -9, GLYPH_RAW },   // 0x70 'p'
+  {   972,   8,  13,  10,    1,   -9, GLYPH_RAW },   // 0x71 'q'
+  {   985,   5,  10,   6,    1,   -9, GLYPH_RAW },   // 0x72 'r'
+  {   992,   8,  10,   9,    1,   -9, GLYPH_RAW },   // 0x73 's'
+  {  1002,   4,  12,   5,    1,  -11, GLYPH_RAW },   // 0x74 't'
+  {  1008,   8,  10,  10,    1,   -9, GLYPH_RAW },   // 0x75 'u'
+  {  1018,   9,  10,   9,    0,   -9, GLYPH_RAW },   // 0x76 'v'
+  {  1030,  13,  10,  13,    0,   -9, GLYPH_RAW },   // 0x77 'w'
+  {  1047,   7,  10,   9,    1,   -9, GLYPH_RAW },   // 0x78 'x'
+  {  1056,   8,  14,   9,    0,   -9, GLYPH_RAW },   // 0x79 'y'
+  {  1070,   7,  10,   9,    1,   -9, GLYPH_RAW },   // 0x7A 'z'
+  {  1079,   4,  17,   6,    1,  -12, GLYPH_RAW },   // 0x7B '{'
+  {  1088,   2,  17,   4,    2,  -12, GLYPH_RLE },   // 0x7C '|'
+  {  1090,   4,  17,   6,    1,  -12, GLYPH_RAW },   // 0x7D '}'
+  {  1099,   7,   3,   9,    1,   -7, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t FreeSans9pt7b = {
+  FreeSans9pt7bData,
+  FreeSans9pt7bGlyphs,
+  NULL,
+  0x20, 0x7E, 22 };
+
+// 95 glyphs, 1102 bytes of glyph data
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/symbols/Symbols5pt7b.h
+
+static const uint8_t Symbols5pt7bData[] = {
+  0x00, 0x08, 0x52, 0x4A, 0x10, 0x00, 0x03, 0xFB, 0x73, 0xCE, 0x1F, 0xC0,
+  0x00, 0x12, 0x48, 0x00, 0x00, 0xCF, 0xF3, 0xCF, 0xF3, 0x00, 0x01, 0xE8,
+  0x6D, 0xB6, 0x17, 0x80, 0x01, 0xE8, 0x61, 0x86, 0x17, 0x80, 0x31, 0x24,
+  0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x66, 0x00, 0x66, 0x66, 0x90,
+  0x00, 0x3C, 0x81, 0x42, 0x3C, 0x18, 0x18, 0x00, 0x00, 0x3C, 0x81, 0x5A,
+  0x3C, 0x18, 0x18, 0x00, 0x00, 0x3C, 0x81, 0x7E, 0x3C, 0x18, 0x18, 0x00,
+  0xA4, 0x28, 0x16, 0x34, 0x52, 0x62, 0xB0 };
+
+static const packedGlyph_t Symbols5pt7bGlyphs[] = {
+  {     0,   0,   1,   5,    0,   -7, GLYPH_RAW },   // 0x20 ' '
+  {     0,   6,   8,   5,    1,   -7, GLYPH_RAW },   // 0x21 '!'
+  {     6,   6,   8,   5,    1,   -7, GLYPH_RAW },   // 0x22 '"'
+  {    12,   4,   8,   5,    2,   -7, GLYPH_RAW },   // 0x23 '#'
+  {    12,   4,   8,   5,    2,   -7, GLYPH_RAW },   // 0x24 '$'
+  {    16,   6,   8,   5,    1,   -7, GLYPH_RAW },   // 0x25 '%'
+  {    22,   6,   8,   5,    1,   -7, GLYPH_RAW },   // 0x26 '&'
+  {    28,   6,   8,   5,    1,   -7, GLYPH_RAW },   // 0x27 '\''
+  {    34,   6,   8,   5,    1,   -7, GLYPH_RAW },   // 0x28 '('
+  {    40,   4,   8,   5,    2,   -7, GLYPH_RAW },   // 0x29 ')'
+  {    44,   4,   8,   5,    2,   -7, GLYPH_RAW },   // 0x2A '*'
+  {    48,   8,   8,   5,    0,   -7, GLYPH_RAW },   // 0x2B '+'
+  {    56,   8,   8,   5,    0,   -7, GLYPH_RAW },   // 0x2C ','
+  {    64,   8,   8,   5,    0,   -7, GLYPH_RAW },   // 0x2D '-'
+  {    72,   8,   8,   5,    0,   -7, GLYPH_RLE } }; // 0x2E '.'
+
+static const packedFont_t Symbols5pt7b = {
+  Symbols5pt7bData,
+  Symbols5pt7bGlyphs,
+  NULL,
+  0x20, 0x2E, 19 };
+
+// 15 glyphs, 79 bytes of glyph data
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/symbols/Symbols6pt7b.h
+
+static const uint8_t Symbols6pt7bData[] = {
+  0xF9, 0x16, 0x22, 0x22, 0x22, 0x22, 0x26, 0x1F, 0x90, 0x00, 0x7E, 0x81,
+  0xBD, 0xA5, 0xA5, 0xA5, 0x81, 0x7E, 0x00, 0x00, 0x03, 0xC3, 0x14, 0x94,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x42, 0x92, 0x8C, 0x3C, 0x00, 0x00, 0x00,
+  0x18, 0x7E, 0xFF, 0x66, 0x66, 0xFF, 0x7E, 0x18, 0x00, 0x00, 0x18, 0x66,
+  0x5A, 0xBD, 0xBD, 0x5A, 0x66, 0x18, 0x00, 0x00, 0x18, 0x66, 0x42, 0x81,
+  0x81, 0x42, 0x66, 0x18, 0x00, 0x31, 0x24, 0xBF, 0xFF, 0xFC, 0xFF, 0xFC,
+  0x00, 0x96, 0x26, 0x26, 0x26, 0x26, 0x26, 0x98, 0x32, 0x30, 0x01, 0xE3,
+  0x3F, 0x00, 0xC7, 0x92, 0x48, 0x00, 0x00, 0x3C, 0xC3, 0x81, 0x81, 0x5A,
+  0x3C, 0x18, 0x00, 0x00, 0xA4, 0x22, 0x43, 0x69, 0x16, 0x34, 0x52, 0xF4,
+  0xA4, 0x22, 0x43, 0x22, 0x29, 0x16, 0x34, 0x52, 0xF4, 0xA4, 0x2F, 0x91,
+  0x63, 0x45, 0x2F, 0x40 };
+
+static const packedGlyph_t Symbols6pt7bGlyphs[] = {
+  {     0,   0,   1,   6,    0,   -8, GLYPH_RAW },   // 0x20 ' '
+  {     0,   8,  10,   6,    1,   -8, GLYPH_RLE },   // 0x21 '!'
+  {     9,   8,  10,   6,    1,   -8, GLYPH_RAW },   // 0x22 '"'
+  {    19,   6,  10,   6,    2,   -8, GLYPH_RAW },   // 0x23 '#'
+  {    27,   6,  10,   6,    2,   -8, GLYPH_RAW },   // 0x24 '$'
+  {    35,   8,  10,   6,    1,   -8, GLYPH_RAW },   // 0x25 '%'
+  {    45,   8,  10,   6,    1,   -8, GLYPH_RAW },   // 0x26 '&'
+  {    55,   8,  10,   6,    1,   -8, GLYPH_RAW },   // 0x27 '\''
+  {    65,   6,  10,   6,    2,   -8, GLYPH_RAW },   // 0x28 '('
+  {    73,   8,  10,   6,    1,   -8, GLYPH_RLE },   // 0x29 ')'
+  {    82,   6,  10,   6,    2,   -8, GLYPH_RAW },   // 0x2A '*'
+  {    90,   8,  10,   6,    1,   -8, GLYPH_RAW },   // 0x2B '+'
+  {   100,   8,  10,   6,    1,   -8, GLYPH_RLE },   // 0x2C ','
+  {   108,   8,  10,   6,    1,   -8, GLYPH_RLE },   // 0x2D '-'
+  {   117,   8,  10,   6,    1,   -8, GLYPH_RLE } }; // 0x2E '.'
+
+static const packedFont_t Symbols6pt7b = {
+  Symbols6pt7bData,
+  Symbols6pt7bGlyphs,
+  NULL,
+  0x20, 0x2E, 22 };
+
+// 15 glyphs, 124 bytes of glyph data
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/symbols/Symbols8pt7b.h
+
+static const uint8_t Symbols8pt7bData[] = {
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x2C, 0x07, 0x6B, 0x6B, 0xAD, 0xAD, 0xC0,
+  0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1B, 0xED,
+  0x56, 0xAB, 0x55, 0xAA, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xF0, 0x61, 0x44, 0x91, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x51, 0x24, 0x50, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x38, 0x35,
+  0x91, 0xB1, 0x33, 0x32, 0x33, 0x32, 0x33, 0x31, 0xB1, 0x95, 0x38, 0x3F,
+  0x00, 0x00, 0x00, 0x80, 0x7C, 0x10, 0x44, 0x44, 0x9C, 0xB7, 0xDA, 0x72,
+  0x44, 0x44, 0x10, 0x7C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7C, 0x10,
+  0x44, 0x04, 0x80, 0xB0, 0x1A, 0x02, 0x40, 0x44, 0x10, 0x7C, 0x02, 0x00,
+  0x00, 0xB5, 0x41, 0x31, 0x41, 0x31, 0x37, 0x1F, 0x71, 0x81, 0xFF, 0x19,
+  0xF9, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x77, 0x19, 0x34, 0xBB, 0x00,
+  0x1F, 0x08, 0x81, 0x07, 0xF6, 0x0C, 0x50, 0x38, 0x3E, 0x1B, 0x08, 0x84,
+  0x40, 0x00, 0xF8, 0x91, 0x27, 0x39, 0x11, 0x17, 0x12, 0x25, 0x23, 0x75,
+  0x57, 0x39, 0x1F, 0xC0, 0xF8, 0x91, 0x27, 0x39, 0x11, 0x13, 0x13, 0x12,
+  0x93, 0x75, 0x57, 0x39, 0x1F, 0xC0, 0xF8, 0x91, 0x27, 0x33, 0x33, 0x11,
+  0x92, 0x93, 0x75, 0x57, 0x39, 0x1F, 0xC0, 0xF8, 0x91, 0xF7, 0x19, 0x29,
+  0x37, 0x55, 0x73, 0x91, 0xFC };
+
+static const packedGlyph_t Symbols8pt7bGlyphs[] = {
+  {     0,   0,   1,   9,    0,  -11, GLYPH_RAW },   // 0x20 ' '
+  {     0,  11,  13,   9,    1,  -11, GLYPH_RAW },   // 0x21 '!'
+  {    18,   9,  13,   9,    2,  -11, GLYPH_RAW },   // 0x22 '"'
+  {    33,   7,  13,   9,    3,  -11, GLYPH_RAW },   // 0x23 '#'
+  {    45,   7,  13,   9,    3,  -11, GLYPH_RAW },   // 0x24 '$'
+  {    57,  11,  13,   9,    1,  -11, GLYPH_RLE },   // 0x25 '%'
+  {    73,  11,  13,   9,    1,  -11, GLYPH_RAW },   // 0x26 '&'
+  {    91,  11,  13,   9,    1,  -11, GLYPH_RAW },   // 0x27 '\''
+  {   109,   9,  13,   9,    2,  -11, GLYPH_RLE },   // 0x28 '('
+  {   120,  11,  13,   9,    1,  -11, GLYPH_RLE },   // 0x29 ')'
+  {   131,   9,  13,   9,    2,  -11, GLYPH_RAW },   // 0x2A '*'
+  {   146,  11,  13,   9,    1,  -11, GLYPH_RLE },   // 0x2B '+'
+  {   160,  11,  13,   9,    1,  -11, GLYPH_RLE },   // 0x2C ','
+  {   174,  11,  13,   9,    1,  -11, GLYPH_RLE },   // 0x2D '-'
+  {   187,  11,  13,   9,    1,  -11, GLYPH_RLE } }; // 0x2E '.'
+
+static const packedFont_t Symbols8pt7b = {
+  Symbols8pt7bData,
+  Symbols8pt7bGlyphs,
+  NULL,
+  0x20, 0x2E, 30 };
+
+// 15 glyphs, 197 bytes of glyph data
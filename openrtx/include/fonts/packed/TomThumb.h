@@ -0,0 +1,124 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/TomThumb.h
+
+static const uint8_t TomThumbData[] = {
+  0xE8, 0xB4, 0xBE, 0xFA, 0x79, 0xE4, 0x85, 0x42, 0xDB, 0xD6, 0xC0, 0x6A,
+  0x40, 0x95, 0x80, 0xAA, 0x80, 0x5D, 0x00, 0x60, 0xE0, 0x80, 0x25, 0x48,
+  0x76, 0xDC, 0x75, 0x40, 0xC5, 0x4E, 0xC5, 0x1C, 0xB7, 0x92, 0xF3, 0x1C,
+  0x73, 0xDE, 0xE5, 0x48, 0xF7, 0xDE, 0xF7, 0x9C, 0xA0, 0x46, 0x2A, 0x22,
+  0xE3, 0x80, 0x88, 0xA8, 0xE5, 0x04, 0x57, 0xC6, 0x57, 0xDA, 0xD7, 0x5C,
+  0x72, 0x46, 0xD6, 0xDC, 0xF3, 0xCE, 0xF3, 0xC8, 0x73, 0xD6, 0xB7, 0xDA,
+  0xE9, 0x2E, 0x24, 0xD4, 0xB7, 0x5A, 0x92, 0x4E, 0xBF, 0xDA, 0xBF, 0xFA,
+  0x56, 0xD4, 0xD7, 0x48, 0x56, 0xF6, 0xD7, 0xEA, 0x71, 0x1C, 0xE9, 0x24,
+  0xB6, 0xD6, 0xB6, 0xA4, 0xB7, 0xFA, 0xB5, 0x5A, 0xB5, 0x24, 0xE5, 0x4E,
+  0xF2, 0x4E, 0x88, 0x80, 0xE4, 0x9E, 0x54, 0x90, 0xCE, 0xF0, 0x9A, 0xDC,
+  0x72, 0x30, 0x2E, 0xD6, 0x77, 0x30, 0x2B, 0xA4, 0x77, 0x94, 0x9A, 0xDA,
+  0xB8, 0x20, 0x9A, 0x80, 0x97, 0x6A, 0xC9, 0x2E, 0xFF, 0xD0, 0xD6, 0xD0,
+  0x56, 0xA0, 0xD6, 0xE8, 0x76, 0xB2, 0x72, 0x40, 0x79, 0xE0, 0x5D, 0x26,
+  0xB6, 0xB0, 0xB7, 0xA0, 0xBF, 0xF0, 0xA9, 0x50, 0xB5, 0x94, 0xEF, 0x70,
+  0x6A, 0x26, 0xD8, 0xC8, 0xAC, 0x78 };
+
+static const packedGlyph_t TomThumbGlyphs[] = {
+  {     0,   0,   1,   2,    0,   -5, GLYPH_RAW },   // 0x20 ' '
+  {     0,   1,   5,   2,    0,   -5, GLYPH_RAW },   // 0x21 '!'
+  {     1,   3,   2,   4,    0,   -5, GLYPH_RAW },   // 0x22 '"'
+  {     2,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x23 '#'
+  {     4,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x24 '$'
+  {     6,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x25 '%'
+  {     8,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x26 '&'
+  {    10,   1,   2,   2,    0,   -5, GLYPH_RAW },   // 0x27 '\''
+  {    11,   2,   5,   3,    0,   -5, GLYPH_RAW },   // 0x28 '('
+  {    13,   2,   5,   3,    0,   -5, GLYPH_RAW },   // 0x29 ')'
+  {    15,   3,   3,   4,    0,   -5, GLYPH_RAW },   // 0x2A '*'
+  {    17,   3,   3,   4,    0,   -4, GLYPH_RAW },   // 0x2B '+'
+  {    19,   2,   2,   3,    0,   -2, GLYPH_RAW },   // 0x2C ','
+  {    20,   3,   1,   4,    0,   -3, GLYPH_RAW },   // 0x2D '-'
+  {    21,   1,   1,   2,    0,   -1, GLYPH_RAW },   // 0x2E '.'
+  {    22,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x2F '/'
+  {    24,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x30 '0'
+  {    26,   2,   5,   3,    0,   -5, GLYPH_RAW },   // 0x31 '1'
+  {    28,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x32 '2'
+  {    30,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x33 '3'
+  {    32,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x34 '4'
+  {    34,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x35 '5'
+  {    36,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x36 '6'
+  {    38,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x37 '7'
+  {    40,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x38 '8'
+  {    42,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x39 '9'
+  {    44,   1,   3,   2,    0,   -4, GLYPH_RAW },   // 0x3A ':'
+  {    45,   2,   4,   3,    0,   -4, GLYPH_RAW },   // 0x3B ';'
+  {    46,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x3C '<'
+  {    48,   3,   3,   4,    0,   -4, GLYPH_RAW },   // 0x3D '='
+  {    50,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x3E '>'
+  {    52,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x3F '?'
+  {    54,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x40 '@'
+  {    56,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x41 'A'
+  {    58,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x42 'B'
+  {    60,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x43 'C'
+  {    62,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x44 'D'
+  {    64,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x45 'E'
+  {    66,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x46 'F'
+  {    68,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x47 'G'
+  {    70,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x48 'H'
+  {    72,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x49 'I'
+  {    74,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x4A 'J'
+  {    76,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x4B 'K'
+  {    78,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x4C 'L'
+  {    80,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x4D 'M'
+  {    82,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x4E 'N'
+  {    84,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x4F 'O'
+  {    86,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x50 'P'
+  {    88,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x51 'Q'
+  {    90,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x52 'R'
+  {    92,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x53 'S'
+  {    94,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x54 'T'
+  {    96,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x55 'U'
+  {    98,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x56 'V'
+  {   100,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x57 'W'
+  {   102,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x58 'X'
+  {   104,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x59 'Y'
+  {   106,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x5A 'Z'
+  {   108,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x5B '['
+  {   110,   3,   3,   4,    0,   -4, GLYPH_RAW },   // 0x5C '\\'
+  {   112,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x5D ']'
+  {   114,   3,   2,   4,    0,   -5, GLYPH_RAW },   // 0x5E '^'
+  {    20,   3,   1,   4,    0,   -1, GLYPH_RAW },   // 0x5F '_'
+  {   115,   2,   2,   3,    0,   -5, GLYPH_RAW },   // 0x60 '`'
+  {   116,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x61 'a'
+  {   118,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x62 'b'
+  {   120,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x63 'c'
+  {   122,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x64 'd'
+  {   124,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x65 'e'
+  {   126,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x66 'f'
+  {   128,   3,   5,   4,    0,   -4, GLYPH_RAW },   // 0x67 'g'
+  {   130,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x68 'h'
+  {   132,   1,   5,   2,    0,   -5, GLYPH_RAW },   // 0x69 'i'
+  {   133,   3,   6,   4,    0,   -5, GLYPH_RAW },   // 0x6A 'j'
+  {   136,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x6B 'k'
+  {   138,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x6C 'l'
+  {   140,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x6D 'm'
+  {   142,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x6E 'n'
+  {   144,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x6F 'o'
+  {   146,   3,   5,   4,    0,   -4, GLYPH_RAW },   // 0x70 'p'
+  {   148,   3,   5,   4,    0,   -4, GLYPH_RAW },   // 0x71 'q'
+  {   150,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x72 'r'
+  {   152,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x73 's'
+  {   154,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x74 't'
+  {   156,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x75 'u'
+  {   158,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x76 'v'
+  {   160,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x77 'w'
+  {   162,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x78 'x'
+  {   164,   3,   5,   4,    0,   -4, GLYPH_RAW },   // 0x79 'y'
+  {   166,   3,   4,   4,    0,   -4, GLYPH_RAW },   // 0x7A 'z'
+  {   168,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x7B '{'
+  {   170,   1,   5,   2,    0,   -5, GLYPH_RAW },   // 0x7C '|'
+  {   171,   3,   5,   4,    0,   -5, GLYPH_RAW },   // 0x7D '}'
+  {   173,   3,   2,   4,    0,   -5, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t TomThumb = {
+  TomThumbData,
+  TomThumbGlyphs,
+  NULL,
+  0x20, 0x7E, 6 };
+
+// 95 glyphs, 174 bytes of glyph data
@@ -0,0 +1,196 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/UbuntuRegular10pt7b.h
+
+static const uint8_t UbuntuRegular10pt7bData[] = {
+  0x0C, 0xC1, 0x98, 0x66, 0x0C, 0xCF, 0xFF, 0xFF, 0xC6, 0x61, 0x98, 0xFF,
+  0xFF, 0xFC, 0xCC, 0x19, 0x86, 0x60, 0xCC, 0x00, 0x38, 0x30, 0xD8, 0xC3,
+  0x19, 0x86, 0x36, 0x0C, 0x6C, 0x0D, 0xB0, 0x0E, 0x60, 0x01, 0x9C, 0x03,
+  0x6C, 0x0D, 0x8C, 0x1B, 0x18, 0x66, 0x30, 0xC6, 0xC3, 0x07, 0x00, 0x1E,
+  0x0F, 0xE1, 0x8C, 0x31, 0x86, 0x70, 0x7C, 0x0F, 0x03, 0xE1, 0xE6, 0x78,
+  0xDB, 0x0F, 0x70, 0xC7, 0xFC, 0x7C, 0xC0, 0x0A, 0x08, 0x04, 0x32, 0x6F,
+  0xE0, 0x81, 0xB1, 0xDC, 0x44, 0x42, 0x82, 0x82, 0x82, 0x4F, 0x54, 0x28,
+  0x28, 0x28, 0x24, 0x6D, 0xAC, 0xFC, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60,
+  0xC0, 0xC0, 0x1C, 0x3F, 0x98, 0xDC, 0x7C, 0x1E, 0x0F, 0x07, 0x83, 0xC1,
+  0xE0, 0xF8, 0xEC, 0x67, 0xF0, 0xE0, 0x0C, 0xFF, 0xF3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x3C, 0xFE, 0xC7, 0x03, 0x03, 0x03, 0x06,
+  0x0C, 0x18, 0x70, 0x60, 0xC0, 0xFF, 0xFF, 0x78, 0xFE, 0x06, 0x06, 0x0E,
+  0x3C, 0x3C, 0x06, 0x03, 0x03, 0x03, 0x87, 0xFE, 0x7C, 0x06, 0x07, 0x07,
+  0x87, 0xC3, 0x63, 0x31, 0x99, 0x8C, 0xFF, 0xFF, 0xC1, 0x80, 0xC0, 0x60,
+  0x30, 0x18, 0x18, 0x12, 0x72, 0x72, 0x75, 0x47, 0x63, 0x82, 0x72, 0x73,
+  0x5B, 0x25, 0x30, 0x07, 0x0F, 0x8E, 0x0C, 0x06, 0x07, 0xF3, 0xFD, 0x87,
+  0xC1, 0xE0, 0xF0, 0x6C, 0x77, 0xF1, 0xF0, 0x0F, 0x37, 0x26, 0x26, 0x27,
+  0x26, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27, 0x25, 0x3E, 0x3F, 0xB8,
+  0xF8, 0x3C, 0x1B, 0x98, 0xF8, 0xEE, 0xC3, 0xE0, 0xF0, 0x7C, 0x77, 0xF1,
+  0xF0, 0x3E, 0x3F, 0xB8, 0xD8, 0x3C, 0x1E, 0x0F, 0x86, 0xFF, 0x3F, 0x81,
+  0x80, 0xC1, 0xC7, 0xC3, 0x80, 0x06, 0xA6, 0x80, 0xF0, 0x7C, 0x0F, 0x03,
+  0x0F, 0x7C, 0xF0, 0x80, 0x7B, 0xF8, 0xC3, 0x0C, 0x61, 0x8C, 0x30, 0x00,
+  0x0C, 0x30, 0xC0, 0x07, 0x00, 0x38, 0x03, 0x60, 0x1B, 0x00, 0xD8, 0x0C,
+  0x60, 0x63, 0x06, 0x0C, 0x30, 0x61, 0xFF, 0x1F, 0xFC, 0xC0, 0x66, 0x03,
+  0x60, 0x0C, 0xFE, 0x3F, 0xCC, 0x3B, 0x06, 0xC3, 0xBF, 0xCF, 0xFB, 0x07,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0xFF, 0xBF, 0x80, 0x45, 0x38, 0x13, 0x51,
+  0x12, 0x72, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0x83, 0x51, 0x28, 0x45,
+  0x10, 0x07, 0x49, 0x22, 0x53, 0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x62, 0x12, 0x53, 0x19, 0x27, 0x40, 0xFE, 0xFE, 0xC0, 0xC0,
+  0xC0, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x0F, 0x36,
+  0x26, 0x26, 0x26, 0x71, 0x71, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x0F,
+  0x8F, 0xF7, 0x05, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xC0, 0xF0, 0x36,
+  0x0D, 0xC3, 0x3F, 0xC7, 0xF0, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6F,
+  0x96, 0x46, 0x46, 0x46, 0x46, 0x46, 0x20, 0x0F, 0xD0, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0x7C, 0xC0,
+  0xF0, 0x6C, 0x33, 0x18, 0xCC, 0x36, 0x0F, 0x03, 0x60, 0xCC, 0x31, 0x8C,
+  0x33, 0x06, 0xC1, 0xF0, 0x30, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x60, 0x06, 0x70, 0x0E, 0x70,
+  0x0E, 0x78, 0x1E, 0x68, 0x16, 0xEC, 0x36, 0xC4, 0x23, 0xC6, 0x63, 0xC6,
+  0x63, 0xC3, 0xC3, 0xC3, 0xC3, 0xC1, 0x83, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x7C, 0x0F, 0xC1, 0xF8, 0x3D, 0x87, 0x98, 0xF1, 0x9E, 0x33, 0xC3, 0x78,
+  0x2F, 0x07, 0xE0, 0x7C, 0x07, 0x80, 0xC0, 0x46, 0x6A, 0x34, 0x44, 0x22,
+  0x82, 0x13, 0x85, 0xA4, 0xA4, 0xA4, 0xA5, 0x83, 0x12, 0x82, 0x24, 0x44,
+  0x3A, 0x66, 0x40, 0x06, 0x38, 0x12, 0x45, 0x54, 0x54, 0x54, 0x4B, 0x17,
+  0x22, 0x72, 0x72, 0x72, 0x72, 0x70, 0x46, 0x6A, 0x34, 0x44, 0x22, 0x82,
+  0x13, 0x85, 0xA4, 0xA4, 0xA4, 0xA5, 0x83, 0x12, 0x82, 0x24, 0x43, 0x49,
+  0x75, 0xB2, 0xD3, 0xC5, 0xB3, 0x10, 0xFE, 0x1F, 0xF3, 0x07, 0x60, 0x6C,
+  0x0D, 0x81, 0xB0, 0x77, 0xFC, 0xFE, 0x18, 0x63, 0x0E, 0x60, 0xEC, 0x0D,
+  0x80, 0xC0, 0x25, 0x37, 0x13, 0x62, 0x72, 0x83, 0x75, 0x64, 0x73, 0x72,
+  0x73, 0x5B, 0x26, 0x20, 0x0F, 0x54, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x24, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x12, 0x42, 0x28, 0x44, 0x30, 0xC0,
+  0x1B, 0x01, 0x98, 0x0C, 0xC0, 0x63, 0x06, 0x18, 0x30, 0x63, 0x03, 0x18,
+  0x18, 0xC0, 0x6C, 0x03, 0x60, 0x0E, 0x00, 0x70, 0x01, 0x00, 0xC0, 0x01,
+  0xE0, 0x00, 0xF0, 0x70, 0x6C, 0x38, 0x66, 0x1C, 0x33, 0x0B, 0x19, 0x8D,
+  0x8C, 0xC6, 0xC6, 0x32, 0x26, 0x1B, 0x1B, 0x0D, 0x8D, 0x86, 0x86, 0xC1,
+  0xC1, 0xC0, 0xE0, 0xE0, 0xC0, 0x1B, 0x01, 0x8C, 0x18, 0x31, 0x80, 0xD8,
+  0x06, 0xC0, 0x1C, 0x00, 0xE0, 0x0D, 0x80, 0xC6, 0x06, 0x30, 0x60, 0xC6,
+  0x03, 0x60, 0x0C, 0xC0, 0x36, 0x06, 0x60, 0x63, 0x0C, 0x19, 0x81, 0x98,
+  0x0F, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x0F, 0x37, 0x26, 0x26, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x27,
+  0xF3, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18,
+  0x18, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03, 0x0F, 0x50, 0x7C,
+  0xF8, 0x18, 0x37, 0xFF, 0xF1, 0xE3, 0xC7, 0xFD, 0xF8, 0xC0, 0x60, 0x30,
+  0x18, 0x0F, 0xE7, 0xFB, 0x0D, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x37,
+  0xFB, 0xF0, 0x1F, 0x7F, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x7F,
+  0x1F, 0x01, 0x80, 0xC0, 0x60, 0x33, 0xFB, 0xFD, 0x87, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x36, 0x1B, 0xFC, 0x7E, 0x34, 0x37, 0x22, 0x32, 0x12, 0x54,
+  0x5F, 0x78, 0x27, 0x74, 0x51, 0x3D, 0xFC, 0x30, 0xFF, 0xFC, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x00, 0x1F, 0xBF, 0xD8, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0x61, 0xBF, 0xCF, 0xE0, 0x30, 0x3B, 0xF9, 0xF8, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0x04, 0x4F, 0x70, 0x18, 0xC0, 0x01, 0x8C, 0x63, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x1F, 0xB8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC6, 0xCC, 0xD8,
+  0xF0, 0xF0, 0xD8, 0xCC, 0xC4, 0xC6, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCF, 0x70, 0xFC, 0xF3, 0xFF, 0xEC, 0x71, 0xF0, 0xC3, 0xC3, 0x0F,
+  0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xC0, 0xFC,
+  0xFE, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x1E, 0x1F,
+  0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0,
+  0xFC, 0x7F, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC3, 0x7F, 0xBF,
+  0x98, 0x0C, 0x06, 0x03, 0x00, 0x1F, 0xBF, 0xD8, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0x61, 0xBF, 0xCF, 0xE0, 0x30, 0x18, 0x0C, 0x06, 0x7F, 0xFC,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x00, 0x7D, 0xFB, 0x06, 0x0E, 0x0F,
+  0x87, 0x83, 0x07, 0xFF, 0xF0, 0xC6, 0x31, 0xFF, 0xE3, 0x18, 0xC6, 0x31,
+  0x8F, 0xBC, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE3, 0x7F,
+  0x3F, 0xC0, 0xF0, 0x36, 0x19, 0x86, 0x61, 0x8C, 0xC3, 0x30, 0x68, 0x1E,
+  0x07, 0x80, 0xC0, 0xC1, 0x07, 0x83, 0x0D, 0x86, 0x33, 0x14, 0x66, 0x28,
+  0xC4, 0x59, 0x0D, 0xB6, 0x1A, 0x2C, 0x14, 0x50, 0x38, 0x60, 0x20, 0x80,
+  0xC0, 0xD8, 0x63, 0x30, 0x78, 0x1E, 0x03, 0x01, 0xE0, 0xFC, 0x33, 0x18,
+  0x6C, 0x0C, 0xC1, 0xE0, 0xD8, 0xCC, 0x66, 0x31, 0xB0, 0xD8, 0x6C, 0x34,
+  0x0E, 0x07, 0x03, 0x01, 0x87, 0xC3, 0x80, 0x0E, 0x52, 0x42, 0x42, 0x42,
+  0x52, 0x42, 0x42, 0x5E, 0x0F, 0xFA };
+
+static const packedGlyph_t UbuntuRegular10pt7bGlyphs[] = {
+  {     0,   0,   1,   5,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,  11,  14,  13,    1,  -13, GLYPH_RAW },   // 0x23 '#'
+  {    20,  15,  14,  17,    1,  -13, GLYPH_RAW },   // 0x25 '%'
+  {    47,  11,  14,  13,    1,  -13, GLYPH_RAW },   // 0x26 '&'
+  {    67,   2,   5,   5,    2,  -15, GLYPH_RLE },   // 0x27 '\''
+  {    68,   9,   8,  10,    1,  -13, GLYPH_RAW },   // 0x2A '*'
+  {    77,  10,  10,  11,    1,  -10, GLYPH_RLE },   // 0x2B '+'
+  {    87,   3,   5,   5,    1,   -1, GLYPH_RAW },   // 0x2C ','
+  {    67,   5,   2,   7,    1,   -6, GLYPH_RLE },   // 0x2D '-'
+  {    89,   2,   3,   5,    1,   -2, GLYPH_RAW },   // 0x2E '.'
+  {    90,   8,  20,   8,    0,  -15, GLYPH_RAW },   // 0x2F '/'
+  {   110,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x30 '0'
+  {   126,   6,  14,  11,    1,  -13, GLYPH_RAW },   // 0x31 '1'
+  {   137,   8,  14,  11,    1,  -13, GLYPH_RAW },   // 0x32 '2'
+  {   151,   8,  14,  11,    1,  -13, GLYPH_RAW },   // 0x33 '3'
+  {   165,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x34 '4'
+  {   181,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x35 '5'
+  {   195,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x36 '6'
+  {   211,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x37 '7'
+  {   225,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x38 '8'
+  {   241,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x39 '9'
+  {   257,   2,  11,   5,    1,  -10, GLYPH_RLE },   // 0x3A ':'
+  {   259,   8,   9,  11,    2,   -9, GLYPH_RAW },   // 0x3E '>'
+  {   268,   6,  14,   8,    1,  -13, GLYPH_RAW },   // 0x3F '?'
+  {   279,  13,  14,  13,    0,  -13, GLYPH_RAW },   // 0x41 'A'
+  {   302,  10,  14,  13,    2,  -13, GLYPH_RAW },   // 0x42 'B'
+  {   320,  10,  14,  12,    1,  -13, GLYPH_RLE },   // 0x43 'C'
+  {   337,  11,  14,  14,    2,  -13, GLYPH_RLE },   // 0x44 'D'
+  {   356,   8,  14,  11,    2,  -13, GLYPH_RAW },   // 0x45 'E'
+  {   370,   8,  14,  11,    2,  -13, GLYPH_RLE },   // 0x46 'F'
+  {   383,  10,  14,  13,    1,  -13, GLYPH_RAW },   // 0x47 'G'
+  {   401,  10,  14,  14,    2,  -13, GLYPH_RLE },   // 0x48 'H'
+  {   415,   2,  14,   6,    2,  -13, GLYPH_RLE },   // 0x49 'I'
+  {   417,   8,  14,  10,    0,  -13, GLYPH_RAW },   // 0x4A 'J'
+  {   431,  10,  14,  13,    2,  -13, GLYPH_RAW },   // 0x4B 'K'
+  {   449,   8,  14,  10,    2,  -13, GLYPH_RAW },   // 0x4C 'L'
+  {   463,  16,  14,  18,    1,  -13, GLYPH_RAW },   // 0x4D 'M'
+  {   491,  11,  14,  15,    2,  -13, GLYPH_RAW },   // 0x4E 'N'
+  {   511,  14,  14,  16,    1,  -13, GLYPH_RLE },   // 0x4F 'O'
+  {   531,   9,  14,  12,    2,  -13, GLYPH_RLE },   // 0x50 'P'
+  {   546,  14,  18,  16,    1,  -13, GLYPH_RLE },   // 0x51 'Q'
+  {   570,  11,  14,  13,    2,  -13, GLYPH_RAW },   // 0x52 'R'
+  {   590,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x53 'S'
+  {   604,  10,  14,  10,    0,  -13, GLYPH_RLE },   // 0x54 'T'
+  {   618,  10,  14,  14,    2,  -13, GLYPH_RLE },   // 0x55 'U'
+  {   635,  13,  14,  13,    0,  -13, GLYPH_RAW },   // 0x56 'V'
+  {   658,  17,  14,  19,    1,  -13, GLYPH_RAW },   // 0x57 'W'
+  {   688,  13,  14,  13,    0,  -13, GLYPH_RAW },   // 0x58 'X'
+  {   711,  12,  14,  12,    0,  -13, GLYPH_RAW },   // 0x59 'Y'
+  {   732,   9,  14,  11,    1,  -13, GLYPH_RLE },   // 0x5A 'Z'
+  {   745,   8,  20,   8,    0,  -15, GLYPH_RAW },   // 0x5C '\\'
+  {   765,  10,   2,  10,    0,    3, GLYPH_RLE },   // 0x5F '_'
+  {   767,   7,  11,  10,    1,  -10, GLYPH_RAW },   // 0x61 'a'
+  {   777,   9,  15,  12,    2,  -14, GLYPH_RAW },   // 0x62 'b'
+  {   794,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x63 'c'
+  {   805,   9,  15,  12,    1,  -14, GLYPH_RAW },   // 0x64 'd'
+  {   822,   9,  11,  11,    1,  -10, GLYPH_RLE },   // 0x65 'e'
+  {   833,   6,  15,   8,    2,  -14, GLYPH_RAW },   // 0x66 'f'
+  {   845,   9,  15,  12,    1,  -10, GLYPH_RAW },   // 0x67 'g'
+  {   862,   8,  15,  12,    2,  -14, GLYPH_RAW },   // 0x68 'h'
+  {   877,   2,  15,   6,    2,  -14, GLYPH_RLE },   // 0x69 'i'
+  {   880,   5,  19,   6,   -1,  -14, GLYPH_RAW },   // 0x6A 'j'
+  {   892,   8,  15,  10,    2,  -14, GLYPH_RAW },   // 0x6B 'k'
+  {   907,   4,  15,   6,    2,  -14, GLYPH_RAW },   // 0x6C 'l'
+  {   915,  14,  11,  18,    2,  -10, GLYPH_RAW },   // 0x6D 'm'
+  {   935,   8,  11,  12,    2,  -10, GLYPH_RAW },   // 0x6E 'n'
+  {   946,  10,  11,  12,    1,  -10, GLYPH_RAW },   // 0x6F 'o'
+  {   960,   9,  15,  12,    2,  -10, GLYPH_RAW },   // 0x70 'p'
+  {   977,   9,  15,  12,    1,  -10, GLYPH_RAW },   // 0x71 'q'
+  {   994,   6,  11,   8,    2,  -10, GLYPH_RAW },   // 0x72 'r'
+  {  1003,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x73 's'
+  {  1013,   5,  14,   8,    2,  -13, GLYPH_RAW },   // 0x74 't'
+  {  1022,   8,  11,  12,    2,  -10, GLYPH_RAW },   // 0x75 'u'
+  {  1033,  10,  11,  10,    0,  -10, GLYPH_RAW },   // 0x76 'v'
+  {  1047,  15,  11,  15,    0,  -10, GLYPH_RAW },   // 0x77 'w'
+  {  1068,  10,  11,  10,    0,  -10, GLYPH_RAW },   // 0x78 'x'
+  {  1082,   9,  15,   9,    0,  -10, GLYPH_RAW },   // 0x79 'y'
+  {  1099,   7,  11,   9,    1,  -10, GLYPH_RLE },   // 0x7A 'z'
+  {  1108,   2,  20,   6,    2,  -15, GLYPH_RLE } }; // 0x7C '|'
+
+static const uint8_t UbuntuRegular10pt7bIndex[] = {
+    0,   0,   0,   1,   0,   2,   3,   4,   0,   0,   5,   6,
+    7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+   19,  20,  21,   0,   0,   0,  22,  23,   0,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+   39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,   0,
+   50,   0,   0,  51,   0,  52,  53,  54,  55,  56,  57,  58,
+   59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+   71,  72,  73,  74,  75,  76,  77,   0,  78,   0,   0 };
+
+static const packedFont_t UbuntuRegular10pt7b = {
+  UbuntuRegular10pt7bData,
+  UbuntuRegular10pt7bGlyphs,
+  UbuntuRegular10pt7bIndex,
+  0x20, 0x7E, 23 };
+
+// 79 glyphs, 1110 bytes of glyph data
@@ -0,0 +1,228 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/UbuntuRegular12pt7b.h
+
+static const uint8_t UbuntuRegular12pt7bData[] = {
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x86, 0x0C, 0xFF, 0xFF, 0xFF, 0xF1, 0x83,
+  0x06, 0x0C, 0x38, 0x70, 0xC1, 0x83, 0x06, 0x3F, 0xFF, 0xFF, 0xFC, 0xC1,
+  0x86, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x3C, 0x03, 0x0F, 0xC0, 0xC3, 0x9C,
+  0x30, 0x61, 0x86, 0x0C, 0x31, 0x81, 0x86, 0x60, 0x30, 0xCC, 0x07, 0x3B,
+  0x3C, 0x7E, 0xEF, 0xC7, 0x9B, 0x9C, 0x06, 0x61, 0x80, 0xCC, 0x30, 0x31,
+  0x86, 0x0C, 0x30, 0xC1, 0x87, 0x38, 0x60, 0x7E, 0x18, 0x07, 0x80, 0x0F,
+  0x00, 0x7E, 0x03, 0x9C, 0x0C, 0x30, 0x30, 0xC0, 0xC7, 0x01, 0x98, 0x07,
+  0xC0, 0x1E, 0x01, 0xFC, 0x36, 0x38, 0xF0, 0x66, 0xC0, 0xD3, 0x01, 0xCE,
+  0x07, 0x1F, 0xF6, 0x1F, 0x0C, 0x0C, 0x1C, 0x0E, 0x36, 0x7D, 0xF3, 0xE0,
+  0xA0, 0xD8, 0xEE, 0x22, 0x00, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x95,
+  0x2A, 0x2A, 0x2A, 0x2A, 0x25, 0x6D, 0xB5, 0xB0, 0x09, 0x92, 0x82, 0x92,
+  0x92, 0x82, 0x92, 0x82, 0x92, 0x92, 0x82, 0x92, 0x83, 0x82, 0x92, 0x82,
+  0x92, 0x92, 0x82, 0x92, 0x82, 0x92, 0x92, 0x82, 0x90, 0x44, 0x68, 0x33,
+  0x43, 0x22, 0x62, 0x13, 0x62, 0x12, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x85, 0x63, 0x12, 0x62, 0x23, 0x43, 0x38, 0x64, 0x40, 0x0C, 0x77, 0xFB,
+  0xCC, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x26, 0x48,
+  0x23, 0x43, 0x92, 0x92, 0x92, 0x82, 0x83, 0x73, 0x73, 0x73, 0x73, 0x82,
+  0x82, 0x82, 0x9F, 0x70, 0x25, 0x49, 0x31, 0x53, 0x92, 0x92, 0x92, 0x82,
+  0x56, 0x56, 0x93, 0x93, 0x92, 0x92, 0x93, 0x63, 0x1A, 0x27, 0x30, 0x73,
+  0x93, 0x84, 0x75, 0x63, 0x12, 0x53, 0x22, 0x52, 0x32, 0x42, 0x42, 0x33,
+  0x42, 0x32, 0x52, 0x22, 0x62, 0x2F, 0x98, 0x2A, 0x2A, 0x2A, 0x22, 0x27,
+  0x37, 0x32, 0x82, 0x82, 0x82, 0x75, 0x57, 0x74, 0x83, 0x82, 0x82, 0x82,
+  0x83, 0x53, 0x19, 0x26, 0x30, 0x64, 0x56, 0x43, 0x72, 0x82, 0x92, 0x82,
+  0x15, 0x3A, 0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x72, 0x12, 0x53, 0x13,
+  0x33, 0x37, 0x55, 0x30, 0x0F, 0x79, 0x28, 0x28, 0x29, 0x28, 0x29, 0x28,
+  0x29, 0x28, 0x29, 0x29, 0x29, 0x28, 0x29, 0x29, 0x26, 0x36, 0x4A, 0x22,
+  0x62, 0x12, 0x84, 0x84, 0x82, 0x13, 0x52, 0x25, 0x13, 0x56, 0x52, 0x25,
+  0x22, 0x53, 0x12, 0x84, 0x84, 0x85, 0x63, 0x1A, 0x46, 0x30, 0x35, 0x48,
+  0x32, 0x43, 0x12, 0x62, 0x12, 0x74, 0x74, 0x75, 0x62, 0x1A, 0x35, 0x12,
+  0x83, 0x82, 0x83, 0x73, 0x64, 0x46, 0x54, 0x60, 0x09, 0xF6, 0x90, 0x11,
+  0x94, 0x95, 0x85, 0x94, 0x92, 0x74, 0x45, 0x45, 0x44, 0x81, 0x90, 0x15,
+  0x27, 0x63, 0x62, 0x62, 0x62, 0x52, 0x52, 0x52, 0x53, 0x52, 0x62, 0xF7,
+  0x26, 0x26, 0x24, 0x63, 0xC3, 0xC3, 0xB2, 0x12, 0xA2, 0x12, 0x93, 0x13,
+  0x82, 0x32, 0x82, 0x32, 0x72, 0x52, 0x62, 0x52, 0x53, 0x52, 0x5B, 0x4B,
+  0x32, 0x92, 0x22, 0x92, 0x22, 0x92, 0x12, 0xB2, 0x08, 0x4A, 0x22, 0x54,
+  0x12, 0x72, 0x12, 0x72, 0x12, 0x72, 0x12, 0x62, 0x29, 0x3A, 0x22, 0x63,
+  0x12, 0x84, 0x84, 0x84, 0x75, 0x63, 0x1A, 0x28, 0x40, 0x57, 0x4A, 0x23,
+  0x62, 0x13, 0xA2, 0xA3, 0xA2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xB2, 0xB3,
+  0xB3, 0x62, 0x3A, 0x57, 0x10, 0x08, 0x6B, 0x32, 0x64, 0x22, 0x83, 0x12,
+  0x92, 0x12, 0x95, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x95, 0x92, 0x12, 0x83,
+  0x12, 0x64, 0x2B, 0x38, 0x60, 0x0A, 0x1A, 0x12, 0x92, 0x92, 0x92, 0x92,
+  0x9A, 0x1A, 0x12, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9F, 0x70, 0x0F, 0x78,
+  0x28, 0x28, 0x28, 0x28, 0x91, 0x91, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x57, 0x4A, 0x23, 0x61, 0x23, 0xA2, 0xA3, 0xA2, 0xB2, 0xB2,
+  0xB2, 0x94, 0x94, 0x92, 0x12, 0x82, 0x13, 0x72, 0x23, 0x62, 0x3A, 0x57,
+  0x10, 0x02, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9F, 0xF0, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x0F, 0xF4, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x11, 0x52,
+  0x19, 0x35, 0x30, 0xC0, 0x66, 0x06, 0x30, 0x61, 0x86, 0x0C, 0x60, 0x66,
+  0x03, 0x60, 0x1E, 0x00, 0xF8, 0x06, 0xF0, 0x33, 0xC1, 0x8F, 0x0C, 0x3C,
+  0x60, 0xE3, 0x03, 0x98, 0x0E, 0xC0, 0x38, 0x02, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8F, 0x50,
+  0x60, 0x01, 0x9C, 0x00, 0xE7, 0x00, 0x39, 0xE0, 0x1E, 0x68, 0x05, 0x9B,
+  0x03, 0x6E, 0x40, 0x9B, 0x18, 0x63, 0xC6, 0x10, 0xF0, 0xCC, 0x3C, 0x33,
+  0x0F, 0x04, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x0C, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xC0, 0x02, 0x95, 0x86, 0x77, 0x64, 0x12, 0x64, 0x22, 0x54,
+  0x23, 0x44, 0x33, 0x34, 0x42, 0x34, 0x52, 0x24, 0x53, 0x14, 0x62, 0x14,
+  0x76, 0x85, 0x85, 0x94, 0xA1, 0x56, 0x8A, 0x53, 0x63, 0x33, 0x83, 0x22,
+  0xA2, 0x13, 0xA5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xA3, 0x12, 0xA2, 0x23,
+  0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0x08, 0x4A, 0x22, 0x63, 0x12, 0x75,
+  0x84, 0x84, 0x84, 0x75, 0x63, 0x1A, 0x28, 0x42, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA0, 0x57, 0x8B, 0x54, 0x54, 0x33, 0x93, 0x22, 0xB2, 0x13, 0xB5,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x34, 0x54,
+  0x5A, 0x96, 0xE2, 0xF1, 0x4E, 0x5E, 0x32, 0xFF, 0x07, 0xFE, 0x30, 0x39,
+  0x80, 0x6C, 0x03, 0x60, 0x1B, 0x00, 0xD8, 0x1C, 0xFF, 0xC7, 0xFC, 0x30,
+  0x61, 0x81, 0x8C, 0x0E, 0x60, 0x33, 0x00, 0xD8, 0x07, 0xC0, 0x18, 0x36,
+  0x39, 0x13, 0x51, 0x22, 0x92, 0x93, 0x94, 0x84, 0x94, 0x94, 0x93, 0x92,
+  0x92, 0x94, 0x6D, 0x36, 0x30, 0x0F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x25, 0x02, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92,
+  0x12, 0x72, 0x23, 0x53, 0x39, 0x65, 0x40, 0x02, 0xC2, 0x12, 0xA2, 0x22,
+  0xA2, 0x22, 0xA2, 0x32, 0x82, 0x42, 0x82, 0x43, 0x63, 0x52, 0x62, 0x62,
+  0x62, 0x72, 0x42, 0x82, 0x42, 0x92, 0x22, 0xA2, 0x22, 0xA6, 0xB4, 0xC4,
+  0xD2, 0x70, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x0C, 0x0E, 0xC0, 0xE0,
+  0x66, 0x07, 0x03, 0x30, 0x38, 0x19, 0x83, 0x61, 0xCE, 0x1B, 0x0C, 0x30,
+  0xDC, 0x61, 0x8C, 0x63, 0x0C, 0x63, 0x18, 0x77, 0x1D, 0x81, 0xB0, 0x6C,
+  0x0D, 0x83, 0x60, 0x78, 0x1F, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x03,
+  0x83, 0x12, 0x82, 0x32, 0x62, 0x43, 0x43, 0x52, 0x42, 0x72, 0x22, 0x86,
+  0x94, 0xB2, 0xB4, 0x96, 0x82, 0x22, 0x72, 0x42, 0x53, 0x43, 0x33, 0x62,
+  0x32, 0x82, 0x13, 0x83, 0x02, 0xA2, 0x12, 0x82, 0x23, 0x63, 0x32, 0x62,
+  0x52, 0x42, 0x62, 0x42, 0x72, 0x22, 0x86, 0x94, 0xB2, 0xC2, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0x60, 0x0F, 0x99, 0x39, 0x29, 0x29, 0x29, 0x29,
+  0x39, 0x29, 0x29, 0x29, 0x39, 0x29, 0x29, 0x39, 0xF9, 0x02, 0xA2, 0x92,
+  0x92, 0xA2, 0x92, 0xA2, 0x92, 0x92, 0xA2, 0x92, 0x93, 0x92, 0x92, 0xA2,
+  0x92, 0x92, 0xA2, 0x92, 0xA2, 0x92, 0x92, 0xA2, 0x0F, 0x90, 0x17, 0x38,
+  0x83, 0x82, 0x82, 0x28, 0x1C, 0x54, 0x64, 0x65, 0x52, 0x19, 0x28, 0x02,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x15, 0x39, 0x23, 0x43, 0x12, 0x62, 0x12,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x12, 0x53, 0x19, 0x27, 0x40, 0x46,
+  0x28, 0x13, 0x72, 0x72, 0x82, 0x82, 0x82, 0x82, 0x92, 0x83, 0x88, 0x46,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x35, 0x12, 0x29, 0x13, 0x43, 0x12, 0x64,
+  0x74, 0x74, 0x74, 0x74, 0x72, 0x12, 0x62, 0x13, 0x52, 0x29, 0x46, 0x10,
+  0x35, 0x58, 0x23, 0x42, 0x22, 0x64, 0x7F, 0xB9, 0x29, 0x39, 0x35, 0x13,
+  0x84, 0x62, 0x3E, 0xFF, 0x86, 0x0C, 0x1F, 0xBF, 0x60, 0xC1, 0x83, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x80, 0x46, 0x39, 0x13, 0x52, 0x12, 0x64,
+  0x74, 0x74, 0x74, 0x74, 0x75, 0x62, 0x13, 0x43, 0x29, 0x35, 0x12, 0x92,
+  0x11, 0x62, 0x29, 0x36, 0x30, 0x02, 0x82, 0x82, 0x82, 0x82, 0x87, 0x39,
+  0x12, 0x52, 0x12, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x62, 0x04, 0x6F, 0xB0, 0x0C, 0x30, 0x00, 0x00, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC7, 0xFB, 0xC0, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x01, 0x81, 0xB0, 0x66, 0x38, 0xCE, 0x1B, 0x03, 0xC0,
+  0x7C, 0x0D, 0xE1, 0x8C, 0x30, 0xC6, 0x0C, 0xC0, 0xD8, 0x0C, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF7, 0x17, 0x26, 0x2F, 0x21, 0x25,
+  0x35, 0x56, 0x26, 0x46, 0x26, 0x46, 0x26, 0x46, 0x26, 0x46, 0x26, 0x46,
+  0x26, 0x46, 0x26, 0x46, 0x26, 0x46, 0x26, 0x46, 0x26, 0x20, 0x17, 0x29,
+  0x12, 0x52, 0x12, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x62, 0x44, 0x68, 0x33, 0x43, 0x22, 0x62, 0x12, 0x84, 0x84, 0x84, 0x84,
+  0x82, 0x12, 0x62, 0x23, 0x43, 0x38, 0x55, 0x40, 0x16, 0x49, 0x22, 0x53,
+  0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x13, 0x43, 0x19,
+  0x22, 0x15, 0x32, 0x92, 0x92, 0x92, 0x90, 0x46, 0x39, 0x13, 0x52, 0x12,
+  0x64, 0x74, 0x74, 0x74, 0x74, 0x72, 0x12, 0x62, 0x13, 0x43, 0x29, 0x35,
+  0x12, 0x92, 0x92, 0x92, 0x92, 0x7F, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0C, 0x00, 0x26, 0x27, 0x13, 0x41, 0x12, 0x73, 0x74,
+  0x65, 0x64, 0x73, 0x73, 0x5B, 0x26, 0x20, 0xC1, 0x83, 0x06, 0x0F, 0xFF,
+  0xF0, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x38, 0xBF, 0x3E, 0x02, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x12, 0x52, 0x19,
+  0x37, 0xC0, 0x3E, 0x07, 0x60, 0x66, 0x06, 0x70, 0xE3, 0x0C, 0x30, 0xC1,
+  0x98, 0x19, 0x81, 0xF8, 0x0F, 0x00, 0xF0, 0x06, 0x00, 0xC0, 0x40, 0x78,
+  0x1C, 0x0D, 0x83, 0x83, 0x30, 0x70, 0x66, 0x1B, 0x0C, 0x63, 0x63, 0x0C,
+  0x6C, 0x61, 0x9D, 0xCC, 0x1B, 0x1B, 0x03, 0x63, 0x60, 0x7C, 0x7C, 0x07,
+  0x07, 0x00, 0xE0, 0xE0, 0xE0, 0x76, 0x06, 0x30, 0xC1, 0x98, 0x1F, 0x80,
+  0xF0, 0x06, 0x00, 0xF0, 0x1F, 0x83, 0x9C, 0x30, 0xC6, 0x06, 0xE0, 0x70,
+  0xC0, 0x7C, 0x19, 0x83, 0x30, 0x67, 0x18, 0x63, 0x0C, 0x61, 0xD8, 0x1B,
+  0x03, 0x60, 0x78, 0x07, 0x00, 0xE0, 0x18, 0x07, 0x07, 0xC0, 0xF0, 0x00,
+  0x0F, 0x36, 0x35, 0x36, 0x26, 0x26, 0x26, 0x36, 0x26, 0x26, 0x36, 0xF3,
+  0x0F, 0xFF, 0x10 };
+
+static const packedGlyph_t UbuntuRegular12pt7bGlyphs[] = {
+  {     0,   0,   1,   6,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,  14,  17,  16,    1,  -16, GLYPH_RAW },   // 0x23 '#'
+  {    30,  19,  17,  21,    1,  -16, GLYPH_RAW },   // 0x25 '%'
+  {    71,  14,  17,  16,    1,  -16, GLYPH_RAW },   // 0x26 '&'
+  {   101,   2,   6,   6,    2,  -18, GLYPH_RLE },   // 0x27 '\''
+  {   102,   9,   9,  12,    2,  -16, GLYPH_RAW },   // 0x2A '*'
+  {   113,  12,  12,  14,    1,  -12, GLYPH_RLE },   // 0x2B '+'
+  {   125,   3,   7,   6,    1,   -2, GLYPH_RAW },   // 0x2C ','
+  {   101,   6,   2,   8,    1,   -7, GLYPH_RLE },   // 0x2D '-'
+  {   128,   3,   3,   6,    1,   -2, GLYPH_RLE },   // 0x2E '.'
+  {   129,  11,  23,   9,   -1,  -18, GLYPH_RLE },   // 0x2F '/'
+  {   153,  12,  17,  14,    1,  -16, GLYPH_RLE },   // 0x30 '0'
+  {   177,   6,  17,  14,    3,  -16, GLYPH_RAW },   // 0x31 '1'
+  {   190,  11,  17,  14,    2,  -16, GLYPH_RLE },   // 0x32 '2'
+  {   208,  11,  17,  14,    1,  -16, GLYPH_RLE },   // 0x33 '3'
+  {   227,  12,  17,  14,    1,  -16, GLYPH_RLE },   // 0x34 '4'
+  {   251,  10,  17,  14,    2,  -16, GLYPH_RLE },   // 0x35 '5'
+  {   269,  11,  17,  14,    2,  -16, GLYPH_RLE },   // 0x36 '6'
+  {   292,  11,  17,  14,    1,  -16, GLYPH_RLE },   // 0x37 '7'
+  {   309,  12,  17,  14,    1,  -16, GLYPH_RLE },   // 0x38 '8'
+  {   334,  11,  17,  14,    1,  -16, GLYPH_RLE },   // 0x39 '9'
+  {   356,   3,  13,   6,    1,  -12, GLYPH_RLE },   // 0x3A ':'
+  {   359,  11,  11,  14,    1,  -12, GLYPH_RLE },   // 0x3E '>'
+  {   371,   8,  17,  10,    1,  -16, GLYPH_RLE },   // 0x3F '?'
+  {   387,  15,  17,  15,    0,  -16, GLYPH_RLE },   // 0x41 'A'
+  {   416,  12,  17,  15,    2,  -16, GLYPH_RLE },   // 0x42 'B'
+  {   441,  13,  17,  15,    1,  -16, GLYPH_RLE },   // 0x43 'C'
+  {   461,  14,  17,  17,    2,  -16, GLYPH_RLE },   // 0x44 'D'
+  {   485,  11,  17,  14,    2,  -16, GLYPH_RLE },   // 0x45 'E'
+  {   502,  10,  17,  13,    2,  -16, GLYPH_RLE },   // 0x46 'F'
+  {   518,  13,  17,  16,    1,  -16, GLYPH_RLE },   // 0x47 'G'
+  {   541,  13,  17,  17,    2,  -16, GLYPH_RLE },   // 0x48 'H'
+  {   558,   2,  17,   6,    2,  -16, GLYPH_RLE },   // 0x49 'I'
+  {   560,  10,  17,  12,    0,  -16, GLYPH_RLE },   // 0x4A 'J'
+  {   579,  13,  17,  15,    2,  -16, GLYPH_RAW },   // 0x4B 'K'
+  {   607,  10,  17,  12,    2,  -16, GLYPH_RLE },   // 0x4C 'L'
+  {   624,  18,  17,  20,    1,  -16, GLYPH_RAW },   // 0x4D 'M'
+  {   663,  13,  17,  17,    2,  -16, GLYPH_RLE },   // 0x4E 'N'
+  {   689,  16,  17,  18,    1,  -16, GLYPH_RLE },   // 0x4F 'O'
+  {   714,  12,  17,  15,    2,  -16, GLYPH_RLE },   // 0x50 'P'
+  {   734,  17,  21,  19,    1,  -16, GLYPH_RLE },   // 0x51 'Q'
+  {   763,  13,  17,  15,    2,  -16, GLYPH_RAW },   // 0x52 'R'
+  {   791,  11,  17,  13,    1,  -16, GLYPH_RLE },   // 0x53 'S'
+  {   809,  12,  17,  12,    0,  -16, GLYPH_RLE },   // 0x54 'T'
+  {   826,  13,  17,  17,    2,  -16, GLYPH_RLE },   // 0x55 'U'
+  {   847,  16,  17,  16,    0,  -16, GLYPH_RLE },   // 0x56 'V'
+  {   878,  21,  17,  23,    1,  -16, GLYPH_RAW },   // 0x57 'W'
+  {   923,  14,  17,  15,    1,  -16, GLYPH_RLE },   // 0x58 'X'
+  {   952,  14,  17,  14,    0,  -16, GLYPH_RLE },   // 0x59 'Y'
+  {   977,  12,  17,  14,    1,  -16, GLYPH_RLE },   // 0x5A 'Z'
+  {   993,  11,  23,   9,   -1,  -18, GLYPH_RLE },   // 0x5C '\\'
+  {  1016,  12,   2,  12,    0,    3, GLYPH_RLE },   // 0x5F '_'
+  {  1018,  10,  13,  13,    1,  -12, GLYPH_RLE },   // 0x61 'a'
+  {  1031,  11,  18,  14,    2,  -17, GLYPH_RLE },   // 0x62 'b'
+  {  1055,  10,  13,  11,    1,  -12, GLYPH_RLE },   // 0x63 'c'
+  {  1068,  11,  18,  14,    1,  -17, GLYPH_RLE },   // 0x64 'd'
+  {  1092,  11,  13,  13,    1,  -12, GLYPH_RLE },   // 0x65 'e'
+  {  1106,   7,  18,   9,    2,  -17, GLYPH_RAW },   // 0x66 'f'
+  {  1122,  11,  17,  14,    1,  -12, GLYPH_RLE },   // 0x67 'g'
+  {  1145,  10,  18,  14,    2,  -17, GLYPH_RLE },   // 0x68 'h'
+  {  1165,   2,  18,   6,    2,  -17, GLYPH_RLE },   // 0x69 'i'
+  {  1168,   6,  22,   6,   -2,  -17, GLYPH_RAW },   // 0x6A 'j'
+  {  1185,  11,  18,  13,    2,  -17, GLYPH_RAW },   // 0x6B 'k'
+  {  1210,   4,  18,   7,    2,  -17, GLYPH_RAW },   // 0x6C 'l'
+  {  1219,  18,  13,  22,    2,  -12, GLYPH_RLE },   // 0x6D 'm'
+  {  1246,  10,  13,  14,    2,  -12, GLYPH_RLE },   // 0x6E 'n'
+  {  1261,  12,  13,  14,    1,  -12, GLYPH_RLE },   // 0x6F 'o'
+  {  1280,  11,  17,  14,    2,  -12, GLYPH_RLE },   // 0x70 'p'
+  {  1303,  11,  17,  14,    1,  -12, GLYPH_RLE },   // 0x71 'q'
+  {  1325,   7,  13,   9,    2,  -12, GLYPH_RAW },   // 0x72 'r'
+  {  1337,   9,  13,  11,    1,  -12, GLYPH_RLE },   // 0x73 's'
+  {  1351,   7,  17,  10,    2,  -16, GLYPH_RAW },   // 0x74 't'
+  {  1366,  10,  13,  14,    2,  -12, GLYPH_RLE },   // 0x75 'u'
+  {  1381,  12,  13,  12,    0,  -12, GLYPH_RAW },   // 0x76 'v'
+  {  1401,  19,  13,  19,    0,  -12, GLYPH_RAW },   // 0x77 'w'
+  {  1432,  12,  13,  12,    0,  -12, GLYPH_RAW },   // 0x78 'x'
+  {  1452,  11,  17,  11,    0,  -12, GLYPH_RAW },   // 0x79 'y'
+  {  1476,   9,  13,  11,    1,  -12, GLYPH_RLE },   // 0x7A 'z'
+  {  1488,   2,  23,   7,    2,  -18, GLYPH_RLE } }; // 0x7C '|'
+
+static const uint8_t UbuntuRegular12pt7bIndex[] = {
+    0,   0,   0,   1,   0,   2,   3,   4,   0,   0,   5,   6,
+    7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+   19,  20,  21,   0,   0,   0,  22,  23,   0,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+   39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,   0,
+   50,   0,   0,  51,   0,  52,  53,  54,  55,  56,  57,  58,
+   59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+   71,  72,  73,  74,  75,  76,  77,   0,  78,   0,   0 };
+
+static const packedFont_t UbuntuRegular12pt7b = {
+  UbuntuRegular12pt7bData,
+  UbuntuRegular12pt7bGlyphs,
+  UbuntuRegular12pt7bIndex,
+  0x20, 0x7E, 27 };
+
+// 79 glyphs, 1491 bytes of glyph data
@@ -0,0 +1,268 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/UbuntuRegular16pt7b.h
+
+static const uint8_t UbuntuRegular16pt7bData[] = {
+  0x63, 0x33, 0x83, 0x33, 0x83, 0x24, 0x73, 0x33, 0x83, 0x33, 0x83, 0x33,
+  0x3F, 0xFF, 0x64, 0x33, 0x38, 0x33, 0x38, 0x33, 0x34, 0xFF, 0xF6, 0x33,
+  0x33, 0x83, 0x33, 0x83, 0x33, 0x74, 0x23, 0x83, 0x33, 0x83, 0x33, 0x60,
+  0x25, 0xA2, 0x57, 0x82, 0x62, 0x32, 0x72, 0x62, 0x52, 0x62, 0x62, 0x52,
+  0x52, 0x72, 0x52, 0x43, 0x72, 0x52, 0x42, 0x82, 0x52, 0x32, 0xA2, 0x32,
+  0x42, 0xA7, 0x32, 0xC5, 0x33, 0x35, 0xC2, 0x37, 0xA2, 0x42, 0x32, 0xA2,
+  0x32, 0x52, 0x82, 0x42, 0x52, 0x73, 0x42, 0x52, 0x72, 0x52, 0x52, 0x62,
+  0x62, 0x52, 0x62, 0x72, 0x32, 0x62, 0x87, 0x52, 0xA5, 0x20, 0x56, 0xC9,
+  0x9A, 0x84, 0x44, 0x73, 0x63, 0x73, 0x63, 0x73, 0x54, 0x82, 0x35, 0x99,
+  0xB6, 0xC6, 0xC7, 0x72, 0x25, 0x14, 0x43, 0x14, 0x44, 0x33, 0x13, 0x64,
+  0x13, 0x23, 0x86, 0x23, 0x94, 0x34, 0x75, 0x4F, 0x14, 0xB2, 0x35, 0x75,
+  0x30, 0xFF, 0xFF, 0xFA, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x8E, 0x2F, 0x27,
+  0xBF, 0xF8, 0x1C, 0x01, 0xB0, 0x1D, 0xC0, 0xEE, 0x0E, 0x38, 0x11, 0x00,
+  0x62, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x6F, 0xD6, 0x2C, 0x2C, 0x2C, 0x2C,
+  0x2C, 0x26, 0x77, 0x77, 0x76, 0x6E, 0x40, 0xFF, 0xFF, 0x6F, 0xF6, 0xC2,
+  0xB2, 0xC2, 0xC2, 0xB2, 0xC2, 0xB2, 0xC2, 0xC2, 0xB2, 0xC2, 0xB2, 0xC2,
+  0xC2, 0xB2, 0xC2, 0xB2, 0xC2, 0xC2, 0xB2, 0xC2, 0xB2, 0xC2, 0xC2, 0xB2,
+  0xC2, 0xB2, 0xC2, 0xC2, 0xB2, 0xC0, 0x45, 0x77, 0x59, 0x34, 0x34, 0x23,
+  0x53, 0x23, 0x53, 0x13, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+  0x73, 0x13, 0x53, 0x23, 0x53, 0x24, 0x34, 0x39, 0x57, 0x75, 0x40, 0x63,
+  0x45, 0x2F, 0x52, 0x31, 0x14, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x30, 0x36, 0x59, 0x3B,
+  0x33, 0x44, 0x21, 0x73, 0xA3, 0xA3, 0xA3, 0x93, 0x93, 0x93, 0x93, 0xA2,
+  0xA3, 0x93, 0x93, 0x93, 0xA3, 0x9F, 0xF9, 0x36, 0x4B, 0x2B, 0x32, 0x54,
+  0xA3, 0xA3, 0xA3, 0x93, 0x66, 0x76, 0x77, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3,
+  0x96, 0x64, 0x1C, 0x1B, 0x47, 0x40, 0x93, 0xB4, 0xA5, 0x96, 0x87, 0x83,
+  0x13, 0x73, 0x23, 0x63, 0x33, 0x63, 0x33, 0x53, 0x43, 0x43, 0x53, 0x43,
+  0x53, 0x33, 0x63, 0x3F, 0xFF, 0x09, 0x3C, 0x3C, 0x3C, 0x3C, 0x33, 0x2A,
+  0x3A, 0x3A, 0x33, 0xA3, 0xA3, 0xA3, 0x97, 0x69, 0x4A, 0x86, 0xA4, 0xA3,
+  0xA3, 0xA3, 0xA3, 0x96, 0x64, 0x1C, 0x1B, 0x47, 0x40, 0x84, 0x67, 0x58,
+  0x45, 0x74, 0x93, 0x93, 0xA2, 0x15, 0x4B, 0x2C, 0x14, 0x44, 0x13, 0x67,
+  0x76, 0x76, 0x76, 0x73, 0x13, 0x54, 0x14, 0x34, 0x3A, 0x39, 0x65, 0x40,
+  0x0F, 0xF9, 0xA3, 0x93, 0x93, 0xA3, 0x93, 0xA3, 0x93, 0xA3, 0x93, 0xA3,
+  0xA3, 0x93, 0xA3, 0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0x70, 0x45, 0x77, 0x59,
+  0x34, 0x34, 0x23, 0x53, 0x23, 0x53, 0x23, 0x53, 0x23, 0x53, 0x33, 0x33,
+  0x49, 0x57, 0x59, 0x33, 0x35, 0x13, 0x67, 0x76, 0x76, 0x77, 0x54, 0x1B,
+  0x39, 0x57, 0x30, 0x45, 0x69, 0x3A, 0x34, 0x34, 0x14, 0x53, 0x13, 0x76,
+  0x76, 0x76, 0x77, 0x54, 0x1C, 0x2B, 0x36, 0x13, 0x93, 0xA3, 0x94, 0x84,
+  0x75, 0x48, 0x57, 0x64, 0x80, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xF6, 0x11, 0xD5, 0xC5, 0xC6, 0xC5, 0xC6, 0xC3, 0x96, 0x75, 0x76, 0x75,
+  0x85, 0xB1, 0xD0, 0x26, 0x3A, 0x21, 0x53, 0x93, 0x83, 0x83, 0x74, 0x73,
+  0x64, 0x64, 0x73, 0x73, 0x83, 0x83, 0xFF, 0xB3, 0x83, 0x83, 0x83, 0x50,
+  0x93, 0xF2, 0x5F, 0x15, 0xF0, 0x31, 0x3E, 0x31, 0x3D, 0x33, 0x3C, 0x33,
+  0x3C, 0x33, 0x3B, 0x35, 0x3A, 0x35, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37,
+  0x37, 0xF0, 0x6F, 0x05, 0xF2, 0x43, 0xB3, 0x33, 0xD3, 0x23, 0xD3, 0x23,
+  0xD3, 0x13, 0xF0, 0x30, 0x0A, 0x5C, 0x3D, 0x23, 0x65, 0x13, 0x83, 0x13,
+  0x83, 0x13, 0x83, 0x13, 0x64, 0x2C, 0x3C, 0x3D, 0x23, 0x74, 0x13, 0x87,
+  0x96, 0x96, 0x96, 0x87, 0x74, 0x1E, 0x1D, 0x2A, 0x50, 0x77, 0x6C, 0x3D,
+  0x25, 0x62, 0x34, 0xB4, 0xC3, 0xC3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xE3, 0xD3, 0xD4, 0xD5, 0x62, 0x4D, 0x4C, 0x68, 0x20, 0x0A, 0x7C, 0x5E,
+  0x33, 0x66, 0x23, 0x84, 0x23, 0x94, 0x13, 0xA3, 0x13, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xB6, 0xB6, 0xB6, 0xA3, 0x13, 0x94, 0x13, 0x84, 0x23, 0x66, 0x2E,
+  0x3C, 0x5A, 0x70, 0x0D, 0x1D, 0x1D, 0x13, 0xB3, 0xB3, 0xB3, 0xB3, 0xBC,
+  0x2C, 0x2C, 0x23, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBF, 0xFC, 0x0F,
+  0xFC, 0xA3, 0xA3, 0xA3, 0xA3, 0xAC, 0x1C, 0x1C, 0x13, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA0, 0x77, 0x6C, 0x3D, 0x25, 0x62,
+  0x33, 0xC4, 0xC3, 0xC3, 0xD3, 0xD3, 0xD3, 0xD3, 0xA6, 0xA6, 0xA3, 0x13,
+  0x93, 0x13, 0x93, 0x14, 0x83, 0x25, 0x63, 0x3D, 0x4C, 0x68, 0x20, 0x03,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xAF, 0xFF, 0x9A, 0x6A, 0x6A,
+  0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x30, 0x0F, 0xFF, 0xF3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0xA3, 0xA3, 0x94, 0x12, 0x54, 0x1C, 0x1B, 0x56, 0x40, 0x03, 0x93,
+  0x23, 0x83, 0x33, 0x73, 0x43, 0x63, 0x53, 0x53, 0x63, 0x43, 0x73, 0x33,
+  0x83, 0x23, 0x93, 0x13, 0xA6, 0xB7, 0xA3, 0x14, 0x93, 0x24, 0x83, 0x34,
+  0x73, 0x45, 0x53, 0x64, 0x43, 0x73, 0x43, 0x74, 0x33, 0x84, 0x23, 0x94,
+  0x13, 0xA4, 0x03, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x9F, 0xF6, 0x23, 0xF0,
+  0x34, 0x4D, 0x44, 0x4D, 0x43, 0x6B, 0x53, 0x31, 0x39, 0x31, 0x32, 0x32,
+  0x29, 0x22, 0x32, 0x32, 0x37, 0x32, 0x32, 0x33, 0x27, 0x23, 0x32, 0x33,
+  0x26, 0x33, 0x32, 0x34, 0x25, 0x24, 0x32, 0x34, 0x25, 0x24, 0x32, 0x34,
+  0x33, 0x34, 0x32, 0x35, 0x23, 0x25, 0x31, 0x45, 0x31, 0x35, 0x31, 0x37,
+  0x21, 0x27, 0x67, 0x57, 0x67, 0x57, 0x68, 0x38, 0x6F, 0x46, 0xF4, 0x6F,
+  0x43, 0x03, 0xB7, 0xA8, 0x98, 0x99, 0x86, 0x13, 0x76, 0x23, 0x66, 0x24,
+  0x56, 0x33, 0x56, 0x43, 0x46, 0x53, 0x36, 0x62, 0x36, 0x63, 0x26, 0x73,
+  0x16, 0x82, 0x16, 0x89, 0x98, 0xA7, 0xB6, 0xB6, 0xC2, 0x76, 0xBC, 0x7E,
+  0x55, 0x65, 0x34, 0xA3, 0x34, 0xA4, 0x23, 0xC3, 0x13, 0xE6, 0xE6, 0xE6,
+  0xE6, 0xE6, 0xE6, 0xE3, 0x13, 0xC3, 0x23, 0xB4, 0x24, 0xA3, 0x45, 0x65,
+  0x5E, 0x7C, 0xB6, 0x70, 0x0A, 0x5C, 0x3E, 0x13, 0x74, 0x13, 0x87, 0x96,
+  0x96, 0x96, 0x87, 0x74, 0x1E, 0x1C, 0x3A, 0x53, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC0, 0x76, 0xBC, 0x7E, 0x55, 0x65, 0x34, 0xA3, 0x34,
+  0xA4, 0x23, 0xC3, 0x13, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE3, 0x13,
+  0xC3, 0x23, 0xB4, 0x24, 0xA3, 0x45, 0x65, 0x5E, 0x7B, 0xB7, 0xF1, 0x3F,
+  0x24, 0xF2, 0x6F, 0x08, 0xE5, 0xF2, 0x32, 0x0A, 0x6C, 0x4E, 0x23, 0x74,
+  0x23, 0x84, 0x13, 0x93, 0x13, 0x93, 0x13, 0x93, 0x13, 0x84, 0x13, 0x74,
+  0x2E, 0x2C, 0x4B, 0x53, 0x53, 0x53, 0x63, 0x43, 0x64, 0x33, 0x73, 0x33,
+  0x74, 0x23, 0x83, 0x23, 0x84, 0x13, 0x94, 0x47, 0x6A, 0x3B, 0x24, 0x61,
+  0x33, 0xB3, 0xB3, 0xB4, 0xB5, 0xA7, 0x88, 0x96, 0xB3, 0xC3, 0xB3, 0xB3,
+  0xB3, 0x12, 0x6F, 0x31, 0xC4, 0x84, 0x0F, 0xFF, 0x67, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x37, 0x03, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x74, 0x13, 0x73, 0x24, 0x54,
+  0x3B, 0x59, 0x85, 0x50, 0x03, 0xD7, 0xB4, 0x13, 0xB3, 0x23, 0xB3, 0x24,
+  0x93, 0x43, 0x93, 0x43, 0x93, 0x53, 0x73, 0x63, 0x73, 0x63, 0x73, 0x73,
+  0x53, 0x83, 0x53, 0x84, 0x34, 0x93, 0x33, 0xA3, 0x33, 0xB3, 0x13, 0xC3,
+  0x13, 0xC7, 0xD5, 0xE5, 0xF0, 0x38, 0x03, 0xF6, 0x6F, 0x66, 0xF6, 0x31,
+  0x38, 0x38, 0x32, 0x38, 0x38, 0x32, 0x37, 0x57, 0x32, 0x37, 0x57, 0x32,
+  0x37, 0x21, 0x36, 0x32, 0x45, 0x31, 0x35, 0x34, 0x35, 0x31, 0x35, 0x34,
+  0x34, 0x33, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34, 0x34, 0x33, 0x34, 0x35,
+  0x32, 0x35, 0x32, 0x36, 0x32, 0x35, 0x32, 0x36, 0x31, 0x37, 0x31, 0x36,
+  0x31, 0x37, 0x31, 0x37, 0x67, 0x68, 0x59, 0x58, 0x59, 0x59, 0x3B, 0x35,
+  0x03, 0xB3, 0x23, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0x53, 0x83, 0x33,
+  0xA3, 0x23, 0xA3, 0x13, 0xC5, 0xE4, 0xE4, 0xD5, 0xD6, 0xB3, 0x23, 0x93,
+  0x34, 0x74, 0x43, 0x73, 0x63, 0x53, 0x83, 0x34, 0x83, 0x33, 0xA3, 0x13,
+  0xC3, 0x03, 0xD3, 0x13, 0xB3, 0x23, 0xB3, 0x33, 0x93, 0x53, 0x73, 0x63,
+  0x73, 0x73, 0x53, 0x83, 0x53, 0x93, 0x33, 0xB3, 0x13, 0xC7, 0xD5, 0xF0,
+  0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+  0x38, 0x1F, 0x01, 0xF0, 0x1F, 0x0D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3D, 0x3C, 0x3C, 0x3C, 0x3D, 0x3C, 0x3C, 0x3C, 0xFF, 0xF3, 0x02,
+  0xD2, 0xC2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2,
+  0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xC2, 0xD2,
+  0xC2, 0xD2, 0xC2, 0xC2, 0xD2, 0x0F, 0xF0, 0x37, 0x5A, 0x31, 0x54, 0xA4,
+  0xA3, 0xA3, 0xA3, 0x3A, 0x1F, 0x16, 0x67, 0x67, 0x67, 0x76, 0x31, 0xC3,
+  0x91, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x16, 0x5C,
+  0x34, 0x54, 0x23, 0x83, 0x13, 0x83, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x83, 0x13, 0x74, 0x13, 0x64, 0x2C, 0x58, 0x50, 0x56, 0x49, 0x24,
+  0x73, 0x93, 0x83, 0x93, 0x93, 0x93, 0x93, 0x93, 0xA3, 0x93, 0xA4, 0x51,
+  0x39, 0x56, 0x10, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x56,
+  0x13, 0x3C, 0x24, 0x54, 0x13, 0x83, 0x13, 0x86, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x93, 0x13, 0x83, 0x14, 0x73, 0x24, 0x63, 0x3C, 0x59, 0x10, 0x56,
+  0x7A, 0x44, 0x44, 0x23, 0x73, 0x23, 0x86, 0x96, 0x9F, 0xF6, 0xC3, 0xD3,
+  0xC3, 0xD4, 0x71, 0x4B, 0x68, 0x20, 0x37, 0x28, 0x14, 0x54, 0x63, 0x73,
+  0x73, 0x73, 0x79, 0x19, 0x13, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x70, 0x58, 0x5C, 0x24, 0x63, 0x13,
+  0x83, 0x13, 0x86, 0x96, 0x96, 0x96, 0x96, 0x97, 0x83, 0x13, 0x83, 0x24,
+  0x54, 0x3C, 0x47, 0x13, 0xC3, 0xC3, 0xC3, 0xB3, 0x22, 0x74, 0x2C, 0x49,
+  0x40, 0x03, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBA, 0x4C, 0x23,
+  0x64, 0x13, 0x73, 0x13, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x83, 0x06, 0xF0, 0xFF, 0xF3, 0x53, 0x53, 0xFF, 0xF0,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x31, 0x62, 0x53, 0x03, 0xB3,
+  0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0x64, 0x13, 0x63, 0x23, 0x53,
+  0x33, 0x43, 0x43, 0x33, 0x53, 0x23, 0x63, 0x13, 0x76, 0x87, 0x73, 0x23,
+  0x63, 0x33, 0x53, 0x43, 0x43, 0x53, 0x33, 0x63, 0x23, 0x64, 0x13, 0x74,
+  0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39,
+  0xCE, 0x79, 0xE7, 0x18, 0x45, 0x3A, 0x18, 0x23, 0x54, 0x53, 0x13, 0x54,
+  0x57, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63,
+  0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63,
+  0x63, 0x28, 0x4C, 0x23, 0x64, 0x13, 0x73, 0x13, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x83, 0x56, 0x8A, 0x54, 0x44,
+  0x33, 0x83, 0x23, 0x83, 0x13, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0x13,
+  0x83, 0x23, 0x83, 0x34, 0x44, 0x5A, 0x86, 0x50, 0x28, 0x5C, 0x33, 0x64,
+  0x23, 0x74, 0x13, 0x83, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x83,
+  0x13, 0x83, 0x14, 0x54, 0x2C, 0x33, 0x16, 0x53, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC0, 0x58, 0x5C, 0x24, 0x63, 0x14, 0x73, 0x13, 0x86, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x93, 0x13, 0x83, 0x13, 0x83, 0x24, 0x54, 0x3C, 0x56,
+  0x13, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x2F, 0x67, 0x37, 0x37, 0x37,
+  0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3A,
+  0x23, 0x61, 0x13, 0x93, 0x94, 0x86, 0x78, 0x68, 0x76, 0x84, 0x93, 0x95,
+  0x6F, 0x02, 0x83, 0x03, 0x63, 0x63, 0x63, 0x63, 0x68, 0x18, 0x13, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x73, 0x41, 0x18,
+  0x26, 0x10, 0x03, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x83, 0x13, 0x73, 0x14, 0x63, 0x2C, 0x49, 0x10, 0x03, 0x96,
+  0x93, 0x13, 0x73, 0x23, 0x73, 0x23, 0x73, 0x33, 0x53, 0x43, 0x53, 0x44,
+  0x34, 0x53, 0x33, 0x63, 0x33, 0x73, 0x13, 0x83, 0x13, 0x87, 0x95, 0xA5,
+  0xB3, 0x60, 0xE0, 0x38, 0x0F, 0xC0, 0x70, 0x1D, 0xC0, 0xE0, 0x73, 0x83,
+  0xE0, 0xE7, 0x07, 0xC1, 0xCE, 0x0D, 0x83, 0x0E, 0x1B, 0x8E, 0x1C, 0x77,
+  0x1C, 0x38, 0xC6, 0x38, 0x31, 0x8C, 0xE0, 0x77, 0x1D, 0xC0, 0xEE, 0x1B,
+  0x80, 0xF8, 0x3E, 0x01, 0xF0, 0x7C, 0x01, 0xC0, 0x70, 0x03, 0x80, 0xE0,
+  0x03, 0x73, 0x23, 0x53, 0x43, 0x33, 0x53, 0x33, 0x63, 0x13, 0x86, 0x85,
+  0xA3, 0xB4, 0x96, 0x73, 0x13, 0x73, 0x23, 0x53, 0x43, 0x33, 0x54, 0x23,
+  0x63, 0x13, 0x83, 0x03, 0x87, 0x73, 0x13, 0x63, 0x23, 0x63, 0x33, 0x53,
+  0x33, 0x43, 0x43, 0x43, 0x53, 0x33, 0x53, 0x23, 0x63, 0x23, 0x73, 0x13,
+  0x73, 0x13, 0x73, 0x12, 0x95, 0x95, 0x94, 0xB3, 0xA4, 0xA3, 0xA4, 0x67,
+  0x75, 0x90, 0x0F, 0xBA, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x39, 0x39,
+  0x39, 0x3A, 0x39, 0x39, 0xFB, 0x0F, 0xFF, 0xF0 };
+
+static const packedGlyph_t UbuntuRegular16pt7bGlyphs[] = {
+  {     0,   0,   1,   7,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,  17,  21,  21,    2,  -20, GLYPH_RLE },   // 0x23 '#'
+  {    36,  23,  21,  27,    2,  -20, GLYPH_RLE },   // 0x25 '%'
+  {    94,  19,  21,  21,    1,  -20, GLYPH_RLE },   // 0x26 '&'
+  {   133,   3,   8,   7,    2,  -23, GLYPH_RAW },   // 0x27 '\''
+  {   136,  13,  12,  15,    1,  -20, GLYPH_RAW },   // 0x2A '*'
+  {   156,  14,  14,  17,    1,  -15, GLYPH_RLE },   // 0x2B '+'
+  {   170,   4,   9,   8,    2,   -3, GLYPH_RAW },   // 0x2C ','
+  {   175,   8,   2,  10,    1,   -9, GLYPH_RAW },   // 0x2D '-'
+  {   177,   4,   4,   8,    2,   -3, GLYPH_RAW },   // 0x2E '.'
+  {   179,  14,  30,  12,   -1,  -23, GLYPH_RLE },   // 0x2F '/'
+  {   210,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x30 '0'
+  {   239,   9,  21,  17,    2,  -20, GLYPH_RLE },   // 0x31 '1'
+  {   261,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x32 '2'
+  {   283,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x33 '3'
+  {   306,  15,  21,  17,    1,  -20, GLYPH_RLE },   // 0x34 '4'
+  {   335,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x35 '5'
+  {   357,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x36 '6'
+  {   384,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x37 '7'
+  {   405,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x38 '8'
+  {   435,  13,  21,  17,    2,  -20, GLYPH_RLE },   // 0x39 '9'
+  {   461,   4,  16,   8,    2,  -15, GLYPH_RAW },   // 0x3A ':'
+  {   469,  15,  13,  17,    1,  -15, GLYPH_RLE },   // 0x3E '>'
+  {   483,  11,  21,  13,    1,  -20, GLYPH_RLE },   // 0x3F '?'
+  {   504,  21,  21,  21,    0,  -20, GLYPH_RLE },   // 0x41 'A'
+  {   544,  15,  21,  20,    3,  -20, GLYPH_RLE },   // 0x42 'B'
+  {   573,  16,  21,  19,    2,  -20, GLYPH_RLE },   // 0x43 'C'
+  {   597,  17,  21,  22,    3,  -20, GLYPH_RLE },   // 0x44 'D'
+  {   627,  14,  21,  18,    3,  -20, GLYPH_RLE },   // 0x45 'E'
+  {   647,  13,  21,  17,    3,  -20, GLYPH_RLE },   // 0x46 'F'
+  {   667,  16,  21,  21,    2,  -20, GLYPH_RLE },   // 0x47 'G'
+  {   695,  16,  21,  22,    3,  -20, GLYPH_RLE },   // 0x48 'H'
+  {   716,   3,  21,   9,    3,  -20, GLYPH_RLE },   // 0x49 'I'
+  {   719,  13,  21,  16,    0,  -20, GLYPH_RLE },   // 0x4A 'J'
+  {   742,  17,  21,  20,    3,  -20, GLYPH_RLE },   // 0x4B 'K'
+  {   782,  12,  21,  16,    3,  -20, GLYPH_RLE },   // 0x4C 'L'
+  {   802,  25,  21,  29,    2,  -20, GLYPH_RLE },   // 0x4D 'M'
+  {   865,  17,  21,  23,    3,  -20, GLYPH_RLE },   // 0x4E 'N'
+  {   897,  20,  21,  24,    2,  -20, GLYPH_RLE },   // 0x4F 'O'
+  {   928,  15,  21,  19,    3,  -20, GLYPH_RLE },   // 0x50 'P'
+  {   952,  20,  27,  24,    2,  -20, GLYPH_RLE },   // 0x51 'Q'
+  {   991,  16,  21,  20,    3,  -20, GLYPH_RLE },   // 0x52 'R'
+  {  1027,  14,  21,  16,    1,  -20, GLYPH_RLE },   // 0x53 'S'
+  {  1050,  17,  21,  19,    1,  -20, GLYPH_RLE },   // 0x54 'T'
+  {  1071,  15,  21,  21,    3,  -20, GLYPH_RLE },   // 0x55 'U'
+  {  1096,  19,  21,  19,    0,  -20, GLYPH_RLE },   // 0x56 'V'
+  {  1134,  27,  21,  29,    1,  -20, GLYPH_RLE },   // 0x57 'W'
+  {  1200,  18,  21,  20,    1,  -20, GLYPH_RLE },   // 0x58 'X'
+  {  1237,  19,  21,  19,    0,  -20, GLYPH_RLE },   // 0x59 'Y'
+  {  1273,  16,  21,  18,    1,  -20, GLYPH_RLE },   // 0x5A 'Z'
+  {  1295,  14,  30,  12,   -1,  -23, GLYPH_RLE },   // 0x5C '\\'
+  {  1325,  15,   2,  15,    0,    5, GLYPH_RLE },   // 0x5F '_'
+  {  1327,  13,  16,  16,    1,  -15, GLYPH_RLE },   // 0x61 'a'
+  {  1345,  15,  24,  18,    2,  -23, GLYPH_RLE },   // 0x62 'b'
+  {  1377,  12,  16,  14,    1,  -15, GLYPH_RLE },   // 0x63 'c'
+  {  1395,  15,  24,  18,    1,  -23, GLYPH_RLE },   // 0x64 'd'
+  {  1427,  15,  16,  17,    1,  -15, GLYPH_RLE },   // 0x65 'e'
+  {  1446,  10,  24,  12,    2,  -23, GLYPH_RLE },   // 0x66 'f'
+  {  1471,  15,  22,  18,    1,  -15, GLYPH_RLE },   // 0x67 'g'
+  {  1501,  14,  24,  18,    2,  -23, GLYPH_RLE },   // 0x68 'h'
+  {  1528,   3,  23,   7,    2,  -22, GLYPH_RLE },   // 0x69 'i'
+  {  1532,   8,  29,   7,   -3,  -22, GLYPH_RLE },   // 0x6A 'j'
+  {  1558,  14,  24,  16,    2,  -23, GLYPH_RLE },   // 0x6B 'k'
+  {  1596,   5,  24,   8,    2,  -23, GLYPH_RAW },   // 0x6C 'l'
+  {  1611,  21,  16,  25,    2,  -15, GLYPH_RLE },   // 0x6D 'm'
+  {  1645,  14,  16,  18,    2,  -15, GLYPH_RLE },   // 0x6E 'n'
+  {  1664,  16,  16,  18,    1,  -15, GLYPH_RLE },   // 0x6F 'o'
+  {  1688,  15,  22,  18,    2,  -15, GLYPH_RLE },   // 0x70 'p'
+  {  1718,  15,  22,  18,    1,  -15, GLYPH_RLE },   // 0x71 'q'
+  {  1747,  10,  16,  12,    2,  -15, GLYPH_RLE },   // 0x72 'r'
+  {  1762,  12,  16,  14,    1,  -15, GLYPH_RLE },   // 0x73 's'
+  {  1779,   9,  21,  12,    2,  -20, GLYPH_RLE },   // 0x74 't'
+  {  1802,  14,  16,  18,    2,  -15, GLYPH_RLE },   // 0x75 'u'
+  {  1822,  15,  16,  17,    1,  -15, GLYPH_RLE },   // 0x76 'v'
+  {  1850,  23,  16,  25,    1,  -15, GLYPH_RAW },   // 0x77 'w'
+  {  1896,  14,  16,  16,    1,  -15, GLYPH_RLE },   // 0x78 'x'
+  {  1923,  14,  22,  16,    1,  -15, GLYPH_RLE },   // 0x79 'y'
+  {  1958,  13,  16,  15,    1,  -15, GLYPH_RLE },   // 0x7A 'z'
+  {  1973,   2,  30,   9,    3,  -23, GLYPH_RLE } }; // 0x7C '|'
+
+static const uint8_t UbuntuRegular16pt7bIndex[] = {
+    0,   0,   0,   1,   0,   2,   3,   4,   0,   0,   5,   6,
+    7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+   19,  20,  21,   0,   0,   0,  22,  23,   0,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+   39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,   0,
+   50,   0,   0,  51,   0,  52,  53,  54,  55,  56,  57,  58,
+   59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+   71,  72,  73,  74,  75,  76,  77,   0,  78,   0,   0 };
+
+static const packedFont_t UbuntuRegular16pt7b = {
+  UbuntuRegular16pt7bData,
+  UbuntuRegular16pt7bGlyphs,
+  UbuntuRegular16pt7bIndex,
+  0x20, 0x7E, 36 };
+
+// 79 glyphs, 1976 bytes of glyph data
@@ -0,0 +1,147 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/UbuntuRegular6pt7b.h
+
+static const uint8_t UbuntuRegular6pt7bData[] = {
+  0xFB, 0xB6, 0x80, 0x28, 0xAF, 0xCA, 0x53, 0xF5, 0x14, 0x21, 0x1F, 0x08,
+  0x30, 0x41, 0x0F, 0x88, 0x40, 0x62, 0x94, 0x98, 0x68, 0x16, 0x19, 0x29,
+  0x46, 0x30, 0x91, 0x21, 0x85, 0x51, 0xA3, 0x3B, 0xE0, 0x29, 0x49, 0x24,
+  0x48, 0x80, 0x89, 0x12, 0x49, 0x4A, 0x00, 0x25, 0x5C, 0xA5, 0x00, 0x21,
+  0x3E, 0x42, 0x00, 0x56, 0xC0, 0x08, 0x84, 0x22, 0x10, 0x88, 0x42, 0x20,
+  0x74, 0x63, 0x18, 0xC6, 0x2E, 0x2E, 0x92, 0x49, 0x74, 0x42, 0x22, 0x22,
+  0x1F, 0xF0, 0x42, 0xE1, 0x84, 0x3E, 0x11, 0x94, 0xA9, 0x7C, 0x42, 0x7A,
+  0x10, 0xE0, 0x84, 0x3E, 0x32, 0x21, 0xE8, 0xC6, 0x2E, 0xF8, 0x44, 0x42,
+  0x11, 0x08, 0x74, 0x62, 0xE8, 0xC6, 0x2E, 0x74, 0x63, 0x17, 0x84, 0x4C,
+  0xC6, 0x50, 0x15, 0x80, 0x0B, 0xA0, 0xE0, 0x80, 0xF8, 0x3E, 0x83, 0x82,
+  0xE8, 0x00, 0xE1, 0x12, 0x40, 0x44, 0x3E, 0x20, 0xA7, 0x34, 0x9A, 0x4D,
+  0x26, 0x6C, 0x80, 0x3C, 0x00, 0x10, 0x50, 0xA1, 0x44, 0x4F, 0x91, 0x41,
+  0xFA, 0x18, 0x7E, 0x86, 0x18, 0x7E, 0x3D, 0x08, 0x20, 0x82, 0x04, 0x0F,
+  0xF9, 0x0A, 0x0C, 0x18, 0x30, 0x61, 0x7C, 0xFC, 0x21, 0xE8, 0x42, 0x1F,
+  0xFC, 0x21, 0xE8, 0x42, 0x10, 0x3D, 0x08, 0x20, 0x86, 0x14, 0x4F, 0x86,
+  0x18, 0x7F, 0x86, 0x18, 0x61, 0xFF, 0x08, 0x42, 0x10, 0x86, 0x2E, 0x86,
+  0x29, 0x28, 0xC2, 0xC8, 0xA1, 0x84, 0x21, 0x08, 0x42, 0x1F, 0x80, 0xE0,
+  0xE8, 0xB4, 0x59, 0x4C, 0xA6, 0x23, 0x01, 0x83, 0x86, 0x8C, 0x98, 0xB1,
+  0x61, 0xC1, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x51, 0x1C, 0xFA, 0x18, 0x61,
+  0xFA, 0x08, 0x20, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x51, 0x1C, 0x10, 0x18,
+  0xF9, 0x0A, 0x14, 0x2F, 0x91, 0x21, 0x41, 0x78, 0x86, 0x11, 0x1E, 0xFE,
+  0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x86, 0x18, 0x61, 0x86, 0x18, 0x5E,
+  0x83, 0x05, 0x12, 0x22, 0x85, 0x0A, 0x08, 0x80, 0x30, 0x86, 0x10, 0xA5,
+  0x24, 0xA4, 0xA2, 0x94, 0x51, 0x04, 0x82, 0x88, 0xA0, 0x81, 0x05, 0x11,
+  0x41, 0x82, 0x89, 0x11, 0x41, 0x02, 0x04, 0x08, 0xF8, 0x44, 0x44, 0x22,
+  0x1F, 0xF2, 0x49, 0x24, 0x93, 0x80, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10,
+  0x82, 0xE4, 0x92, 0x49, 0x27, 0x80, 0x22, 0x94, 0xA8, 0x80, 0xFC, 0x90,
+  0xE1, 0x79, 0x97, 0x84, 0x21, 0xE8, 0xC6, 0x31, 0xF0, 0x7C, 0x21, 0x08,
+  0x3C, 0x08, 0x42, 0xF8, 0xC6, 0x31, 0x78, 0x74, 0x7F, 0x08, 0x3C, 0x78,
+  0x8F, 0x88, 0x88, 0x80, 0x7C, 0x63, 0x18, 0xBC, 0x3E, 0x84, 0x21, 0xE8,
+  0xC6, 0x31, 0x88, 0xDF, 0x80, 0x24, 0x12, 0x49, 0x27, 0x00, 0x84, 0x21,
+  0x2A, 0x62, 0x92, 0x88, 0xAA, 0xAA, 0x40, 0xF7, 0x44, 0x62, 0x31, 0x18,
+  0x8C, 0x44, 0xF4, 0x63, 0x18, 0xC4, 0x74, 0x63, 0x18, 0xB8, 0xF4, 0x63,
+  0x18, 0xFA, 0x10, 0x7C, 0x63, 0x18, 0xBC, 0x21, 0xF8, 0x88, 0x88, 0x78,
+  0xC3, 0x1E, 0x88, 0xF8, 0x88, 0x87, 0x8C, 0x63, 0x18, 0xBC, 0x8C, 0x54,
+  0xA5, 0x10, 0x88, 0xC4, 0x55, 0x4A, 0xA5, 0x51, 0x10, 0x85, 0x23, 0x0C,
+  0x4A, 0x10, 0x8C, 0x54, 0xA5, 0x10, 0x98, 0xF1, 0x24, 0x8F, 0x29, 0x25,
+  0x12, 0x48, 0x80, 0x0B, 0x89, 0x24, 0x52, 0x4A, 0x00, 0x66, 0x60 };
+
+static const packedGlyph_t UbuntuRegular6pt7bGlyphs[] = {
+  {     0,   0,   1,   3,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,   1,   8,   3,    1,   -7, GLYPH_RAW },   // 0x21 '!'
+  {     1,   3,   3,   5,    1,   -8, GLYPH_RAW },   // 0x22 '"'
+  {     3,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x23 '#'
+  {     9,   5,  12,   7,    1,   -9, GLYPH_RAW },   // 0x24 '$'
+  {    17,   8,   8,  10,    1,   -7, GLYPH_RAW },   // 0x25 '%'
+  {    25,   7,   8,   8,    1,   -7, GLYPH_RAW },   // 0x26 '&'
+  {    32,   1,   3,   3,    1,   -8, GLYPH_RAW },   // 0x27 '\''
+  {    33,   3,  11,   4,    1,   -8, GLYPH_RAW },   // 0x28 '('
+  {    38,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x29 ')'
+  {    43,   5,   5,   6,    1,   -7, GLYPH_RAW },   // 0x2A '*'
+  {    47,   5,   5,   7,    1,   -5, GLYPH_RAW },   // 0x2B '+'
+  {    51,   2,   4,   3,    0,   -1, GLYPH_RAW },   // 0x2C ','
+  {    32,   3,   1,   5,    1,   -3, GLYPH_RAW },   // 0x2D '-'
+  {    52,   1,   2,   3,    1,   -1, GLYPH_RAW },   // 0x2E '.'
+  {    53,   5,  11,   5,    0,   -8, GLYPH_RAW },   // 0x2F '/'
+  {    60,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x30 '0'
+  {    65,   3,   8,   7,    1,   -7, GLYPH_RAW },   // 0x31 '1'
+  {    68,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x32 '2'
+  {    73,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x33 '3'
+  {    78,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x34 '4'
+  {    83,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x35 '5'
+  {    88,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x36 '6'
+  {    93,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x37 '7'
+  {    98,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x38 '8'
+  {   103,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x39 '9'
+  {   108,   1,   7,   3,    1,   -6, GLYPH_RAW },   // 0x3A ':'
+  {   109,   2,   9,   3,    0,   -6, GLYPH_RAW },   // 0x3B ';'
+  {   112,   5,   5,   7,    1,   -5, GLYPH_RAW },   // 0x3C '<'
+  {   116,   5,   3,   7,    1,   -3, GLYPH_RAW },   // 0x3D '='
+  {   118,   5,   5,   7,    1,   -5, GLYPH_RAW },   // 0x3E '>'
+  {   122,   4,   8,   5,    1,   -7, GLYPH_RAW },   // 0x3F '?'
+  {   126,   9,   9,  11,    1,   -7, GLYPH_RAW },   // 0x40 '@'
+  {   137,   7,   8,   7,    0,   -7, GLYPH_RAW },   // 0x41 'A'
+  {   144,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x42 'B'
+  {   150,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x43 'C'
+  {   156,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x44 'D'
+  {   163,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x45 'E'
+  {   168,   5,   8,   6,    1,   -7, GLYPH_RAW },   // 0x46 'F'
+  {   173,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x47 'G'
+  {   179,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x48 'H'
+  {   185,   1,   8,   3,    1,   -7, GLYPH_RAW },   // 0x49 'I'
+  {   186,   5,   8,   6,    0,   -7, GLYPH_RAW },   // 0x4A 'J'
+  {   191,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x4B 'K'
+  {   197,   5,   8,   6,    1,   -7, GLYPH_RAW },   // 0x4C 'L'
+  {   202,   9,   8,  11,    1,   -7, GLYPH_RAW },   // 0x4D 'M'
+  {   211,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x4E 'N'
+  {   218,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x4F 'O'
+  {   225,   6,   8,   7,    1,   -7, GLYPH_RAW },   // 0x50 'P'
+  {   231,   7,  10,   9,    1,   -7, GLYPH_RAW },   // 0x51 'Q'
+  {   240,   7,   8,   8,    1,   -7, GLYPH_RAW },   // 0x52 'R'
+  {   247,   4,   8,   6,    1,   -7, GLYPH_RAW },   // 0x53 'S'
+  {   251,   7,   8,   7,    0,   -7, GLYPH_RAW },   // 0x54 'T'
+  {   258,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x55 'U'
+  {   264,   7,   8,   7,    0,   -7, GLYPH_RAW },   // 0x56 'V'
+  {   271,  11,   8,  11,    0,   -7, GLYPH_RAW },   // 0x57 'W'
+  {   282,   7,   8,   7,    0,   -7, GLYPH_RAW },   // 0x58 'X'
+  {   289,   7,   8,   7,    0,   -7, GLYPH_RAW },   // 0x59 'Y'
+  {   296,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x5A 'Z'
+  {   301,   3,  11,   4,    1,   -8, GLYPH_RAW },   // 0x5B '['
+  {   306,   5,  11,   5,    0,   -8, GLYPH_RAW },   // 0x5C '\\'
+  {   313,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x5D ']'
+  {   318,   5,   5,   7,    1,   -7, GLYPH_RAW },   // 0x5E '^'
+  {   322,   6,   1,   6,    0,    2, GLYPH_RAW },   // 0x5F '_'
+  {   323,   2,   2,   5,    1,   -8, GLYPH_RAW },   // 0x60 '`'
+  {   324,   4,   6,   6,    1,   -5, GLYPH_RAW },   // 0x61 'a'
+  {   327,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x62 'b'
+  {   333,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x63 'c'
+  {   337,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x64 'd'
+  {   343,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x65 'e'
+  {   347,   4,   9,   5,    1,   -8, GLYPH_RAW },   // 0x66 'f'
+  {   352,   5,   8,   7,    1,   -5, GLYPH_RAW },   // 0x67 'g'
+  {   357,   5,   9,   7,    1,   -8, GLYPH_RAW },   // 0x68 'h'
+  {   363,   1,   9,   3,    1,   -8, GLYPH_RAW },   // 0x69 'i'
+  {   365,   3,  11,   3,   -1,   -8, GLYPH_RAW },   // 0x6A 'j'
+  {   370,   5,   9,   6,    1,   -8, GLYPH_RAW },   // 0x6B 'k'
+  {   376,   2,   9,   3,    1,   -8, GLYPH_RAW },   // 0x6C 'l'
+  {   379,   9,   6,  11,    1,   -5, GLYPH_RAW },   // 0x6D 'm'
+  {   386,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x6E 'n'
+  {   390,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x6F 'o'
+  {   394,   5,   8,   7,    1,   -5, GLYPH_RAW },   // 0x70 'p'
+  {   399,   5,   8,   7,    1,   -5, GLYPH_RAW },   // 0x71 'q'
+  {   404,   4,   6,   5,    1,   -5, GLYPH_RAW },   // 0x72 'r'
+  {   407,   4,   6,   6,    1,   -5, GLYPH_RAW },   // 0x73 's'
+  {   410,   4,   8,   6,    1,   -7, GLYPH_RAW },   // 0x74 't'
+  {   414,   5,   6,   7,    1,   -5, GLYPH_RAW },   // 0x75 'u'
+  {   418,   5,   6,   5,    0,   -5, GLYPH_RAW },   // 0x76 'v'
+  {   422,   9,   6,   9,    0,   -5, GLYPH_RAW },   // 0x77 'w'
+  {   429,   6,   6,   6,    0,   -5, GLYPH_RAW },   // 0x78 'x'
+  {   434,   5,   8,   5,    0,   -5, GLYPH_RAW },   // 0x79 'y'
+  {   439,   4,   6,   6,    1,   -5, GLYPH_RAW },   // 0x7A 'z'
+  {   442,   3,  11,   4,    1,   -8, GLYPH_RAW },   // 0x7B '{'
+  {   447,   1,  11,   3,    1,   -8, GLYPH_RLE },   // 0x7C '|'
+  {   448,   3,  11,   4,    0,   -8, GLYPH_RAW },   // 0x7D '}'
+  {   453,   6,   2,   7,    1,   -4, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t UbuntuRegular6pt7b = {
+  UbuntuRegular6pt7bData,
+  UbuntuRegular6pt7bGlyphs,
+  NULL,
+  0x20, 0x7E, 14 };
+
+// 95 glyphs, 455 bytes of glyph data
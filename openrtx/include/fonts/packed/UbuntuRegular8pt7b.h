@@ -0,0 +1,179 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/UbuntuRegular8pt7b.h
+
+static const uint8_t UbuntuRegular8pt7bData[] = {
+  0xFE, 0x60, 0x99, 0x99, 0x11, 0x08, 0x84, 0x5F, 0xF2, 0x21, 0x10, 0x89,
+  0xFF, 0x44, 0x22, 0x11, 0x00, 0x10, 0x21, 0xF4, 0x08, 0x10, 0x18, 0x08,
+  0x0C, 0x04, 0x08, 0x1F, 0xC2, 0x04, 0x00, 0x70, 0x48, 0x88, 0x89, 0x08,
+  0x90, 0x8A, 0x07, 0x4E, 0x05, 0x10, 0x91, 0x09, 0x11, 0x11, 0x20, 0xE0,
+  0x3C, 0x21, 0x10, 0x88, 0x42, 0xC1, 0x81, 0x23, 0x09, 0x83, 0x41, 0x9F,
+  0x20, 0xF0, 0x12, 0x44, 0x48, 0x88, 0x88, 0x84, 0x44, 0x21, 0x84, 0x22,
+  0x21, 0x11, 0x11, 0x12, 0x22, 0x48, 0x11, 0x25, 0xF1, 0x42, 0x88, 0x80,
+  0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0x55, 0x80, 0xC0, 0x02, 0x08,
+  0x10, 0x20, 0x81, 0x02, 0x08, 0x10, 0x40, 0x81, 0x04, 0x08, 0x10, 0x40,
+  0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x82, 0x88, 0xE0, 0x13, 0x59,
+  0x11, 0x11, 0x11, 0x10, 0x38, 0x8A, 0x08, 0x10, 0x41, 0x04, 0x10, 0x41,
+  0x03, 0xF8, 0x79, 0x08, 0x08, 0x10, 0x47, 0x01, 0x01, 0x03, 0x09, 0xE0,
+  0x04, 0x18, 0x51, 0x22, 0x48, 0xA1, 0x7F, 0x04, 0x08, 0x10, 0x7E, 0x81,
+  0x02, 0x07, 0x80, 0x80, 0x81, 0x03, 0x09, 0xE0, 0x1C, 0x41, 0x04, 0x0F,
+  0x90, 0xA0, 0xC1, 0x82, 0x88, 0xE0, 0xFE, 0x04, 0x10, 0x40, 0x82, 0x04,
+  0x08, 0x20, 0x40, 0x80, 0x38, 0x8A, 0x0C, 0x14, 0x47, 0x11, 0x41, 0x82,
+  0x88, 0xE0, 0x38, 0x8A, 0x0C, 0x18, 0x28, 0x4F, 0x81, 0x04, 0x11, 0xC0,
+  0xC3, 0x50, 0x05, 0x58, 0x02, 0x18, 0xC6, 0x03, 0x01, 0x80, 0x80, 0x07,
+  0xE7, 0x80, 0x70, 0x0C, 0x03, 0x0C, 0x70, 0x80, 0x74, 0x42, 0x13, 0x21,
+  0x00, 0x02, 0x10, 0x0F, 0x81, 0x83, 0x10, 0x04, 0x8F, 0xA8, 0x84, 0xC8,
+  0x26, 0x41, 0x32, 0x09, 0x88, 0x4A, 0x3D, 0x90, 0x00, 0x60, 0x00, 0xFC,
+  0x00, 0x04, 0x01, 0x40, 0x28, 0x08, 0x81, 0x10, 0x41, 0x08, 0x21, 0xFC,
+  0x40, 0x48, 0x0A, 0x00, 0x80, 0xF8, 0x84, 0x82, 0x82, 0x84, 0xFC, 0x82,
+  0x81, 0x81, 0x82, 0xFC, 0x1F, 0x10, 0x50, 0x10, 0x08, 0x04, 0x02, 0x01,
+  0x00, 0x40, 0x10, 0x47, 0xC0, 0xFC, 0x41, 0x20, 0x50, 0x18, 0x0C, 0x06,
+  0x03, 0x01, 0x81, 0x41, 0x3F, 0x00, 0xFF, 0x02, 0x04, 0x08, 0x1F, 0xA0,
+  0x40, 0x81, 0x03, 0xF8, 0xFF, 0x02, 0x04, 0x08, 0x1F, 0xA0, 0x40, 0x81,
+  0x02, 0x00, 0x1F, 0x10, 0x50, 0x10, 0x08, 0x04, 0x02, 0x03, 0x01, 0x40,
+  0x90, 0x47, 0xE0, 0x01, 0x72, 0x72, 0x72, 0x72, 0x7B, 0x72, 0x72, 0x72,
+  0x72, 0x71, 0x0B, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x03, 0x09,
+  0xE0, 0x81, 0x41, 0x23, 0x12, 0x0A, 0x06, 0x02, 0xC1, 0x10, 0x86, 0x40,
+  0xA0, 0x20, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x03, 0xF8,
+  0x40, 0x4C, 0x19, 0x83, 0x28, 0xA5, 0x15, 0x14, 0xA2, 0x8C, 0x51, 0x84,
+  0x30, 0x06, 0x00, 0x80, 0x80, 0xE0, 0x68, 0x32, 0x19, 0x0C, 0x46, 0x13,
+  0x05, 0x82, 0xC0, 0xE0, 0x20, 0x1E, 0x08, 0x44, 0x0A, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x40, 0x88, 0x41, 0xE0, 0xFC, 0x82, 0x81, 0x81, 0x81,
+  0x82, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x1E, 0x08, 0x44, 0x0A, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x01, 0x40, 0x88, 0x41, 0xE0, 0x10, 0x02, 0x00, 0x60,
+  0xFC, 0x41, 0x20, 0x50, 0x28, 0x14, 0x13, 0xF1, 0x0C, 0x82, 0x40, 0xA0,
+  0x20, 0x3C, 0x86, 0x04, 0x06, 0x03, 0x01, 0x01, 0x03, 0x09, 0xE0, 0x09,
+  0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x40, 0x80,
+  0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xA0, 0x8F, 0x80,
+  0x80, 0xC0, 0x50, 0x48, 0x24, 0x11, 0x10, 0x88, 0x28, 0x14, 0x0A, 0x02,
+  0x00, 0x80, 0x0C, 0x10, 0x50, 0x84, 0x8A, 0x24, 0x51, 0x22, 0x88, 0xA2,
+  0x85, 0x14, 0x28, 0xA0, 0x82, 0x04, 0x10, 0x80, 0xA0, 0x88, 0x84, 0x41,
+  0x40, 0x40, 0x50, 0x44, 0x22, 0x20, 0xA0, 0x20, 0x80, 0xA0, 0x90, 0x44,
+  0x42, 0x20, 0xA0, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0xFE, 0x04, 0x10,
+  0x41, 0x02, 0x08, 0x20, 0x41, 0x03, 0xF8, 0xF2, 0x49, 0x24, 0x92, 0x49,
+  0x27, 0x80, 0x81, 0x02, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0x40, 0x81, 0x01, 0xE4, 0x92, 0x49, 0x24, 0x92, 0x4F, 0x10, 0x50, 0xA2,
+  0x24, 0x50, 0x40, 0xFF, 0x88, 0x80, 0x78, 0x10, 0x5F, 0x86, 0x18, 0x5F,
+  0x81, 0x02, 0x04, 0x0F, 0x90, 0xA0, 0xC1, 0x83, 0x06, 0x17, 0xC0, 0x3D,
+  0x08, 0x20, 0x82, 0x04, 0x0F, 0x02, 0x04, 0x08, 0x13, 0xE8, 0x60, 0xC1,
+  0x83, 0x05, 0x09, 0xF0, 0x38, 0x8A, 0x0F, 0xF8, 0x10, 0x10, 0x1E, 0x7C,
+  0x21, 0x0F, 0xC2, 0x10, 0x84, 0x21, 0x00, 0x3E, 0x86, 0x0C, 0x18, 0x30,
+  0x50, 0x9F, 0x02, 0x0B, 0xE0, 0x81, 0x02, 0x04, 0x0F, 0x90, 0xA0, 0xC1,
+  0x83, 0x06, 0x0C, 0x10, 0xCF, 0xF0, 0x24, 0x02, 0x49, 0x24, 0x92, 0x70,
+  0x82, 0x08, 0x20, 0x8A, 0x4A, 0x30, 0xA2, 0x48, 0xA1, 0x92, 0x49, 0x24,
+  0x92, 0x30, 0xF3, 0x91, 0x8A, 0x10, 0xC2, 0x18, 0x43, 0x08, 0x61, 0x0C,
+  0x21, 0xF9, 0x0A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x3C, 0x42, 0x81, 0x81,
+  0x81, 0x81, 0x42, 0x3C, 0xF9, 0x0A, 0x0C, 0x18, 0x30, 0x61, 0x7C, 0x81,
+  0x02, 0x00, 0x3E, 0x86, 0x0C, 0x18, 0x30, 0x50, 0x9F, 0x02, 0x04, 0x08,
+  0xFC, 0x21, 0x08, 0x42, 0x10, 0x7C, 0x20, 0xC1, 0x04, 0x3E, 0x88, 0x8F,
+  0x88, 0x88, 0x88, 0x70, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x50, 0x9E, 0x83,
+  0x05, 0x12, 0x24, 0x45, 0x0A, 0x08, 0x82, 0x0C, 0x10, 0x51, 0x44, 0x8A,
+  0x24, 0x51, 0x14, 0x50, 0xA2, 0x82, 0x08, 0x81, 0x42, 0x24, 0x18, 0x18,
+  0x24, 0x42, 0x81, 0x82, 0x89, 0x12, 0x22, 0x85, 0x04, 0x08, 0x10, 0x43,
+  0x00, 0xFC, 0x10, 0x84, 0x21, 0x08, 0x3F, 0x19, 0x08, 0x42, 0x10, 0x98,
+  0x21, 0x08, 0x42, 0x10, 0x83, 0xFF, 0xFF, 0xC1, 0x08, 0x42, 0x10, 0x83,
+  0x21, 0x08, 0x42, 0x10, 0x98, 0x73, 0x18 };
+
+static const packedGlyph_t UbuntuRegular8pt7bGlyphs[] = {
+  {     0,   0,   1,   4,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,   1,  11,   4,    1,  -10, GLYPH_RAW },   // 0x21 '!'
+  {     2,   4,   4,   7,    1,  -12, GLYPH_RAW },   // 0x22 '"'
+  {     4,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x23 '#'
+  {    17,   7,  15,   9,    1,  -12, GLYPH_RAW },   // 0x24 '$'
+  {    31,  12,  11,  14,    1,  -10, GLYPH_RAW },   // 0x25 '%'
+  {    48,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x26 '&'
+  {    61,   1,   4,   4,    1,  -12, GLYPH_RAW },   // 0x27 '\''
+  {    62,   4,  16,   5,    1,  -12, GLYPH_RAW },   // 0x28 '('
+  {    70,   4,  16,   5,    0,  -12, GLYPH_RAW },   // 0x29 ')'
+  {    78,   7,   6,   8,    1,  -10, GLYPH_RAW },   // 0x2A '*'
+  {    84,   7,   7,   9,    1,   -7, GLYPH_RAW },   // 0x2B '+'
+  {    91,   2,   5,   4,    0,   -1, GLYPH_RAW },   // 0x2C ','
+  {    61,   4,   1,   6,    1,   -4, GLYPH_RAW },   // 0x2D '-'
+  {    93,   1,   2,   4,    1,   -1, GLYPH_RAW },   // 0x2E '.'
+  {    94,   7,  16,   6,    0,  -12, GLYPH_RAW },   // 0x2F '/'
+  {   108,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x30 '0'
+  {   118,   4,  11,   9,    1,  -10, GLYPH_RAW },   // 0x31 '1'
+  {   124,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x32 '2'
+  {   134,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x33 '3'
+  {   144,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x34 '4'
+  {   154,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x35 '5'
+  {   164,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x36 '6'
+  {   174,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x37 '7'
+  {   184,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x38 '8'
+  {   194,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x39 '9'
+  {   204,   1,   8,   4,    1,   -7, GLYPH_RAW },   // 0x3A ':'
+  {   205,   2,  11,   4,    0,   -7, GLYPH_RAW },   // 0x3B ';'
+  {   208,   7,   7,   9,    1,   -7, GLYPH_RAW },   // 0x3C '<'
+  {   215,   7,   4,   9,    1,   -6, GLYPH_RLE },   // 0x3D '='
+  {   217,   8,   7,   9,    1,   -7, GLYPH_RAW },   // 0x3E '>'
+  {   224,   5,  11,   6,    1,  -10, GLYPH_RAW },   // 0x3F '?'
+  {   231,  13,  13,  15,    1,  -10, GLYPH_RAW },   // 0x40 '@'
+  {   253,  11,  11,  11,    0,  -10, GLYPH_RAW },   // 0x41 'A'
+  {   269,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x42 'B'
+  {   280,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x43 'C'
+  {   293,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x44 'D'
+  {   306,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x45 'E'
+  {   316,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x46 'F'
+  {   326,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x47 'G'
+  {   339,   9,  11,  11,    1,  -10, GLYPH_RLE },   // 0x48 'H'
+  {   350,   1,  11,   3,    1,  -10, GLYPH_RLE },   // 0x49 'I'
+  {   351,   7,  11,   8,    0,  -10, GLYPH_RAW },   // 0x4A 'J'
+  {   361,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x4B 'K'
+  {   374,   7,  11,   8,    1,  -10, GLYPH_RAW },   // 0x4C 'L'
+  {   384,  11,  11,  13,    1,  -10, GLYPH_RAW },   // 0x4D 'M'
+  {   400,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x4E 'N'
+  {   413,  10,  11,  12,    1,  -10, GLYPH_RAW },   // 0x4F 'O'
+  {   427,   8,  11,  10,    1,  -10, GLYPH_RAW },   // 0x50 'P'
+  {   438,  10,  14,  12,    1,  -10, GLYPH_RAW },   // 0x51 'Q'
+  {   456,   9,  11,  10,    1,  -10, GLYPH_RAW },   // 0x52 'R'
+  {   469,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x53 'S'
+  {   479,   9,  11,   9,    0,  -10, GLYPH_RLE },   // 0x54 'T'
+  {   491,   9,  11,  11,    1,  -10, GLYPH_RAW },   // 0x55 'U'
+  {   504,   9,  11,   9,    0,  -10, GLYPH_RAW },   // 0x56 'V'
+  {   517,  13,  11,  13,    0,  -10, GLYPH_RAW },   // 0x57 'W'
+  {   535,   9,  11,   9,    0,  -10, GLYPH_RAW },   // 0x58 'X'
+  {   548,   9,  11,   9,    0,  -10, GLYPH_RAW },   // 0x59 'Y'
+  {   561,   7,  11,   9,    1,  -10, GLYPH_RAW },   // 0x5A 'Z'
+  {   571,   3,  16,   5,    2,  -12, GLYPH_RAW },   // 0x5B '['
+  {   577,   7,  16,   6,    0,  -12, GLYPH_RAW },   // 0x5C '\\'
+  {   591,   3,  16,   5,    0,  -12, GLYPH_RAW },   // 0x5D ']'
+  {   597,   7,   6,   9,    1,  -10, GLYPH_RAW },   // 0x5E '^'
+  {   603,   8,   1,   8,    0,    3, GLYPH_RAW },   // 0x5F '_'
+  {   604,   3,   3,   6,    1,  -11, GLYPH_RAW },   // 0x60 '`'
+  {   606,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x61 'a'
+  {   612,   7,  12,   9,    1,  -11, GLYPH_RAW },   // 0x62 'b'
+  {   623,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x63 'c'
+  {   629,   7,  12,   9,    1,  -11, GLYPH_RAW },   // 0x64 'd'
+  {   640,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x65 'e'
+  {   647,   5,  12,   6,    1,  -11, GLYPH_RAW },   // 0x66 'f'
+  {   655,   7,  11,   9,    1,   -7, GLYPH_RAW },   // 0x67 'g'
+  {   665,   7,  12,   9,    1,  -11, GLYPH_RAW },   // 0x68 'h'
+  {   676,   1,  12,   3,    1,  -11, GLYPH_RAW },   // 0x69 'i'
+  {   678,   3,  15,   3,   -1,  -11, GLYPH_RAW },   // 0x6A 'j'
+  {   684,   6,  12,   8,    1,  -11, GLYPH_RAW },   // 0x6B 'k'
+  {   693,   3,  12,   4,    1,  -11, GLYPH_RAW },   // 0x6C 'l'
+  {   698,  11,   8,  13,    1,   -7, GLYPH_RAW },   // 0x6D 'm'
+  {   709,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x6E 'n'
+  {   716,   8,   8,  10,    1,   -7, GLYPH_RAW },   // 0x6F 'o'
+  {   724,   7,  11,   9,    1,   -7, GLYPH_RAW },   // 0x70 'p'
+  {   734,   7,  11,   9,    1,   -7, GLYPH_RAW },   // 0x71 'q'
+  {   744,   5,   8,   6,    1,   -7, GLYPH_RAW },   // 0x72 'r'
+  {   749,   5,   8,   7,    1,   -7, GLYPH_RAW },   // 0x73 's'
+  {   754,   4,  11,   6,    1,  -10, GLYPH_RAW },   // 0x74 't'
+  {   760,   7,   8,   9,    1,   -7, GLYPH_RAW },   // 0x75 'u'
+  {   767,   7,   8,   7,    0,   -7, GLYPH_RAW },   // 0x76 'v'
+  {   774,  13,   8,  13,    0,   -7, GLYPH_RAW },   // 0x77 'w'
+  {   787,   8,   8,   8,    0,   -7, GLYPH_RAW },   // 0x78 'x'
+  {   795,   7,  11,   7,    0,   -7, GLYPH_RAW },   // 0x79 'y'
+  {   805,   6,   8,   8,    1,   -7, GLYPH_RAW },   // 0x7A 'z'
+  {   811,   5,  16,   5,    0,  -12, GLYPH_RAW },   // 0x7B '{'
+  {   821,   1,  16,   4,    1,  -12, GLYPH_RAW },   // 0x7C '|'
+  {   823,   5,  16,   5,    0,  -12, GLYPH_RAW },   // 0x7D '}'
+  {   833,   7,   2,   9,    1,   -5, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t UbuntuRegular8pt7b = {
+  UbuntuRegular8pt7bData,
+  UbuntuRegular8pt7bGlyphs,
+  NULL,
+  0x20, 0x7E, 18 };
+
+// 95 glyphs, 835 bytes of glyph data
@@ -0,0 +1,194 @@
+// This is a generated file, please do not edit it! Use generate_fonts.py
+// Source: openrtx/include/fonts/adafruit/UbuntuRegular9pt7b.h
+
+static const uint8_t UbuntuRegular9pt7bData[] = {
+  0xFF, 0x30, 0x99, 0x99, 0x90, 0x10, 0x84, 0x21, 0x0B, 0xFF, 0x21, 0x08,
+  0x42, 0x10, 0x84, 0xFF, 0xD0, 0x84, 0x21, 0x08, 0x10, 0x10, 0x3C, 0x42,
+  0x80, 0x80, 0x40, 0x30, 0x0C, 0x02, 0x01, 0x01, 0x82, 0x7C, 0x10, 0x10,
+  0x70, 0x24, 0x42, 0x22, 0x21, 0x11, 0x08, 0x90, 0x39, 0x00, 0x09, 0xC0,
+  0x91, 0x08, 0x88, 0x44, 0x44, 0x22, 0x40, 0xE0, 0x3C, 0x10, 0x84, 0x21,
+  0x08, 0x24, 0x0E, 0x04, 0x86, 0x12, 0x82, 0xA0, 0x44, 0x28, 0xF1, 0xF8,
+  0x12, 0x24, 0x48, 0x88, 0x88, 0x88, 0x44, 0x22, 0x10, 0x84, 0x42, 0x21,
+  0x11, 0x11, 0x11, 0x22, 0x44, 0x80, 0x10, 0x22, 0x4B, 0xE2, 0x85, 0x11,
+  0x00, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0x55, 0x80, 0xF0, 0xC0,
+  0x02, 0x08, 0x10, 0x20, 0x81, 0x02, 0x08, 0x10, 0x20, 0x81, 0x02, 0x08,
+  0x10, 0x20, 0x80, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x42, 0x3C, 0x13, 0x59, 0x11, 0x11, 0x11, 0x11, 0x38, 0x8A, 0x08,
+  0x10, 0x20, 0x82, 0x08, 0x20, 0x82, 0x07, 0xF0, 0x7C, 0x82, 0x01, 0x01,
+  0x06, 0x38, 0x06, 0x01, 0x01, 0x01, 0x82, 0x7C, 0x02, 0x06, 0x0A, 0x12,
+  0x22, 0x22, 0x42, 0x82, 0xFF, 0x02, 0x02, 0x02, 0x7F, 0x40, 0x40, 0x40,
+  0x40, 0x7C, 0x02, 0x01, 0x01, 0x01, 0x82, 0x7C, 0x0E, 0x30, 0x40, 0x40,
+  0x80, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x42, 0x3C, 0xFF, 0x02, 0x02, 0x04,
+  0x08, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x3C, 0x42, 0x81, 0x81,
+  0x42, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x3C, 0x42, 0x81, 0x81,
+  0x81, 0x41, 0x3F, 0x01, 0x02, 0x02, 0x0C, 0x70, 0xC1, 0x80, 0x50, 0x01,
+  0x56, 0x01, 0x06, 0x08, 0x30, 0xC0, 0x30, 0x08, 0x06, 0x01, 0x08, 0xF1,
+  0x80, 0x80, 0x60, 0x10, 0x0C, 0x03, 0x0C, 0x10, 0x60, 0x80, 0x7A, 0x10,
+  0x41, 0x08, 0x42, 0x08, 0x00, 0x02, 0x08, 0x0F, 0x81, 0x83, 0x10, 0x04,
+  0x8F, 0x28, 0x88, 0xC8, 0x46, 0x42, 0x32, 0x11, 0x90, 0x8C, 0x44, 0x91,
+  0xD8, 0x80, 0x03, 0x00, 0x07, 0xC0, 0x04, 0x00, 0x80, 0x28, 0x05, 0x01,
+  0x10, 0x22, 0x08, 0x21, 0x04, 0x3F, 0x88, 0x09, 0x01, 0x40, 0x10, 0xFC,
+  0x41, 0x20, 0x50, 0x28, 0x27, 0xF2, 0x05, 0x01, 0x80, 0xC0, 0x60, 0x5F,
+  0xC0, 0x0F, 0x8C, 0x14, 0x01, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x40,
+  0x10, 0x03, 0x04, 0x3E, 0xFC, 0x20, 0xC8, 0x0A, 0x02, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0xA0, 0x28, 0x33, 0xF0, 0xFF, 0x02, 0x04, 0x08, 0x1F,
+  0xA0, 0x40, 0x81, 0x02, 0x07, 0xF0, 0xFF, 0x02, 0x04, 0x08, 0x1F, 0xA0,
+  0x40, 0x81, 0x02, 0x04, 0x00, 0x1F, 0x10, 0x50, 0x10, 0x08, 0x04, 0x02,
+  0x03, 0x01, 0x80, 0xA0, 0x48, 0x23, 0xF0, 0x01, 0x72, 0x72, 0x72, 0x72,
+  0x7B, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x0C, 0x02, 0x04, 0x08, 0x10,
+  0x20, 0x40, 0x81, 0x02, 0x06, 0x13, 0xC0, 0x81, 0x41, 0x23, 0x12, 0x0A,
+  0x06, 0x02, 0x81, 0x30, 0x84, 0x41, 0x20, 0x50, 0x10, 0x81, 0x02, 0x04,
+  0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x07, 0xF0, 0x40, 0x13, 0x01, 0x94,
+  0x0C, 0xA0, 0xA4, 0x85, 0x24, 0x4A, 0x22, 0x30, 0xA1, 0x85, 0x0C, 0x10,
+  0x60, 0x03, 0x00, 0x10, 0x80, 0xE0, 0x68, 0x32, 0x19, 0x0C, 0x46, 0x13,
+  0x05, 0x82, 0xC0, 0xE0, 0x30, 0x10, 0x0F, 0x03, 0x0C, 0x40, 0x24, 0x02,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x40, 0x24, 0x02, 0x30, 0xC0, 0xF0,
+  0xFC, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0xFC, 0x80, 0x80, 0x80, 0x80,
+  0x0F, 0x03, 0x0C, 0x40, 0x24, 0x02, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x40, 0x24, 0x02, 0x30, 0xC0, 0xF0, 0x02, 0x00, 0x10, 0x00, 0xE0, 0xFC,
+  0x41, 0x20, 0x50, 0x28, 0x14, 0x13, 0xF1, 0x08, 0x82, 0x40, 0xA0, 0x50,
+  0x10, 0x3C, 0x42, 0x80, 0x80, 0x40, 0x30, 0x0C, 0x02, 0x01, 0x01, 0x82,
+  0x7C, 0x09, 0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x40, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x50, 0x47, 0xC0, 0x80, 0x28, 0x09, 0x01, 0x20, 0x22, 0x08, 0x41,
+  0x04, 0x40, 0x88, 0x11, 0x01, 0x40, 0x28, 0x02, 0x00, 0x80, 0x00, 0xC0,
+  0x40, 0x50, 0x20, 0x48, 0x28, 0x24, 0x14, 0x11, 0x0B, 0x10, 0x88, 0x88,
+  0x44, 0x44, 0x14, 0x14, 0x0A, 0x0A, 0x02, 0x02, 0x01, 0x01, 0x00, 0x80,
+  0x50, 0x22, 0x10, 0x48, 0x12, 0x03, 0x00, 0xC0, 0x48, 0x21, 0x08, 0x44,
+  0x0A, 0x01, 0x80, 0x28, 0x08, 0x82, 0x10, 0x41, 0x10, 0x14, 0x01, 0x00,
+  0x20, 0x04, 0x00, 0x80, 0x10, 0x02, 0x00, 0xFF, 0x01, 0x02, 0x04, 0x08,
+  0x08, 0x10, 0x20, 0x20, 0x40, 0x80, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0xF0, 0x80, 0x81, 0x02, 0x02, 0x04, 0x08, 0x08, 0x10,
+  0x20, 0x20, 0x40, 0x80, 0x81, 0x02, 0x02, 0xF1, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xF0, 0x08, 0x0A, 0x05, 0x04, 0x44, 0x12, 0x0A, 0x02,
+  0x09, 0x88, 0x80, 0x7C, 0x04, 0x0B, 0xF8, 0x30, 0x60, 0xC1, 0x7E, 0x80,
+  0x40, 0x20, 0x10, 0x08, 0x05, 0xF3, 0x05, 0x01, 0x80, 0xC0, 0x60, 0x30,
+  0x18, 0x17, 0xF0, 0x3E, 0x82, 0x04, 0x08, 0x10, 0x20, 0x20, 0x3E, 0x00,
+  0x80, 0x40, 0x20, 0x10, 0x09, 0xF5, 0x07, 0x01, 0x80, 0xC0, 0x60, 0x30,
+  0x14, 0x09, 0xFC, 0x3C, 0x42, 0x81, 0x81, 0xFF, 0x80, 0x80, 0x40, 0x3E,
+  0x3D, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x20, 0x82, 0x00, 0x3F,
+  0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x01, 0x02, 0x7C, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0xCF, 0xF8, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x81,
+  0x02, 0x04, 0x08, 0x10, 0x63, 0x48, 0xA1, 0x82, 0xC4, 0x48, 0x50, 0x40,
+  0x92, 0x49, 0x24, 0x92, 0x48, 0xC0, 0xF9, 0xE4, 0x30, 0xA0, 0x83, 0x04,
+  0x18, 0x20, 0xC1, 0x06, 0x08, 0x30, 0x41, 0x82, 0x08, 0xFC, 0x82, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x3E, 0x20, 0xA0, 0x30, 0x18, 0x0C,
+  0x06, 0x02, 0x82, 0x3E, 0x00, 0xFE, 0x40, 0xA0, 0x30, 0x18, 0x0C, 0x06,
+  0x03, 0x82, 0xBE, 0x40, 0x20, 0x10, 0x00, 0x3F, 0xA0, 0x60, 0x30, 0x18,
+  0x0C, 0x06, 0x02, 0x83, 0x3E, 0x80, 0x40, 0x20, 0x10, 0xFE, 0x08, 0x20,
+  0x82, 0x08, 0x20, 0x80, 0x7E, 0x08, 0x10, 0x30, 0x20, 0x41, 0xF8, 0x84,
+  0x21, 0xF8, 0x42, 0x10, 0x84, 0x20, 0xF0, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x41, 0x3F, 0x80, 0xA0, 0x90, 0x48, 0x22, 0x21, 0x10, 0x50,
+  0x28, 0x08, 0x00, 0x82, 0x0C, 0x10, 0x51, 0x44, 0x8A, 0x24, 0x51, 0x14,
+  0x50, 0xA2, 0x82, 0x08, 0x10, 0x40, 0x80, 0xA0, 0x88, 0x82, 0x80, 0x80,
+  0xA0, 0x88, 0x82, 0x80, 0x80, 0x80, 0xA0, 0x90, 0x44, 0x42, 0x20, 0xA0,
+  0x50, 0x10, 0x08, 0x04, 0x04, 0x1C, 0x00, 0xFC, 0x10, 0x84, 0x20, 0x84,
+  0x20, 0xFC, 0x19, 0x08, 0x42, 0x10, 0x84, 0xC1, 0x08, 0x42, 0x10, 0x84,
+  0x18, 0x0F, 0x20, 0xC1, 0x08, 0x42, 0x10, 0x84, 0x19, 0x08, 0x42, 0x10,
+  0x84, 0xC0, 0x61, 0x99, 0x86 };
+
+static const packedGlyph_t UbuntuRegular9pt7bGlyphs[] = {
+  {     0,   0,   1,   4,    0,    0, GLYPH_RAW },   // 0x20 ' '
+  {     0,   1,  12,   5,    2,  -11, GLYPH_RAW },   // 0x21 '!'
+  {     2,   4,   5,   8,    1,  -13, GLYPH_RAW },   // 0x22 '"'
+  {     5,  10,  12,  12,    1,  -11, GLYPH_RAW },   // 0x23 '#'
+  {    20,   8,  16,  10,    1,  -13, GLYPH_RAW },   // 0x24 '$'
+  {    36,  13,  12,  15,    1,  -11, GLYPH_RAW },   // 0x25 '%'
+  {    56,  10,  12,  12,    1,  -11, GLYPH_RAW },   // 0x26 '&'
+  {    71,   1,   5,   4,    1,  -13, GLYPH_RAW },   // 0x27 '\''
+  {    72,   4,  17,   6,    1,  -13, GLYPH_RAW },   // 0x28 '('
+  {    81,   4,  17,   6,    1,  -13, GLYPH_RAW },   // 0x29 ')'
+  {    90,   7,   7,   9,    1,  -11, GLYPH_RAW },   // 0x2A '*'
+  {    97,   7,   7,  10,    1,   -8, GLYPH_RAW },   // 0x2B '+'
+  {   104,   2,   5,   4,    0,   -1, GLYPH_RAW },   // 0x2C ','
+  {   106,   4,   1,   6,    1,   -5, GLYPH_RAW },   // 0x2D '-'
+  {   107,   1,   2,   4,    1,   -1, GLYPH_RAW },   // 0x2E '.'
+  {   108,   7,  17,   7,    0,  -13, GLYPH_RAW },   // 0x2F '/'
+  {   123,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x30 '0'
+  {   135,   4,  12,  10,    2,  -11, GLYPH_RAW },   // 0x31 '1'
+  {   141,   7,  12,  10,    1,  -11, GLYPH_RAW },   // 0x32 '2'
+  {   152,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x33 '3'
+  {   164,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x34 '4'
+  {   176,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x35 '5'
+  {   188,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x36 '6'
+  {   200,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x37 '7'
+  {   212,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x38 '8'
+  {   224,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x39 '9'
+  {   236,   1,   9,   4,    1,   -8, GLYPH_RAW },   // 0x3A ':'
+  {   238,   2,  12,   4,    0,   -8, GLYPH_RAW },   // 0x3B ';'
+  {   241,   8,   9,  10,    1,   -9, GLYPH_RAW },   // 0x3C '<'
+  {   250,   8,   4,  10,    1,   -7, GLYPH_RLE },   // 0x3D '='
+  {   253,   8,   9,  10,    1,   -9, GLYPH_RAW },   // 0x3E '>'
+  {   262,   6,  12,   7,    1,  -11, GLYPH_RAW },   // 0x3F '?'
+  {   271,  13,  14,  17,    2,  -11, GLYPH_RAW },   // 0x40 '@'
+  {   294,  11,  12,  11,    0,  -11, GLYPH_RAW },   // 0x41 'A'
+  {   311,   9,  12,  12,    2,  -11, GLYPH_RAW },   // 0x42 'B'
+  {   325,  10,  12,  12,    1,  -11, GLYPH_RAW },   // 0x43 'C'
+  {   340,  10,  12,  13,    2,  -11, GLYPH_RAW },   // 0x44 'D'
+  {   355,   7,  12,  10,    2,  -11, GLYPH_RAW },   // 0x45 'E'
+  {   366,   7,  12,  10,    2,  -11, GLYPH_RAW },   // 0x46 'F'
+  {   377,   9,  12,  12,    1,  -11, GLYPH_RAW },   // 0x47 'G'
+  {   391,   9,  12,  13,    2,  -11, GLYPH_RLE },   // 0x48 'H'
+  {   403,   1,  12,   5,    2,  -11, GLYPH_RLE },   // 0x49 'I'
+  {   404,   7,  12,   9,    0,  -11, GLYPH_RAW },   // 0x4A 'J'
+  {   415,   9,  12,  11,    2,  -11, GLYPH_RAW },   // 0x4B 'K'
+  {   429,   7,  12,   9,    2,  -11, GLYPH_RAW },   // 0x4C 'L'
+  {   440,  13,  12,  15,    1,  -11, GLYPH_RAW },   // 0x4D 'M'
+  {   460,   9,  12,  13,    2,  -11, GLYPH_RAW },   // 0x4E 'N'
+  {   474,  12,  12,  14,    1,  -11, GLYPH_RAW },   // 0x4F 'O'
+  {   492,   8,  12,  11,    2,  -11, GLYPH_RAW },   // 0x50 'P'
+  {   504,  12,  15,  14,    1,  -11, GLYPH_RAW },   // 0x51 'Q'
+  {   527,   9,  12,  11,    2,  -11, GLYPH_RAW },   // 0x52 'R'
+  {   541,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x53 'S'
+  {   553,   9,  12,   9,    0,  -11, GLYPH_RLE },   // 0x54 'T'
+  {   566,   9,  12,  13,    2,  -11, GLYPH_RAW },   // 0x55 'U'
+  {   580,  11,  12,  11,    0,  -11, GLYPH_RAW },   // 0x56 'V'
+  {   597,  17,  12,  17,    0,  -11, GLYPH_RAW },   // 0x57 'W'
+  {   623,  10,  12,  10,    0,  -11, GLYPH_RAW },   // 0x58 'X'
+  {   638,  11,  12,  11,    0,  -11, GLYPH_RAW },   // 0x59 'Y'
+  {   655,   8,  12,  10,    1,  -11, GLYPH_RAW },   // 0x5A 'Z'
+  {   667,   4,  17,   6,    2,  -13, GLYPH_RAW },   // 0x5B '['
+  {   676,   7,  17,   7,    0,  -13, GLYPH_RAW },   // 0x5C '\\'
+  {   691,   4,  17,   6,    0,  -13, GLYPH_RAW },   // 0x5D ']'
+  {   700,   9,   7,  10,    1,  -11, GLYPH_RAW },   // 0x5E '^'
+  {   708,   9,   1,   9,    0,    3, GLYPH_RLE },   // 0x5F '_'
+  {   709,   3,   3,   7,    1,  -12, GLYPH_RAW },   // 0x60 '`'
+  {   711,   7,   9,   9,    1,   -8, GLYPH_RAW },   // 0x61 'a'
+  {   719,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x62 'b'
+  {   735,   7,   9,   9,    1,   -8, GLYPH_RAW },   // 0x63 'c'
+  {   743,   9,  14,  11,    1,  -13, GLYPH_RAW },   // 0x64 'd'
+  {   759,   8,   9,  10,    1,   -8, GLYPH_RAW },   // 0x65 'e'
+  {   768,   6,  14,   7,    1,  -13, GLYPH_RAW },   // 0x66 'f'
+  {   779,   8,  12,  10,    1,   -8, GLYPH_RAW },   // 0x67 'g'
+  {   791,   8,  14,  10,    1,  -13, GLYPH_RAW },   // 0x68 'h'
+  {   805,   1,  13,   3,    1,  -12, GLYPH_RAW },   // 0x69 'i'
+  {   807,   4,  16,   3,   -2,  -12, GLYPH_RAW },   // 0x6A 'j'
+  {   815,   7,  14,   9,    1,  -13, GLYPH_RAW },   // 0x6B 'k'
+  {   828,   3,  14,   4,    1,  -13, GLYPH_RAW },   // 0x6C 'l'
+  {   834,  13,   9,  15,    1,   -8, GLYPH_RAW },   // 0x6D 'm'
+  {   849,   8,   9,  10,    1,   -8, GLYPH_RAW },   // 0x6E 'n'
+  {   858,   9,   9,  11,    1,   -8, GLYPH_RAW },   // 0x6F 'o'
+  {   869,   9,  12,  11,    1,   -8, GLYPH_RAW },   // 0x70 'p'
+  {   883,   9,  12,  11,    1,   -8, GLYPH_RAW },   // 0x71 'q'
+  {   897,   6,   9,   7,    1,   -8, GLYPH_RAW },   // 0x72 'r'
+  {   904,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x73 's'
+  {   911,   5,  12,   7,    1,  -11, GLYPH_RAW },   // 0x74 't'
+  {   919,   8,   9,  10,    1,   -8, GLYPH_RAW },   // 0x75 'u'
+  {   928,   9,   9,   9,    0,   -8, GLYPH_RAW },   // 0x76 'v'
+  {   939,  13,   9,  13,    0,   -8, GLYPH_RAW },   // 0x77 'w'
+  {   954,   9,   9,   9,    0,   -8, GLYPH_RAW },   // 0x78 'x'
+  {   965,   9,  12,   9,    0,   -8, GLYPH_RAW },   // 0x79 'y'
+  {   979,   6,   9,   8,    1,   -8, GLYPH_RAW },   // 0x7A 'z'
+  {   986,   5,  17,   6,    0,  -13, GLYPH_RAW },   // 0x7B '{'
+  {   997,   1,  17,   5,    2,  -13, GLYPH_RLE },   // 0x7C '|'
+  {   999,   5,  17,   6,    1,  -13, GLYPH_RAW },   // 0x7D '}'
+  {  1010,   8,   3,  10,    1,   -5, GLYPH_RAW } }; // 0x7E '~'
+
+static const packedFont_t UbuntuRegular9pt7b = {
+  UbuntuRegular9pt7bData,
+  UbuntuRegular9pt7bGlyphs,
+  NULL,
+  0x20, 0x7E, 20 };
+
+// 95 glyphs, 1013 bytes of glyph data
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef PACKEDFONT_H
+#define PACKEDFONT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Compact font format, generated from the Adafruit GFX fonts by
+ * scripts/generate_fonts.py.
+ *
+ * Glyph bitmaps have no empty columns at their sides and are stored in one of
+ * two encodings, whichever is smaller:
+ *
+ * - GLYPH_RAW: one bit per pixel, rows packed one after the other starting
+ *   from the most significant bit, as in the Adafruit GFX fonts.
+ * - GLYPH_RLE: alternating runs of unset and set pixels, starting with unset
+ *   ones and running across rows. Each run is stored in nibbles, starting from
+ *   the most significant one: a run of 15 or more pixels continues in the
+ *   following nibble, a nibble below 15 ends the run.
+ */
+enum glyphEncoding
+{
+    GLYPH_RAW = 0,
+    GLYPH_RLE = 1
+};
+
+typedef struct
+{
+    uint16_t offset;      // Offset of the glyph bitmap in the font data
+    uint8_t  width;       // Bitmap width, in pixels
+    uint8_t  height;      // Bitmap height, in pixels
+    uint8_t  xAdvance;    // Distance to advance the cursor (x axis)
+    int8_t   xOffset;     // X distance from the cursor to the top left corner
+    int8_t   yOffset;     // Y distance from the cursor to the top left corner
+    uint8_t  encoding;    // Bitmap encoding, from enum glyphEncoding
+}
+packedGlyph_t;
+
+typedef struct
+{
+    const uint8_t       *data;      // Glyph bitmaps
+    const packedGlyph_t *glyph;     // Glyph array
+    const uint8_t       *index;     // Glyph of each character, NULL if the
+                                    // glyph array has all of them
+    uint8_t              first;     // First character
+    uint8_t              last;      // Last character
+    uint8_t              yAdvance;  // Newline distance (y axis)
+}
+packedFont_t;
+
+/**
+ * Get the glyph of a character. Characters without a glyph get the one of the
+ * first character of the font, the space.
+ *
+ * @param font: font.
+ * @param c: character.
+ * @return pointer to the glyph of the character.
+ */
+static inline const packedGlyph_t *packedFont_glyph(const packedFont_t *font,
+                                                    const char c)
+{
+    uint8_t code = (uint8_t) c;
+
+    if((code < font->first) || (code > font->last))
+        return &font->glyph[0];
+
+    if(font->index == NULL)
+        return &font->glyph[code - font->first];
+
+    return &font->glyph[font->index[code - font->first]];
+}
+
+#endif /* PACKEDFONT_H */
@@ -55,13 +55,57 @@ void display_terminate();
 /**
  * Copy a given section, between two given rows, of framebuffer content to the
  * display. This function blocks the caller until render is completed.
+ * Rows are expressed in pixels also for displays organized in pages of pixel
+ * rows: drivers of these displays copy all the pages covering the section.
+ * An asynchronous transfer in progress is completed before starting the new
+ * one.
  *
  * @param startRow: first row of the framebuffer section to be copied
- * @param endRow: last row of the framebuffer section to be copied
+ * @param endRow: row following the last one of the framebuffer section to be
+ * copied
  * @param fb: pointer to frameBuffer.
  */
 void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb);
 
+/**
+ * Start copying a given section, between two given rows, of framebuffer
+ * content to the display and return without waiting for the transfer to
+ * complete. An asynchronous transfer in progress is completed before starting
+ * the new one.
+ * The content of the section is read during the transfer, thus it must not be
+ * modified until display_renderingInProgress() returns false.
+ *
+ * NOTE: only the drivers of the targets defining CONFIG_DISPLAY_ASYNC in
+ * hwconfig.h provide this function.
+ *
+ * @param startRow: first row of the framebuffer section to be copied
+ * @param endRow: row following the last one of the framebuffer section to be
+ * copied
+ * @param rows: pointer to the content of the framebuffer section, starting
+ * from its first row.
+ */
+void display_renderRowsAsync(uint8_t startRow, uint8_t endRow,
+                             const void *rows);
+
+/**
+ * Check if an asynchronous transfer to the display is in progress.
+ *
+ * NOTE: only the drivers of the targets defining CONFIG_DISPLAY_ASYNC in
+ * hwconfig.h provide this function.
+ *
+ * @return true if a transfer is in progress.
+ */
+bool display_renderingInProgress();
+
+/**
+ * Block the caller until the asynchronous transfer to the display in progress,
+ * if any, is completed.
+ *
+ * NOTE: only the drivers of the targets defining CONFIG_DISPLAY_ASYNC in
+ * hwconfig.h provide this function.
+ */
+void display_waitRender();
+
 /**
  * Copy framebuffer content to the display internal buffer, to be called
  * whenever there is need to update the display.
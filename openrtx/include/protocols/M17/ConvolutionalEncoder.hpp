@@ -13,10 +13,56 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <array>
+#include <utility>
 
 namespace M17
 {
 
+/**
+ * Compute bit by bit the convolutional encoding of a byte, using the M17
+ * encoding scheme.
+ *
+ * \param memory: initial content of the encoder memory.
+ * \param value: byte to be convolved.
+ * \return result of the convolutional encoding process, most significant bit
+ * first.
+ */
+constexpr uint16_t convolveBits(uint8_t memory, uint8_t value)
+{
+    uint16_t result = 0;
+
+    for(uint8_t i = 0; i < 8; i++)
+    {
+        memory  = ((memory << 1) | ((value & 0x80) >> 7)) & 0x1F;
+        result  = (result << 1) | (__builtin_popcount(memory & 0x19) & 0x01);
+        result  = (result << 1) | (__builtin_popcount(memory & 0x17) & 0x01);
+        value <<= 1;
+    }
+
+    return result;
+}
+
+template < size_t... I >
+constexpr std::array< uint16_t, sizeof...(I) >
+makeConvolutionTable(const bool byMemory, std::index_sequence< I... >)
+{
+    return {{ __builtin_bswap16(byMemory ? convolveBits(I, 0x00)
+                                         : convolveBits(0x00, I))... }};
+}
+
+/*
+ * Convolutional encoding lookup tables, storing the encoded data in memory
+ * order. Being the code linear, the encoding of a byte is the XOR between the
+ * encoding of the byte starting from an empty memory and the encoding of a
+ * zero byte starting from the current memory content. Only the four least
+ * significant bits of the memory affect the output.
+ */
+static constexpr auto CONV_BYTE_TABLE =
+    makeConvolutionTable(false, std::make_index_sequence< 256 >{});
+static constexpr auto CONV_MEMORY_TABLE =
+    makeConvolutionTable(true, std::make_index_sequence< 16 >{});
+
 /**
  * Convolutional encoder tailored on M17 protocol specifications, requiring a
  * coder rate R = 1/2, a constraint length K = 5 and polynomials G1 = 0x19 and
@@ -79,23 +125,15 @@ private:
      * \param value: byte to be convolved.
      * \return result of the convolutional encoding process.
      */
-    uint16_t convolveByte(uint8_t value)
+    uint16_t convolveByte(const uint8_t value)
     {
-        uint16_t result = 0;
-
-        for(uint8_t i = 0; i < 8; i++)
-        {
-            memory  = (memory << 1) | ((value & 0x80) >> 7);
-            memory &= 0x1F;
-            result  = (result << 1) | (__builtin_popcount(memory & 0x19) & 0x01);
-            result  = (result << 1) | (__builtin_popcount(memory & 0x17) & 0x01);
-            value <<= 1;
-        }
+        uint16_t result = CONV_BYTE_TABLE[value] ^ CONV_MEMORY_TABLE[memory];
+        memory = value & 0x0F;
 
-        return __builtin_bswap16(result);
+        return result;
     }
 
-    uint8_t memory = 0;    ///< Convolutional encoder memory.
+    uint8_t memory = 0;    ///< Encoder memory, last four input bits.
 };
 
 }      // namespace M17
@@ -38,8 +38,9 @@ public:
     void sample(const int16_t sample)
     {
         samples[sampIdx] = sample;
+        samples[sampIdx + SYNCWORD_SAMPLES] = sample;
         prevIdx = sampIdx;
-        sampIdx = (sampIdx + 1) % SYNCWORD_SAMPLES;
+        sampIdx = (sampIdx == SYNCWORD_SAMPLES - 1) ? 0 : sampIdx + 1;
     }
 
     /**
@@ -51,13 +52,39 @@ public:
      */
     int32_t convolve(const std::array< int8_t, SYNCW_SIZE >& syncword)
     {
+        const int16_t *x = &samples[prevIdx + SAMPLES_PER_SYM];
         int32_t conv = 0;
-        size_t  pos  = prevIdx + SAMPLES_PER_SYM;
 
-        for(auto& sym : syncword)
+        for(size_t i = 0; i < SYNCW_SIZE; i++)
+            conv += (int32_t) syncword[i] * (int32_t) x[i * SAMPLES_PER_SYM];
+
+        return conv;
+    }
+
+    /**
+     * Compute the convolution products between the samples stored in the
+     * correlator memory and a set of target syncwords, with a single pass over
+     * the correlator memory. Syncwords which are the negation of one of the
+     * given ones do not need to be checked separately, as their convolution
+     * product is the negation of the corresponding one.
+     *
+     * @param syncwords: symbols of the target syncwords.
+     * @return convolution products, one for each syncword.
+     */
+    template < size_t M >
+    std::array< int32_t, M >
+    convolve(const std::array< std::array< int8_t, SYNCW_SIZE >, M >& syncwords)
+    {
+        const int16_t *x = &samples[prevIdx + SAMPLES_PER_SYM];
+        std::array< int32_t, M > conv;
+        conv.fill(0);
+
+        for(size_t i = 0; i < SYNCW_SIZE; i++)
         {
-            conv += (int32_t) sym * (int32_t) samples[pos % SYNCWORD_SAMPLES];
-            pos  += SAMPLES_PER_SYM;
+            int32_t sample = x[i * SAMPLES_PER_SYM];
+
+            for(size_t j = 0; j < M; j++)
+                conv[j] += (int32_t) syncwords[j][i] * sample;
         }
 
         return conv;
@@ -108,7 +135,8 @@ public:
     }
 
     /**
-     * Access the internal sample memory.
+     * Access the internal sample memory. The first (SYNCW_SIZE * SAMPLES_PER_SYM)
+     * elements form a circular buffer containing the past samples.
      *
      * @return a pointer to the correlator memory.
      */
@@ -143,9 +171,9 @@ private:
 
     static constexpr size_t SYNCWORD_SAMPLES = SYNCW_SIZE * SAMPLES_PER_SYM;
 
-    int16_t samples[SYNCWORD_SAMPLES];  ///< Samples' storage
-    size_t  sampIdx;                    ///< Index of the next sample to write
-    size_t  prevIdx;                    ///< Index of the last written sample
+    int16_t samples[2 * SYNCWORD_SAMPLES];  ///< Samples' storage, stored twice
+    size_t  sampIdx;                        ///< Index of the next sample to write
+    size_t  prevIdx;                        ///< Index of the last written sample
 };
 
 #endif
@@ -69,6 +69,12 @@ static constexpr std::array<float, 41> rrc_taps_24k =
     -0.001227380092907312, -0.002021130037130002,
 };
 
+/*
+ * Coefficients for M17 RRC filters, in Q15 fixed point format
+ */
+static constexpr std::array<int16_t, 81> rrc_taps_48k_q15 = firTapsToQ15(rrc_taps_48k);
+static constexpr std::array<int16_t, 41> rrc_taps_24k_q15 = firTapsToQ15(rrc_taps_24k);
+
 /*
  * FIR implementations of the RRC filter for baseband audio generation.
  */
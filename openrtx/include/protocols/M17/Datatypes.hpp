@@ -23,6 +23,10 @@ using lich_t    = std::array< uint8_t, 12 >;   // Data type for Golay(24,12) enc
 using frame_t   = std::array< uint8_t, 48 >;   // Data type for a full M17 data frame, including sync word
 using syncw_t   = std::array< uint8_t, 2  >;   // Data type for a sync word
 
+// Data type for a full M17 data frame, including sync word, with one soft
+// decision value per bit: 0x0000 is a certain zero, 0xFFFF a certain one.
+using soft_frame_t = std::array< uint16_t, 384 >;
+
 enum DataMode
 {
     DATAMODE_PACKET = 0,
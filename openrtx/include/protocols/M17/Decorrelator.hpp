@@ -13,6 +13,7 @@
 
 #include <string>
 #include <array>
+#include "Utils.hpp"
 
 namespace M17
 {
@@ -45,6 +46,24 @@ inline void decorrelate(std::array< uint8_t, N >& data)
     }
 }
 
+/**
+ * Decorrelate soft decision data. A soft bit is inverted in place of each bit
+ * set to one in the decorrelation sequence.
+ *
+ * \param data: soft bit array to be decorrelated, one bit per element.
+ */
+template <size_t N >
+inline void decorrelate(std::array< uint16_t, N >& data)
+{
+    static_assert(N <= sequence.size() * 8, "Input exceeds sequence length");
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if(getBit(sequence, i))
+            data[i] = 0xFFFF - data[i];
+    }
+}
+
 }      // namespace M17
 
 #endif // DECORRELATOR_H
@@ -12,6 +12,7 @@
 #endif
 
 #include "core/iir.hpp"
+#include "core/fir.hpp"
 #include <cstdint>
 #include <cstddef>
 #include <memory>
@@ -22,6 +23,7 @@
 #include "core/audio_stream.h"
 #include "protocols/M17/Datatypes.hpp"
 #include "protocols/M17/Constants.hpp"
+#include "protocols/M17/DSP.hpp"
 #include "protocols/M17/Correlator.hpp"
 #include "protocols/M17/Synchronizer.hpp"
 #include "protocols/M17/DevEstimator.hpp"
@@ -72,6 +74,16 @@ public:
      */
     const frame_t& getFrame();
 
+    /**
+     * Returns the soft decision version of the frame decoded from the baseband
+     * signal. Each bit carries a confidence level derived from the distance of
+     * the sample from the symbol decision thresholds.
+     *
+     * @return reference to the internal data structure containing the soft
+     * bits of the last decoded frame.
+     */
+    const soft_frame_t& getSoftFrame();
+
     /**
      * Demodulates data from the ADC and fills the idle frame.
      * Everytime this function is called a whole ADC buffer is consumed.
@@ -81,6 +93,17 @@ public:
      */
     bool update(const bool invertPhase = false);
 
+    /**
+     * Check if a new frame has been fully decoded since the last call to
+     * getFrame() or getSoftFrame().
+     *
+     * @return true if a new frame is available.
+     */
+    bool frameReady() const
+    {
+        return newFrame;
+    }
+
     /**
      * Process a single baseband sample through the demodulation chain.
      *
@@ -89,17 +112,73 @@ public:
      */
     void sample(int16_t rawSample, bool invertPhase = false);
 
+    /**
+     * Process a block of baseband samples through the demodulation chain.
+     * The filtering stages (DC removal, RRC and threshold estimation) are run
+     * over the whole block, only the symbol decisions are taken per-sample.
+     * The result is the same as calling sample() on each element.
+     *
+     * @param samples: pointer to the signed 16-bit baseband samples.
+     * @param length: number of samples in the block.
+     * @param invertPhase: invert the phase of the samples before decoding.
+     */
+    void processBlock(const int16_t *samples, const size_t length,
+                      const bool invertPhase = false);
+
     /**
      * @return true if a demodulator is locked on an M17 stream.
      */
     bool isLocked();
 
+    /**
+     * Set the level of the idle gate. While the demodulator is not locked and
+     * the short-term baseband level stays below the gate level, the syncword
+     * search is suspended. Setting the level to zero disables the gate.
+     *
+     * @param level: gate level, in the same units of the baseband samples.
+     */
+    void setIdleGateLevel(const float level);
+
+    /**
+     * Get the number of blocks processed by processBlock() since the last
+     * reset of the demodulator.
+     *
+     * @return number of processed blocks.
+     */
+    uint32_t processedBlocks();
+
+    /**
+     * Get the number of blocks in which the syncword search has been fully
+     * suspended by the idle gate since the last reset of the demodulator.
+     *
+     * @return number of gated blocks.
+     */
+    uint32_t gatedBlocks();
+
 private:
 
+    /**
+     * Run clock recovery, correlation and the demodulator state machine on
+     * an already filtered baseband sample.
+     *
+     * @param sample: filtered baseband sample.
+     */
+    void demodulate(int16_t sample);
+
+    /**
+     * @return true if the idle gate is closed for the current sample.
+     */
+    inline bool idleGateClosed()
+    {
+        return (demodState == DemodState::UNLOCKED)
+            && (corrThreshold < idleGateLevel);
+    }
+
     /**
      * Quantize a given sample to its corresponding symbol and append it to the
-     * ongoing frame. When a frame is complete, it swaps the pointers and updates
-     * newFrame variable.
+     * ongoing frame, together with the soft decision values of its two bits.
+     * When a frame is complete, it swaps the pointers and updates newFrame
+     * variable.
      *
      * @param sample: baseband sample.
      * @return quantized symbol.
@@ -150,6 +229,13 @@ private:
     static constexpr size_t  FRAME_SAMPLES      = FRAME_SYMBOLS * SAMPLES_PER_SYMBOL;
     static constexpr size_t  SAMPLE_BUF_SIZE    = FRAME_SAMPLES / 2;
     static constexpr size_t  SYNCWORD_SAMPLES   = SAMPLES_PER_SYMBOL * SYNCWORD_SYMBOLS;
+    static constexpr size_t  BLOCK_SIZE         = SAMPLE_BUF_SIZE / 8;
+
+    /**
+     * Default level of the idle gate, about 24dB below the level of a nominal
+     * M17 baseband signal.
+     */
+    static constexpr float   IDLE_GATE_LEVEL    = 256.0f;
 
     /**
      * Internal state of the demodulator.
@@ -169,12 +255,24 @@ private:
     static constexpr std::array < float, 3 > sfNum = {4.24433681e-05f, 8.48867363e-05f, 4.24433681e-05f};
     static constexpr std::array < float, 3 > sfDen = {1.0f,           -1.98148851f,     0.98165828f};
 
+    /**
+     * Syncwords searched by the correlator while unlocked. The stream syncword
+     * is the negation of the LSF one, thus its correlation is not computed.
+     */
+    static constexpr std::array < std::array < int8_t, SYNCWORD_SYMBOLS >, 2 > syncwords =
+    {{
+        {{ +3, +3, +3, +3, -3, -3, +3, -3 }},   // LSF
+        {{ +3, -3, +3, +3, -3, -3, -3, -3 }}    // Packet
+    }};
+
     DemodState                     demodState;      ///< Demodulator state
     std::unique_ptr< int16_t[] >   baseband_buffer; ///< Buffer for baseband audio handling.
     streamId                       basebandId;      ///< Id of the baseband input stream.
     pathId                         basebandPath;    ///< Id of the baseband input path.
     std::unique_ptr<frame_t >      demodFrame;      ///< Frame being demodulated.
     std::unique_ptr<frame_t >      readyFrame;      ///< Fully demodulated frame to be returned.
+    std::unique_ptr<soft_frame_t > demodSoftFrame;  ///< Soft bits of the frame being demodulated.
+    std::unique_ptr<soft_frame_t > readySoftFrame;  ///< Soft bits of the frame to be returned.
     bool                           newFrame;        ///< A new frame has been fully decoded.
     bool                           resetClockRec;   ///< Clock recovery reset request.
     bool                           updateSampPoint; ///< Sampling point update pending.
@@ -185,13 +283,19 @@ private:
     uint8_t                        missedSyncs;     ///< Counter of missed synchronizations
     uint32_t                       initCount;       ///< Downcounter for initialization
     float                          corrThreshold;   ///< Correlation threshold
+    float                          idleGateLevel;   ///< Level of the idle gate
+    uint32_t                       blockCount;      ///< Counter of processed blocks
+    uint32_t                       gatedCount;      ///< Counter of gated blocks
     struct dcBlock                 dcBlock;         ///< State of the DC removal filter
+    std::array< int16_t, BLOCK_SIZE > blockSamples; ///< Filtered samples of the current block
+    std::array< float,   BLOCK_SIZE > blockValues;  ///< Scratch buffer for block filtering
 
     Correlator   < SYNCWORD_SYMBOLS, SAMPLES_PER_SYMBOL > correlator;
     Synchronizer < SYNCWORD_SYMBOLS, SAMPLES_PER_SYMBOL > lsfSync   {{ +3, +3, +3, +3, -3, -3, +3, -3 }};
     Synchronizer < SYNCWORD_SYMBOLS, SAMPLES_PER_SYMBOL > streamSync{{ -3, -3, -3, -3, +3, +3, -3, +3 }};
     Synchronizer < SYNCWORD_SYMBOLS, SAMPLES_PER_SYMBOL > packetSync{{ +3, -3, +3, +3, -3, -3, -3, -3 }};
     Iir          < 3 >                                        sampleFilter{sfNum, sfDen};
+    FirQ15       < rrc_taps_24k_q15.size() >                  rrc{rrc_taps_24k_q15};
     DevEstimator                                              devEstimator;
     ClockRecovery< SAMPLES_PER_SYMBOL >                       clockRec;
 };
@@ -61,6 +61,17 @@ public:
      */
     FrameType decodeFrame(const frame_t &frame);
 
+    /**
+     * Decode an M17 frame from soft decision data, identifying its type.
+     * Convolutionally encoded data is decoded with a soft decision Viterbi
+     * decoder, while the sync word and the LICH are sliced to hard bits.
+     * Frame data must contain the sync word in the first sixteen elements.
+     *
+     * @param frame: soft bit array containing frame data.
+     * @return the type of frame recognized.
+     */
+    FrameType decodeFrame(const soft_frame_t &frame);
+
     /**
      * Get the latest Link Setup Frame decoded. Check of the validity of the
      * data contained in the LSF is left to application code.
@@ -108,25 +119,64 @@ private:
      * Decode Link Setup Frame data and update the internal LSF field with
      * the new frame data.
      *
-     * @param data: byte array containing frame data, without sync word.
+     * @param frame: byte array containing frame data.
      */
-    void decodeLSF(const std::array<uint8_t, 46> &data);
+    void decodeLSF(const frame_t &frame);
+
+    /**
+     * Decode Link Setup Frame soft decision data and update the internal LSF
+     * field with the new frame data.
+     *
+     * @param frame: soft bit array containing frame data.
+     */
+    void decodeLSF(const soft_frame_t &frame);
 
     /**
      * Decode stream data and update the internal LSF field with the new
      * frame data.
      *
-     * @param data: byte array containing frame data, without sync word.
+     * @param frame: byte array containing frame data.
      */
-    void decodeStream(const std::array<uint8_t, 46> &data);
+    void decodeStream(const frame_t &frame);
+
+    /**
+     * Decode stream soft decision data and update the internal LSF field with
+     * the new frame data.
+     *
+     * @param frame: soft bit array containing frame data.
+     */
+    void decodeStream(const soft_frame_t &frame);
 
     /**
      * Decode packet data and update the internal packet frame field with the
      * new frame data.
      *
-     * @param data: byte array containing frame data, without sync word.
+     * @param frame: byte array containing frame data.
+     */
+    void decodePacket(const frame_t &frame);
+
+    /**
+     * Decode packet soft decision data and update the internal packet frame
+     * field with the new frame data.
+     *
+     * @param frame: soft bit array containing frame data.
+     */
+    void decodePacket(const soft_frame_t &frame);
+
+    /**
+     * Realign the output of the Viterbi decoding of a packet frame.
+     *
+     * @param data: byte array containing the decoded packet data.
+     */
+    void alignPacketData(std::array<uint8_t, PacketFrame::FRAME_SIZE> &data);
+
+    /**
+     * Append the LSF segment contained in a LICH block to the LSF being
+     * reassembled from LICH data.
+     *
+     * @param lich: LICH block.
      */
-    void decodePacket(const std::array<uint8_t, 46> &data);
+    void appendLich(const lich_t &lich);
 
     /**
      * Decode a LICH block.
@@ -144,6 +194,7 @@ private:
     StreamFrame streamFrame;    ///< Latest stream dat frame received.
     PacketFrame packetFrame;    ///< Latest packet data frame received.
     HardViterbi viterbi;        ///< Viterbi decoder.
+    SoftViterbi softViterbi;    ///< Soft decision Viterbi decoder.
 
     ///< Maximum allowed hamming distance when determining the frame type.
     static constexpr uint8_t MAX_SYNC_HAMM_DISTANCE = 4;
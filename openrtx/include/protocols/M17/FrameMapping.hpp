@@ -0,0 +1,345 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ * 
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef FRAME_MAPPING_H
+#define FRAME_MAPPING_H
+
+#ifndef __cplusplus
+#error This header is C++ only!
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <utility>
+#include "CodePuncturing.hpp"
+#include "Decorrelator.hpp"
+#include "Interleaver.hpp"
+#include "Datatypes.hpp"
+#include "Utils.hpp"
+
+namespace M17
+{
+
+/*
+ * Bit mapping tables fusing the puncturing, interleaving and decorrelation
+ * stages of M17 frames into a single bit gathering pass.
+ *
+ * Receive tables are indexed by the position of a symbol in the depunctured
+ * sequence fed to the Viterbi decoder. Each entry holds the position of the
+ * corresponding bit inside the received frame, sync word included, with bit
+ * 15 set when the bit has to be inverted to undo the decorrelation. Punctured
+ * symbols are marked by MAP_PUNCTURED.
+ *
+ * Transmit tables are indexed by the position of a bit inside the payload of
+ * the transmitted frame and hold the position of the corresponding bit inside
+ * the convolutionally encoded data. Decorrelation is applied afterwards, one
+ * byte at a time.
+ */
+
+static constexpr size_t   FRAME_PAYLOAD_BITS = 368;     ///< Frame payload bits
+static constexpr size_t   SYNC_WORD_BITS     = 16;      ///< Sync word bits
+static constexpr size_t   LICH_BITS          = 96;      ///< LICH segment bits
+static constexpr uint16_t MAP_PUNCTURED      = 0xFFFF;  ///< Punctured symbol
+static constexpr uint16_t MAP_INVERTED       = 0x8000;  ///< Inverted bit flag
+static constexpr uint16_t MAP_POSITION       = 0x01FF;  ///< Bit position mask
+
+static_assert(FRAME_PAYLOAD_BITS == sequence.size() * 8,
+              "Decorrelator sequence size mismatch");
+
+/**
+ * Number of bits left by a puncturing matrix in each one of its periods.
+ *
+ * @param matrix: puncturing matrix.
+ * @return number of non-punctured bits.
+ */
+template < size_t P >
+constexpr size_t punctureWeight(const std::array< uint8_t, P >& matrix)
+{
+    size_t weight = 0;
+
+    for(size_t i = 0; i < P; i++)
+        weight += matrix[i];
+
+    return weight;
+}
+
+/**
+ * Compute the length of the symbol sequence obtained by depuncturing a given
+ * amount of bits, rounded up to a whole number of Viterbi decoder steps.
+ *
+ * @param matrix: puncturing matrix.
+ * @param count: number of punctured bits.
+ * @return number of depunctured symbols.
+ */
+template < size_t P >
+constexpr size_t depuncturedSize(const std::array< uint8_t, P >& matrix,
+                                 const size_t count)
+{
+    size_t consumed = 0;
+    size_t symbols  = 0;
+
+    while(consumed < count)
+    {
+        consumed += matrix[symbols % P];
+        symbols  += 1;
+    }
+
+    return (symbols + 1) & ~static_cast< size_t >(1);
+}
+
+/**
+ * Compute the position of a bit of the deinterleaved payload inside a frame,
+ * together with the flag telling whether it has been inverted by the
+ * decorrelator.
+ *
+ * @param index: bit position inside the deinterleaved payload.
+ * @return receive bit map entry.
+ */
+constexpr uint16_t frameBitEntry(const size_t index)
+{
+    // The interleaver permutation is an involution, see static_assert below
+    size_t pos    = INTERLEAVER_TABLE< FRAME_PAYLOAD_BITS >[index];
+    bool inverted = (sequence[pos / 8] >> (7 - (pos % 8))) & 0x01;
+
+    return static_cast< uint16_t >(pos + SYNC_WORD_BITS)
+         | (inverted ? MAP_INVERTED : 0);
+}
+
+/**
+ * Compute an entry of a receive bit map.
+ *
+ * @param matrix: puncturing matrix.
+ * @param offset: position of the first punctured bit in the deinterleaved
+ * payload.
+ * @param count: number of punctured bits.
+ * @param symbol: symbol position in the depunctured sequence.
+ * @return receive bit map entry.
+ */
+template < size_t P >
+constexpr uint16_t rxMapEntry(const std::array< uint8_t, P >& matrix,
+                              const size_t offset, const size_t count,
+                              const size_t symbol)
+{
+    if(matrix[symbol % P] == 0)
+        return MAP_PUNCTURED;
+
+    size_t index = (symbol / P) * punctureWeight(matrix);
+    for(size_t i = 0; i < (symbol % P); i++)
+        index += matrix[i];
+
+    if(index >= count)
+        return MAP_PUNCTURED;
+
+    return frameBitEntry(offset + index);
+}
+
+/**
+ * Compute an entry of a transmit bit map.
+ *
+ * @param matrix: puncturing matrix.
+ * @param index: bit position in the punctured sequence.
+ * @return position of the bit in the depunctured sequence.
+ */
+template < size_t P >
+constexpr uint16_t txMapEntry(const std::array< uint8_t, P >& matrix,
+                              const size_t index)
+{
+    size_t weight = punctureWeight(matrix);
+    size_t pos    = (index / weight) * P;
+    size_t rem    = index % weight;
+
+    for(size_t i = 0; i < P; i++)
+    {
+        if(matrix[i] == 0)
+            continue;
+
+        if(rem == 0)
+            return pos + i;
+
+        rem--;
+    }
+
+    return pos;
+}
+
+/**
+ * Compute an entry of the transmit bit map of a frame.
+ *
+ * @param matrix: puncturing matrix.
+ * @param offset: number of bits preceding the punctured ones, which are
+ * copied as they are.
+ * @param pos: bit position inside the frame payload.
+ * @return position of the bit in the source data.
+ */
+template < size_t P >
+constexpr uint16_t txFrameEntry(const std::array< uint8_t, P >& matrix,
+                                const size_t offset, const size_t pos)
+{
+    size_t index = INTERLEAVER_TABLE< FRAME_PAYLOAD_BITS >[pos];
+
+    if(index < offset)
+        return index;
+
+    return offset + txMapEntry(matrix, index - offset);
+}
+
+template < size_t P, size_t... I >
+constexpr std::array< uint16_t, sizeof...(I) >
+makeRxMap(const std::array< uint8_t, P >& matrix, const size_t offset,
+          const size_t count, std::index_sequence< I... >)
+{
+    return {{ rxMapEntry(matrix, offset, count, I)... }};
+}
+
+template < size_t P, size_t... I >
+constexpr std::array< uint16_t, FRAME_PAYLOAD_BITS >
+makeTxMap(const std::array< uint8_t, P >& matrix, const size_t offset,
+          std::index_sequence< I... >)
+{
+    return {{ txFrameEntry(matrix, offset, I)... }};
+}
+
+template < size_t... I >
+constexpr std::array< uint16_t, sizeof...(I) >
+makeLichMap(std::index_sequence< I... >)
+{
+    return {{ frameBitEntry(I)... }};
+}
+
+template < size_t NB >
+constexpr bool isInvolution(const std::array< uint16_t, NB >& table)
+{
+    for(size_t i = 0; i < NB; i++)
+    {
+        if(table[table[i]] != i)
+            return false;
+    }
+
+    return true;
+}
+
+static_assert(isInvolution(INTERLEAVER_TABLE< FRAME_PAYLOAD_BITS >),
+              "Interleaver permutation is not an involution");
+
+
+static constexpr size_t LSF_SYMBOLS =
+    depuncturedSize(LSF_PUNCTURE, FRAME_PAYLOAD_BITS);
+static constexpr size_t STREAM_SYMBOLS =
+    depuncturedSize(DATA_PUNCTURE, FRAME_PAYLOAD_BITS - LICH_BITS);
+static constexpr size_t PACKET_SYMBOLS =
+    depuncturedSize(PACKET_PUNCTURE, FRAME_PAYLOAD_BITS);
+
+/**
+ * Receive bit map for link setup frames.
+ */
+static constexpr auto LSF_RX_MAP =
+    makeRxMap(LSF_PUNCTURE, 0, FRAME_PAYLOAD_BITS,
+              std::make_index_sequence< LSF_SYMBOLS >{});
+
+/**
+ * Receive bit map for the convolutionally encoded part of stream frames.
+ */
+static constexpr auto STREAM_RX_MAP =
+    makeRxMap(DATA_PUNCTURE, LICH_BITS, FRAME_PAYLOAD_BITS - LICH_BITS,
+              std::make_index_sequence< STREAM_SYMBOLS >{});
+
+/**
+ * Receive bit map for packet frames.
+ */
+static constexpr auto PACKET_RX_MAP =
+    makeRxMap(PACKET_PUNCTURE, 0, FRAME_PAYLOAD_BITS,
+              std::make_index_sequence< PACKET_SYMBOLS >{});
+
+/**
+ * Receive bit map for the LICH segment of stream frames.
+ */
+static constexpr auto LICH_RX_MAP =
+    makeLichMap(std::make_index_sequence< LICH_BITS >{});
+
+/**
+ * Transmit bit map for link setup frames.
+ */
+static constexpr auto LSF_TX_MAP =
+    makeTxMap(LSF_PUNCTURE, 0,
+              std::make_index_sequence< FRAME_PAYLOAD_BITS >{});
+
+/**
+ * Transmit bit map for stream frames. Source data is made by the LICH segment
+ * followed by the convolutionally encoded stream data.
+ */
+static constexpr auto STREAM_TX_MAP =
+    makeTxMap(DATA_PUNCTURE, LICH_BITS,
+              std::make_index_sequence< FRAME_PAYLOAD_BITS >{});
+
+/**
+ * Transmit bit map for packet frames.
+ */
+static constexpr auto PACKET_TX_MAP =
+    makeTxMap(PACKET_PUNCTURE, 0,
+              std::make_index_sequence< FRAME_PAYLOAD_BITS >{});
+
+
+/**
+ * Get a bit from a received frame through a receive bit map entry.
+ *
+ * @param frame: received frame.
+ * @param entry: bit map entry, must not be a punctured one.
+ * @return bit value, decorrelated.
+ */
+template < size_t N >
+inline bool getMappedBit(const std::array< uint8_t, N >& frame,
+                         const uint16_t entry)
+{
+    return getBit(frame, entry & MAP_POSITION) ^ (entry >> 15);
+}
+
+/**
+ * Get a soft bit from a received frame through a receive bit map entry.
+ *
+ * @param frame: received soft decision frame.
+ * @param entry: bit map entry, must not be a punctured one.
+ * @return soft bit value, decorrelated.
+ */
+template < size_t N >
+inline uint16_t getMappedBit(const std::array< uint16_t, N >& frame,
+                             const uint16_t entry)
+{
+    uint16_t mask = -static_cast< uint16_t >(entry >> 15);
+    return frame[entry & MAP_POSITION] ^ mask;
+}
+
+/**
+ * Fill the payload of a frame ready for transmission, gathering the bits of
+ * the source data through a transmit bit map and decorrelating them. The
+ * sync word is left untouched.
+ *
+ * @param source: convolutionally encoded source data.
+ * @param txMap: transmit bit map.
+ * @param frame: destination frame.
+ */
+template < size_t N >
+inline void mapFrame(const std::array< uint8_t, N >& source,
+                     const std::array< uint16_t, FRAME_PAYLOAD_BITS >& txMap,
+                     frame_t& frame)
+{
+    static constexpr size_t SYNC_SIZE = SYNC_WORD_BITS / 8;
+
+    for(size_t i = 0; i < sequence.size(); i++)
+    {
+        const uint16_t *pos = &txMap[8 * i];
+        uint8_t byte = 0;
+
+        for(size_t j = 0; j < 8; j++)
+            byte = (byte << 1) | getBit(source, pos[j]);
+
+        frame[SYNC_SIZE + i] = byte ^ sequence[i];
+    }
+}
+
+}      // namespace M17
+
+#endif // FRAME_MAPPING_H
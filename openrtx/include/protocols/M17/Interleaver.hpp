@@ -11,11 +11,41 @@
 #error This header is C++ only!
 #endif
 
+#include <utility>
 #include "Utils.hpp"
 
 namespace M17
 {
 
+/**
+ * Compute the position of a bit after the interleaving, using the quadratic
+ * permutation polynomial from M17 protocol specification.
+ * Polynomial used is P(x) = 45*x + 92*x^2.
+ *
+ * \param i: bit position before interleaving.
+ * \param NB: size of the interleaved block, in bits.
+ * \return bit position after interleaving.
+ */
+constexpr size_t interleaverIndex(const size_t i, const size_t NB)
+{
+    return ((45 * i) + (92 * i * i)) % NB;
+}
+
+template < size_t NB, size_t... I >
+constexpr std::array< uint16_t, NB >
+makeInterleaverTable(std::index_sequence< I... >)
+{
+    return {{ static_cast< uint16_t >(interleaverIndex(I, NB))... }};
+}
+
+/**
+ * Interleaver permutation table for a block of NB bits, computed at compile
+ * time. Entry i holds the position of the i-th input bit after interleaving.
+ */
+template < size_t NB >
+constexpr std::array< uint16_t, NB > INTERLEAVER_TABLE =
+    makeInterleaverTable< NB >(std::make_index_sequence< NB >{});
+
 /**
  * Interleave a block of data using the quadratic permutation polynomial from
  * M17 protocol specification. Polynomial used is P(x) = 45*x + 92*x^2.
@@ -26,16 +56,10 @@ template < size_t N >
 void interleave(std::array< uint8_t, N >& data)
 {
     std::array< uint8_t, N > interleaved;
+    const auto& table = INTERLEAVER_TABLE< N*8 >;
 
-    static constexpr size_t F1 = 45;
-    static constexpr size_t F2 = 92;
-    static constexpr size_t NB = N*8;
-
-    for(size_t i = 0; i < NB; i++)
-    {
-        size_t index = ((F1 * i) + (F2 * i * i)) % NB;
-        setBit(interleaved, index, getBit(data, i));
-    }
+    for(size_t i = 0; i < N*8; i++)
+        setBit(interleaved, table[i], getBit(data, i));
 
     std::copy(interleaved.begin(), interleaved.end(), data.begin());
 }
@@ -51,16 +75,28 @@ template < size_t N >
 void deinterleave(std::array< uint8_t, N >& data)
 {
     std::array< uint8_t, N > deinterleaved;
+    const auto& table = INTERLEAVER_TABLE< N*8 >;
+
+    for(size_t i = 0; i < N*8; i++)
+        setBit(deinterleaved, i, getBit(data, table[i]));
+
+    std::copy(deinterleaved.begin(), deinterleaved.end(), data.begin());
+}
 
-    static constexpr size_t F1 = 45;
-    static constexpr size_t F2 = 92;
-    static constexpr size_t NB = N*8;
+/**
+ * Perform the deinterleaving operation on a block of soft decision data.
+ * Polynomial used is P(x) = 45*x + 92*x^2.
+ *
+ * \param data: input soft bit array, one bit per element.
+ */
+template < size_t N >
+void deinterleave(std::array< uint16_t, N >& data)
+{
+    std::array< uint16_t, N > deinterleaved;
+    const auto& table = INTERLEAVER_TABLE< N >;
 
-    for(size_t i = 0; i < NB; i++)
-    {
-        size_t index = ((F1 * i) + (F2 * i * i)) % NB;
-        setBit(deinterleaved, i, getBit(data, index));
-    }
+    for(size_t i = 0; i < N; i++)
+        deinterleaved[i] = data[table[i]];
 
     std::copy(deinterleaved.begin(), deinterleaved.end(), data.begin());
 }
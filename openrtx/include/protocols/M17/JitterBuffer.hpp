@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef JITTERBUFFER_H
+#define JITTERBUFFER_H
+
+#ifndef __cplusplus
+#error This header is C++ only!
+#endif
+
+#include <cstdint>
+#include "Datatypes.hpp"
+
+namespace M17
+{
+
+/**
+ * Statistics of the jitter buffer. Latencies go from the beginning of the
+ * over-the-air transmission of a stream frame to the moment its audio starts
+ * to be played.
+ */
+struct JitterStats {
+    uint32_t received;   ///< Stream frames stored in the buffer
+    uint32_t played;     ///< Stream frames played
+    uint32_t concealed;  ///< Missing stream frames replaced by concealment
+    uint32_t underruns;  ///< Concealed frames played with the buffer empty
+    uint32_t late;       ///< Frames discarded, received after their playout
+    uint32_t duplicates; ///< Frames discarded, already in the buffer
+    uint32_t dropped;    ///< Frames discarded to reduce the buffer latency
+    uint16_t jitter;     ///< Estimated arrival jitter, in ms
+    uint16_t latencyMin; ///< Minimum end-to-end latency, in ms
+    uint16_t latencyMax; ///< Maximum end-to-end latency, in ms
+    uint16_t latencyAvg; ///< Average end-to-end latency, in ms
+    uint8_t target;      ///< Current target depth, in stream frames
+    uint8_t level;       ///< Current depth, in stream frames
+};
+
+/**
+ * Adaptive jitter buffer for the voice payload of M17 stream frames.
+ *
+ * Frames are stored by frame number and played in sequence at the pace of the
+ * audio output, one stream frame (two codec2 frames) per call of pop(). The
+ * playout starts once the buffer holds the target number of frames, which is
+ * adapted to the arrival jitter estimated as in RFC 3550. When the buffer
+ * stays above its target for too long, a frame is discarded to bring the
+ * latency back down.
+ *
+ * Missing frames are concealed repeating the last codec2 frame received and,
+ * if the loss lasts more than one stream frame, fading it out by lowering the
+ * energy field of the codec2 3200 bit/s frames.
+ */
+class JitterBuffer
+{
+public:
+    /**
+     * Constructor.
+     */
+    JitterBuffer();
+
+    /**
+     * Destructor.
+     */
+    ~JitterBuffer();
+
+    /**
+     * Discard all the frames stored and restart from an empty buffer, to be
+     * called at the end of a transmission. Statistics are kept.
+     */
+    void reset();
+
+    /**
+     * Clear the statistics.
+     */
+    void resetStats();
+
+    /**
+     * Store the payload of a stream frame.
+     *
+     * @param frameNum: stream frame number, the end of stream flag is ignored.
+     * @param payload: 16 bytes of stream frame payload.
+     * @param now: arrival time, in ms.
+     * @return true if the frame has been stored, false if it has been
+     * discarded being a duplicate or arriving too late.
+     */
+    bool push(const uint16_t frameNum, const uint8_t *payload,
+              const uint32_t now);
+
+    /**
+     * Get the payload of the next stream frame to be played, concealing it if
+     * missing.
+     *
+     * @param payload: place where to store the 16 bytes of payload.
+     * @param now: playout time, in ms.
+     * @param outDelay: time needed to play the audio already queued on the
+     * output, in ms.
+     * @return true if a payload is available, false while the buffer is
+     * filling up.
+     */
+    bool pop(uint8_t *payload, const uint32_t now, const uint32_t outDelay);
+
+    /**
+     * Get the number of stream frames between the next one to be played and
+     * the newest one received, included.
+     *
+     * @return current buffer depth, in stream frames.
+     */
+    uint8_t level() const;
+
+    /**
+     * Get the current statistics.
+     *
+     * @param out: place where to store the statistics.
+     */
+    void getStats(JitterStats &out) const;
+
+    static constexpr uint32_t FRAME_TIME = 40; ///< Stream frame period, in ms
+    static constexpr uint8_t SLOTS = 16;       ///< Buffer capacity, in frames
+    static constexpr uint8_t MIN_DEPTH = 1;    ///< Minimum target depth
+    static constexpr uint8_t MAX_DEPTH = 8;    ///< Maximum target depth
+
+private:
+    /**
+     * Signed distance between two frame numbers, taking into account the
+     * wraparound of the 15 bit frame counter.
+     */
+    static int16_t distance(const uint16_t a, const uint16_t b);
+
+    /**
+     * Check if a frame is stored in the buffer.
+     */
+    bool available(const uint16_t frameNum) const;
+
+    /**
+     * Update the jitter estimate with a new arrival and the target depth.
+     */
+    void updateJitter(const uint16_t frameNum, const uint32_t now);
+
+    /**
+     * Generate the payload replacing a missing frame.
+     */
+    void conceal(uint8_t *payload);
+
+    struct Slot {
+        uint8_t payload[16]; ///< Frame payload
+        uint32_t arrival;    ///< Arrival time, in ms
+        uint16_t frameNum;   ///< Frame number
+        bool valid;          ///< Slot holds a frame not yet played
+    };
+
+    Slot slots[SLOTS];    ///< Frame storage, indexed by frame number.
+    uint8_t last[16];     ///< Payload of the last frame played.
+    uint16_t playNum;     ///< Number of the next frame to be played.
+    uint16_t newest;      ///< Number of the newest frame received.
+    uint16_t lastNum;     ///< Number of the last frame used for the jitter.
+    uint32_t lastArrival; ///< Arrival time of that frame, in ms.
+    uint32_t jitterQ4;    ///< Jitter estimate, in 1/16 of ms.
+    uint8_t target;       ///< Target depth, in frames.
+    uint8_t excess;       ///< Consecutive playouts above the target depth.
+    uint8_t lossRun;      ///< Consecutive codec2 frames concealed.
+    uint8_t stalled;      ///< Frames concealed with the buffer empty.
+    bool haveBase;        ///< At least one frame received.
+    bool haveLast;        ///< At least one frame played.
+    bool started;         ///< Playout started.
+    JitterStats stats;    ///< Statistics.
+    uint64_t latencySum;  ///< Sum of the latencies, for the average.
+
+    ///< Frame number field bits, the remaining one is the end of stream flag.
+    static constexpr uint16_t FN_MASK = 0x7FFF;
+
+    ///< Playouts above the target depth after which a frame is discarded.
+    static constexpr uint8_t SHRINK_DELAY = 25;
+
+    ///< Codec2 frames repeated unchanged before starting to fade out.
+    static constexpr uint8_t REPEAT_FRAMES = 2;
+
+    ///< Energy quantization steps removed for each faded codec2 frame.
+    static constexpr uint8_t FADE_STEP = 4;
+};
+
+} // namespace M17
+
+#endif // JITTERBUFFER_H
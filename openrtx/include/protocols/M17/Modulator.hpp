@@ -14,6 +14,7 @@
 #include "core/audio_stream.h"
 #include "protocols/M17/PwmCompensator.hpp"
 #include "protocols/M17/Constants.hpp"
+#include "protocols/M17/DSP.hpp"
 #include "core/audio_path.h"
 #include <cstdint>
 #include <memory>
@@ -76,6 +77,23 @@ public:
      */
     void stop();
 
+    /**
+     * Generate the baseband signal of a 40ms long block of transmission
+     * preamble, without sending it to the output stage.
+     *
+     * @param baseband: destination buffer, FRAME_SAMPLES elements long.
+     */
+    void preambleToBaseband(stream_sample_t *baseband);
+
+    /**
+     * Generate the baseband signal obtained by 4FSK modulation of a given
+     * frame, without sending it to the output stage.
+     *
+     * @param frame: M17 frame to be modulated.
+     * @param baseband: destination buffer, FRAME_SAMPLES elements long.
+     */
+    void frameToBaseband(const frame_t& frame, stream_sample_t *baseband);
+
     /**
      * Invert baseband signal phase before output.
      *
@@ -83,26 +101,32 @@ public:
      */
     void invertPhase(const bool status);
 
+    static constexpr size_t TX_SAMPLE_RATE     = 48000;
+    static constexpr size_t SAMPLES_PER_SYMBOL = TX_SAMPLE_RATE / SYMBOL_RATE;
+    static constexpr size_t FRAME_SAMPLES      = FRAME_SYMBOLS * SAMPLES_PER_SYMBOL;
+
 private:
 
     /**
      * Generate baseband stream from symbol stream.
+     *
+     * @param baseband: destination buffer, FRAME_SAMPLES elements long.
      */
-    void symbolsToBaseband();
+    void symbolsToBaseband(stream_sample_t *baseband);
 
     /**
      * Emit the baseband stream towards the output stage, platform dependent.
      */
     void sendBaseband();
 
-    static constexpr size_t TX_SAMPLE_RATE     = 48000;
-    static constexpr size_t SAMPLES_PER_SYMBOL = TX_SAMPLE_RATE / SYMBOL_RATE;
-    static constexpr size_t FRAME_SAMPLES      = FRAME_SYMBOLS * SAMPLES_PER_SYMBOL;
-
     static constexpr float  RRC_GAIN          = 23000.0f;
     static constexpr float  RRC_OFFSET        = 0.0f;
 
+    using RrcInterpolator = FirInterpolator< std::tuple_size< decltype(rrc_taps_48k) >::value,
+                                             SAMPLES_PER_SYMBOL >;
+
     std::array< int8_t, FRAME_SYMBOLS > symbols;
+    RrcInterpolator              rrc;              ///< RRC interpolating filter.
     std::unique_ptr< int16_t[] > baseband_buffer;  ///< Buffer for baseband audio handling.
     stream_sample_t              *idleBuffer;      ///< Half baseband buffer, free for processing.
     streamId                     outStream;        ///< Baseband output stream ID.
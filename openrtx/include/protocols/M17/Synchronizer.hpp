@@ -45,9 +45,29 @@ public:
      */
     int8_t update(Correlator< SYNCW_SIZE, SAMPLES_PER_SYM >& correlator,
                   const int32_t posTh, const int32_t negTh)
+    {
+        int32_t corr = correlator.convolve(syncword);
+        return update(corr, correlator.sampleIndex(), posTh, negTh);
+    }
+
+    /**
+     * Perform an update step of the syncronizer using a correlation value
+     * already computed by the caller, for example when the correlations with
+     * multiple syncwords are computed at once.
+     *
+     * @param corr: convolution product between the correlator memory and the
+     * syncword of this synchronizer.
+     * @param sampleIndex: index of the last correlator sample, modulo the
+     * number of samples per symbol.
+     * @param posTh: threshold to detect a positive correlation peak.
+     * @param negTh: threshold to detect a negative correlation peak.
+     * @return +1 if a positive correlation peak has been found, -1 if a negative
+     * correlation peak has been found an zero otherwise.
+     */
+    int8_t update(const int32_t corr, const size_t sampleIndex,
+                  const int32_t posTh, const int32_t negTh)
     {
         int32_t sign    = 0;
-        int32_t corr    = correlator.convolve(syncword);
         bool    trigger = (corr > posTh) || (corr < negTh);
 
         if(trigger == true)
@@ -58,7 +78,7 @@ public:
                 triggered = true;
             }
 
-            values[correlator.sampleIndex()] = corr;
+            values[sampleIndex] = corr;
         }
         else
         {
@@ -14,9 +14,15 @@
 #include <cstdint>
 #include <cstddef>
 #include <array>
-#include <bitset>
+#include <algorithm>
+#include <cstring>
+#include "FrameMapping.hpp"
 #include "Utils.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace M17
 {
 
@@ -34,8 +40,7 @@ public:
     /**
      * Constructor.
      */
-    HardViterbi() : prevMetrics(&prevMetricsData), currMetrics(&currMetricsData)
-    { }
+    HardViterbi() { }
 
     /**
      * Destructor.
@@ -55,8 +60,8 @@ public:
     {
         static_assert(IN*4 < 244, "Input size exceeds max history");
 
-        currMetricsData.fill(0x00);
-        prevMetricsData.fill(0x00);
+        metrics[0].fill(0x00);
+        metrics[1].fill(0x00);
 
         size_t pos = 0;
         for (size_t i = 0; i < IN*8; i += 2)
@@ -85,8 +90,8 @@ public:
     {
         static_assert(IN*4 < 244, "Input size exceeds max history");
 
-        currMetricsData.fill(0x00);
-        prevMetricsData.fill(0x00);
+        metrics[0].fill(0x00);
+        metrics[1].fill(0x00);
 
         size_t   histPos     = 0;
         size_t   punctIndex  = 0;
@@ -119,59 +124,140 @@ public:
         return (chainback(out, histPos) - punctBitCnt) / ((K - 1) >> 1);
     }
 
-private:
-
     /**
-     * Decode one bit and update trellis.
+     * Decode convolutionally encoded data contained in a received frame,
+     * fetching the symbols through a receive bit map. This fuses the
+     * decorrelation, deinterleaving and depuncturing of the frame data with
+     * the decoding.
      *
-     * @param s0: cost of the first symbol.
-     * @param s1: cost of the second symbol.
-     * @param pos: bit position in history.
+     * @param in: received frame, including the sync word.
+     * @param out: destination array where decoded data are written.
+     * @param symbolMap: receive bit map.
+     * @return number of bit errors corrected.
      */
-    void decodeBit(uint8_t s0, uint8_t s1, size_t pos)
+    template < size_t IN, size_t OUT, size_t S >
+    uint16_t decodeMapped(const std::array< uint8_t,  IN  >& in,
+                                std::array< uint8_t,  OUT >& out,
+                          const std::array< uint16_t, S   >& symbolMap)
     {
-        static constexpr uint8_t COST_TABLE_0[] = {0, 0, 0, 0, 2, 2, 2, 2};
-        static constexpr uint8_t COST_TABLE_1[] = {0, 2, 2, 0, 0, 2, 2, 0};
+        static_assert(S/2 <= 244, "Input size exceeds max history");
 
-        for(uint8_t i = 0; i < NumStates/2; i++)
+        metrics[0].fill(0x00);
+        metrics[1].fill(0x00);
+
+        uint16_t punctBitCnt = 0;
+
+        for(size_t i = 0; i < S; i += 2)
         {
-            uint16_t metric = std::abs(COST_TABLE_0[i] - s0)
-                            + std::abs(COST_TABLE_1[i] - s1);
+            uint8_t sym[2] = {1, 1};
 
+            for(uint8_t j = 0; j < 2; j++)
+            {
+                const uint16_t entry = symbolMap[i + j];
 
-            uint16_t m0 = (*prevMetrics)[i] + metric;
-            uint16_t m1 = (*prevMetrics)[i + NumStates/2] + (4 - metric);
+                if(entry != MAP_PUNCTURED)
+                    sym[j] = getMappedBit(in, entry) ? 2 : 0;
+                else
+                    punctBitCnt++;
+            }
 
-            uint16_t m2 = (*prevMetrics)[i] + (4 - metric);
-            uint16_t m3 = (*prevMetrics)[i + NumStates/2] + metric;
+            decodeBit(sym[0], sym[1], i/2);
+        }
 
-            uint8_t i0 = 2 * i;
-            uint8_t i1 = i0 + 1;
+        return (chainback(out, S/2) - punctBitCnt) / ((K - 1) >> 1);
+    }
 
-            if(m0 >= m1)
-            {
-                history[pos].set(i0, true);
-                (*currMetrics)[i0] = m1;
-            }
-            else
-            {
-                history[pos].set(i0, false);
-                (*currMetrics)[i0] = m0;
-            }
+private:
 
-            if(m2 >= m3)
-            {
-                history[pos].set(i1, true);
-                (*currMetrics)[i1] = m3;
-            }
-            else
-            {
-                history[pos].set(i1, false);
-                (*currMetrics)[i1] = m2;
-            }
+    /**
+     * Decode one bit and update trellis.
+     *
+     * @param s0: cost of the first symbol.
+     * @param s1: cost of the second symbol.
+     * @param pos: bit position in history.
+     */
+    void decodeBit(uint8_t s0, uint8_t s1, size_t pos)
+    {
+        const uint16_t *prev = metrics[pos & 1].data();
+        uint16_t       *curr = metrics[(pos + 1) & 1].data();
+
+        // Branch metrics for encoder outputs 00 and 01, the ones for 11 and 10
+        // are their complement to the maximum cost.
+        uint16_t bm0 = s0 + s1;
+        uint16_t bm1 = s0 + (2 - s1);
+
+        #ifdef __SSE2__
+        // Eight butterflies at once, 16-bit path metrics never exceed the
+        // signed range given the maximum history length.
+        const __m128i bm = _mm_setr_epi16(bm0, bm1, bm1, bm0, 4 - bm1,
+                                          4 - bm0, 4 - bm0, 4 - bm1);
+        const __m128i bmc = _mm_sub_epi16(_mm_set1_epi16(4), bm);
+        const __m128i a = _mm_loadu_si128(reinterpret_cast< const __m128i * >(prev));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast< const __m128i * >(prev + 8));
+
+        __m128i m0 = _mm_add_epi16(a, bm);
+        __m128i m1 = _mm_add_epi16(b, bmc);
+        __m128i m2 = _mm_add_epi16(a, bmc);
+        __m128i m3 = _mm_add_epi16(b, bm);
+
+        // Lane masks set when the path coming from the lower state survives
+        __m128i lt0  = _mm_cmplt_epi16(m0, m1);
+        __m128i lt1  = _mm_cmplt_epi16(m2, m3);
+        __m128i even = _mm_min_epi16(m0, m1);
+        __m128i odd  = _mm_min_epi16(m2, m3);
+
+        _mm_storeu_si128(reinterpret_cast< __m128i * >(curr),
+                         _mm_unpacklo_epi16(even, odd));
+        _mm_storeu_si128(reinterpret_cast< __m128i * >(curr + 8),
+                         _mm_unpackhi_epi16(even, odd));
+
+        __m128i lt = _mm_packs_epi16(_mm_unpacklo_epi16(lt0, lt1),
+                                     _mm_unpackhi_epi16(lt0, lt1));
+        history[pos] = ~_mm_movemask_epi8(lt);
+        #else
+        // Two butterflies at once, packing two 16-bit path metrics in a 32-bit
+        // word. Since path metrics never exceed 0x7FFF, bit 15 of each lane is
+        // free and can be used to compare the lanes without borrows.
+        static constexpr uint32_t MAX_COST = 0x00040004;
+        static constexpr uint32_t MSB      = 0x80008000;
+
+        const uint32_t bm01 = bm0 | (bm1 << 16);
+        const uint32_t bm23 = bm1 | (bm0 << 16);
+        const uint32_t bm[4] = { bm01, bm23, MAX_COST - bm23, MAX_COST - bm01 };
+        uint16_t dec = 0;
+
+        for(uint8_t i = 0; i < NumStates/2; i += 2)
+        {
+            uint32_t a, b;
+            memcpy(&a, prev + i, sizeof(a));
+            memcpy(&b, prev + i + NumStates/2, sizeof(b));
+
+            uint32_t m0 = a + bm[i/2];
+            uint32_t m1 = b + (MAX_COST - bm[i/2]);
+            uint32_t m2 = a + (MAX_COST - bm[i/2]);
+            uint32_t m3 = b + bm[i/2];
+
+            // Lane MSB set when the path coming from the upper state survives
+            uint32_t ge0  = ((m0 | MSB) - m1) & MSB;
+            uint32_t ge1  = ((m2 | MSB) - m3) & MSB;
+            uint32_t sel0 = (ge0 >> 15) * 0xFFFF;
+            uint32_t sel1 = (ge1 >> 15) * 0xFFFF;
+            uint32_t even = (m1 & sel0) | (m0 & ~sel0);
+            uint32_t odd  = (m3 & sel1) | (m2 & ~sel1);
+
+            uint32_t lo = (even & 0xFFFF) | (odd << 16);
+            uint32_t hi = (even >> 16)    | (odd & 0xFFFF0000);
+            memcpy(curr + 2*i,     &lo, sizeof(lo));
+            memcpy(curr + 2*i + 2, &hi, sizeof(hi));
+
+            dec |= ((ge0 >> 15) & 0x01) << (2*i);
+            dec |= ((ge1 >> 15) & 0x01) << (2*i + 1);
+            dec |= (ge0 >> 31)          << (2*i + 2);
+            dec |= (ge1 >> 31)          << (2*i + 3);
         }
 
-        std::swap(currMetrics, prevMetrics);
+        history[pos] = dec;
+        #endif
     }
 
     /**
@@ -184,6 +270,8 @@ private:
     template < size_t OUT >
     uint16_t chainback(std::array< uint8_t, OUT >& out, size_t pos)
     {
+        // Path metrics after the last decoded bit
+        const auto& last = metrics[pos & 1];
         uint8_t state = 0;
         size_t bitPos = OUT*8;
 
@@ -191,34 +279,21 @@ private:
         {
             bitPos--;
             pos--;
-            bool bit = history[pos].test(state >> 4);
+            bool bit = (history[pos] >> (state >> 4)) & 0x01;
             state >>= 1;
             if(bit) state |= 0x80;
             setBit(out, bitPos, bit);
         }
 
-        uint16_t cost = (*prevMetrics)[0];
-
-        for(size_t i = 0; i < NumStates; i++)
-        {
-            uint16_t m = (*prevMetrics)[i];
-            if(m < cost) cost = m;
-        }
-
-        return cost;
+        return *std::min_element(last.begin(), last.end());
     }
 
 
     static constexpr size_t K = 5;
     static constexpr size_t NumStates = (1 << (K - 1));
 
-    std::array< uint16_t, NumStates > *prevMetrics;
-    std::array< uint16_t, NumStates > *currMetrics;
-
-    std::array< uint16_t, NumStates >  prevMetricsData;
-    std::array< uint16_t, NumStates >  currMetricsData;
-
-    std::array< std::bitset< NumStates >, 244 > history;
+    std::array< std::array< uint16_t, NumStates >, 2 > metrics;  ///< Path metrics, alternated at each step
+    std::array< uint16_t, 244 >                        history;  ///< Decision bits, one word per step
 };
 
 /**
@@ -235,8 +310,7 @@ public:
     /**
      * Constructor.
      */
-    SoftViterbi() : prevMetrics(&prevMetricsData), currMetrics(&currMetricsData)
-    { }
+    SoftViterbi() { }
 
     /**
      * Destructor.
@@ -256,8 +330,8 @@ public:
     {
         static_assert(IN < 244*2, "Input size exceeds max history");
 
-        currMetricsData.fill(0);
-        prevMetricsData.fill(0);
+        metrics[0].fill(0);
+        metrics[1].fill(0);
 
         size_t pos = 0;
         for (size_t i = 0; i < IN; i += 2)
@@ -269,7 +343,7 @@ public:
             pos++;
         }
 
-        return chainback(out, pos);
+        return chainback(out, pos) / 0xFFFF;
     }
 
     /**
@@ -287,8 +361,8 @@ public:
     {
         static_assert(IN < 244*2, "Input size exceeds max history");
 
-        currMetricsData.fill(0);
-        prevMetricsData.fill(0);
+        metrics[0].fill(0);
+        metrics[1].fill(0);
 
         size_t   histPos     = 0;
         size_t   punctIndex  = 0;
@@ -319,7 +393,54 @@ public:
             histPos++;
         }
 
-        return chainback(out, histPos) - punctBitCnt;
+        // Each punctured bit adds half of the cost of a bit error to all the
+        // paths, remove its contribution before scaling the cost to bits.
+        uint32_t cost = chainback(out, histPos) - (punctBitCnt * 0x7FFF);
+        return cost / 0xFFFF;
+    }
+
+    /**
+     * Decode convolutionally encoded soft decision data contained in a
+     * received frame, fetching the symbols through a receive bit map. This
+     * fuses the decorrelation, deinterleaving and depuncturing of the frame
+     * data with the decoding.
+     *
+     * @param in: received soft decision frame, including the sync word.
+     * @param out: destination array where decoded data are written.
+     * @param symbolMap: receive bit map.
+     * @return number of bit errors corrected.
+     */
+    template < size_t IN, size_t OUT, size_t S >
+    uint16_t decodeMapped(const std::array< uint16_t, IN  >& in,
+                                std::array< uint8_t,  OUT >& out,
+                          const std::array< uint16_t, S   >& symbolMap)
+    {
+        static_assert(S/2 <= 244, "Input size exceeds max history");
+
+        metrics[0].fill(0);
+        metrics[1].fill(0);
+
+        uint16_t punctBitCnt = 0;
+
+        for(size_t i = 0; i < S; i += 2)
+        {
+            uint16_t sym[2] = {0x7FFF, 0x7FFF};
+
+            for(uint8_t j = 0; j < 2; j++)
+            {
+                const uint16_t entry = symbolMap[i + j];
+
+                if(entry != MAP_PUNCTURED)
+                    sym[j] = getMappedBit(in, entry);
+                else
+                    punctBitCnt++;
+            }
+
+            decodeBit(sym[0], sym[1], i/2);
+        }
+
+        uint32_t cost = chainback(out, S/2) - (punctBitCnt * 0x7FFF);
+        return cost / 0xFFFF;
     }
 
 private:
@@ -333,50 +454,79 @@ private:
      */
     void decodeBit(uint16_t s0, uint16_t s1, size_t pos)
     {
-        static constexpr uint16_t COST_TABLE_0[] = {0, 0, 0, 0, 0xFFFF,
-                                                    0xFFFF, 0xFFFF, 0xFFFF};
-        static constexpr uint16_t COST_TABLE_1[] = {0, 0xFFFF, 0xFFFF, 0,
-                                                    0, 0xFFFF, 0xFFFF, 0};
-
-        for(uint8_t i = 0; i < NumStates/2; i++)
+        const uint32_t *prev = metrics[pos & 1].data();
+        uint32_t       *curr = metrics[(pos + 1) & 1].data();
+
+        // Branch metrics for encoder outputs 00 and 01, the ones for 11 and 10
+        // are their complement to the maximum cost.
+        uint32_t bm0 = s0 + s1;
+        uint32_t bm1 = s0 + (0xFFFF - s1);
+
+        #ifdef __SSE2__
+        // Four butterflies at once, 32-bit path metrics never exceed the
+        // signed range given the maximum history length.
+        const __m128i maxCost = _mm_set1_epi32(0x1FFFE);
+        const __m128i bm[2] =
         {
-            uint32_t metric = q_AbsDiff(COST_TABLE_0[i], s0)
-                            + q_AbsDiff(COST_TABLE_1[i], s1);
+            _mm_setr_epi32(bm0, bm1, bm1, bm0),
+            _mm_setr_epi32(0x1FFFE - bm1, 0x1FFFE - bm0,
+                           0x1FFFE - bm0, 0x1FFFE - bm1)
+        };
 
+        __m128i lt[4];
 
-            uint32_t m0 = (*prevMetrics)[i] + metric;
-            uint32_t m1 = (*prevMetrics)[i + NumStates/2] + (0x1FFFE - metric);
-
-            uint32_t m2 = (*prevMetrics)[i] + (0x1FFFE - metric);
-            uint32_t m3 = (*prevMetrics)[i + NumStates/2] + metric;
-
-            uint8_t i0 = 2 * i;
-            uint8_t i1 = i0 + 1;
+        for(uint8_t i = 0; i < 2; i++)
+        {
+            const __m128i bmc = _mm_sub_epi32(maxCost, bm[i]);
+            const __m128i a = _mm_loadu_si128(reinterpret_cast< const __m128i * >(prev + 4*i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast< const __m128i * >(prev + 4*i + 8));
+
+            __m128i m0 = _mm_add_epi32(a, bm[i]);
+            __m128i m1 = _mm_add_epi32(b, bmc);
+            __m128i m2 = _mm_add_epi32(a, bmc);
+            __m128i m3 = _mm_add_epi32(b, bm[i]);
+
+            // Lane masks set when the path coming from the lower state survives
+            __m128i lt0  = _mm_cmplt_epi32(m0, m1);
+            __m128i lt1  = _mm_cmplt_epi32(m2, m3);
+            __m128i even = _mm_or_si128(_mm_and_si128(lt0, m0),
+                                        _mm_andnot_si128(lt0, m1));
+            __m128i odd  = _mm_or_si128(_mm_and_si128(lt1, m2),
+                                        _mm_andnot_si128(lt1, m3));
+
+            _mm_storeu_si128(reinterpret_cast< __m128i * >(curr + 8*i),
+                             _mm_unpacklo_epi32(even, odd));
+            _mm_storeu_si128(reinterpret_cast< __m128i * >(curr + 8*i + 4),
+                             _mm_unpackhi_epi32(even, odd));
+
+            lt[2*i]     = _mm_unpacklo_epi32(lt0, lt1);
+            lt[2*i + 1] = _mm_unpackhi_epi32(lt0, lt1);
+        }
 
-            if(m0 >= m1)
-            {
-                history[pos].set(i0, true);
-                (*currMetrics)[i0] = m1;
-            }
-            else
-            {
-                history[pos].set(i0, false);
-                (*currMetrics)[i0] = m0;
-            }
+        __m128i mask = _mm_packs_epi16(_mm_packs_epi32(lt[0], lt[1]),
+                                       _mm_packs_epi32(lt[2], lt[3]));
+        history[pos] = ~_mm_movemask_epi8(mask);
+        #else
+        const uint32_t bm[4] = { bm0, bm1, 0x1FFFE - bm1, 0x1FFFE - bm0 };
+        uint16_t dec = 0;
 
-            if(m2 >= m3)
-            {
-                history[pos].set(i1, true);
-                (*currMetrics)[i1] = m3;
-            }
-            else
-            {
-                history[pos].set(i1, false);
-                (*currMetrics)[i1] = m2;
-            }
+        for(uint8_t i = 0; i < NumStates/2; i++)
+        {
+            // Branch metric pattern is 0, 1, 1, 0, 2, 3, 3, 2
+            uint32_t metric = bm[((i >> 1) & 0x02) | (((i >> 1) ^ i) & 0x01)];
+            uint32_t m0 = prev[i] + metric;
+            uint32_t m1 = prev[i + NumStates/2] + (0x1FFFE - metric);
+            uint32_t m2 = prev[i] + (0x1FFFE - metric);
+            uint32_t m3 = prev[i + NumStates/2] + metric;
+
+            curr[2*i]     = std::min(m0, m1);
+            curr[2*i + 1] = std::min(m2, m3);
+            dec |= static_cast< uint16_t >(m0 >= m1) << (2*i);
+            dec |= static_cast< uint16_t >(m2 >= m3) << (2*i + 1);
         }
 
-        std::swap(currMetrics, prevMetrics);
+        history[pos] = dec;
+        #endif
     }
 
     /**
@@ -389,6 +539,8 @@ private:
     template < size_t OUT >
     uint32_t chainback(std::array< uint8_t, OUT >& out, size_t pos)
     {
+        // Path metrics after the last decoded bit
+        const auto& last = metrics[pos & 1];
         uint8_t state = 0;
         size_t bitPos = OUT*8;
 
@@ -396,48 +548,20 @@ private:
         {
             bitPos--;
             pos--;
-            bool bit = history[pos].test(state >> 4);
+            bool bit = (history[pos] >> (state >> 4)) & 0x01;
             state >>= 1;
             if(bit) state |= 0x80;
             setBit(out, bitPos, bit);
         }
 
-        uint32_t cost = (*prevMetrics)[0];
-
-        for(size_t i = 0; i < NumStates; i++)
-        {
-            uint32_t m = (*prevMetrics)[i];
-            if(m < cost) cost = m;
-        }
-
-        return cost;
-    }
-
-    /**
-     * Utility function to compute the absolute value of a difference between
-     * two fixed-point values.
-     *
-     * @param v1: first value
-     * @param v2: second value
-     * @return abs(v1-v2)
-     */
-    inline uint16_t q_AbsDiff(const uint16_t v1, const uint16_t v2)
-    {
-        if(v2 > v1) return v2 - v1;
-        return v1 - v2;
+        return *std::min_element(last.begin(), last.end());
     }
 
-
     static constexpr size_t K = 5;
     static constexpr size_t NumStates = (1 << (K - 1));
 
-    std::array< uint32_t, NumStates > *prevMetrics;
-    std::array< uint32_t, NumStates > *currMetrics;
-
-    std::array< uint32_t, NumStates >  prevMetricsData;
-    std::array< uint32_t, NumStates >  currMetricsData;
-
-    std::array< std::bitset< NumStates >, 244 > history;
+    std::array< std::array< uint32_t, NumStates >, 2 > metrics;  ///< Path metrics, alternated at each step
+    std::array< uint16_t, 244 >                        history;  ///< Decision bits, one word per step
 };
 
 }      // namespace M17
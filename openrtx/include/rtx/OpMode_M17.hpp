@@ -12,6 +12,7 @@
 #include "protocols/M17/Demodulator.hpp"
 #include "protocols/M17/Modulator.hpp"
 #include "protocols/M17/MetaText.hpp"
+#include "protocols/M17/JitterBuffer.hpp"
 #include "core/audio_path.h"
 #include "OpMode.hpp"
 
@@ -108,6 +109,12 @@ private:
      */
     void txState(rtxStatus_t *const status);
 
+    /**
+     * Move the received voice frames from the jitter buffer to the codec2
+     * decoder, keeping its queue topped up.
+     */
+    void rxPlayout();
+
     /**
      * Compare two callsigns in plain text form.
      * The comparison does not take into account the country prefixes (strips
@@ -125,6 +132,10 @@ private:
     // (~240 ms), so 25 superframes ≈ 6 seconds.
     static constexpr uint16_t GPS_UPDATE_TICKS = 25;
 
+    // Codec2 frames left in the decoder queue below which a new stream frame
+    // is taken from the jitter buffer.
+    static constexpr uint8_t RX_AUDIO_LOW_WATER = 2;
+
     bool startRx;                      ///< Flag for RX management.
     bool startTx;                      ///< Flag for TX management.
     bool locked;                       ///< Demodulator locked on data stream.
@@ -140,6 +151,7 @@ private:
     M17::FrameEncoder encoder;      ///< M17 frame encoder
     uint16_t gpsTimer;                 ///< GPS data transmission interval timer
     M17::MetaText metaText;            ///< M17 metatext accumulator
+    M17::JitterBuffer jitterBuffer;    ///< Received voice frames
 };
 
 #endif /* OPMODE_M17_H */
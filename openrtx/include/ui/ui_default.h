@@ -237,6 +237,90 @@ typedef struct ui_state_t
 }
 ui_state_t;
 
+/**
+ * Size of the copy of the state shown by a widget, enough for the M17 call
+ * information. Widgets showing a larger state are drawn again at each frame.
+ */
+#define WIDGET_STATE_SIZE 112
+
+/**
+ * Retained state of a widget: an horizontal band of the screen which is drawn
+ * again only when the state it shows changes.
+ */
+typedef struct widget_t
+{
+    uint8_t state[WIDGET_STATE_SIZE]; // Copy of the state shown by the widget
+    uint8_t size;         // Size of the state bound to the widget
+    uint8_t used;         // Size of the state added since the last binding
+    bool    changed;      // State added since the last binding differs
+    uint8_t startRow;     // First screen row covered by the widget
+    uint8_t endRow;       // Row following the last one covered by the widget
+}
+widget_t;
+
+/**
+ * Request the next screen drawn with widgets to be drawn from scratch.
+ */
+void _ui_invalidateWidgets();
+
+/**
+ * Start drawing a screen made of widgets. All the widgets of the screen have
+ * to be bound before drawing any of them.
+ *
+ * @return true if the screen has been cleared and has to be drawn from scratch.
+ */
+bool _ui_beginWidgets();
+
+/**
+ * Bind a widget to the state added to it since the previous binding and to
+ * the screen rows it covers. When any of them changed since the previous
+ * frame, the rows previously and newly covered by the widget are cleared. An
+ * empty range of rows hides the widget.
+ *
+ * @param widget: widget to be bound.
+ * @param startRow: first screen row covered by the widget.
+ * @param endRow: row following the last one covered by the widget.
+ */
+void _ui_bindWidget(widget_t *widget, int16_t startRow, int16_t endRow);
+
+/**
+ * Bind a widget showing a line of text, covering the rows from the font
+ * height above its baseline down to the descenders of the font.
+ *
+ * @param widget: widget to be bound.
+ * @param baseline: baseline of the text.
+ * @param font: font of the text.
+ */
+void _ui_bindTextWidget(widget_t *widget, int16_t baseline, fontSize_t font);
+
+/**
+ * Check if a bound widget has to be drawn in the current frame, that is if
+ * any of the rows it covers has been cleared. Widgets sharing rows with a
+ * changed one are drawn again on top of their unchanged content.
+ *
+ * @param widget: bound widget.
+ * @return true if the widget has to be drawn.
+ */
+bool _ui_redrawWidget(const widget_t *widget);
+
+/**
+ * Add data to the state shown by a widget, which is compared byte by byte
+ * against the one shown in the previous frame when the widget is bound.
+ *
+ * @param widget: widget showing the data.
+ * @param data: data to be added to the state.
+ * @param size: size of the data, in bytes.
+ */
+void _ui_addState(widget_t *widget, const void *data, size_t size);
+
+/**
+ * Add a string, including its terminator, to the state shown by a widget.
+ *
+ * @param widget: widget showing the string.
+ * @param str: string to be added to the state.
+ */
+void _ui_addStateString(widget_t *widget, const char *str);
+
 extern layout_t layout;
 extern state_t last_state;
 extern bool    macro_latched;
@@ -18,10 +18,33 @@
 #include <string.h>
 #include <stdio.h>
 #include <errno.h>
+#include <stdatomic.h>
 #include "core/dsp.h"
 #include "hwconfig.h"
 
-#define BUF_SIZE 4
+#if defined(PLATFORM_LINUX)
+#include "mcu/x86_64/drivers/vclock.h"
+#endif
+
+/* Capacity of the frame queue, must be a power of two */
+#ifndef CONFIG_CODEC2_QUEUE_SIZE
+#define CONFIG_CODEC2_QUEUE_SIZE 8
+#endif
+
+/* Default depth of the frame queue, in frames */
+#ifndef CONFIG_CODEC2_QUEUE_DEPTH
+#define CONFIG_CODEC2_QUEUE_DEPTH 4
+#endif
+
+#if (CONFIG_CODEC2_QUEUE_SIZE & (CONFIG_CODEC2_QUEUE_SIZE - 1)) != 0
+#error CONFIG_CODEC2_QUEUE_SIZE must be a power of two
+#endif
+
+#if CONFIG_CODEC2_QUEUE_DEPTH > CONFIG_CODEC2_QUEUE_SIZE
+#error CONFIG_CODEC2_QUEUE_DEPTH exceeds the queue capacity
+#endif
+
+#define QUEUE_MASK (CONFIG_CODEC2_QUEUE_SIZE - 1)
 #define CODEC2_FRAME_SAMPLES 160 /* Samples per codec2 3200-mode frame */
 #define DMA_BUF_SAMPLES (CODEC2_FRAME_SAMPLES * 2) /* Double-buffered DMA */
 
@@ -41,19 +64,46 @@ static bool running;
 static bool reqStop;
 static pthread_t codecThread;
 static pthread_attr_t codecAttr;
-static pthread_mutex_t data_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t init_mutex = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t wakeup_cond = PTHREAD_COND_INITIALIZER;
 
-static uint8_t readPos;
-static uint8_t writePos;
-static uint8_t numElements;
-static uint64_t dataBuffer[BUF_SIZE];
+/*
+ * Wakeup for a thread blocked on the frame queue. The mutex and the condition
+ * variable are touched only when a thread actually has to sleep.
+ */
+struct waiter {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    atomic_bool sleeping;
+    bool clockReleased;     // Sleeping thread released the Linux virtual clock
+};
+
+/*
+ * Frame queue, lock-free with a single producer and a single consumer: the
+ * encoder thread and the caller of codec_popFrame() when encoding, the caller
+ * of codec_pushFrame() and the decoder thread when decoding. The indices run
+ * freely, the producer only writes the head and the consumer only the tail.
+ */
+static atomic_uint head;
+static atomic_uint tail;
+static atomic_uint depth = CONFIG_CODEC2_QUEUE_DEPTH;
+static uint64_t dataBuffer[CONFIG_CODEC2_QUEUE_SIZE];
+
+static struct waiter notEmpty = { PTHREAD_MUTEX_INITIALIZER,
+                                  PTHREAD_COND_INITIALIZER, false, false };
+static struct waiter notFull = { PTHREAD_MUTEX_INITIALIZER,
+                                 PTHREAD_COND_INITIALIZER, false, false };
+
+static atomic_uint frames;
+static atomic_uint overruns;
+static atomic_uint underruns;
+static atomic_uint highWater;
 
 static void *encodeFunc(void *arg);
 static void *decodeFunc(void *arg);
 static bool startThread(const pathId path, void *(*func)(void *));
 static void stopThread();
+static bool queuePush(const uint64_t frame, const bool blocking);
+static bool queuePop(uint64_t *frame, const bool blocking);
 
 void codec_init()
 {
@@ -65,9 +115,8 @@ void codec_init()
         return;
 
     running = false;
-    readPos = 0;
-    writePos = 0;
-    numElements = 0;
+    atomic_store(&head, 0);
+    atomic_store(&tail, 0);
 }
 
 void codec_terminate()
@@ -109,30 +158,24 @@ bool codec_running()
     return running;
 }
 
+bool codec_runningOnPath(const pathId path)
+{
+    pthread_mutex_lock(&init_mutex);
+    bool owner = running && (audioPath == path);
+    pthread_mutex_unlock(&init_mutex);
+
+    return owner;
+}
+
 int codec_popFrame(uint8_t *frame, const bool blocking)
 {
     if (running == false)
         return -EPERM;
 
     uint64_t element;
-
-    // No data available and non-blocking call: just return false.
-    if ((numElements == 0) && (blocking == false))
+    if (queuePop(&element, blocking) == false)
         return -EAGAIN;
 
-    // Blocking call: wait until some data is pushed
-    pthread_mutex_lock(&data_mutex);
-    while (numElements == 0) {
-        pthread_cond_wait(&wakeup_cond, &data_mutex);
-    }
-
-    element = dataBuffer[readPos];
-    readPos = (readPos + 1) % BUF_SIZE;
-    numElements -= 1;
-    pthread_mutex_unlock(&data_mutex);
-
-    // Do memcpy after mutex unlock to reduce execution time spent inside the
-    // critical section
     memcpy(frame, &element, 8);
 
     return 0;
@@ -143,28 +186,162 @@ int codec_pushFrame(const uint8_t *frame, const bool blocking)
     if (running == false)
         return -EPERM;
 
-    // Copy data to a temporary variable before mutex lock to reduce execution
-    // time spent inside the critical section
     uint64_t element;
     memcpy(&element, frame, 8);
 
-    // No space available and non-blocking call: return
-    if ((numElements >= BUF_SIZE) && (blocking == false))
+    if (queuePush(element, blocking) == false)
         return -EAGAIN;
 
-    // Blocking call: wait until there is some free space
-    pthread_mutex_lock(&data_mutex);
-    while (numElements >= BUF_SIZE) {
-        pthread_cond_wait(&wakeup_cond, &data_mutex);
+    return 0;
+}
+
+void codec_setQueueDepth(const uint8_t frames)
+{
+    uint8_t value = frames;
+
+    if (value < 1)
+        value = 1;
+
+    if (value > CONFIG_CODEC2_QUEUE_SIZE)
+        value = CONFIG_CODEC2_QUEUE_SIZE;
+
+    atomic_store(&depth, value);
+}
+
+void codec_getStats(struct codecStats *stats)
+{
+    unsigned int t = atomic_load(&tail);
+    unsigned int h = atomic_load(&head);
+
+    stats->frames = atomic_load_explicit(&frames, memory_order_relaxed);
+    stats->overruns = atomic_load_explicit(&overruns, memory_order_relaxed);
+    stats->underruns = atomic_load_explicit(&underruns, memory_order_relaxed);
+    stats->depth = atomic_load_explicit(&depth, memory_order_relaxed);
+    stats->level = h - t;
+    stats->highWater = atomic_load_explicit(&highWater, memory_order_relaxed);
+}
+
+void codec_resetStats()
+{
+    atomic_store_explicit(&frames, 0, memory_order_relaxed);
+    atomic_store_explicit(&overruns, 0, memory_order_relaxed);
+    atomic_store_explicit(&underruns, 0, memory_order_relaxed);
+    atomic_store_explicit(&highWater, 0, memory_order_relaxed);
+}
+
+/**
+ * \internal
+ * Block the caller until an index of the frame queue moves away from a given
+ * value. Spurious wakeups are possible.
+ */
+static void waitIndex(struct waiter *w, atomic_uint *index, unsigned int value)
+{
+    // Announce the sleep before checking the index for the last time: the
+    // other side either sees the flag or has already moved the index.
+    atomic_store(&w->sleeping, true);
+
+    pthread_mutex_lock(&w->mutex);
+    if (atomic_load(index) == value) {
+        // The other side may be the codec thread, waiting on the virtual
+        // clock for audio data: do not hold the clock while blocked. The
+        // thread waking us up holds it again on our behalf.
+#if defined(PLATFORM_LINUX)
+        w->clockReleased = vclock_blockBegin();
+#endif
+
+        pthread_cond_wait(&w->cond, &w->mutex);
+
+#if defined(PLATFORM_LINUX)
+        vclock_blockEnd(w->clockReleased == false);
+        w->clockReleased = false;
+#endif
     }
+    pthread_mutex_unlock(&w->mutex);
 
-    // There is free space, push data into the queue
-    dataBuffer[writePos] = element;
-    writePos = (writePos + 1) % BUF_SIZE;
-    numElements += 1;
+    atomic_store_explicit(&w->sleeping, false, memory_order_relaxed);
+}
 
-    pthread_mutex_unlock(&data_mutex);
-    return 0;
+/**
+ * \internal
+ * Wake up the thread blocked on an index of the frame queue, if any. To be
+ * called after having moved the index.
+ */
+static void wakeIndex(struct waiter *w)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&w->sleeping, memory_order_relaxed) == false)
+        return;
+
+    if (atomic_exchange(&w->sleeping, false) == false)
+        return;
+
+    pthread_mutex_lock(&w->mutex);
+
+#if defined(PLATFORM_LINUX)
+    if (w->clockReleased) {
+        vclock_hold();
+        w->clockReleased = false;
+    }
+#endif
+
+    pthread_cond_signal(&w->cond);
+    pthread_mutex_unlock(&w->mutex);
+}
+
+/**
+ * \internal
+ * Push a frame to the queue, producer side.
+ */
+static bool queuePush(const uint64_t frame, const bool blocking)
+{
+    unsigned int h = atomic_load_explicit(&head, memory_order_relaxed);
+    unsigned int t = atomic_load_explicit(&tail, memory_order_acquire);
+
+    while ((h - t) >= atomic_load_explicit(&depth, memory_order_relaxed)) {
+        if (blocking == false) {
+            atomic_fetch_add_explicit(&overruns, 1, memory_order_relaxed);
+            return false;
+        }
+
+        waitIndex(&notFull, &tail, t);
+        t = atomic_load_explicit(&tail, memory_order_acquire);
+    }
+
+    dataBuffer[h & QUEUE_MASK] = frame;
+    atomic_store_explicit(&head, h + 1, memory_order_release);
+    wakeIndex(&notEmpty);
+
+    // Queue level seen by the producer, right after the push
+    unsigned int level = (h + 1) - t;
+    if (level > atomic_load_explicit(&highWater, memory_order_relaxed))
+        atomic_store_explicit(&highWater, level, memory_order_relaxed);
+
+    return true;
+}
+
+/**
+ * \internal
+ * Pop a frame from the queue, consumer side.
+ */
+static bool queuePop(uint64_t *frame, const bool blocking)
+{
+    unsigned int t = atomic_load_explicit(&tail, memory_order_relaxed);
+    unsigned int h = atomic_load_explicit(&head, memory_order_acquire);
+
+    while (h == t) {
+        if (blocking == false)
+            return false;
+
+        waitIndex(&notEmpty, &head, h);
+        h = atomic_load_explicit(&head, memory_order_acquire);
+    }
+
+    *frame = dataBuffer[t & QUEUE_MASK];
+    atomic_store_explicit(&tail, t + 1, memory_order_release);
+    atomic_fetch_add_explicit(&frames, 1, memory_order_relaxed);
+    wakeIndex(&notFull);
+
+    return true;
 }
 
 static void *encodeFunc(void *arg)
@@ -226,23 +403,9 @@ static void *encodeFunc(void *arg)
         uint64_t frame = 0;
         codec2_encode(codec2, ((uint8_t *)&frame), audio.data);
 
-        pthread_mutex_lock(&data_mutex);
-
-        // If buffer is full erase the oldest frame
-        if (numElements >= BUF_SIZE) {
-            readPos = (readPos + 1) % BUF_SIZE;
-        }
-
-        dataBuffer[writePos] = frame;
-        writePos = (writePos + 1) % BUF_SIZE;
-
-        if (numElements == 0)
-            pthread_cond_signal(&wakeup_cond);
-
-        if (numElements < BUF_SIZE)
-            numElements += 1;
-
-        pthread_mutex_unlock(&data_mutex);
+        // The encoder is paced by the microphone, if the queue is full the
+        // frame is dropped and accounted as an overrun.
+        queuePush(frame, false);
     }
 
     audioStream_terminate(iStream);
@@ -285,6 +448,9 @@ static void *decodeFunc(void *arg)
     // noises at speaker output. Behaviour observed on both Module17 and MD-UV380
     outputStream_sync(oStream, false);
 
+    // Silence gaps are accounted as underruns only after the first frame
+    bool playing = false;
+
     while (reqStop == false) {
         // Invalid path, quit
         if (audioPath_getStatus(oPath) != PATH_OPEN)
@@ -292,21 +458,12 @@ static void *decodeFunc(void *arg)
 
         // Try popping data from the queue
         uint64_t frame = 0;
-        bool newData = false;
+        bool newData = queuePop(&frame, false);
 
-        pthread_mutex_lock(&data_mutex);
-
-        if (numElements != 0) {
-            frame = dataBuffer[readPos];
-            readPos = (readPos + 1) % BUF_SIZE;
-            if (numElements >= BUF_SIZE)
-                pthread_cond_signal(&wakeup_cond);
-
-            numElements -= 1;
-            newData = true;
-        }
-
-        pthread_mutex_unlock(&data_mutex);
+        if (newData)
+            playing = true;
+        else if (playing)
+            atomic_fetch_add_explicit(&underruns, 1, memory_order_relaxed);
 
         stream_sample_t *audioBuf = outputStream_getIdleBuffer(oStream);
         if (audioBuf == NULL)
@@ -369,13 +526,14 @@ static bool startThread(const pathId path, void *(*func)(void *))
         }
     }
 
+    atomic_store(&head, 0);
+    atomic_store(&tail, 0);
+    codec_resetStats();
+
     running = true;
     audioPath = path;
     pthread_mutex_unlock(&init_mutex);
 
-    readPos = 0;
-    writePos = 0;
-    numElements = 0;
     reqStop = false;
 
     pthread_attr_init(&codecAttr);
@@ -406,7 +564,18 @@ static bool startThread(const pathId path, void *(*func)(void *))
 static void stopThread()
 {
     reqStop = true;
+
+#if defined(PLATFORM_LINUX)
+    bool clockReleased = vclock_blockBegin();
+#endif
+
     pthread_join(codecThread, NULL);
+
+#if defined(PLATFORM_LINUX)
+    if (clockReleased)
+        vclock_blockEnd(false);
+#endif
+
     running = false;
 
 #ifdef __ZEPHYR__
@@ -5,8 +5,16 @@
  */
 
 #include "core/audio_path.h"
-#include <map>
-#include <set>
+
+/* Maximum number of audio paths, either open or suspended */
+#ifndef CONFIG_AUDIO_PATH_MAX
+#define CONFIG_AUDIO_PATH_MAX 16
+#endif
+
+static constexpr uint32_t MAX_PATHS = CONFIG_AUDIO_PATH_MAX;
+static_assert((MAX_PATHS >= 2) && (MAX_PATHS <= 32)
+              && ((MAX_PATHS & (MAX_PATHS - 1)) == 0),
+              "Audio path table size must be a power of two, up to 32");
 
 /**
  * \internal
@@ -19,6 +27,8 @@ struct Path
     int8_t destination = -1;   ///< Destination endpoint of the path.
     int8_t priority    = -1;   ///< Path priority level.
 
+    Path() { }
+
     Path(enum AudioSource src, enum AudioSink sink, enum AudioPriority prio)
     {
         source = static_cast<int8_t>(src);
@@ -80,24 +90,66 @@ struct Path
 
 /**
  * \internal
- * Data structure representing an established audio route.
+ * Data structure representing an established audio route. The routes
+ * suspended by this one and the ones suspending it are sets of slots of the
+ * route table, stored as bitmasks.
  */
 struct Route
 {
-    Path path;                    ///< Path associated to this route.
-    std::set< int > suspendList;  ///< Suspended paths with lower priority.
-    std::set< int > suspendedBy;  ///< List of paths which suspended this route.
+    pathId   id          = 0;  ///< ID of the route, zero if the slot is free.
+    uint32_t generation  = 0;  ///< Times the slot has been used.
+    Path     path;             ///< Path associated to this route.
+    uint32_t suspendList = 0;  ///< Suspended paths with lower priority.
+    uint32_t suspendedBy = 0;  ///< List of paths which suspended this route.
 
     bool isActive() const
     {
-        return suspendedBy.empty();
+        return suspendedBy == 0;
     }
 };
 
 
-static std::set< int >        activePaths;      // IDs of currently active paths.
-static std::map< int, Route > routes;           // Route data of currently active paths.
-static int                    pathCounter = 1;  // Counter for path ID generation.
+static Route    routes[MAX_PATHS];  // Route table, indexed by slot.
+static uint32_t activePaths = 0;    // Slots of the currently active paths.
+
+/*
+ * Path IDs carry the slot of the route table in the lowest bits and the
+ * generation of the slot in the upper ones. A released ID is not valid
+ * anymore even after its slot has been reused.
+ */
+static constexpr uint32_t SLOT_BITS = __builtin_ctz(MAX_PATHS);
+static constexpr uint32_t MAX_GEN   = INT32_MAX >> SLOT_BITS;
+
+/**
+ * \internal
+ * Get the route corresponding to a path ID.
+ *
+ * @param id: path ID.
+ * @return pointer to the route or nullptr if the path does not exist.
+ */
+static inline Route *getRoute(const pathId id)
+{
+    if(id <= 0)
+        return nullptr;
+
+    Route *route = &routes[id & (MAX_PATHS - 1)];
+    if(route->id != id)
+        return nullptr;
+
+    return route;
+}
+
+/**
+ * \internal
+ * Get the index of the lowest set bit of a mask and clear it.
+ */
+static inline uint32_t popSlot(uint32_t& mask)
+{
+    uint32_t slot = __builtin_ctz(mask);
+    mask &= mask - 1;
+
+    return slot;
+}
 
 
 pathId audioPath_request(enum AudioSource source, enum AudioSink sink,
@@ -107,12 +159,14 @@ pathId audioPath_request(enum AudioSource source, enum AudioSink sink,
     if (!path.isValid())
         return -1;
 
-    std::set< int > pathsToSuspend;
+    uint32_t pathsToSuspend = 0;
 
     // Check if this new path can be activated, otherwise return -1
-    for (const auto& id : activePaths)
+    uint32_t active = activePaths;
+    while(active != 0)
     {
-        const Path& activePath = routes.at(id).path;
+        uint32_t slot = popSlot(active);
+        const Path& activePath = routes[slot].path;
         if(path.isCompatible(activePath))
             continue;
 
@@ -121,26 +175,42 @@ pathId audioPath_request(enum AudioSource source, enum AudioSink sink,
             return -1;
 
         // Active path has lower priority than this new one
-        pathsToSuspend.insert(id);
+        pathsToSuspend |= (1u << slot);
     }
 
+    // Look for a free slot in the route table
+    uint32_t newSlot = 0;
+    while((newSlot < MAX_PATHS) && (routes[newSlot].id != 0))
+        newSlot += 1;
+
+    if(newSlot >= MAX_PATHS)
+        return -1;
+
     // New path can be activated
-    const int newPathId = pathCounter;
-    pathCounter += 1;
-    const Route newRoute{path, pathsToSuspend, {}};
+    Route& newRoute = routes[newSlot];
+    newRoute.generation += 1;
+    if(newRoute.generation > MAX_GEN)
+        newRoute.generation = 1;
+
+    const pathId newPathId = (newRoute.generation << SLOT_BITS) | newSlot;
+    newRoute.id          = newPathId;
+    newRoute.path        = path;
+    newRoute.suspendList = pathsToSuspend;
+    newRoute.suspendedBy = 0;
 
     // Move active paths that should be suspended to the suspend-list and
     // close them to free resources for the new path.
-    for(const auto& id : pathsToSuspend)
+    uint32_t suspend = pathsToSuspend;
+    while(suspend != 0)
     {
-        activePaths.erase(id);
-        routes.at(id).suspendedBy.insert(newPathId);
-        routes.at(id).path.close();
+        uint32_t slot = popSlot(suspend);
+        routes[slot].suspendedBy |= (1u << newSlot);
+        routes[slot].path.close();
     }
 
     // Set this new path as active and open it
-    routes.insert(std::make_pair(newPathId, newRoute));
-    activePaths.insert(newPathId);
+    activePaths &= ~pathsToSuspend;
+    activePaths |= (1u << newSlot);
     path.open();
 
     return newPathId;
@@ -150,17 +220,17 @@ pathInfo_t audioPath_getInfo(const pathId id)
 {
     pathInfo_t info = {0, 0, 0, 0};
 
-    const auto it = routes.find(id);
-    if(it == routes.end())
+    const Route *route = getRoute(id);
+    if(route == nullptr)
     {
         info.status = PATH_CLOSED;
         return info;
     }
 
-    info.source = it->second.path.source;
-    info.sink   = it->second.path.destination;
-    info.prio   = it->second.path.priority;
-    if(it->second.isActive())
+    info.source = route->path.source;
+    info.sink   = route->path.destination;
+    info.prio   = route->path.priority;
+    if(route->isActive())
         info.status = PATH_OPEN;
     else
         info.status = PATH_SUSPENDED;
@@ -170,12 +240,12 @@ pathInfo_t audioPath_getInfo(const pathId id)
 
 enum PathStatus audioPath_getStatus(const pathId id)
 {
-    const auto it = routes.find(id);
+    const Route *route = getRoute(id);
 
-    if(it == routes.end())
+    if(route == nullptr)
         return PATH_CLOSED;
 
-    if(it->second.isActive())
+    if(route->isActive())
         return PATH_OPEN;
 
     return PATH_SUSPENDED;
@@ -183,13 +253,14 @@ enum PathStatus audioPath_getStatus(const pathId id)
 
 void audioPath_release(const pathId id)
 {
-    auto it = routes.find(id);
-    if(it == routes.end())  // Does not exists
+    Route *route = getRoute(id);
+    if(route == nullptr)  // Does not exists
         return;
 
-    Route routeToRemove = it->second;
-    routes.erase(it);
-    activePaths.erase(id);
+    const uint32_t slotMask      = 1u << (id & (MAX_PATHS - 1));
+    const Route    routeToRemove = *route;
+    route->id = 0;
+    activePaths &= ~slotMask;
 
     // If path is active, close it
     if(routeToRemove.isActive())
@@ -200,13 +271,12 @@ void audioPath_release(const pathId id)
      * - remove the ID from its suspend list.
      * - add to its suspend list the paths suspended by the one being removed.
      */
-    for(const auto& i : routeToRemove.suspendedBy)
+    uint32_t suspendedBy = routeToRemove.suspendedBy;
+    while(suspendedBy != 0)
     {
-        auto& suspendList = routes.at(i).suspendList;
-        suspendList.erase(id);
-
-        for(const auto& j : routeToRemove.suspendList)
-            suspendList.insert(j);
+        uint32_t& suspendList = routes[popSlot(suspendedBy)].suspendList;
+        suspendList &= ~slotMask;
+        suspendList |= routeToRemove.suspendList;
     }
 
     /*
@@ -217,24 +287,25 @@ void audioPath_release(const pathId id)
      * - if the path to be removed was not suspended by any other path, resume
      *   the path.
      */
-    for(const auto& i : routeToRemove.suspendList)
+    uint32_t suspendList = routeToRemove.suspendList;
+    while(suspendList != 0)
     {
-        auto& suspendedBy = routes.at(i).suspendedBy;
-        suspendedBy.erase(id);
+        uint32_t i = popSlot(suspendList);
+        uint32_t& suspendedBy = routes[i].suspendedBy;
+        suspendedBy &= ~slotMask;
 
-        if(routeToRemove.suspendedBy.empty() == false)
+        if(routeToRemove.suspendedBy != 0)
         {
             // If I was suspended, propagate who suspended me
-            for(const auto& j : routeToRemove.suspendedBy)
-                suspendedBy.insert(j);
+            suspendedBy |= routeToRemove.suspendedBy;
         }
         else
         {
             // This path can be started again
-            if(suspendedBy.empty())
+            if(suspendedBy == 0)
             {
-                activePaths.insert(i);
-                routes.at(i).path.open();
+                activePaths |= (1u << i);
+                routes[i].path.open();
             }
         }
     }
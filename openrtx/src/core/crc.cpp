@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ * 
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "core/crc.h"
+#include <array>
+#include <utility>
+
+/*
+ * Number of lookup tables used by the CRC engines, selectable according to the
+ * available flash memory. Each table takes 512 bytes per CRC type: using one
+ * table the CRC is computed one byte at a time, using four or eight tables
+ * (slicing-by-N) the CRC is computed on four or eight bytes at a time.
+ */
+#ifndef CONFIG_CRC_SLICES
+#define CONFIG_CRC_SLICES 4
+#endif
+
+static constexpr size_t CRC_SLICES = CONFIG_CRC_SLICES;
+
+static_assert((CRC_SLICES == 1) || (CRC_SLICES == 4) || (CRC_SLICES == 8),
+              "CRC slices must be one, four or eight");
+
+/**
+ * Compute bit by bit the CRC of a single byte, with zero initial value.
+ *
+ * @param poly: CRC polynomial.
+ * @param value: input byte.
+ * @return CRC value.
+ */
+static constexpr uint16_t crcByte(const uint16_t poly, const uint8_t value)
+{
+    uint16_t crc = value << 8;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        if (crc & 0x8000)
+            crc = (crc << 1) ^ poly;
+        else
+            crc = crc << 1;
+    }
+
+    return crc;
+}
+
+/**
+ * Compute an entry of a slicing-by-N lookup table, that is the CRC of a byte
+ * followed by a given number of zero bytes.
+ *
+ * @param poly: CRC polynomial.
+ * @param slice: table index, equal to the number of trailing zero bytes.
+ * @param value: input byte.
+ * @return table entry.
+ */
+static constexpr uint16_t crcSliceEntry(const uint16_t poly, const size_t slice,
+                                        const uint8_t value)
+{
+    if (slice == 0)
+        return crcByte(poly, value);
+
+    uint16_t prev = crcSliceEntry(poly, slice - 1, value);
+    return (prev << 8) ^ crcByte(poly, prev >> 8);
+}
+
+template <size_t... I>
+static constexpr std::array<uint16_t, sizeof...(I)>
+crcTable(const uint16_t poly, std::index_sequence<I...>)
+{
+    return { { crcSliceEntry(poly, I / 256, I % 256)... } };
+}
+
+using crc_table_t = std::array<uint16_t, 256 * CRC_SLICES>;
+
+static constexpr crc_table_t CRC_M17_TABLE =
+    crcTable(0x5935, std::make_index_sequence<256 * CRC_SLICES>{});
+
+static constexpr crc_table_t CRC_CCITT_TABLE =
+    crcTable(0x1021, std::make_index_sequence<256 * CRC_SLICES>{});
+
+/**
+ * Update a non-reflected 16-bit CRC using the lookup tables.
+ *
+ * @param table: lookup tables for the CRC polynomial.
+ * @param crc: current CRC value.
+ * @param data: input data.
+ * @param len: data length, in bytes.
+ * @return updated CRC value.
+ */
+static uint16_t crcUpdate(const crc_table_t &table, uint16_t crc,
+                          const uint8_t *data, size_t len)
+{
+#if CONFIG_CRC_SLICES > 1
+    // The current CRC value is merged with the first two input bytes, the
+    // remaining ones are looked up directly.
+    while (len >= CRC_SLICES) {
+        crc ^= (data[0] << 8) | data[1];
+
+        uint16_t next = table[(CRC_SLICES - 1) * 256 + (crc >> 8)]
+                      ^ table[(CRC_SLICES - 2) * 256 + (crc & 0xFF)];
+
+        for (size_t i = 2; i < CRC_SLICES; i++)
+            next ^= table[(CRC_SLICES - 1 - i) * 256 + data[i]];
+
+        crc = next;
+        data += CRC_SLICES;
+        len -= CRC_SLICES;
+    }
+#endif
+
+    for (size_t i = 0; i < len; i++)
+        crc = (crc << 8) ^ table[(crc >> 8) ^ data[i]];
+
+    return crc;
+}
+
+uint16_t crc_m17_update(const uint16_t crc, const void *data, const size_t len)
+{
+    return crcUpdate(CRC_M17_TABLE, crc, (const uint8_t *)data, len);
+}
+
+uint16_t crc_m17(const void *data, const size_t len)
+{
+    return crc_m17_update(CRC_M17_INIT, data, len);
+}
+
+uint16_t crc_ccitt_update(const uint16_t crc, const void *data,
+                          const size_t len)
+{
+    return crcUpdate(CRC_CCITT_TABLE, crc, (const uint8_t *)data, len);
+}
+
+uint16_t crc_ccitt(const void *data, const size_t len)
+{
+    return crc_ccitt_update(CRC_CCITT_INIT, data, len);
+}
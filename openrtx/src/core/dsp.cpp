@@ -21,6 +21,14 @@ int16_t dsp_dcBlockFilter(struct dcBlock *dcb, int16_t sample)
     dcb->accum -= 164 * dcb->prevOut; // 32768.0 * (1.0 - pole)
     dcb->prevOut = dcb->accum >> 15;
 
+    // Removing a large DC offset may bring the output out of range, saturate
+    // instead of wrapping around.
+    if (dcb->prevOut > INT16_MAX)
+        return INT16_MAX;
+
+    if (dcb->prevOut < INT16_MIN)
+        return INT16_MIN;
+
     return static_cast<int16_t>(dcb->prevOut);
 }
 
@@ -22,28 +22,27 @@
 
 #include "qrcode.h"
 
-#include "fonts/adafruit/gfxfont.h"
-#include "fonts/adafruit/TomThumb.h"
-#include "fonts/adafruit/FreeSans6pt7b.h"
-#include "fonts/adafruit/FreeSans8pt7b.h"
-#include "fonts/adafruit/FreeSans9pt7b.h"
-#include "fonts/adafruit/FreeSans10pt7b.h"
-#include "fonts/adafruit/FreeSans12pt7b.h"
-#include "fonts/adafruit/FreeSans16pt7b.h"
-#include "fonts/adafruit/FreeSans18pt7b.h"
-#include "fonts/adafruit/FreeSans24pt7b.h"
-#include "fonts/adafruit/UbuntuRegular6pt7b.h"
-#include "fonts/adafruit/UbuntuRegular8pt7b.h"
-#include "fonts/adafruit/UbuntuRegular9pt7b.h"
-#include "fonts/adafruit/UbuntuRegular10pt7b.h"
-#include "fonts/adafruit/UbuntuRegular12pt7b.h"
-#include "fonts/adafruit/UbuntuRegular16pt7b.h"
-#include "fonts/adafruit/UbuntuRegular18pt7b.h"
-#include "fonts/adafruit/UbuntuRegular24pt7b.h"
-
-#include "fonts/symbols/Symbols5pt7b.h"
-#include "fonts/symbols/Symbols6pt7b.h"
-#include "fonts/symbols/Symbols8pt7b.h"
+#include "fonts/packed/packedfont.h"
+#include "fonts/packed/TomThumb.h"
+#if defined FONT_FREE_SANS
+#include "fonts/packed/FreeSans6pt7b.h"
+#include "fonts/packed/FreeSans8pt7b.h"
+#include "fonts/packed/FreeSans9pt7b.h"
+#include "fonts/packed/FreeSans10pt7b.h"
+#include "fonts/packed/FreeSans12pt7b.h"
+#include "fonts/packed/FreeSans16pt7b.h"
+#elif defined FONT_UBUNTU_REGULAR
+#include "fonts/packed/UbuntuRegular6pt7b.h"
+#include "fonts/packed/UbuntuRegular8pt7b.h"
+#include "fonts/packed/UbuntuRegular9pt7b.h"
+#include "fonts/packed/UbuntuRegular10pt7b.h"
+#include "fonts/packed/UbuntuRegular12pt7b.h"
+#include "fonts/packed/UbuntuRegular16pt7b.h"
+#endif
+
+#include "fonts/packed/Symbols5pt7b.h"
+#include "fonts/packed/Symbols6pt7b.h"
+#include "fonts/packed/Symbols8pt7b.h"
 
 // Variable swap macro
 #define DEG_RAD  0.017453292519943295769236907684886
@@ -54,58 +53,73 @@
 /**
  * Fonts, ordered by the fontSize_t enum.
  */
-static const GFXfont fonts[] = { TomThumb,            // 5pt
+static const packedFont_t fonts[] = { TomThumb,            // 5pt
     #if defined FONT_FREE_SANS
-                                 FreeSans6pt7b,       // 6pt
-                                 FreeSans8pt7b,       // 8pt
-                                 FreeSans9pt7b,       // 9pt
-                                 FreeSans10pt7b,      // 10pt
-                                 FreeSans12pt7b,      // 12pt
-                                 FreeSans16pt7b,      // 16pt
+                                      FreeSans6pt7b,       // 6pt
+                                      FreeSans8pt7b,       // 8pt
+                                      FreeSans9pt7b,       // 9pt
+                                      FreeSans10pt7b,      // 10pt
+                                      FreeSans12pt7b,      // 12pt
+                                      FreeSans16pt7b,      // 16pt
     #elif defined FONT_UBUNTU_REGULAR
-                                 UbuntuRegular6pt7b,  // 6pt
-                                 UbuntuRegular8pt7b,  // 8pt
-                                 UbuntuRegular9pt7b,  // 9pt
-                                 UbuntuRegular10pt7b, // 10pt
-                                 UbuntuRegular12pt7b, // 12pt
-                                 UbuntuRegular16pt7b, // 16pt
+                                      UbuntuRegular6pt7b,  // 6pt
+                                      UbuntuRegular8pt7b,  // 8pt
+                                      UbuntuRegular9pt7b,  // 9pt
+                                      UbuntuRegular10pt7b, // 10pt
+                                      UbuntuRegular12pt7b, // 12pt
+                                      UbuntuRegular16pt7b, // 16pt
     #else
     #error Unsupported font family!
     #endif
-                                 Symbols5pt7b,      // 5pt
-                                 Symbols6pt7b,      // 6pt
-                                 Symbols8pt7b       // 8pt
-                               };
+                                      Symbols5pt7b,        // 5pt
+                                      Symbols6pt7b,        // 6pt
+                                      Symbols8pt7b         // 8pt
+                                    };
 
 #ifdef CONFIG_PIX_FMT_RGB565
 
-/* This specialization is meant for an RGB565 little endian pixel format.
- * Thus, to accomodate for the endianness, the fields in struct rgb565_t have to
- * be written in reversed order.
- *
- * For more details about endianness and bitfield structs see the following web
- * page: http://mjfrazer.org/mjfrazer/bitfields/
+/* This specialization is meant for an RGB565 pixel format, stored in the byte
+ * order expected by the display controller: native byte order by default, big
+ * endian when CONFIG_PIX_FMT_BE is defined. In this way, the framebuffer can be
+ * sent to the display as it is, without any conversion.
  */
 
-#define PIXEL_T rgb565_t
+#define PIXEL_T uint16_t
+#define PIXEL_BITS 16
 #define FB_SIZE (CONFIG_SCREEN_HEIGHT * CONFIG_SCREEN_WIDTH)
 
-typedef struct
+/* Convert a pixel between native and framebuffer byte order, both ways */
+#ifdef CONFIG_PIX_FMT_BE
+#define PIXEL_ORDER(x) __builtin_bswap16(x)
+#else
+#define PIXEL_ORDER(x) (x)
+#endif
+
+/* Color components of a pixel in native byte order */
+#define PIXEL_R(x) (((x) >> 11) & 0x1F)
+#define PIXEL_G(x) (((x) >> 5)  & 0x3F)
+#define PIXEL_B(x) ((x) & 0x1F)
+
+static uint16_t _true2highColor(color_t true_color)
 {
-    uint16_t b : 5;
-    uint16_t g : 6;
-    uint16_t r : 5;
+    uint16_t high_color = ((true_color.r >> 3) << 11)
+                        | ((true_color.g >> 2) << 5)
+                        |  (true_color.b >> 3);
+
+    return PIXEL_ORDER(high_color);
 }
-rgb565_t;
 
-static rgb565_t _true2highColor(color_t true_color)
+/* Blend a pixel over another one, both in framebuffer byte order */
+static inline uint16_t _blendPixel(uint16_t old_pixel, uint16_t new_pixel,
+                                   uint8_t alpha)
 {
-    rgb565_t high_color;
-    high_color.r = true_color.r >> 3;
-    high_color.g = true_color.g >> 2;
-    high_color.b = true_color.b >> 3;
+    uint16_t old_px = PIXEL_ORDER(old_pixel);
+    uint16_t new_px = PIXEL_ORDER(new_pixel);
+    uint16_t r = ((255-alpha)*PIXEL_R(old_px)+alpha*PIXEL_R(new_px))/255;
+    uint16_t g = ((255-alpha)*PIXEL_G(old_px)+alpha*PIXEL_G(new_px))/255;
+    uint16_t b = ((255-alpha)*PIXEL_B(old_px)+alpha*PIXEL_B(new_px))/255;
 
-    return high_color;
+    return PIXEL_ORDER((r << 11) | (g << 5) | b);
 }
 
 #elif defined CONFIG_PIX_FMT_BW
@@ -117,8 +131,25 @@ static rgb565_t _true2highColor(color_t true_color)
  */
 
 #define PIXEL_T uint8_t
+#define PIXEL_BITS 1
 #define FB_SIZE (((CONFIG_SCREEN_HEIGHT * CONFIG_SCREEN_WIDTH) / 8 ) + 1)
 
+/*
+ * Position of a pixel in the framebuffer: by default pixels are stored by
+ * rows, eight consecutive pixels of a row in each byte. When
+ * CONFIG_PIX_FMT_PAGED is defined, pixels are stored in pages of eight rows as
+ * in the memory of most monochrome display controllers: each byte holds eight
+ * consecutive pixels of a column, the topmost one in the least significant
+ * bit.
+ */
+#ifdef CONFIG_PIX_FMT_PAGED
+#define PIXEL_CELL(x, y) ((x) + ((y) / 8) * CONFIG_SCREEN_WIDTH)
+#define PIXEL_ELEM(x, y) ((y) % 8)
+#else
+#define PIXEL_CELL(x, y) (((x) + (y) * CONFIG_SCREEN_WIDTH) / 8)
+#define PIXEL_ELEM(x, y) (((x) + (y) * CONFIG_SCREEN_WIDTH) % 8)
+#endif
+
 typedef enum
 {
     WHITE = 0,
@@ -147,6 +178,674 @@ static PIXEL_T __attribute__((section(".bss.fb"))) framebuffer[FB_SIZE];
 #endif
 static char text[32];
 
+/*
+ * Dirty line tracking: the drawing primitives mark the lines they write to,
+ * and gfx_flush() sends the marked lines to the display. A line is a row of
+ * pixels, or a page of eight rows when the framebuffer is organized in pages.
+ *
+ * Since the UI redraws a screen from scratch at each update, every line ends
+ * up marked. When CONFIG_GFX_SHADOW_BUFFER is defined, a copy of the content
+ * last sent to the display is kept and the marked lines are compared against
+ * it, sending only the lines which actually changed. The copy is as large as
+ * the framebuffer, thus it is enabled by default only for monochrome displays.
+ */
+#ifdef CONFIG_PIX_FMT_PAGED
+#define LINE_ROWS 8
+#define LINE_START(l) (((uint32_t) (l)) * CONFIG_SCREEN_WIDTH)
+#define LINE_END(l)   (((uint32_t) (l) + 1) * CONFIG_SCREEN_WIDTH)
+#else
+#define LINE_ROWS 1
+#define LINE_BITS     (CONFIG_SCREEN_WIDTH * PIXEL_BITS)
+#define LINE_START(l) ((((uint32_t) (l)) * LINE_BITS) / 8)
+#define LINE_END(l)   (((((uint32_t) (l) + 1) * LINE_BITS) + 7) / 8)
+#endif
+
+#define NUM_LINES   (CONFIG_SCREEN_HEIGHT / LINE_ROWS)
+#define DIRTY_WORDS ((NUM_LINES + 31) / 32)
+
+#if (PIXEL_BITS == 1) && !defined(CONFIG_GFX_SHADOW_BUFFER)
+#define CONFIG_GFX_SHADOW_BUFFER
+#endif
+
+#ifdef CONFIG_GFX_SHADOW_BUFFER
+
+#if ((CONFIG_SCREEN_WIDTH * PIXEL_BITS) % 8) != 0
+#error The shadow buffer requires the framebuffer rows to be byte aligned
+#endif
+
+#if defined(PLATFORM_LINUX)
+static PIXEL_T shadowBuffer[FB_SIZE];
+#else
+static PIXEL_T __attribute__((section(".bss.fb"))) shadowBuffer[FB_SIZE];
+#endif
+
+#endif
+
+/*
+ * Double buffering: the rows to be flushed are copied to a transfer buffer and
+ * sent to the display in background, while the next frame is drawn. The
+ * transfer buffer holds the whole screen or, to save RAM, only a band of
+ * CONFIG_GFX_DOUBLE_BUFFER_ROWS rows: larger updates are sent in more bands,
+ * waiting for the transfer of each band before copying the next one.
+ */
+#ifdef CONFIG_GFX_DOUBLE_BUFFER
+
+#ifndef CONFIG_DISPLAY_ASYNC
+#error Double buffering requires a display driver with asynchronous transfers
+#endif
+
+#ifndef CONFIG_GFX_DOUBLE_BUFFER_ROWS
+#define CONFIG_GFX_DOUBLE_BUFFER_ROWS CONFIG_SCREEN_HEIGHT
+#endif
+
+#if ((CONFIG_GFX_DOUBLE_BUFFER_ROWS % LINE_ROWS) != 0) || \
+    (CONFIG_GFX_DOUBLE_BUFFER_ROWS > CONFIG_SCREEN_HEIGHT)
+#error The double buffer must hold whole lines of the framebuffer
+#endif
+
+#if ((CONFIG_SCREEN_WIDTH * PIXEL_BITS) % 8) != 0
+#error Double buffering requires the framebuffer rows to be byte aligned
+#endif
+
+#define XFER_SIZE ((CONFIG_GFX_DOUBLE_BUFFER_ROWS * CONFIG_SCREEN_WIDTH * \
+                    PIXEL_BITS) / (8 * sizeof(PIXEL_T)))
+
+#if defined(PLATFORM_LINUX)
+static PIXEL_T xferBuffer[XFER_SIZE];
+#else
+static PIXEL_T __attribute__((section(".bss.fb"))) xferBuffer[XFER_SIZE];
+#endif
+
+/*
+ * Bands are merged as long as they fit in the transfer buffer, sending them
+ * with a single transfer.
+ */
+#define FLUSH_MAX_ROWS  CONFIG_GFX_DOUBLE_BUFFER_ROWS
+#define FLUSH_MERGE_GAP CONFIG_GFX_DOUBLE_BUFFER_ROWS
+
+#else
+
+/*
+ * Unchanged rows between two bands to be flushed below which the bands are
+ * merged, saving the setup of a new transfer. Eight rows are also the height
+ * of a memory page in the controllers of monochrome displays.
+ */
+#define FLUSH_MAX_ROWS  CONFIG_SCREEN_HEIGHT
+#define FLUSH_MERGE_GAP 8
+
+#endif
+
+static uint32_t dirtyLines[DIRTY_WORDS];
+
+static inline void markDirty(const uint8_t row)
+{
+    uint8_t line = row / LINE_ROWS;
+    dirtyLines[line / 32] |= (1u << (line % 32));
+}
+
+static inline bool isDirty(const uint8_t line)
+{
+    return (dirtyLines[line / 32] & (1u << (line % 32))) != 0;
+}
+
+/*
+ * Check if a line differs from the content last sent to the display. Without
+ * the shadow buffer, every marked line is assumed to be changed.
+ */
+static inline bool lineChanged(const uint8_t line)
+{
+#ifdef CONFIG_GFX_SHADOW_BUFFER
+    const uint8_t *fb     = (const uint8_t *) framebuffer;
+    const uint8_t *shadow = (const uint8_t *) shadowBuffer;
+    uint32_t       start  = LINE_START(line);
+
+    return memcmp(&fb[start], &shadow[start], LINE_END(line) - start) != 0;
+#else
+    (void) line;
+    return true;
+#endif
+}
+
+/*
+ * Record the content of the lines covering a set of rows about to be sent to
+ * the display.
+ */
+static void syncRows(const uint8_t startRow, const uint8_t endRow)
+{
+    uint8_t first = startRow / LINE_ROWS;
+    uint8_t last  = (endRow + LINE_ROWS - 1) / LINE_ROWS;
+
+#ifdef CONFIG_GFX_SHADOW_BUFFER
+    const uint8_t *fb     = (const uint8_t *) framebuffer;
+    uint8_t       *shadow = (uint8_t *) shadowBuffer;
+    uint32_t       start  = LINE_START(first);
+
+    memcpy(&shadow[start], &fb[start], LINE_END(last - 1) - start);
+#endif
+
+    for(uint8_t line = first; line < last; line++)
+        dirtyLines[line / 32] &= ~(1u << (line % 32));
+}
+
+/*
+ * Send a band of rows to the display. Without double buffering, the caller is
+ * blocked until the transfer is completed.
+ */
+static void sendRows(const uint8_t startRow, const uint8_t endRow)
+{
+    syncRows(startRow, endRow);
+
+#ifdef CONFIG_GFX_DOUBLE_BUFFER
+    const uint8_t *fb    = (const uint8_t *) framebuffer;
+    uint32_t       start = LINE_START(startRow / LINE_ROWS);
+    uint32_t       end   = LINE_END((endRow / LINE_ROWS) - 1);
+
+    // The transfer buffer is free once the previous band has been sent
+    display_waitRender();
+    memcpy(xferBuffer, &fb[start], end - start);
+    display_renderRowsAsync(startRow, endRow, xferBuffer);
+#else
+    display_renderRows(startRow, endRow, framebuffer);
+#endif
+}
+
+/*
+ * Span raster layer: the drawing primitives fill horizontal spans of pixels
+ * instead of setting them one at a time. Spans are clipped once by the caller
+ * and written with word or byte stores.
+ */
+typedef struct
+{
+    color_t  color;   // Source color
+    uint16_t pixel;   // Color in framebuffer format
+    bool     visible; // Color is opaque enough to be drawn
+}
+ink_t;
+
+static inline ink_t makeInk(const color_t color)
+{
+    ink_t ink;
+    ink.color = color;
+
+#ifdef CONFIG_PIX_FMT_RGB565
+    ink.pixel   = _true2highColor(color);
+    ink.visible = (color.alpha > 0);
+#elif defined CONFIG_PIX_FMT_BW
+    // Ignore more than half transparent pixels
+    ink.pixel   = _color2bw(color);
+    ink.visible = (color.alpha >= 128);
+#endif
+
+    return ink;
+}
+
+/*
+ * Fill the pixels of row y from x0 to x1, excluded. Coordinates must be
+ * within the screen, with x0 < x1.
+ */
+static inline void putSpan(const int16_t x0, const int16_t x1, const int16_t y,
+                    const ink_t *ink)
+{
+    markDirty(y);
+
+#ifdef CONFIG_PIX_FMT_RGB565
+    uint16_t *px = &framebuffer[x0 + y*CONFIG_SCREEN_WIDTH];
+    uint16_t  n  = x1 - x0;
+
+    if(ink->color.alpha < 255)
+    {
+        for(; n > 0; n--, px++)
+            *px = _blendPixel(*px, ink->pixel, ink->color.alpha);
+
+        return;
+    }
+
+    // Short spans, as the ones of glyphs, are not worth any setup
+    if(n < 8)
+    {
+        for(; n > 0; n--, px++)
+            *px = ink->pixel;
+
+        return;
+    }
+
+    // Both bytes are equal, as for black and white
+    if((ink->pixel >> 8) == (ink->pixel & 0xFF))
+    {
+        memset(px, ink->pixel & 0xFF, n * sizeof(uint16_t));
+        return;
+    }
+
+    // Align to a word boundary, then store two pixels at a time
+    if((((uintptr_t) px) & 0x03) != 0)
+    {
+        *px++ = ink->pixel;
+        n--;
+    }
+
+    uint32_t pair = (((uint32_t) ink->pixel) << 16) | ink->pixel;
+    for(; n >= 2; n -= 2, px += 2)
+        memcpy(px, &pair, sizeof(pair));
+
+    if(n > 0)
+        *px = ink->pixel;
+#elif defined CONFIG_PIX_FMT_PAGED
+    uint8_t *px   = &framebuffer[x0 + (y / 8)*CONFIG_SCREEN_WIDTH];
+    uint8_t  mask = 1 << (y % 8);
+
+    if(ink->pixel != 0)
+    {
+        for(int16_t x = x0; x < x1; x++, px++)
+            *px |= mask;
+    }
+    else
+    {
+        for(int16_t x = x0; x < x1; x++, px++)
+            *px &= ~mask;
+    }
+#elif defined CONFIG_PIX_FMT_BW
+    uint32_t first = x0 + y*CONFIG_SCREEN_WIDTH;
+    uint32_t last  = x1 - 1 + y*CONFIG_SCREEN_WIDTH;
+    uint8_t *px    = &framebuffer[first / 8];
+    uint8_t *end   = &framebuffer[last / 8];
+    uint8_t  head  = 0xFF << (first % 8);
+    uint8_t  tail  = 0xFF >> (7 - (last % 8));
+    uint8_t  fill  = (ink->pixel != 0) ? 0xFF : 0x00;
+
+    // Partial bytes at the two ends, whole bytes in between
+    if(px == end)
+    {
+        uint8_t mask = head & tail;
+        *px = (*px & ~mask) | (fill & mask);
+        return;
+    }
+
+    *px = (*px & ~head) | (fill & head);
+    memset(px + 1, fill, end - (px + 1));
+    *end = (*end & ~tail) | (fill & tail);
+#endif
+}
+
+/*
+ * Fill the pixels from (x0, y0) to (x1, y1), excluded, clipping them to the
+ * screen.
+ */
+static void fillRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                     const ink_t *ink)
+{
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 > CONFIG_SCREEN_WIDTH)  x1 = CONFIG_SCREEN_WIDTH;
+    if(y1 > CONFIG_SCREEN_HEIGHT) y1 = CONFIG_SCREEN_HEIGHT;
+
+    if((x0 >= x1) || (y0 >= y1) || (ink->visible == false))
+        return;
+
+#ifdef CONFIG_PIX_FMT_PAGED
+    // Fill the rows belonging to the same page at once
+    for(int32_t y = y0; y < y1;)
+    {
+        int32_t  page = y / 8;
+        int32_t  next = MIN((page + 1) * 8, y1);
+        uint8_t  mask = (0xFF << (y % 8)) & (0xFF >> (7 - ((next - 1) % 8)));
+        uint8_t  fill = (ink->pixel != 0) ? mask : 0x00;
+        uint8_t *px   = &framebuffer[x0 + page*CONFIG_SCREEN_WIDTH];
+
+        for(int32_t x = x0; x < x1; x++, px++)
+            *px = (*px & ~mask) | fill;
+
+        markDirty(y);
+        y = next;
+    }
+#else
+    for(int32_t y = y0; y < y1; y++)
+        putSpan(x0, x1, y, ink);
+#endif
+}
+
+/*
+ * Load up to 56 pixels of a bitmap glyph, starting from the pixel at position
+ * pos. The first pixel is in the most significant bit, followed by the others
+ * and then by zeros.
+ */
+static inline uint64_t loadPixels(const uint8_t *bitmap, const uint32_t pos,
+                                  const uint8_t n)
+{
+    uint8_t  bytes = ((pos % 8) + n + 7) / 8;
+    uint64_t bits  = 0;
+
+    for(uint8_t i = 0; i < bytes; i++)
+        bits |= ((uint64_t) bitmap[(pos / 8) + i]) << (56 - (8 * i));
+
+    return (bits << (pos % 8)) & ~(UINT64_MAX >> n);
+}
+
+/*
+ * Read the length of the next run of a run-length encoded glyph.
+ */
+static inline uint32_t nextRun(const uint8_t *data, uint32_t *nibble)
+{
+    uint32_t run = 0;
+    uint8_t  value;
+
+    do
+    {
+        value = data[*nibble / 2];
+        if((*nibble % 2) == 0)
+            value >>= 4;
+
+        value &= 0x0F;
+        run   += value;
+        (*nibble)++;
+    }
+    while(value == 15);
+
+    return run;
+}
+
+/*
+ * Draw a bitmap glyph with the top left corner at (x, y). The glyph is clipped
+ * to the screen once, excluding its first row and column as done so far by the
+ * text rendering. Each row is loaded in a word, up to 56 pixels at a time, and
+ * the runs of set pixels are found by counting the leading zeros.
+ */
+static void blitBitmap(const int32_t x, const int32_t y, const uint8_t *bitmap,
+                       const uint8_t w, const uint8_t h, const ink_t *ink)
+{
+    int32_t minX = (x > 1) ? x : 1;
+    int32_t minY = (y > 1) ? y : 1;
+    int32_t maxX = MIN(x + w, CONFIG_SCREEN_WIDTH);
+    int32_t maxY = MIN(y + h, CONFIG_SCREEN_HEIGHT);
+
+    if((minX >= maxX) || (minY >= maxY))
+        return;
+
+    // Glyph bitmaps are packed, rows are not aligned to byte boundaries
+    uint32_t row = (minY - y) * w;
+    for(int32_t py = minY; py < maxY; py++, row += w)
+    {
+        for(int32_t cx = minX - x; cx < maxX - x; cx += 56)
+        {
+            uint64_t bits = loadPixels(bitmap, row + cx, MIN(56, maxX - x - cx));
+            int32_t  px   = x + cx;
+
+            while(bits != 0)
+            {
+                uint8_t skip = __builtin_clzll(bits);
+                bits <<= skip;
+                px    += skip;
+
+                uint8_t run = __builtin_clzll(~bits);
+                putSpan(px, px + run, py, ink);
+                bits <<= run;
+                px    += run;
+            }
+        }
+    }
+}
+
+/*
+ * Draw a run-length encoded glyph with the top left corner at (x, y), clipped
+ * as the bitmap ones. Runs of set pixels crossing the end of a row are split
+ * in one span per row.
+ */
+static void blitRle(const int32_t x, const int32_t y, const uint8_t *data,
+                    const uint8_t w, const uint8_t h, const ink_t *ink)
+{
+    int32_t minX = (x > 1) ? x : 1;
+    int32_t minY = (y > 1) ? y : 1;
+    int32_t maxX = MIN(x + w, CONFIG_SCREEN_WIDTH);
+    int32_t maxY = MIN(y + h, CONFIG_SCREEN_HEIGHT);
+
+    if((minX >= maxX) || (minY >= maxY))
+        return;
+
+    int32_t  py     = y;
+    int32_t  col    = 0;
+    uint32_t nibble = 0;
+
+    while(py < maxY)
+    {
+        // Unset pixels
+        col += nextRun(data, &nibble);
+        while(col >= w)
+        {
+            col -= w;
+            py++;
+        }
+
+        // Set pixels
+        uint32_t run = nextRun(data, &nibble);
+        while((run > 0) && (py < maxY))
+        {
+            uint32_t n  = MIN(run, (uint32_t) (w - col));
+            int32_t  x0 = (x + col > minX) ? x + col : minX;
+            int32_t  x1 = MIN(x + col + (int32_t) n, maxX);
+
+            if((py >= minY) && (x0 < x1))
+                putSpan(x0, x1, py, ink);
+
+            run -= n;
+            col += n;
+            if(col == w)
+            {
+                col = 0;
+                py++;
+            }
+        }
+    }
+}
+
+/*
+ * Glyph cache: the glyphs of the CONFIG_GFX_GLYPH_CACHE font size are expanded
+ * in RAM as spans of set pixels the first time they are drawn, and then drawn
+ * from there without decoding them again. When the CONFIG_GFX_GLYPH_CACHE_SPANS
+ * spans of the cache are used up, the remaining glyphs are decoded at every
+ * draw.
+ */
+#ifdef CONFIG_GFX_GLYPH_CACHE
+
+#ifndef CONFIG_GFX_GLYPH_CACHE_SPANS
+#define CONFIG_GFX_GLYPH_CACHE_SPANS 1024
+#endif
+
+// Printable ASCII characters
+#define CACHE_GLYPHS 95
+
+typedef struct
+{
+    uint8_t row;      // Glyph row
+    uint8_t start;    // First set pixel
+    uint8_t end;      // Pixel following the last set one
+}
+span_t;
+
+enum cacheState
+{
+    GLYPH_UNCACHED = 0,
+    GLYPH_CACHED,
+    GLYPH_NO_SPACE
+};
+
+typedef struct
+{
+    uint16_t first;   // First span of the glyph
+    uint8_t  count;   // Number of spans
+    uint8_t  state;   // Cache state, from enum cacheState
+}
+cacheEntry_t;
+
+static span_t       cacheSpans[CONFIG_GFX_GLYPH_CACHE_SPANS];
+static cacheEntry_t cacheEntries[CACHE_GLYPHS];
+static uint16_t     cacheUsed;
+
+/*
+ * Append a span to the ones of a glyph being expanded, counting also the ones
+ * exceeding the available space.
+ */
+static inline void addSpan(span_t *spans, uint16_t *count, const uint16_t size,
+                           const uint8_t row, const uint8_t start,
+                           const uint8_t end)
+{
+    if(*count < size)
+    {
+        spans[*count].row   = row;
+        spans[*count].start = start;
+        spans[*count].end   = end;
+    }
+
+    (*count)++;
+}
+
+/*
+ * Expand a glyph in spans of set pixels, one row at a time. Returns the number
+ * of spans of the glyph, even when exceeding the given size.
+ */
+static uint16_t expandGlyph(const uint8_t *data, const packedGlyph_t *glyph,
+                            span_t *spans, const uint16_t size)
+{
+    uint8_t  w     = glyph->width;
+    uint8_t  h     = glyph->height;
+    uint16_t count = 0;
+
+    if(w == 0)
+        return 0;
+
+    if(glyph->encoding == GLYPH_RAW)
+    {
+        for(uint8_t row = 0; row < h; row++)
+        {
+            for(uint8_t cx = 0; cx < w; cx += 56)
+            {
+                uint64_t bits = loadPixels(data, (row * w) + cx,
+                                           MIN(56, w - cx));
+                uint8_t  px   = cx;
+
+                while(bits != 0)
+                {
+                    uint8_t skip = __builtin_clzll(bits);
+                    bits <<= skip;
+                    px    += skip;
+
+                    uint8_t run = __builtin_clzll(~bits);
+                    addSpan(spans, &count, size, row, px, px + run);
+                    bits <<= run;
+                    px    += run;
+                }
+            }
+        }
+
+        return count;
+    }
+
+    uint8_t  row    = 0;
+    uint32_t col    = 0;
+    uint32_t nibble = 0;
+
+    while(row < h)
+    {
+        col += nextRun(data, &nibble);
+        while(col >= w)
+        {
+            col -= w;
+            row++;
+        }
+
+        uint32_t run = nextRun(data, &nibble);
+        while((run > 0) && (row < h))
+        {
+            uint32_t n = MIN(run, w - col);
+            addSpan(spans, &count, size, row, col, col + n);
+
+            run -= n;
+            col += n;
+            if(col == w)
+            {
+                col = 0;
+                row++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Draw a glyph from the cache, expanding it first if not done yet. Returns
+ * false if the glyph is not in the cache.
+ */
+static bool blitCached(const int32_t x, const int32_t y, const uint8_t size,
+                       const packedGlyph_t *glyph, const ink_t *ink)
+{
+    const packedFont_t *font  = &fonts[size];
+    uint32_t            index = glyph - font->glyph;
+
+    if((size != CONFIG_GFX_GLYPH_CACHE) || (index >= CACHE_GLYPHS))
+        return false;
+
+    cacheEntry_t *entry = &cacheEntries[index];
+    if(entry->state == GLYPH_UNCACHED)
+    {
+        uint16_t space = MIN(CONFIG_GFX_GLYPH_CACHE_SPANS - cacheUsed,
+                             UINT8_MAX);
+        uint16_t count = expandGlyph(&font->data[glyph->offset], glyph,
+                                     &cacheSpans[cacheUsed], space);
+
+        entry->state = GLYPH_NO_SPACE;
+        if(count <= space)
+        {
+            entry->first = cacheUsed;
+            entry->count = count;
+            entry->state = GLYPH_CACHED;
+            cacheUsed   += count;
+        }
+    }
+
+    if(entry->state != GLYPH_CACHED)
+        return false;
+
+    int32_t minX = (x > 1) ? x : 1;
+    int32_t minY = (y > 1) ? y : 1;
+    int32_t maxX = MIN(x + glyph->width, CONFIG_SCREEN_WIDTH);
+    int32_t maxY = MIN(y + glyph->height, CONFIG_SCREEN_HEIGHT);
+
+    const span_t *span = &cacheSpans[entry->first];
+    for(uint8_t i = 0; i < entry->count; i++, span++)
+    {
+        int32_t py = y + span->row;
+        int32_t x0 = (x + span->start > minX) ? x + span->start : minX;
+        int32_t x1 = MIN(x + span->end, maxX);
+
+        if((py >= minY) && (py < maxY) && (x0 < x1))
+            putSpan(x0, x1, py, ink);
+    }
+
+    return true;
+}
+
+#endif
+
+/*
+ * Draw a glyph of a font with the top left corner at (x, y).
+ */
+static void blitGlyph(const int32_t x, const int32_t y, const uint8_t size,
+                      const packedGlyph_t *glyph, const ink_t *ink)
+{
+    if(ink->visible == false)
+        return;
+
+#ifdef CONFIG_GFX_GLYPH_CACHE
+    if(blitCached(x, y, size, glyph, ink))
+        return;
+#endif
+
+    const uint8_t *data = &fonts[size].data[glyph->offset];
+
+    if(glyph->encoding == GLYPH_RLE)
+        blitRle(x, y, data, glyph->width, glyph->height, ink);
+    else
+        blitBitmap(x, y, data, glyph->width, glyph->height, ink);
+}
 
 void gfx_init()
 {
@@ -158,46 +857,120 @@ void gfx_init()
 
 void gfx_terminate()
 {
+    gfx_waitRender();
     display_terminate();
 }
 
 void gfx_renderRows(uint8_t startRow, uint8_t endRow)
 {
+    if(endRow > CONFIG_SCREEN_HEIGHT)
+        endRow = CONFIG_SCREEN_HEIGHT;
+
+    if(endRow <= startRow)
+        return;
+
+    syncRows(startRow, endRow);
     display_renderRows(startRow, endRow, framebuffer);
 }
 
 void gfx_render()
 {
+    syncRows(0, CONFIG_SCREEN_HEIGHT);
     display_render(framebuffer);
 }
 
+uint16_t gfx_flush()
+{
+    uint16_t rows  = 0;
+    int16_t  first = -1;
+    int16_t  last  = -1;
+
+    for(uint16_t line = 0; line < NUM_LINES; line++)
+    {
+        if((isDirty(line) == false) || (lineChanged(line) == false))
+            continue;
+
+        // Too far from the current band or not fitting in it, send the band
+        // and start a new one.
+        int16_t row = line * LINE_ROWS;
+        if((first >= 0) && (((row - last) > FLUSH_MERGE_GAP) ||
+                            ((row + LINE_ROWS - first) > FLUSH_MAX_ROWS)))
+        {
+            sendRows(first, last + LINE_ROWS);
+            rows += (last + LINE_ROWS) - first;
+            first = -1;
+        }
+
+        if(first < 0)
+            first = row;
+
+        last = row;
+    }
+
+    if(first >= 0)
+    {
+        sendRows(first, last + LINE_ROWS);
+        rows += (last + LINE_ROWS) - first;
+    }
+
+    memset(dirtyLines, 0x00, sizeof(dirtyLines));
+
+    return rows;
+}
+
+bool gfx_renderingInProgress()
+{
+#ifdef CONFIG_GFX_DOUBLE_BUFFER
+    return display_renderingInProgress();
+#else
+    return false;
+#endif
+}
+
+void gfx_waitRender()
+{
+#ifdef CONFIG_GFX_DOUBLE_BUFFER
+    display_waitRender();
+#endif
+}
+
 void gfx_clearRows(uint8_t startRow, uint8_t endRow)
 {
-    if(endRow < startRow)
+    if(endRow > CONFIG_SCREEN_HEIGHT)
+        endRow = CONFIG_SCREEN_HEIGHT;
+
+    if(endRow <= startRow)
         return;
 
-    uint16_t start = startRow * CONFIG_SCREEN_WIDTH * sizeof(PIXEL_T);
-    uint16_t height = endRow - startRow * CONFIG_SCREEN_WIDTH * sizeof(PIXEL_T);
     // Set the specified rows to 0x00 = make the screen black
-    memset(framebuffer + start, 0x00, height);
+    uint8_t *fb = (uint8_t *) framebuffer;
+
+#ifdef CONFIG_PIX_FMT_PAGED
+    for(uint8_t row = startRow; row < endRow; row++)
+    {
+        for(uint16_t x = 0; x < CONFIG_SCREEN_WIDTH; x++)
+            fb[PIXEL_CELL(x, row)] &= ~(1 << PIXEL_ELEM(x, row));
+    }
+#else
+    memset(fb + LINE_START(startRow), 0x00,
+           LINE_END(endRow - 1) - LINE_START(startRow));
+#endif
+
+    for(uint8_t row = startRow; row < endRow; row++)
+        markDirty(row);
 }
 
 void gfx_clearScreen()
 {
     // Set the whole framebuffer to 0x00 = make the screen black
     memset(framebuffer, 0x00, FB_SIZE * sizeof(PIXEL_T));
+    memset(dirtyLines, 0xFF, sizeof(dirtyLines));
 }
 
 void gfx_fillScreen(color_t color)
 {
-    for(int16_t y = 0; y < CONFIG_SCREEN_HEIGHT; y++)
-    {
-        for(int16_t x = 0; x < CONFIG_SCREEN_WIDTH; x++)
-        {
-            point_t pos = {x, y};
-            gfx_setPixel(pos, color);
-        }
-    }
+    ink_t ink = makeInk(color);
+    fillRect(0, 0, CONFIG_SCREEN_WIDTH, CONFIG_SCREEN_HEIGHT, &ink);
 }
 
 inline void gfx_setPixel(point_t pos, color_t color)
@@ -206,29 +979,23 @@ inline void gfx_setPixel(point_t pos, color_t color)
         pos.x < 0 || pos.y < 0)
         return; // off the screen
 
+    markDirty(pos.y);
+
 #ifdef CONFIG_PIX_FMT_RGB565
+    uint16_t index = pos.x + pos.y*CONFIG_SCREEN_WIDTH;
+    uint16_t pixel = _true2highColor(color);
+
     // Blend old pixel value and new one
     if (color.alpha < 255)
-    {
-        uint8_t alpha = color.alpha;
-        rgb565_t new_pixel = _true2highColor(color);
-        rgb565_t old_pixel = framebuffer[pos.x + pos.y*CONFIG_SCREEN_WIDTH];
-        rgb565_t pixel;
-        pixel.r = ((255-alpha)*old_pixel.r+alpha*new_pixel.r)/255;
-        pixel.g = ((255-alpha)*old_pixel.g+alpha*new_pixel.g)/255;
-        pixel.b = ((255-alpha)*old_pixel.b+alpha*new_pixel.b)/255;
-        framebuffer[pos.x + pos.y*CONFIG_SCREEN_WIDTH] = pixel;
-    }
-    else
-    {
-        framebuffer[pos.x + pos.y*CONFIG_SCREEN_WIDTH] = _true2highColor(color);
-    }
+        pixel = _blendPixel(framebuffer[index], pixel, color.alpha);
+
+    framebuffer[index] = pixel;
 #elif defined CONFIG_PIX_FMT_BW
     // Ignore more than half transparent pixels
     if (color.alpha >= 128)
     {
-        uint16_t cell = (pos.x + pos.y*CONFIG_SCREEN_WIDTH) / 8;
-        uint16_t elem = (pos.x + pos.y*CONFIG_SCREEN_WIDTH) % 8;
+        uint16_t cell = PIXEL_CELL(pos.x, pos.y);
+        uint16_t elem = PIXEL_ELEM(pos.x, pos.y);
         framebuffer[cell] &= ~(1 << elem);
         framebuffer[cell] |= (_color2bw(color) << elem);
     }
@@ -298,25 +1065,27 @@ void gfx_drawRect(point_t start, uint16_t width, uint16_t height, color_t color,
 {
     if(width == 0) return;
     if(height == 0) return;
-    uint16_t x_max = start.x + width - 1;
-    uint16_t y_max = start.y + height - 1;
-    bool perimeter = 0;
+    int32_t x_max = start.x + width - 1;
+    int32_t y_max = start.y + height - 1;
     if(x_max > (CONFIG_SCREEN_WIDTH - 1)) x_max = CONFIG_SCREEN_WIDTH - 1;
     if(y_max > (CONFIG_SCREEN_HEIGHT - 1)) y_max = CONFIG_SCREEN_HEIGHT - 1;
-    for(int16_t y = start.y; y <= y_max; y++)
+
+    ink_t ink = makeInk(color);
+
+    if(fill)
     {
-        for(int16_t x = start.x; x <= x_max; x++)
-        {
-            if(y == start.y || y == y_max || x == start.x || x == x_max) perimeter = 1;
-            else perimeter = 0;
-            // If fill is false, draw only rectangle perimeter
-            if(fill || perimeter)
-            {
-                point_t pos = {x, y};
-                gfx_setPixel(pos, color);
-            }
-        }
+        fillRect(start.x, start.y, x_max + 1, y_max + 1, &ink);
+        return;
     }
+
+    // Draw only the rectangle perimeter, each pixel once
+    fillRect(start.x, start.y, x_max + 1, start.y + 1, &ink);
+    if(y_max > start.y)
+        fillRect(start.x, y_max, x_max + 1, y_max + 1, &ink);
+
+    fillRect(start.x, start.y + 1, start.x + 1, y_max, &ink);
+    if(x_max > start.x)
+        fillRect(x_max, start.y + 1, x_max + 1, y_max, &ink);
 }
 
 void gfx_drawCircle(point_t start, uint16_t r, color_t color)
@@ -396,14 +1165,15 @@ void gfx_drawVLine(int16_t x, uint16_t width, color_t color)
  * @param text: the input text
  * @param length: the length of the input text, used for boundary checking
  */
-static inline uint16_t get_line_size(GFXfont f, const char *text, uint16_t length)
+static inline uint16_t get_line_size(const packedFont_t *f, const char *text,
+                                     uint16_t length)
 {
     uint16_t line_size = 0;
     for(unsigned i = 0; i < length && text[i] != '\n' && text[i] != '\r'; i++)
     {
-        GFXglyph glyph = f.glyph[text[i] - f.first];
-        if (line_size + glyph.xAdvance < CONFIG_SCREEN_WIDTH)
-            line_size += glyph.xAdvance;
+        const packedGlyph_t *glyph = packedFont_glyph(f, text[i]);
+        if (line_size + glyph->xAdvance < CONFIG_SCREEN_WIDTH)
+            line_size += glyph->xAdvance;
         else
             break;
     }
@@ -434,15 +1204,14 @@ static inline uint16_t get_reset_x(textAlign_t alignment, uint16_t line_size,
 
 uint8_t gfx_getFontHeight(fontSize_t size)
 {
-    GFXfont f = fonts[size];
-    GFXglyph glyph = f.glyph['|' - f.first];
-    return glyph.height;
+    return packedFont_glyph(&fonts[size], '|')->height;
 }
 
 point_t gfx_printBuffer(point_t start, fontSize_t size, textAlign_t alignment,
                         color_t color, const char *buf)
 {
-    GFXfont f = fonts[size];
+    const packedFont_t *f = &fonts[size];
+    ink_t ink = makeInk(color);
 
     size_t len = strlen(buf);
 
@@ -458,15 +1227,8 @@ point_t gfx_printBuffer(point_t start, fontSize_t size, textAlign_t alignment,
     for(unsigned i = 0; i < len; i++)
     {
         char c = buf[i];
-        GFXglyph glyph = f.glyph[c - f.first];
-        uint8_t *bitmap = f.bitmap;
-
-        uint16_t bo = glyph.bitmapOffset;
-        uint8_t w = glyph.width, h = glyph.height;
-        int8_t xo = glyph.xOffset,
-               yo = glyph.yOffset;
-        uint8_t xx, yy, bits = 0, bit = 0;
-        line_h = h;
+        const packedGlyph_t *glyph = packedFont_glyph(f, c);
+        line_h = glyph->height;
 
         // Handle newline and carriage return
         if (c == '\n')
@@ -480,7 +1242,7 @@ point_t gfx_printBuffer(point_t start, fontSize_t size, textAlign_t alignment,
             line_size = get_line_size(f, &buf[i+1], len-(i+1));
             start.x = reset_x = get_reset_x(alignment, line_size, start.x);
           }
-          start.y += f.yAdvance;
+          start.y += f->yAdvance;
           continue;
         }
         else if (c == '\r')
@@ -490,44 +1252,19 @@ point_t gfx_printBuffer(point_t start, fontSize_t size, textAlign_t alignment,
         }
 
         // Handle wrap around
-        if (start.x + glyph.xAdvance > CONFIG_SCREEN_WIDTH)
+        if (start.x + glyph->xAdvance > CONFIG_SCREEN_WIDTH)
         {
             // Compute size of the first row in pixels
             line_size = get_line_size(f, buf, len);
             start.x = reset_x = get_reset_x(alignment, line_size, start.x);
-            start.y += f.yAdvance;
+            start.y += f->yAdvance;
         }
 
         // Draw bitmap
-        for (yy = 0; yy < h; yy++)
-        {
-            for (xx = 0; xx < w; xx++)
-            {
-                if (!(bit++ & 7))
-                {
-                    bits = bitmap[bo++];
-                }
-
-                if (bits & 0x80)
-                {
-                    if (start.y + yo + yy < CONFIG_SCREEN_HEIGHT &&
-                        start.x + xo + xx < CONFIG_SCREEN_WIDTH &&
-                        start.y + yo + yy > 0 &&
-                        start.x + xo + xx > 0)
-                    {
-                        point_t pos;
-                        pos.x = start.x + xo + xx;
-                        pos.y = start.y + yo + yy;
-                        gfx_setPixel(pos, color);
-
-                    }
-                }
-
-                bits <<= 1;
-            }
-        }
+        blitGlyph(start.x + glyph->xOffset, start.y + glyph->yOffset, size,
+                  glyph, &ink);
 
-        start.x += glyph.xAdvance;
+        start.x += glyph->xAdvance;
     }
     // Calculate text size
     point_t text_size = {0, 0};
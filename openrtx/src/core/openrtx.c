@@ -17,6 +17,7 @@
 #include "core/ui.h"
 #ifdef PLATFORM_LINUX
 #include <stdlib.h>
+#include "mcu/x86_64/drivers/vclock.h"
 #endif
 
 extern void *main_thread(void *arg);
@@ -64,6 +65,10 @@ void *openrtx_run(void *arg)
 {
     (void) arg;
 
+    #ifdef PLATFORM_LINUX
+    vclock_attach();
+    #endif
+
     state.devStatus = RUNNING;
 
     // Start the OpenRTX threads
@@ -26,6 +26,10 @@
 #include "pmu.h"
 #endif
 
+#if defined(PLATFORM_LINUX)
+#include "mcu/x86_64/drivers/vclock.h"
+#endif
+
 /* Mutex for concurrent access to RTX state variable */
 pthread_mutex_t rtx_mutex;
 
@@ -41,6 +45,10 @@ void *ui_threadFunc(void *arg)
     bool        sync_rtx = true;
     long long   time     = 0;
 
+    #if defined(PLATFORM_LINUX)
+    vclock_attach();
+    #endif
+
     // Load initial state and update the UI
     ui_saveState();
     ui_updateGUI();
@@ -96,10 +104,10 @@ void *ui_threadFunc(void *arg)
             sync_rtx = false;
         }
 
-        // Update UI and render on screen, if necessary
+        // Update UI and send the changed rows to the screen, if necessary
         if(ui_updateGUI() == true)
         {
-            gfx_render();
+            gfx_flush();
         }
 
         // 40Hz update rate for keyboard and UI
@@ -165,6 +173,10 @@ void *rtx_threadFunc(void *arg)
 {
     (void) arg;
 
+    #if defined(PLATFORM_LINUX)
+    vclock_attach();
+    #endif
+
     rtx_init(&rtx_mutex);
 
     while(state.devStatus == RUNNING)
@@ -203,6 +215,10 @@ void create_threads()
     pthread_attr_setschedparam(&rtx_attr, &param);
     #endif
 
+    #if defined(PLATFORM_LINUX)
+    vclock_reserve();
+    #endif
+
     pthread_t rtx_thread;
     pthread_create(&rtx_thread, &rtx_attr, rtx_threadFunc, NULL);
 
@@ -217,6 +233,10 @@ void create_threads()
     pthread_attr_setstack(&ui_attr, ui_thread_stack, UI_THREAD_STKSIZE);
     #endif
 
+    #if defined(PLATFORM_LINUX)
+    vclock_reserve();
+    #endif
+
     pthread_t ui_thread;
     pthread_create(&ui_thread, &ui_attr, ui_threadFunc, NULL);
 }
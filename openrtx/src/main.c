@@ -13,6 +13,7 @@
 
 #ifdef PLATFORM_LINUX
 #include "emulator/sdl_engine.h"
+#include "mcu/x86_64/drivers/vclock.h"
 #endif
 
 int main(void)
@@ -39,6 +40,7 @@ int main(void)
     // Here we create a new thread for OpenRTX main program and utilize the main
     // thread for the SDL main loop.
     pthread_t openrtx_thread;
+    vclock_reserve();
     pthread_create(&openrtx_thread, NULL, openrtx_run, NULL);
 
     sdlEngine_run();
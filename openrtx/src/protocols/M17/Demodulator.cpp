@@ -9,6 +9,7 @@
 #include "protocols/M17/Utils.hpp"
 #include "core/audio_stream.h"
 #include <math.h>
+#include <algorithm>
 #include <cstring>
 #include <stdio.h>
 
@@ -132,7 +133,34 @@ static inline void pushLog(const log_entry_t& e)
 #endif
 
 
-Demodulator::Demodulator()
+/**
+ * Invert the phase of a baseband sample, saturating to the int16_t range.
+ */
+static inline int16_t invert(const int16_t sample)
+{
+    if(sample == INT16_MIN)
+        return INT16_MAX;
+
+    return -sample;
+}
+
+/**
+ * Convert a bit confidence level, ranging from 0.0 for a certain zero to 1.0
+ * for a certain one, to a soft decision value.
+ */
+static inline uint16_t softBit(const float value)
+{
+    if(value <= 0.0f)
+        return 0x0000;
+
+    if(value >= 1.0f)
+        return 0xFFFF;
+
+    return static_cast< uint16_t >(value * 65535.0f);
+}
+
+Demodulator::Demodulator() : corrThreshold(0.0f),
+                             idleGateLevel(IDLE_GATE_LEVEL)
 {
 
 }
@@ -153,6 +181,8 @@ void Demodulator::init()
     baseband_buffer = std::make_unique< int16_t[] >(2 * SAMPLE_BUF_SIZE);
     demodFrame      = std::make_unique< frame_t >();
     readyFrame      = std::make_unique< frame_t >();
+    demodSoftFrame  = std::make_unique< soft_frame_t >();
+    readySoftFrame  = std::make_unique< soft_frame_t >();
 
     reset();
 
@@ -176,6 +206,8 @@ void Demodulator::terminate()
     baseband_buffer.reset();
     demodFrame.reset();
     readyFrame.reset();
+    demodSoftFrame.reset();
+    readySoftFrame.reset();
 
     #ifdef ENABLE_DEMOD_LOG
     logRunning = false;
@@ -205,6 +237,12 @@ const frame_t& Demodulator::getFrame()
     return *readyFrame;
 }
 
+const soft_frame_t& Demodulator::getSoftFrame()
+{
+    newFrame = false;
+    return *readySoftFrame;
+}
+
 bool Demodulator::isLocked()
 {
     return (demodState == DemodState::LOCKED)
@@ -217,10 +255,77 @@ void Demodulator::sample(int16_t rawSample, bool invertPhase)
     int16_t sample = dsp_dcBlockFilter(&dcBlock, rawSample);
 
     // Apply RRC on the baseband sample
-    float           elem   = static_cast< float >(sample);
-    if(invertPhase) elem   = 0.0f - elem;
-    sample = static_cast< int16_t >(rrc_24k(elem));
+    if(invertPhase) sample = invert(sample);
+    sample = rrc(sample);
+
+    corrThreshold = sampleFilter(std::abs(sample));
+    demodulate(sample);
+}
+
+void Demodulator::processBlock(const int16_t *samples, const size_t length,
+                               const bool invertPhase)
+{
+    for(size_t start = 0; start < length; start += BLOCK_SIZE)
+    {
+        size_t count = length - start;
+        if(count > BLOCK_SIZE)
+            count = BLOCK_SIZE;
+
+        const int16_t *in = samples + start;
+
+        // Apply DC removal filter
+        for(size_t i = 0; i < count; i++)
+            blockSamples[i] = dsp_dcBlockFilter(&dcBlock, in[i]);
+
+        // Apply RRC on the baseband samples
+        if(invertPhase)
+        {
+            for(size_t i = 0; i < count; i++)
+                blockSamples[i] = invert(blockSamples[i]);
+        }
 
+        rrc.process(blockSamples.data(), blockSamples.data(), count);
+
+        // Update the correlation threshold
+        for(size_t i = 0; i < count; i++)
+            blockValues[i] = std::abs(blockSamples[i]);
+
+        sampleFilter.process(blockValues.data(), blockValues.data(), count);
+
+        // Symbol decisions
+        size_t gated = 0;
+        for(size_t i = 0; i < count; i++)
+        {
+            corrThreshold = blockValues[i];
+            if(idleGateClosed())
+                gated += 1;
+
+            demodulate(blockSamples[i]);
+        }
+
+        blockCount += 1;
+        if(gated == count)
+            gatedCount += 1;
+    }
+}
+
+void Demodulator::setIdleGateLevel(const float level)
+{
+    idleGateLevel = level;
+}
+
+uint32_t Demodulator::processedBlocks()
+{
+    return blockCount;
+}
+
+uint32_t Demodulator::gatedBlocks()
+{
+    return gatedCount;
+}
+
+void Demodulator::demodulate(int16_t sample)
+{
     // Clock recovery reset MUST come before sampling
     if((sampleIndex == 0) && resetClockRec) {
         clockRec.reset();
@@ -239,7 +344,6 @@ void Demodulator::sample(int16_t rawSample, bool invertPhase)
 
     clockRec.sample(sample);
     correlator.sample(sample);
-    corrThreshold = sampleFilter(std::abs(sample));
 
     switch(demodState)
     {
@@ -253,7 +357,12 @@ void Demodulator::sample(int16_t rawSample, bool invertPhase)
             break;
 
         case DemodState::UNLOCKED:
-            unlockedState();
+        {
+            // Correlator and clock recovery keep running to have a full
+            // history when the gate opens, only the syncword search stops.
+            if(idleGateClosed() == false)
+                unlockedState();
+        }
             break;
 
         case DemodState::SYNCED:
@@ -285,8 +394,7 @@ bool Demodulator::update(const bool invertPhase)
         return false;
 
     // Process samples
-    for(size_t i = 0; i < baseband.len; i++)
-        sample(baseband.data[i], invertPhase);
+    processBlock(baseband.data, baseband.len, invertPhase);
 
     return newFrame;
 }
@@ -314,6 +422,19 @@ void Demodulator::quantize(stream_sample_t sample)
     }
 
     setSymbol(*demodFrame, frameIndex, symbol);
+
+    // Soft decision: sample level in symbol units, interpolated linearly
+    // between the symbol decision points. The first bit of a symbol encodes
+    // its sign, the second one whether it is an outer symbol.
+    int32_t deviation = (sample >= 0) ? outerDeviation.first
+                                      : -outerDeviation.second;
+    if(deviation <= 0)
+        deviation = 1;
+
+    float level = (3.0f * sample) / deviation;
+    (*demodSoftFrame)[2 * frameIndex]     = softBit((1.0f - level) / 2.0f);
+    (*demodSoftFrame)[2 * frameIndex + 1] = softBit((std::abs(level) - 1.0f) / 2.0f);
+
     frameIndex += 1;
 }
 
@@ -322,36 +443,42 @@ void Demodulator::reset()
     sampleIndex = 0;
     frameIndex  = 0;
     sampleCount = 0;
+    blockCount  = 0;
+    gatedCount  = 0;
     newFrame    = false;
     demodState  = DemodState::INIT;
     initCount   = RX_SAMPLE_RATE / 50;  // 50ms of init time
 
     dsp_resetState(dcBlock);
+    rrc.reset();
 }
 
 void Demodulator::unlockedState()
 {
     // Three synchronizers are checked per sample (LSF, stream, packet).
-    // Each convolve() is O(SYNCW_SIZE) = 8 MACs; the total overhead is ~50
-    // cycles per sample on the slowest supported target.
+    // The correlations are computed with a single pass over the correlator
+    // memory: since the stream syncword is the negation of the LSF one, only
+    // two convolutions of SYNCWORD_SYMBOLS MACs each are needed.
     int32_t syncThresh = static_cast< int32_t >(corrThreshold * 33.0f);
+    auto    corr       = correlator.convolve(syncwords);
+    size_t  index      = correlator.sampleIndex();
 
     // Try LSF sync first
-    int8_t syncStatus = lsfSync.update(correlator, syncThresh, -syncThresh);
+    int8_t syncStatus = lsfSync.update(corr[0], index, syncThresh, -syncThresh);
     if(syncStatus != 0) {
         demodState = DemodState::SYNCED;
         return;
     }
 
     // If no LSF, try stream sync
-    syncStatus = streamSync.update(correlator, syncThresh, -syncThresh);
+    syncStatus = streamSync.update(-corr[0], index, syncThresh, -syncThresh);
     if(syncStatus != 0) {
         demodState = DemodState::SYNCED;
         return;
     }
 
     // If no stream, try packet sync
-    syncStatus = packetSync.update(correlator, syncThresh, -syncThresh);
+    syncStatus = packetSync.update(corr[1], index, syncThresh, -syncThresh);
     if(syncStatus != 0)
         demodState = DemodState::SYNCED;
 }
@@ -411,6 +538,7 @@ void Demodulator::lockedState(int16_t sample)
     if(frameIndex == FRAME_SYMBOLS) {
         devEstimator.update();
         std::swap(readyFrame, demodFrame);
+        std::swap(readySoftFrame, demodSoftFrame);
 
         frameIndex = 0;
         newFrame = true;
@@ -441,3 +569,4 @@ void Demodulator::syncUpdateState()
 
 constexpr std::array < float, 3 > Demodulator::sfNum;
 constexpr std::array < float, 3 > Demodulator::sfDen;
+constexpr std::array < std::array < int8_t, SYNCWORD_SYMBOLS >, 2 > Demodulator::syncwords;
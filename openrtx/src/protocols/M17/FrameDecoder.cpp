@@ -5,16 +5,53 @@
  */
 
 #include "protocols/M17/Golay.hpp"
+#include "protocols/M17/ConvolutionalEncoder.hpp"
 #include "protocols/M17/FrameDecoder.hpp"
-#include "protocols/M17/Interleaver.hpp"
-#include "protocols/M17/Decorrelator.hpp"
-#include "protocols/M17/CodePuncturing.hpp"
+#include "protocols/M17/FrameMapping.hpp"
 #include "protocols/M17/Constants.hpp"
 #include "protocols/M17/Utils.hpp"
 #include <algorithm>
 
 using namespace M17;
 
+/**
+ * Count the bit errors corrected by a soft decision Viterbi decoding. The
+ * decoded data is encoded again and compared with the hard decision version
+ * of the received bits, giving a figure comparable with the one returned by
+ * the hard decision decoder.
+ *
+ * @param frame: received soft decision frame.
+ * @param decoded: data decoded from the received bits.
+ * @param symbolMap: receive bit map used for the decoding.
+ * @return number of received bits differing from the re-encoded ones.
+ */
+template <size_t OUT, size_t S>
+static uint16_t countBitErrors(const soft_frame_t &frame,
+                               const std::array<uint8_t, OUT> &decoded,
+                               const std::array<uint16_t, S> &symbolMap)
+{
+    static_assert(S <= ((2 * OUT) + 1) * 8, "Bit map exceeds encoded data");
+
+    std::array<uint8_t, (2 * OUT) + 1> encoded;
+    ConvolutionalEncoder encoder;
+
+    encoder.reset();
+    encoder.encode(decoded.data(), encoded.data(), decoded.size());
+    encoded[2 * OUT] = encoder.flush();
+
+    uint16_t errors = 0;
+    for (size_t i = 0; i < S; i++) {
+        if (symbolMap[i] == MAP_PUNCTURED)
+            continue;
+
+        bool received = getMappedBit(frame, symbolMap[i]) > 0x7FFF;
+        if (getBit(encoded, i) != received)
+            errors += 1;
+    }
+
+    return errors;
+}
+
 FrameDecoder::FrameDecoder()
 {
 }
@@ -35,28 +72,56 @@ void FrameDecoder::reset()
 FrameType FrameDecoder::decodeFrame(const frame_t &frame)
 {
     std::array<uint8_t, 2> syncWord;
-    std::array<uint8_t, 46> data;
-
     std::copy_n(frame.begin(), 2, syncWord.begin());
-    std::copy(frame.begin() + 2, frame.end(), data.begin());
 
-    // Re-correlating data is the same operation as decorrelating
-    decorrelate(data);
-    deinterleave(data);
+    // Decorrelation, deinterleaving and depuncturing of frame data are done
+    // on the fly by the decoding functions
+    auto type = getFrameType(syncWord);
+
+    switch (type) {
+        case FrameType::LINK_SETUP:
+            decodeLSF(frame);
+            break;
+
+        case FrameType::STREAM:
+            decodeStream(frame);
+            break;
+
+        case FrameType::PACKET:
+            decodePacket(frame);
+            break;
+
+        case FrameType::EOT:
+            break; // EOT conveys termination only; no payload to decode.
+
+        default:
+            break;
+    }
+
+    return type;
+}
+
+FrameType FrameDecoder::decodeFrame(const soft_frame_t &frame)
+{
+    std::array<uint8_t, 2> syncWord;
+
+    // Sync word is compared using hard bits
+    for (size_t i = 0; i < 16; i++)
+        setBit(syncWord, i, frame[i] > 0x7FFF);
 
     auto type = getFrameType(syncWord);
 
     switch (type) {
         case FrameType::LINK_SETUP:
-            decodeLSF(data);
+            decodeLSF(frame);
             break;
 
         case FrameType::STREAM:
-            decodeStream(data);
+            decodeStream(frame);
             break;
 
         case FrameType::PACKET:
-            decodePacket(data);
+            decodePacket(frame);
             break;
 
         case FrameType::EOT:
@@ -121,46 +186,108 @@ FrameType FrameDecoder::getFrameType(const std::array<uint8_t, 2> &syncWord)
     return type;
 }
 
-void FrameDecoder::decodeLSF(const std::array<uint8_t, 46> &data)
+void FrameDecoder::decodeLSF(const frame_t &frame)
 {
     std::array<uint8_t, sizeof(LinkSetupFrame)> tmp;
 
-    viterbi.decodePunctured(data, tmp, LSF_PUNCTURE);
+    viterbi.decodeMapped(frame, tmp, LSF_RX_MAP);
     memcpy(&lsf.data, tmp.data(), tmp.size());
 }
 
-void FrameDecoder::decodePacket(const std::array<uint8_t, 46> &data)
+void FrameDecoder::decodeLSF(const soft_frame_t &frame)
+{
+    std::array<uint8_t, sizeof(LinkSetupFrame)> tmp;
+
+    softViterbi.decodeMapped(frame, tmp, LSF_RX_MAP);
+    memcpy(&lsf.data, tmp.data(), tmp.size());
+}
+
+void FrameDecoder::decodePacket(const frame_t &frame)
 {
     packetFrame.clear();
 
     // Extract and decode packet data
     std::array<uint8_t, PacketFrame::FRAME_SIZE> tmp;
 
-    uint16_t bitErrs = viterbi.decodePunctured(data, tmp, PACKET_PUNCTURE);
+    uint16_t bitErrs = viterbi.decodeMapped(frame, tmp, PACKET_RX_MAP);
+    alignPacketData(tmp);
+
+    if (bitErrs < MAX_VITERBI_ERRORS)
+        memcpy(&packetFrame.frameData, tmp.data(), tmp.size());
+}
 
+void FrameDecoder::decodePacket(const soft_frame_t &frame)
+{
+    packetFrame.clear();
+
+    // Extract and decode packet data
+    std::array<uint8_t, PacketFrame::FRAME_SIZE> tmp;
+
+    softViterbi.decodeMapped(frame, tmp, PACKET_RX_MAP);
+    alignPacketData(tmp);
+
+    uint16_t bitErrs = countBitErrors(frame, tmp, PACKET_RX_MAP);
+    if (bitErrs < MAX_VITERBI_ERRORS)
+        memcpy(&packetFrame.frameData, tmp.data(), tmp.size());
+}
+
+void FrameDecoder::alignPacketData(
+    std::array<uint8_t, PacketFrame::FRAME_SIZE> &data)
+{
     // Viterbi decoding of P3-punctured packets produces a 2-bit right shift:
     // encoding 26 bytes (208 bits) with flush gives 210 Viterbi steps → 420
     // coded bits, punctured by P3 to 368 bits (46 bytes). The 210-step decode
     // outputs 208 bits, leaving a 2-bit offset. Realign left 2 bits; the last
     // byte's low 2 bits become zero (spec reserved bits).
-    for (size_t i = 0; i < tmp.size(); ++i) {
-        uint8_t currentByte = tmp[i];
-        uint8_t nextByte = (i < tmp.size() - 1) ? tmp[i + 1] : 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        uint8_t currentByte = data[i];
+        uint8_t nextByte = (i < data.size() - 1) ? data[i + 1] : 0;
 
-        tmp[i] = (currentByte << 2) | (nextByte >> 6);
+        data[i] = (currentByte << 2) | (nextByte >> 6);
     }
+}
+
+void FrameDecoder::decodeStream(const frame_t &frame)
+{
+    // Extract and unpack the LICH segment contained at beginning of frame
+    lich_t lich;
+    for (size_t i = 0; i < LICH_RX_MAP.size(); i++)
+        setBit(lich, i, getMappedBit(frame, LICH_RX_MAP[i]));
+
+    appendLich(lich);
 
+    // Extract and decode stream data
+    std::array<uint8_t, sizeof(StreamFrame)> tmp;
+
+    // Skip payload copy if BER is too high to avoid audio artifacts
+    uint16_t bitErrs = viterbi.decodeMapped(frame, tmp, STREAM_RX_MAP);
     if (bitErrs < MAX_VITERBI_ERRORS)
-        memcpy(&packetFrame.frameData, tmp.data(), tmp.size());
+        memcpy(&streamFrame.frameData, tmp.data(), tmp.size());
 }
 
-void FrameDecoder::decodeStream(const std::array<uint8_t, 46> &data)
+void FrameDecoder::decodeStream(const soft_frame_t &frame)
 {
-    // Extract and unpack the LICH segment contained at beginning of frame
+    // Extract the LICH segment contained at beginning of frame, slicing it to
+    // hard bits for the Golay decoder
     lich_t lich;
-    std::array<uint8_t, 6> lsfSegment;
+    for (size_t i = 0; i < LICH_RX_MAP.size(); i++)
+        setBit(lich, i, getMappedBit(frame, LICH_RX_MAP[i]) > 0x7FFF);
+
+    appendLich(lich);
+
+    // Extract and decode stream data
+    std::array<uint8_t, sizeof(StreamFrame)> tmp;
+
+    // Skip payload copy if BER is too high to avoid audio artifacts
+    softViterbi.decodeMapped(frame, tmp, STREAM_RX_MAP);
+    uint16_t bitErrs = countBitErrors(frame, tmp, STREAM_RX_MAP);
+    if (bitErrs < MAX_VITERBI_ERRORS)
+        memcpy(&streamFrame.frameData, tmp.data(), tmp.size());
+}
 
-    std::copy_n(data.begin(), lich.size(), lich.begin());
+void FrameDecoder::appendLich(const lich_t &lich)
+{
+    std::array<uint8_t, 6> lsfSegment;
     bool decodeOk = decodeLich(lsfSegment, lich);
 
     if (decodeOk) {
@@ -182,19 +309,6 @@ void FrameDecoder::decodeStream(const std::array<uint8_t, 46> &data)
             lsfFromLich.clear();
         }
     }
-
-    // Extract and decode stream data
-    std::array<uint8_t, 34> punctured;
-    std::array<uint8_t, sizeof(StreamFrame)> tmp;
-
-    auto begin = data.begin();
-    begin += lich.size();
-    std::copy(begin, data.end(), punctured.begin());
-
-    // Skip payload copy if BER is too high to avoid audio artifacts
-    uint16_t bitErrs = viterbi.decodePunctured(punctured, tmp, DATA_PUNCTURE);
-    if (bitErrs < MAX_VITERBI_ERRORS)
-        memcpy(&streamFrame.frameData, tmp.data(), tmp.size());
 }
 
 bool FrameDecoder::decodeLich(std::array<uint8_t, 6> &segment,
@@ -4,9 +4,7 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
-#include "protocols/M17/CodePuncturing.hpp"
-#include "protocols/M17/Decorrelator.hpp"
-#include "protocols/M17/Interleaver.hpp"
+#include "protocols/M17/FrameMapping.hpp"
 #include "protocols/M17/FrameEncoder.hpp"
 #include "protocols/M17/Constants.hpp"
 
@@ -38,21 +36,16 @@ void FrameEncoder::encodeLsf(LinkSetupFrame& lsf, frame_t& output)
     lsf.updateCrc();
     currLsf = lsf;
 
-    // Encode the LSF, then puncture and decorrelate its data
+    // Encode the LSF
     std::array<uint8_t, 61> encoded;
     encoder.reset();
     encoder.encode(lsf.getData(), encoded.data(), sizeof(LinkSetupFrame));
     encoded[60] = encoder.flush();
 
-    std::array<uint8_t, 46> punctured;
-    puncture(encoded, punctured, LSF_PUNCTURE);
-    interleave(punctured);
-    decorrelate(punctured);
-
-    // Copy data to output buffer, prepended with sync word.
-    auto it = std::copy(LSF_SYNC_WORD.begin(), LSF_SYNC_WORD.end(),
-                        output.begin());
-    std::copy(punctured.begin(), punctured.end(), it);
+    // Puncture, interleave and decorrelate the encoded data into the output
+    // buffer, prepended with sync word.
+    std::copy(LSF_SYNC_WORD.begin(), LSF_SYNC_WORD.end(), output.begin());
+    mapFrame(encoded, LSF_TX_MAP, output);
 }
 
 uint16_t FrameEncoder::encodeStreamFrame(const payload_t& payload,
@@ -65,15 +58,6 @@ uint16_t FrameEncoder::encodeStreamFrame(const payload_t& payload,
     if(isLast) streamFrame.lastFrame();
     memcpy(streamFrame.data(), payload.data(), payload.size());
 
-    // Encode frame
-    std::array<uint8_t, 37> encoded;
-    encoder.reset();
-    encoder.encode(&streamFrame.frameData, encoded.data(), sizeof(StreamFrame));
-    encoded[36] = encoder.flush();
-
-    std::array<uint8_t, 34> punctured;
-    puncture(encoded, punctured, DATA_PUNCTURE);
-
     // Generate LICH segment
     lich_t lich;
     currLsf.generateLichSegment(lich, currentLich);
@@ -83,18 +67,19 @@ uint16_t FrameEncoder::encodeStreamFrame(const payload_t& payload,
         updateLsf = false;
     }
 
-    // Add LICH segment to coded data
-    std::array<uint8_t, 46> frame;
-    auto it = std::copy(lich.begin(), lich.end(), frame.begin());
-    std::copy(punctured.begin(), punctured.end(), it);
-
-    interleave(frame);
-    decorrelate(frame);
+    // Encode frame, placing coded data right after the LICH segment
+    std::array<uint8_t, 12 + 37> encoded;
+    std::copy(lich.begin(), lich.end(), encoded.begin());
+    encoder.reset();
+    encoder.encode(&streamFrame.frameData, encoded.data() + lich.size(),
+                   sizeof(StreamFrame));
+    encoded[48] = encoder.flush();
 
-    // Copy data to output buffer, prepended with sync word.
-    auto oIt = std::copy(STREAM_SYNC_WORD.begin(), STREAM_SYNC_WORD.end(),
-                         output.begin());
-    std::copy(frame.begin(), frame.end(), oIt);
+    // Puncture, interleave and decorrelate the frame data into the output
+    // buffer, prepended with sync word.
+    std::copy(STREAM_SYNC_WORD.begin(), STREAM_SYNC_WORD.end(),
+              output.begin());
+    mapFrame(encoded, STREAM_TX_MAP, output);
 
     return streamFrame.getFrameNumber();
 }
@@ -119,14 +104,9 @@ void FrameEncoder::encodePacketFrame(const PacketFrame& frame,
     encoder.encode(&frame.frameData, encoded.data(), PacketFrame::FRAME_SIZE);
     encoded[ENC_SIZE - 1] = encoder.flush();
 
-    std::array<uint8_t, 46> punctured;
-    puncture(encoded, punctured, PACKET_PUNCTURE);
-
-    interleave(punctured);
-    decorrelate(punctured);
-
-    // Copy data to output buffer, prepended with sync word.
-    auto oIt = std::copy(PACKET_SYNC_WORD.begin(), PACKET_SYNC_WORD.end(),
-                         output.begin());
-    std::copy(punctured.begin(), punctured.end(), oIt);
+    // Puncture, interleave and decorrelate the encoded data into the output
+    // buffer, prepended with sync word.
+    std::copy(PACKET_SYNC_WORD.begin(), PACKET_SYNC_WORD.end(),
+              output.begin());
+    mapFrame(encoded, PACKET_TX_MAP, output);
 }
@@ -5,6 +5,9 @@
  */
 
 #include "protocols/M17/Golay.hpp"
+#include <cstddef>
+#include <array>
+#include <utility>
 
 using namespace M17;
 
@@ -28,76 +31,183 @@ static constexpr uint16_t decode_matrix[12] =
 };
 
 
-uint16_t Golay24::calcChecksum(const uint16_t& value)
+/**
+ * Multiply a 12-bit value by one of the coding matrices.
+ *
+ * @param value: input value.
+ * @param matrix: coding matrix.
+ * @return product between the value and the matrix.
+ */
+static constexpr uint16_t matrixProduct(const uint16_t value,
+                                        const uint16_t (&matrix)[12])
 {
-    uint16_t checksum = 0;
+    uint16_t result = 0;
 
     for(uint8_t i = 0; i < 12; i++)
     {
         if(value & (1 << i))
-        {
-            checksum ^= encode_matrix[i];
-        }
+            result ^= matrix[i];
     }
 
-    return checksum;
+    return result;
 }
 
 
 /**
- * Detect and correct errors in a Golay(24,12) codeword.
+ * Compute the error pattern corresponding to a given syndrome, searching for
+ * the error patterns with up to three bit errors.
  *
- * @param codeword: input codeword.
+ * @param syndrome: codeword syndrome.
  * @return bitmask corresponding to detected bit errors in the codeword, or
  * 0xFFFFFFFF if bit errors are unrecoverable.
  */
-uint32_t Golay24::detectErrors(const uint32_t& codeword)
+static constexpr uint32_t errorPattern(const uint16_t syndrome)
 {
-    uint16_t data   = codeword >> 12;
-    uint16_t parity = codeword & 0xFFF;
-
-    uint16_t syndrome = parity ^ calcChecksum(data);
-
     if(__builtin_popcount(syndrome) <= 3)
-    {
         return syndrome;
-    }
 
-    for(uint8_t i = 0; i<12; i++)
+    for(uint8_t i = 0; i < 12; i++)
     {
-        uint16_t e = 1 << i;
+        uint32_t e = 1 << i;
         uint16_t coded_error = encode_matrix[i];
 
-        if(__builtin_popcount(syndrome^coded_error) <= 2)
-        {
+        if(__builtin_popcount(syndrome ^ coded_error) <= 2)
             return (e << 12) | (syndrome ^ coded_error);
-        }
     }
 
+    uint16_t inv_syndrome = matrixProduct(syndrome, decode_matrix);
+
+    if(__builtin_popcount(inv_syndrome) <= 3)
+        return static_cast< uint32_t >(inv_syndrome) << 12;
 
-    uint16_t inv_syndrome = 0;
     for(uint8_t i = 0; i < 12; i++)
     {
-        if(syndrome & (1 << i))
+        uint32_t e = 1 << i;
+        uint16_t coding_error = decode_matrix[i];
+
+        if(__builtin_popcount(inv_syndrome ^ coding_error) <= 2)
         {
-            inv_syndrome ^= decode_matrix[i];
+            uint32_t data_error = inv_syndrome ^ coding_error;
+            return (data_error << 12) | e;
         }
     }
 
-    if(__builtin_popcount(inv_syndrome) <= 3)
-    {
-        return inv_syndrome << 12;
-    }
+    return 0xFFFFFFFF;
+}
+
+
+/*
+ * Checksum lookup tables: being the code linear, the checksum of a 12-bit
+ * value is the XOR of the checksums of its lower and upper six bits.
+ */
+template < size_t... I >
+static constexpr std::array< uint16_t, 64 >
+checksumTable(const uint8_t shift, std::index_sequence< I... >)
+{
+    return {{ matrixProduct(I << shift, encode_matrix)... }};
+}
+
+static constexpr auto checksumLo = checksumTable(0, std::make_index_sequence< 64 >{});
+static constexpr auto checksumHi = checksumTable(6, std::make_index_sequence< 64 >{});
+
+
+#ifndef CONFIG_GOLAY_COMPACT_TABLE
+
+/*
+ * Syndrome lookup table, mapping each one of the 4096 possible syndromes to
+ * the corresponding error pattern.
+ */
+template < size_t... I >
+static constexpr std::array< uint32_t, 4096 >
+syndromeTable(std::index_sequence< I... >)
+{
+    return {{ errorPattern(I)... }};
+}
+
+static constexpr auto errorTable = syndromeTable(std::make_index_sequence< 4096 >{});
+
+static inline uint32_t lookupErrors(const uint16_t syndrome)
+{
+    return errorTable[syndrome];
+}
+
+#else
 
-    for(uint8_t i = 0; i < 12; i++ )
+/*
+ * Compact syndrome lookup table, for targets with limited flash memory. Each
+ * entry stores the positions of the (up to three) bit errors in 5-bit fields,
+ * unused fields are set to 0x1F and unrecoverable errors are marked by 0xFFFF.
+ * The table takes 8kB instead of 16kB.
+ */
+static constexpr uint16_t packPattern(const uint32_t pattern)
+{
+    if(pattern == 0xFFFFFFFF)
+        return 0xFFFF;
+
+    uint16_t packed = 0x7FFF;
+    uint8_t  field  = 0;
+
+    for(uint8_t i = 0; i < 24; i++)
     {
-        uint16_t e = 1 << i;
-        uint16_t coding_error = decode_matrix[i];
-        if(__builtin_popcount(inv_syndrome ^ coding_error) <= 2 )
+        if(pattern & (1 << i))
         {
-            return ((inv_syndrome ^ coding_error) << 12) | e;
+            packed &= ~(0x1F << (5 * field));
+            packed |= i << (5 * field);
+            field  += 1;
         }
     }
 
-    return 0xFFFFFFFF;
+    return packed;
+}
+
+template < size_t... I >
+static constexpr std::array< uint16_t, 4096 >
+syndromeTable(std::index_sequence< I... >)
+{
+    return {{ packPattern(errorPattern(I))... }};
+}
+
+static constexpr auto errorTable = syndromeTable(std::make_index_sequence< 4096 >{});
+
+static inline uint32_t lookupErrors(const uint16_t syndrome)
+{
+    uint16_t packed = errorTable[syndrome];
+    if(packed == 0xFFFF)
+        return 0xFFFFFFFF;
+
+    uint32_t errors = 0;
+    for(uint8_t i = 0; i < 3; i++)
+    {
+        uint8_t pos = (packed >> (5 * i)) & 0x1F;
+        if(pos < 24)
+            errors |= 1 << pos;
+    }
+
+    return errors;
+}
+
+#endif
+
+
+uint16_t Golay24::calcChecksum(const uint16_t& value)
+{
+    return checksumLo[value & 0x3F] ^ checksumHi[(value >> 6) & 0x3F];
+}
+
+
+/**
+ * Detect and correct errors in a Golay(24,12) codeword.
+ *
+ * @param codeword: input codeword.
+ * @return bitmask corresponding to detected bit errors in the codeword, or
+ * 0xFFFFFFFF if bit errors are unrecoverable.
+ */
+uint32_t Golay24::detectErrors(const uint32_t& codeword)
+{
+    uint16_t data   = codeword >> 12;
+    uint16_t parity = codeword & 0xFFF;
+
+    uint16_t syndrome = parity ^ calcChecksum(data);
+
+    return lookupErrors(syndrome);
 }
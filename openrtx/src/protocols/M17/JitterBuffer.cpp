@@ -0,0 +1,280 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+#include "protocols/M17/JitterBuffer.hpp"
+
+using namespace M17;
+
+JitterBuffer::JitterBuffer()
+{
+    reset();
+    resetStats();
+}
+
+JitterBuffer::~JitterBuffer()
+{
+}
+
+void JitterBuffer::reset()
+{
+    for (auto &slot : slots)
+        slot.valid = false;
+
+    playNum = 0;
+    newest = 0;
+    lastNum = 0;
+    lastArrival = 0;
+    jitterQ4 = 0;
+    target = MIN_DEPTH;
+    excess = 0;
+    lossRun = 0;
+    stalled = 0;
+    haveBase = false;
+    haveLast = false;
+    started = false;
+}
+
+void JitterBuffer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+    stats.latencyMin = UINT16_MAX;
+    latencySum = 0;
+}
+
+bool JitterBuffer::push(const uint16_t frameNum, const uint8_t *payload,
+                        const uint32_t now)
+{
+    uint16_t num = frameNum & FN_MASK;
+
+    if (haveBase) {
+        int16_t ahead = distance(num, playNum);
+
+        // A frame far away from the playout position belongs to a new
+        // stream: start over from it.
+        if ((ahead >= SLOTS) || (ahead < -SLOTS)) {
+            reset();
+        } else if ((ahead < 0) && started) {
+            stats.late += 1;
+            return false;
+        } else if (ahead < 0) {
+            playNum = num;
+        }
+    }
+
+    if (haveBase == false) {
+        playNum = num;
+        newest = num;
+        lastNum = num;
+        lastArrival = now;
+        haveBase = true;
+    }
+
+    if (available(num)) {
+        stats.duplicates += 1;
+        return false;
+    }
+
+    Slot &slot = slots[num % SLOTS];
+
+    memcpy(slot.payload, payload, sizeof(slot.payload));
+    slot.arrival = now;
+    slot.frameNum = num;
+    slot.valid = true;
+    stats.received += 1;
+
+    if (distance(num, newest) > 0)
+        newest = num;
+
+    updateJitter(num, now);
+
+    return true;
+}
+
+bool JitterBuffer::pop(uint8_t *payload, const uint32_t now,
+                       const uint32_t outDelay)
+{
+    if (haveBase == false)
+        return false;
+
+    uint8_t depth = level();
+    if (started == false) {
+        if (depth < target)
+            return false;
+
+        started = true;
+    }
+
+    // Persistently above target: skip a frame to cut down the latency
+    if (depth > target + 1) {
+        excess += 1;
+        if (excess >= SHRINK_DELAY) {
+            if (available(playNum)) {
+                slots[playNum % SLOTS].valid = false;
+                stats.dropped += 1;
+            }
+
+            playNum = (playNum + 1) & FN_MASK;
+            depth -= 1;
+            excess = 0;
+        }
+    } else {
+        excess = 0;
+    }
+
+    // The frames concealed while the buffer was empty took the place of the
+    // ones still missing.
+    while ((stalled > 0) && (depth > 0) && (available(playNum) == false)) {
+        playNum = (playNum + 1) & FN_MASK;
+        depth -= 1;
+        stalled -= 1;
+    }
+
+    Slot &slot = slots[playNum % SLOTS];
+    if (available(playNum)) {
+        memcpy(payload, slot.payload, sizeof(slot.payload));
+        memcpy(last, slot.payload, sizeof(last));
+        slot.valid = false;
+        haveLast = true;
+        lossRun = 0;
+        stalled = 0;
+        playNum = (playNum + 1) & FN_MASK;
+
+        uint32_t latency = FRAME_TIME + (now - slot.arrival) + outDelay;
+        if (latency > UINT16_MAX)
+            latency = UINT16_MAX;
+
+        latencySum += latency;
+        stats.played += 1;
+        if (latency < stats.latencyMin)
+            stats.latencyMin = latency;
+        if (latency > stats.latencyMax)
+            stats.latencyMax = latency;
+
+        return true;
+    }
+
+    conceal(payload);
+    stats.concealed += 1;
+
+    // With newer frames in the buffer this one is lost, otherwise it is late:
+    // if it shows up, waiting for it increases the buffer depth.
+    if (depth > 0) {
+        playNum = (playNum + 1) & FN_MASK;
+    } else {
+        stats.underruns += 1;
+        if (stalled < SLOTS)
+            stalled += 1;
+    }
+
+    return true;
+}
+
+uint8_t JitterBuffer::level() const
+{
+    if (haveBase == false)
+        return 0;
+
+    int16_t depth = distance(newest, playNum) + 1;
+    if (depth < 0)
+        return 0;
+
+    return depth;
+}
+
+void JitterBuffer::getStats(JitterStats &out) const
+{
+    out = stats;
+    out.jitter = jitterQ4 / 16;
+    out.target = target;
+    out.level = level();
+
+    if (out.played == 0)
+        out.latencyMin = 0;
+    else
+        out.latencyAvg = latencySum / out.played;
+}
+
+bool JitterBuffer::available(const uint16_t frameNum) const
+{
+    const Slot &slot = slots[frameNum % SLOTS];
+
+    return slot.valid && (slot.frameNum == frameNum);
+}
+
+int16_t JitterBuffer::distance(const uint16_t a, const uint16_t b)
+{
+    int16_t diff = (a - b) & FN_MASK;
+    if (diff > (FN_MASK / 2))
+        diff -= (FN_MASK + 1);
+
+    return diff;
+}
+
+void JitterBuffer::updateJitter(const uint16_t frameNum, const uint32_t now)
+{
+    // Only frames received in sequence contribute to the estimate
+    int16_t frames = distance(frameNum, lastNum);
+    if (frames <= 0)
+        return;
+
+    // Variation of the transit time with respect to the previous frame
+    int32_t elapsed = now - lastArrival;
+    int32_t delta = elapsed - (frames * static_cast<int32_t>(FRAME_TIME));
+    if (delta < 0)
+        delta = -delta;
+
+    lastNum = frameNum;
+    lastArrival = now;
+
+    // J += (|D| - J) / 16, with J stored in 1/16 ms units and rounded so
+    // that it decays to zero.
+    jitterQ4 += delta - ((jitterQ4 + 15) / 16);
+
+    // Keep four times the jitter in the buffer
+    uint32_t depth = MIN_DEPTH + ((jitterQ4 * 4) + (16 * FRAME_TIME) - 1)
+                                 / (16 * FRAME_TIME);
+    if (depth > MAX_DEPTH)
+        depth = MAX_DEPTH;
+
+    target = depth;
+}
+
+void JitterBuffer::conceal(uint8_t *payload)
+{
+    // Nothing played yet, fall back to an all-zero payload
+    if (haveLast == false) {
+        memset(payload, 0x00, 16);
+        return;
+    }
+
+    // Both halves are replaced with the most recent codec2 frame. In codec2
+    // 3200 bit/s frames, the energy index is a 5 bit Gray coded field starting
+    // at bit 9.
+    for (size_t i = 0; i < 2; i++) {
+        uint8_t *frame = payload + (8 * i);
+        memcpy(frame, &last[8], 8);
+
+        if (lossRun >= REPEAT_FRAMES) {
+            uint32_t steps = (lossRun - REPEAT_FRAMES + 1) * FADE_STEP;
+            uint8_t energy = (frame[1] >> 2) & 0x1F;
+            energy ^= energy >> 1;
+            energy ^= energy >> 2;
+            energy ^= energy >> 4;
+            energy = (energy > steps) ? (energy - steps) : 0;
+            energy ^= energy >> 1;
+            frame[1] = (frame[1] & 0x83) | (energy << 2);
+        }
+
+        if (lossRun < UINT8_MAX)
+            lossRun += 1;
+    }
+}
+
+constexpr uint32_t JitterBuffer::FRAME_TIME;
+constexpr uint8_t JitterBuffer::SLOTS;
+constexpr uint8_t JitterBuffer::MIN_DEPTH;
+constexpr uint8_t JitterBuffer::MAX_DEPTH;
@@ -11,14 +11,11 @@
 #include "protocols/M17/Utils.hpp"
 #include "protocols/M17/DSP.hpp"
 
-#if defined(PLATFORM_LINUX)
-#include <stdio.h>
-#endif
-
 using namespace M17;
 
 
-Modulator::Modulator()
+Modulator::Modulator() : rrc(rrc_taps_48k), idleBuffer(nullptr), outStream(-1),
+                         outPath(-1), txRunning(false), invPhase(false)
 {
 
 }
@@ -38,6 +35,7 @@ void Modulator::init()
     baseband_buffer = std::make_unique< int16_t[] >(2 * FRAME_SAMPLES);
     idleBuffer      = baseband_buffer.get();
     txRunning       = false;
+    rrc.reset();
     #if defined(PLATFORM_MD3x0) || defined(PLATFORM_MDUV3x0)
     pwmComp.reset();
     #endif
@@ -64,7 +62,6 @@ bool Modulator::start()
     if(txRunning)
         return true;
 
-    #ifndef PLATFORM_LINUX
     outPath = audioPath_request(SOURCE_MCU, SINK_RTX, PRIO_TX);
     if(outPath < 0)
         return false;
@@ -77,7 +74,6 @@ bool Modulator::start()
         return false;
 
     idleBuffer = outputStream_getIdleBuffer(outStream);
-    #endif
 
     txRunning = true;
 
@@ -86,33 +82,19 @@ bool Modulator::start()
 
 void Modulator::sendPreamble()
 {
-    // Fill symbol buffer with preamble, made of alternated +3 and -3 symbols
-    for(size_t i = 0; i < symbols.size(); i += 2)
-    {
-        symbols[i]     = +3;
-        symbols[i + 1] = -3;
-    }
-
     // Generate baseband signal and then start transmission
-    symbolsToBaseband();
+    preambleToBaseband(idleBuffer);
     sendBaseband();
 
     // Repeat baseband generation and transmission, this makes the preamble to
     // be long 80ms (two frames)
-    symbolsToBaseband();
+    preambleToBaseband(idleBuffer);
     sendBaseband();
 }
 
 void Modulator::sendFrame(const frame_t& frame)
 {
-    auto it = symbols.begin();
-    for(size_t i = 0; i < frame.size(); i++)
-    {
-        auto sym = byteToSymbols(frame[i]);
-        it       = std::copy(sym.begin(), sym.end(), it);
-    }
-
-    symbolsToBaseband();
+    frameToBaseband(frame, idleBuffer);
     sendBaseband();
 }
 
@@ -125,6 +107,7 @@ void Modulator::stop()
     txRunning  = false;
     idleBuffer = baseband_buffer.get();
     audioPath_release(outPath);
+    rrc.reset();
 
     #if defined(PLATFORM_MD3x0) || defined(PLATFORM_MDUV3x0)
     pwmComp.reset();
@@ -137,28 +120,54 @@ void Modulator::invertPhase(const bool status)
 }
 
 
-void Modulator::symbolsToBaseband()
+void Modulator::preambleToBaseband(stream_sample_t *baseband)
 {
-    memset(idleBuffer, 0x00, FRAME_SAMPLES * sizeof(stream_sample_t));
+    // Fill symbol buffer with preamble, made of alternated +3 and -3 symbols
+    for(size_t i = 0; i < symbols.size(); i += 2)
+    {
+        symbols[i]     = +3;
+        symbols[i + 1] = -3;
+    }
 
-    for(size_t i = 0; i < symbols.size(); i++)
+    symbolsToBaseband(baseband);
+}
+
+void Modulator::frameToBaseband(const frame_t& frame,
+                                stream_sample_t *baseband)
+{
+    auto it = symbols.begin();
+    for(size_t i = 0; i < frame.size(); i++)
     {
-        idleBuffer[i * 10] = symbols[i];
+        auto sym = byteToSymbols(frame[i]);
+        it       = std::copy(sym.begin(), sym.end(), it);
     }
 
-    for(size_t i = 0; i < FRAME_SAMPLES; i++)
+    symbolsToBaseband(baseband);
+}
+
+void Modulator::symbolsToBaseband(stream_sample_t *baseband)
+{
+    // Polyphase RRC interpolation: each symbol directly produces the
+    // SAMPLES_PER_SYMBOL baseband samples of its symbol period.
+    std::array< float, SAMPLES_PER_SYMBOL > phases;
+
+    for(size_t i = 0; i < symbols.size(); i++)
     {
-        float elem    = static_cast< float >(idleBuffer[i]);
-        elem          = M17::rrc_48k(elem * RRC_GAIN) - RRC_OFFSET;
-        #if defined(PLATFORM_MD3x0) || defined(PLATFORM_MDUV3x0)
-        elem          = pwmComp(elem);
-        #endif
-        if(invPhase) elem = 0.0f - elem;    // Invert signal phase
-        idleBuffer[i] = static_cast< int16_t >(elem);
+        stream_sample_t *out = &baseband[i * SAMPLES_PER_SYMBOL];
+        rrc(static_cast< float >(symbols[i]) * RRC_GAIN, phases.data());
+
+        for(size_t j = 0; j < SAMPLES_PER_SYMBOL; j++)
+        {
+            float elem    = phases[j] - RRC_OFFSET;
+            #if defined(PLATFORM_MD3x0) || defined(PLATFORM_MDUV3x0)
+            elem          = pwmComp(elem);
+            #endif
+            if(invPhase) elem = 0.0f - elem;    // Invert signal phase
+            out[j]        = static_cast< int16_t >(elem);
+        }
     }
 }
 
-#ifndef PLATFORM_LINUX
 void Modulator::sendBaseband()
 {
     if(txRunning == false) return;
@@ -168,17 +177,3 @@ void Modulator::sendBaseband()
     outputStream_sync(outStream, true);
     idleBuffer = outputStream_getIdleBuffer(outStream);
 }
-#else
-void Modulator::sendBaseband()
-{
-    FILE *outfile = fopen("/tmp/m17_output.raw", "ab");
-
-    for(size_t i = 0; i < FRAME_SAMPLES; i++)
-    {
-        auto s = idleBuffer[i];
-        fwrite(&s, sizeof(s), 1, outfile);
-    }
-
-    fclose(outfile);
-}
-#endif
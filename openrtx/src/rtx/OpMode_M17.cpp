@@ -44,6 +44,8 @@ void OpMode_M17::enable()
     codec_init();
     modulator.init();
     demodulator.init();
+    jitterBuffer.reset();
+    jitterBuffer.resetStats();
     locked       = false;
     dataValid    = false;
     extendedCall = false;
@@ -185,7 +187,7 @@ void OpMode_M17::rxState(rtxStatus_t *const status)
         // Process new data
         if(newData)
         {
-            auto& frame   = demodulator.getFrame();
+            auto& frame   = demodulator.getSoftFrame();
             auto  type    = decoder.decodeFrame(frame);
             auto  lsf     = decoder.getLsf();
             status->lsfOk = lsf.valid();
@@ -266,11 +268,13 @@ void OpMode_M17::rxState(rtxStatus_t *const status)
                         codec_startDecode(rxAudioPath);
 
                     StreamFrame sf = decoder.getStreamFrame();
-                    codec_pushFrame(sf.data(),     false);
-                    codec_pushFrame(sf.data() + 8, false);
+                    jitterBuffer.push(sf.getFrameNumber(), sf.data(),
+                                      getTick());
                 }
             }
         }
+
+        rxPlayout();
     }
 
     locked = lock;
@@ -293,6 +297,7 @@ void OpMode_M17::rxState(rtxStatus_t *const status)
         status->M17_refl[0] = '\0';
 
         metaText.reset();
+        jitterBuffer.reset();
         codec_stop(rxAudioPath);
         audioPath_release(rxAudioPath);
     }
@@ -394,6 +399,35 @@ void OpMode_M17::txState(rtxStatus_t *const status)
     }
 }
 
+void OpMode_M17::rxPlayout()
+{
+    // Frames are pushed only while the RX audio path is open and owns the
+    // codec: a voice prompt may be playing on its own path.
+    if(audioPath_getStatus(rxAudioPath) != PATH_OPEN)
+        return;
+
+    if(codec_runningOnPath(rxAudioPath) == false)
+        return;
+
+    // The decoder consumes one codec2 frame every 20ms: refill its queue with
+    // a whole stream frame, real or concealed, when it is running low.
+    struct codecStats stats;
+    codec_getStats(&stats);
+
+    while(stats.level <= RX_AUDIO_LOW_WATER)
+    {
+        uint8_t payload[16];
+        uint32_t outDelay = stats.level * 20;
+
+        if(jitterBuffer.pop(payload, getTick(), outDelay) == false)
+            break;
+
+        codec_pushFrame(payload,     false);
+        codec_pushFrame(payload + 8, false);
+        stats.level += 2;
+    }
+}
+
 bool OpMode_M17::compareCallsigns(const std::string& localCs,
                                   const std::string& incomingCs)
 {
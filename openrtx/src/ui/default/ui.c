@@ -282,6 +282,8 @@ static ui_state_t ui_state;
 static bool macro_menu = false;
 static bool layout_ready = false;
 static bool redraw_needed = true;
+static bool full_redraw = true;
+static uint8_t drawn_screen = 0;
 
 static bool standby = false;
 static long long last_event_tick = 0;
@@ -1283,6 +1285,7 @@ void ui_init()
 {
     last_event_tick = getTick();
     redraw_needed = true;
+    full_redraw = true;
     _ui_calculateLayout(&layout);
     layout_ready = true;
     // Initialize struct ui_state to all zeroes
@@ -1396,6 +1399,11 @@ void ui_updateFSM(bool *sync_rtx)
     redraw_needed = true;
     if(standby) redraw_needed = false;
 
+    // Status updates redraw only the widgets whose state changed, any other
+    // event may change what the screen shows.
+    if(event.type != EVENT_STATUS)
+        full_redraw = true;
+
     // Check if battery has enough charge to operate.
     // Check is skipped if there is an ongoing transmission, since the voltage
     // drop caused by the RF PA power absorption causes spurious triggers of
@@ -2644,6 +2652,12 @@ bool ui_updateGUI()
         _ui_calculateLayout(&layout);
         layout_ready = true;
     }
+
+    // Draw the screen from scratch when it changed, after user input or when
+    // the macro menu is drawn over it.
+    if(full_redraw || macro_menu || (last_state.ui_screen != drawn_screen))
+        _ui_invalidateWidgets();
+
     // Draw current GUI page
     switch(last_state.ui_screen)
     {
@@ -2759,6 +2773,8 @@ bool ui_updateGUI()
         _ui_drawMacroMenu(&ui_state);
     }
 
+    drawn_screen  = last_state.ui_screen;
+    full_redraw   = macro_menu;
     redraw_needed = false;
     return true;
 }
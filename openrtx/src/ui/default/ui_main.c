@@ -15,6 +15,13 @@
 #include "core/utils.h"
 #include "ui/utils.h"
 
+// Widgets of the main screens
+static widget_t top_widget;
+static widget_t channel_widget;
+static widget_t mode_widget;
+static widget_t frequency_widget;
+static widget_t bottom_widget;
+
 void _ui_drawMainBackground()
 {
     // Print top bar line of hline_h pixel height
@@ -332,20 +339,154 @@ void _ui_drawMainBottom()
     }
 }
 
-void _ui_drawMainVFO(ui_state_t* ui_state)
+static void _ui_bindMainTop(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    _ui_drawMainTop(ui_state);
-    _ui_drawModeInfo(ui_state);
+#ifdef CONFIG_RTC
+    datetime_t local_time = utcToLocalTime(last_state.time,
+                                           last_state.settings.utc_timezone);
+    int8_t clock[] = { local_time.hour, local_time.minute, local_time.second };
+    _ui_addState(&top_widget, clock, sizeof(clock));
+#endif
+#ifdef CONFIG_BAT_NONE
+    // Input voltage is shown with one decimal digit
+    uint16_t decivolts = last_state.v_bat / 100;
+    _ui_addState(&top_widget, &decivolts, sizeof(decivolts));
+#else
+    uint8_t battery[] = { last_state.settings.showBatteryIcon, last_state.charge };
+    _ui_addState(&top_widget, battery, sizeof(battery));
+#endif
+    _ui_addState(&top_widget, &ui_state->input_locked, sizeof(bool));
+
+    // Clock, battery and lock status are all within the top bar
+    _ui_bindWidget(&top_widget, 0, layout.top_h);
+}
+
+static void _ui_bindBankChannel(bool visible)
+{
+    uint16_t b = (last_state.bank_enabled) ? last_state.bank : 0;
+    _ui_addState(&channel_widget, &b, sizeof(b));
+    _ui_addState(&channel_widget, &last_state.channel_index, sizeof(last_state.channel_index));
+    _ui_addStateString(&channel_widget, last_state.channel.name);
+
+    if(visible)
+        _ui_bindTextWidget(&channel_widget, layout.line1_pos.y, layout.line1_font);
+    else
+        _ui_bindWidget(&channel_widget, 0, 0);
+}
+
+static void _ui_bindModeInfo(ui_state_t* ui_state)
+{
+    const channel_t *channel = &last_state.channel;
+    uint8_t info[] = { channel->mode, channel->bandwidth,
+                       channel->fm.txToneEn, channel->fm.rxToneEn,
+                       channel->fm.txTone };
+    _ui_addState(&mode_widget, info, sizeof(info));
 
     #ifdef CONFIG_M17
-    // Show VFO frequency if the OpMode is not M17 or there is no valid LSF data
+    if(channel->mode == OPMODE_M17)
+    {
+        rtxStatus_t rtxStatus = rtx_getCurrentStatus();
+
+        if(rtxStatus.lsfOk)
+        {
+            // The meta text scrolls while being drawn: redraw it when the
+            // next scroll step is due.
+            long long now = getTick();
+            bool scroll = (now - ui_state->m17_meta_text_last_scroll_tick) >= 100;
+
+            _ui_addState(&mode_widget, rtxStatus.M17_dst, sizeof(rtxStatus.M17_dst));
+            _ui_addState(&mode_widget, rtxStatus.M17_src, sizeof(rtxStatus.M17_src));
+            _ui_addState(&mode_widget, rtxStatus.M17_link, sizeof(rtxStatus.M17_link));
+            _ui_addState(&mode_widget, rtxStatus.M17_refl, sizeof(rtxStatus.M17_refl));
+            _ui_addState(&mode_widget, rtxStatus.M17_meta_text, sizeof(rtxStatus.M17_meta_text));
+            _ui_addState(&mode_widget, &ui_state->m17_meta_text_scroll_position,
+                         sizeof(ui_state->m17_meta_text_scroll_position));
+            _ui_addState(&mode_widget, &scroll, sizeof(scroll));
+
+            // Source, destination, meta text and link take lines 1 to 4
+            int16_t height = gfx_getFontHeight(layout.line2_font);
+            int16_t start  = layout.line1_pos.y - height;
+            int16_t end    = layout.line4_pos.y + (height / 3) + 1;
+            _ui_bindWidget(&mode_widget, start, end);
+            return;
+        }
+
+        _ui_addState(&mode_widget, &ui_state->edit_mode, sizeof(bool));
+        _ui_addState(&mode_widget, ui_state->new_callsign, sizeof(ui_state->new_callsign));
+        _ui_addState(&mode_widget, rtxStatus.destination_address,
+                     sizeof(rtxStatus.destination_address));
+    }
+    #else
+    (void) ui_state;
+    #endif
+
+    _ui_bindTextWidget(&mode_widget, layout.line2_pos.y, layout.line2_font);
+}
+
+static void _ui_bindFrequency(bool visible)
+{
+    freq_t freq = platform_getPttStatus() ? last_state.channel.tx_frequency
+                                          : last_state.channel.rx_frequency;
+    _ui_addState(&frequency_widget, &freq, sizeof(freq));
+
+    // Frequency digits do not go below the baseline
+    int16_t baseline = layout.line3_large_pos.y;
+    int16_t start    = baseline - gfx_getFontHeight(layout.line3_large_font);
+
+    if(visible)
+        _ui_bindWidget(&frequency_widget, start, baseline + 1);
+    else
+        _ui_bindWidget(&frequency_widget, 0, 0);
+}
+
+static void _ui_bindMainBottom()
+{
+    uint8_t meter[] = { last_state.channel.mode, last_state.settings.sqlLevel,
+                        last_state.volume, 0 };
+    if(last_state.channel.mode != OPMODE_FM)
+        meter[3] = platform_getMicLevel();
+
+    _ui_addState(&bottom_widget, &last_state.rssi, sizeof(last_state.rssi));
+    _ui_addState(&bottom_widget, meter, sizeof(meter));
+
+    uint16_t meter_y = CONFIG_SCREEN_HEIGHT - layout.bottom_h - layout.bottom_pad;
+    _ui_bindWidget(&bottom_widget, meter_y, CONFIG_SCREEN_HEIGHT);
+}
+
+/**
+ * Show the frequency and the channel data unless the OpMode is M17 and there
+ * is valid LSF data, shown in place of them.
+ */
+static bool _ui_showChannelData()
+{
+    #ifdef CONFIG_M17
     rtxStatus_t status = rtx_getCurrentStatus();
-    if((status.opMode != OPMODE_M17) || (status.lsfOk == false))
+    if((status.opMode == OPMODE_M17) && (status.lsfOk == true))
+        return false;
     #endif
-        _ui_drawFrequency();
 
-    _ui_drawMainBottom();
+    return true;
+}
+
+void _ui_drawMainVFO(ui_state_t* ui_state)
+{
+    bool showFrequency = _ui_showChannelData();
+
+    // Only the widgets whose state changed are drawn again
+    _ui_beginWidgets();
+    _ui_bindMainTop(ui_state);
+    _ui_bindModeInfo(ui_state);
+    _ui_bindFrequency(showFrequency);
+    _ui_bindMainBottom();
+
+    if(_ui_redrawWidget(&top_widget))
+        _ui_drawMainTop(ui_state);
+    if(_ui_redrawWidget(&mode_widget))
+        _ui_drawModeInfo(ui_state);
+    if(_ui_redrawWidget(&frequency_widget))
+        _ui_drawFrequency();
+    if(_ui_redrawWidget(&bottom_widget))
+        _ui_drawMainBottom();
 }
 
 void _ui_drawMainVFOInput(ui_state_t* ui_state)
@@ -358,19 +499,24 @@ void _ui_drawMainVFOInput(ui_state_t* ui_state)
 
 void _ui_drawMainMEM(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    _ui_drawMainTop(ui_state);
-    _ui_drawModeInfo(ui_state);
-
-    #ifdef CONFIG_M17
-    // Show channel data if the OpMode is not M17 or there is no valid LSF data
-    rtxStatus_t status = rtx_getCurrentStatus();
-    if((status.opMode != OPMODE_M17) || (status.lsfOk == false))
-    #endif
-    {
+    bool showChannel = _ui_showChannelData();
+
+    // Only the widgets whose state changed are drawn again
+    _ui_beginWidgets();
+    _ui_bindMainTop(ui_state);
+    _ui_bindModeInfo(ui_state);
+    _ui_bindBankChannel(showChannel);
+    _ui_bindFrequency(showChannel);
+    _ui_bindMainBottom();
+
+    if(_ui_redrawWidget(&top_widget))
+        _ui_drawMainTop(ui_state);
+    if(_ui_redrawWidget(&mode_widget))
+        _ui_drawModeInfo(ui_state);
+    if(_ui_redrawWidget(&channel_widget))
         _ui_drawBankChannel();
+    if(_ui_redrawWidget(&frequency_widget))
         _ui_drawFrequency();
-    }
-
-    _ui_drawMainBottom();
+    if(_ui_redrawWidget(&bottom_widget))
+        _ui_drawMainBottom();
 }
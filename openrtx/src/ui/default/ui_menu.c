@@ -32,6 +32,11 @@ static char priorSelectedMenuValue[MAX_ENTRY_LEN] = "\0";
 static bool priorEditMode = false;
 static uint32_t lastValueUpdate=0;
 
+// Widgets of the menu title and entries, entries are at least 10 pixels high
+static widget_t menu_title_widget;
+static widget_t menu_widgets[(CONFIG_SCREEN_HEIGHT / 10) + 1];
+#define MENU_MAX_ROWS (sizeof(menu_widgets) / sizeof(menu_widgets[0]))
+
 const char *display_timer_values[] =
 {
     "OFF",
@@ -143,39 +148,85 @@ static void announceMenuItemIfNeeded(char* name, char* value, bool editMode)
     vp_play();
 }
 
-void _ui_drawMenuList(uint8_t selected, int (*getCurrentEntry)(char *buf, uint8_t max_len, uint8_t index))
+static void _ui_bindMenuTitle(const char *title)
+{
+    _ui_addStateString(&menu_title_widget, title);
+    _ui_bindTextWidget(&menu_title_widget, layout.top_pos.y, layout.top_font);
+}
+
+static void _ui_hideMenuEntries(uint8_t first)
+{
+    for(uint8_t row = first; row < MENU_MAX_ROWS; row++)
+        _ui_bindWidget(&menu_widgets[row], 0, 0);
+}
+
+static void _ui_drawMenuTitle(const char *title)
+{
+    if(_ui_redrawWidget(&menu_title_widget))
+        gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
+                  color_white, title);
+}
+
+void _ui_drawMenuList(const char *title, uint8_t selected,
+                      int (*getCurrentEntry)(char *buf, uint8_t max_len, uint8_t index))
 {
     point_t pos = layout.line1_pos;
     // Number of menu entries that fit in the screen height
     uint8_t entries_in_screen = (CONFIG_SCREEN_HEIGHT - 1 - pos.y) / layout.menu_h + 1;
     uint8_t scroll = 0;
+    uint8_t rows = 0;
     char entry_buf[MAX_ENTRY_LEN] = "";
     color_t text_color = color_white;
-    for(int item=0, result=0; (result == 0) && (pos.y < CONFIG_SCREEN_HEIGHT); item++)
+
+    // If selection is off the screen, scroll screen
+    if(selected >= entries_in_screen)
+        scroll = selected - entries_in_screen + 1;
+
+    // Bind the title and the entries shown, only the changed ones are drawn
+    _ui_beginWidgets();
+    _ui_bindMenuTitle(title);
+    for(int result = 0; (result == 0) && (pos.y < CONFIG_SCREEN_HEIGHT) &&
+                        (rows < MENU_MAX_ROWS);)
     {
-        // If selection is off the screen, scroll screen
-        if(selected >= entries_in_screen)
-            scroll = selected - entries_in_screen + 1;
         // Call function pointer to get current menu entry string
-        result = (*getCurrentEntry)(entry_buf, sizeof(entry_buf), item+scroll);
+        result = (*getCurrentEntry)(entry_buf, sizeof(entry_buf), rows + scroll);
         if(result != -1)
         {
-            text_color = color_white;
-            if(item + scroll == selected)
-            {
-                text_color = color_black;
-                // Draw rectangle under selected item, compensating for text height
-                point_t rect_pos = {0, pos.y - layout.menu_h + 3};
-                gfx_drawRect(rect_pos, CONFIG_SCREEN_WIDTH, layout.menu_h, color_white, true);
+            bool highlight = (rows + scroll == selected);
+            if(highlight)
                 announceMenuItemIfNeeded(entry_buf, NULL, false);
-            }
-            gfx_print(pos, layout.menu_font, TEXT_ALIGN_LEFT, text_color, entry_buf);
+
+            // Text widgets also cover the rectangle under the selected item
+            _ui_addStateString(&menu_widgets[rows], entry_buf);
+            _ui_addState(&menu_widgets[rows], &highlight, sizeof(highlight));
+            _ui_bindTextWidget(&menu_widgets[rows], pos.y, layout.menu_font);
             pos.y += layout.menu_h;
+            rows++;
         }
     }
+    _ui_hideMenuEntries(rows);
+
+    _ui_drawMenuTitle(title);
+    pos = layout.line1_pos;
+    for(uint8_t row = 0; row < rows; row++, pos.y += layout.menu_h)
+    {
+        if(_ui_redrawWidget(&menu_widgets[row]) == false)
+            continue;
+
+        (*getCurrentEntry)(entry_buf, sizeof(entry_buf), row + scroll);
+        text_color = color_white;
+        if(row + scroll == selected)
+        {
+            text_color = color_black;
+            // Draw rectangle under selected item, compensating for text height
+            point_t rect_pos = {0, pos.y - layout.menu_h + 3};
+            gfx_drawRect(rect_pos, CONFIG_SCREEN_WIDTH, layout.menu_h, color_white, true);
+        }
+        gfx_print(pos, layout.menu_font, TEXT_ALIGN_LEFT, text_color, entry_buf);
+    }
 }
 
-void _ui_drawMenuListValue(ui_state_t* ui_state, uint8_t selected,
+void _ui_drawMenuListValue(ui_state_t* ui_state, const char *title, uint8_t selected,
                            int (*getCurrentEntry)(char *buf, uint8_t max_len, uint8_t index),
                            int (*getCurrentValue)(char *buf, uint8_t max_len, uint8_t index))
 {
@@ -183,34 +234,30 @@ void _ui_drawMenuListValue(ui_state_t* ui_state, uint8_t selected,
     // Number of menu entries that fit in the screen height
     uint8_t entries_in_screen = (CONFIG_SCREEN_HEIGHT - 1 - pos.y) / layout.menu_h + 1;
     uint8_t scroll = 0;
+    uint8_t rows = 0;
     char entry_buf[MAX_ENTRY_LEN] = "";
     char value_buf[MAX_ENTRY_LEN] = "";
     color_t text_color = color_white;
-    for(int item=0, result=0; (result == 0) && (pos.y < CONFIG_SCREEN_HEIGHT); item++)
+
+    // If selection is off the screen, scroll screen
+    if(selected >= entries_in_screen)
+        scroll = selected - entries_in_screen + 1;
+
+    // Bind the title and the entries shown, only the changed ones are drawn
+    _ui_beginWidgets();
+    _ui_bindMenuTitle(title);
+    for(int result = 0; (result == 0) && (pos.y < CONFIG_SCREEN_HEIGHT) &&
+                        (rows < MENU_MAX_ROWS);)
     {
-        // If selection is off the screen, scroll screen
-        if(selected >= entries_in_screen)
-            scroll = selected - entries_in_screen + 1;
         // Call function pointer to get current menu entry string
-        result = (*getCurrentEntry)(entry_buf, sizeof(entry_buf), item+scroll);
+        result = (*getCurrentEntry)(entry_buf, sizeof(entry_buf), rows + scroll);
         // Call function pointer to get current entry value string
-        result = (*getCurrentValue)(value_buf, sizeof(value_buf), item+scroll);
+        result = (*getCurrentValue)(value_buf, sizeof(value_buf), rows + scroll);
         if(result != -1)
         {
-            text_color = color_white;
-            if(item + scroll == selected)
+            bool highlight = (rows + scroll == selected);
+            if(highlight)
             {
-                // Draw rectangle under selected item, compensating for text height
-                // If we are in edit mode, draw a hollow rectangle
-                text_color = color_black;
-                bool full_rect = true;
-                if(ui_state->edit_mode)
-                {
-                    text_color = color_white;
-                    full_rect = false;
-                }
-                point_t rect_pos = {0, pos.y - layout.menu_h + 3};
-                gfx_drawRect(rect_pos, CONFIG_SCREEN_WIDTH, layout.menu_h, color_white, full_rect);
                 bool editModeChanged = priorEditMode != ui_state->edit_mode;
                 priorEditMode = ui_state->edit_mode;
                 // force the menu item to be spoken  when the edit mode changes.
@@ -224,11 +271,47 @@ void _ui_drawMenuListValue(ui_state_t* ui_state, uint8_t selected,
                                              ui_state->edit_mode);
                 }
             }
-            gfx_print(pos, layout.menu_font, TEXT_ALIGN_LEFT, text_color, entry_buf);
-            gfx_print(pos, layout.menu_font, TEXT_ALIGN_RIGHT, text_color, value_buf);
+
+            // Text widgets also cover the rectangle under the selected item
+            bool edit = highlight && ui_state->edit_mode;
+            _ui_addStateString(&menu_widgets[rows], entry_buf);
+            _ui_addStateString(&menu_widgets[rows], value_buf);
+            _ui_addState(&menu_widgets[rows], &highlight, sizeof(highlight));
+            _ui_addState(&menu_widgets[rows], &edit, sizeof(edit));
+            _ui_bindTextWidget(&menu_widgets[rows], pos.y, layout.menu_font);
             pos.y += layout.menu_h;
+            rows++;
         }
     }
+    _ui_hideMenuEntries(rows);
+
+    _ui_drawMenuTitle(title);
+    pos = layout.line1_pos;
+    for(uint8_t row = 0; row < rows; row++, pos.y += layout.menu_h)
+    {
+        if(_ui_redrawWidget(&menu_widgets[row]) == false)
+            continue;
+
+        (*getCurrentEntry)(entry_buf, sizeof(entry_buf), row + scroll);
+        (*getCurrentValue)(value_buf, sizeof(value_buf), row + scroll);
+        text_color = color_white;
+        if(row + scroll == selected)
+        {
+            // Draw rectangle under selected item, compensating for text height
+            // If we are in edit mode, draw a hollow rectangle
+            text_color = color_black;
+            bool full_rect = true;
+            if(ui_state->edit_mode)
+            {
+                text_color = color_white;
+                full_rect = false;
+            }
+            point_t rect_pos = {0, pos.y - layout.menu_h + 3};
+            gfx_drawRect(rect_pos, CONFIG_SCREEN_WIDTH, layout.menu_h, color_white, full_rect);
+        }
+        gfx_print(pos, layout.menu_font, TEXT_ALIGN_LEFT, text_color, entry_buf);
+        gfx_print(pos, layout.menu_font, TEXT_ALIGN_RIGHT, text_color, value_buf);
+    }
 }
 
 int _ui_getMenuTopEntryName(char *buf, uint8_t max_len, uint8_t index)
@@ -632,42 +715,30 @@ int _ui_getContactName(char *buf, uint8_t max_len, uint8_t index)
 
 void _ui_drawMenuTop(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Menu" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->menu);
-    // Print menu entries
-    _ui_drawMenuList(ui_state->menu_selected, _ui_getMenuTopEntryName);
+    // Print menu entries, with "Menu" on top bar
+    _ui_drawMenuList(currentLanguage->menu, ui_state->menu_selected,
+                     _ui_getMenuTopEntryName);
 }
 
 void _ui_drawMenuBank(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Bank" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->banks);
-    // Print bank entries
-    _ui_drawMenuList(ui_state->menu_selected, _ui_getBankName);
+    // Print bank entries, with "Bank" on top bar
+    _ui_drawMenuList(currentLanguage->banks, ui_state->menu_selected,
+                     _ui_getBankName);
 }
 
 void _ui_drawMenuChannel(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Channel" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->channels);
-    // Print channel entries
-    _ui_drawMenuList(ui_state->menu_selected, _ui_getChannelName);
+    // Print channel entries, with "Channel" on top bar
+    _ui_drawMenuList(currentLanguage->channels, ui_state->menu_selected,
+                     _ui_getChannelName);
 }
 
 void _ui_drawMenuContacts(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Contacts" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->contacts);
-    // Print contact entries
-    _ui_drawMenuList(ui_state->menu_selected, _ui_getContactName);
+    // Print contact entries, with "Contacts" on top bar
+    _ui_drawMenuList(currentLanguage->contacts, ui_state->menu_selected,
+                     _ui_getContactName);
 }
 
 #ifdef CONFIG_GPS
@@ -779,22 +850,16 @@ void _ui_drawMenuGPS()
 
 void _ui_drawMenuSettings(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Settings" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->settings);
-    // Print menu entries
-    _ui_drawMenuList(ui_state->menu_selected, _ui_getSettingsEntryName);
+    // Print menu entries, with "Settings" on top bar
+    _ui_drawMenuList(currentLanguage->settings, ui_state->menu_selected,
+                     _ui_getSettingsEntryName);
 }
 
 void _ui_drawMenuBackupRestore(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Backup & Restore" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->backupAndRestore);
-    // Print menu entries
-    _ui_drawMenuList(ui_state->menu_selected, _ui_getBackupRestoreEntryName);
+    // Print menu entries, with "Backup & Restore" on top bar
+    _ui_drawMenuList(currentLanguage->backupAndRestore, ui_state->menu_selected,
+                     _ui_getBackupRestoreEntryName);
 }
 
 void _ui_drawMenuBackup(ui_state_t* ui_state)
@@ -851,13 +916,10 @@ void _ui_drawMenuRestore(ui_state_t* ui_state)
 
 void _ui_drawMenuInfo(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Info" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->info);
-    // Print menu entries
-    _ui_drawMenuListValue(ui_state, ui_state->menu_selected, _ui_getInfoEntryName,
-                           _ui_getInfoValueName);
+    // Print menu entries, with "Info" on top bar
+    _ui_drawMenuListValue(ui_state, currentLanguage->info, ui_state->menu_selected,
+                          _ui_getInfoEntryName,
+                          _ui_getInfoValueName);
 }
 
 void _ui_drawMenuAbout(ui_state_t* ui_state)
@@ -897,24 +959,17 @@ void _ui_drawMenuAbout(ui_state_t* ui_state)
 
 void _ui_drawSettingsDisplay(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Display" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->display);
-    // Print display settings entries
-    _ui_drawMenuListValue(ui_state, ui_state->menu_selected, _ui_getDisplayEntryName,
-                           _ui_getDisplayValueName);
+    // Print display settings entries, with "Display" on top bar
+    _ui_drawMenuListValue(ui_state, currentLanguage->display, ui_state->menu_selected,
+                          _ui_getDisplayEntryName,
+                          _ui_getDisplayValueName);
 }
 
 #ifdef CONFIG_GPS
 void _ui_drawSettingsGPS(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "GPS Settings" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->gpsSettings);
-    // Print display settings entries
-    _ui_drawMenuListValue(ui_state, ui_state->menu_selected,
+    // Print display settings entries, with "GPS Settings" on top bar
+    _ui_drawMenuListValue(ui_state, currentLanguage->gpsSettings, ui_state->menu_selected,
                           _ui_getSettingsGPSEntryName,
                           _ui_getSettingsGPSValueName);
 }
@@ -982,6 +1037,20 @@ void _ui_drawSettingsTimeDateSet(ui_state_t* ui_state)
 #ifdef CONFIG_M17
 void _ui_drawSettingsM17(ui_state_t* ui_state)
 {
+    bool edit_callsign = (ui_state->edit_mode) &&
+                         (ui_state->menu_selected == M17_CALLSIGN);
+    bool edit_message  = (ui_state->edit_message) &&
+                         (ui_state->menu_selected == M17_METATEXT);
+
+    if((edit_callsign == false) && (edit_message == false))
+    {
+        // Print M17 settings entries, with "M17 Settings" on top bar
+        _ui_drawMenuListValue(ui_state, currentLanguage->m17settings,
+                              ui_state->menu_selected, _ui_getM17EntryName,
+                              _ui_getM17ValueName);
+        return;
+    }
+
     gfx_clearScreen();
     // Print "M17 Settings" on top bar
     gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
@@ -989,7 +1058,7 @@ void _ui_drawSettingsM17(ui_state_t* ui_state)
     gfx_printLine(1, 4, layout.top_h, CONFIG_SCREEN_HEIGHT - layout.bottom_h,
                   layout.horizontal_pad, layout.menu_font,
                   TEXT_ALIGN_LEFT, color_white, currentLanguage->callsign);
-    if((ui_state->edit_mode) && (ui_state->menu_selected == M17_CALLSIGN))
+    if(edit_callsign)
     {
         uint16_t rect_width = CONFIG_SCREEN_WIDTH - (layout.horizontal_pad * 2);
         uint16_t rect_height = (CONFIG_SCREEN_HEIGHT - (layout.top_h + layout.bottom_h))/2;
@@ -1002,7 +1071,6 @@ void _ui_drawSettingsM17(ui_state_t* ui_state)
                       TEXT_ALIGN_CENTER, color_white, ui_state->new_callsign);
     }
     else
-    if((ui_state->edit_message) && (ui_state->menu_selected == M17_METATEXT))
     {
         uint16_t rect_width = CONFIG_SCREEN_WIDTH - (layout.horizontal_pad * 2);
         uint16_t rect_height = (CONFIG_SCREEN_HEIGHT - (layout.top_h + layout.bottom_h))/2;
@@ -1014,34 +1082,23 @@ void _ui_drawSettingsM17(ui_state_t* ui_state)
                           layout.horizontal_pad, layout.message_font,
                           TEXT_ALIGN_CENTER, color_white, ui_state->new_message);
     }
-    else
-    {
-        _ui_drawMenuListValue(ui_state, ui_state->menu_selected, _ui_getM17EntryName,
-                              _ui_getM17ValueName);
-    }
 }
 #endif
 
 void _ui_drawSettingsFM(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "FM Settings" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER, color_white,
-              currentLanguage->fm);
-    // Print FM settings entries
-    _ui_drawMenuListValue(ui_state, ui_state->menu_selected, _ui_getFMEntryName,
+    // Print FM settings entries, with "FM Settings" on top bar
+    _ui_drawMenuListValue(ui_state, currentLanguage->fm, ui_state->menu_selected,
+                          _ui_getFMEntryName,
                           _ui_getFMValueName);
 }
 
 void _ui_drawSettingsAccessibility(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-    // Print "Accessibility" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->accessibility);
-    // Print accessibility settings entries
-    _ui_drawMenuListValue(ui_state, ui_state->menu_selected, _ui_getAccessibilityEntryName,
-                           _ui_getAccessibilityValueName);
+    // Print accessibility settings entries, with "Accessibility" on top bar
+    _ui_drawMenuListValue(ui_state, currentLanguage->accessibility, ui_state->menu_selected,
+                          _ui_getAccessibilityEntryName,
+                          _ui_getAccessibilityValueName);
 }
 
 void _ui_drawSettingsReset2Defaults(ui_state_t* ui_state)
@@ -1075,15 +1132,15 @@ void _ui_drawSettingsReset2Defaults(ui_state_t* ui_state)
 
 void _ui_drawSettingsRadio(ui_state_t* ui_state)
 {
-    gfx_clearScreen();
-
-    // Print "Radio Settings" on top bar
-    gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
-              color_white, currentLanguage->radioSettings);
-
     // Handle the special case where a frequency is being input
     if ((ui_state->menu_selected == R_OFFSET) && (ui_state->edit_mode))
     {
+        gfx_clearScreen();
+
+        // Print "Radio Settings" on top bar
+        gfx_print(layout.top_pos, layout.top_font, TEXT_ALIGN_CENTER,
+                  color_white, currentLanguage->radioSettings);
+
         char buf[17] = { 0 };
         uint16_t rect_width = CONFIG_SCREEN_WIDTH - (layout.horizontal_pad * 2);
         uint16_t rect_height = (CONFIG_SCREEN_HEIGHT - (layout.top_h + layout.bottom_h))/2;
@@ -1118,9 +1175,10 @@ void _ui_drawSettingsRadio(ui_state_t* ui_state)
     }
     else
     {
-        // Print radio settings entries
-        _ui_drawMenuListValue(ui_state, ui_state->menu_selected, _ui_getRadioEntryName,
-                               _ui_getRadioValueName);
+        // Print radio settings entries, with "Radio Settings" on top bar
+        _ui_drawMenuListValue(ui_state, currentLanguage->radioSettings,
+                              ui_state->menu_selected, _ui_getRadioEntryName,
+                              _ui_getRadioValueName);
     }
 }
 
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * Widgets are horizontal bands of the screen bound to the state they show.
+ * In each frame a screen first binds all its widgets, clearing the rows of
+ * the ones whose state changed, and then draws the widgets covering any of
+ * the cleared rows, in the same order used when drawing from scratch.
+ *
+ * Widgets may share rows, as the descenders of a line of text reaching into
+ * the following one. A widget sharing rows with a changed one is drawn again
+ * on top of its unchanged content, which leaves its pixels untouched and
+ * restores the ones falling in the cleared rows. This way, updating only the
+ * changed widgets gives the same screen content as drawing it from scratch,
+ * while the unchanged rows are neither drawn nor flushed to the display.
+ */
+
+#include <string.h>
+#include "ui/ui_default.h"
+
+/*
+ * Size of a widget state not fitting in the retained copy.
+ */
+#define STATE_LARGE UINT8_MAX
+
+#if WIDGET_STATE_SIZE >= STATE_LARGE
+#error The widget state size must fit in a byte
+#endif
+
+static bool     invalid   = true;
+static bool     fullFrame = true;
+static uint32_t clearedRows[(CONFIG_SCREEN_HEIGHT + 31) / 32];
+
+static void clearRows(const uint8_t startRow, const uint8_t endRow)
+{
+    if(startRow >= endRow)
+        return;
+
+    gfx_clearRows(startRow, endRow);
+
+    for(uint8_t row = startRow; row < endRow; row++)
+        clearedRows[row / 32] |= 1u << (row % 32);
+}
+
+void _ui_invalidateWidgets()
+{
+    invalid = true;
+}
+
+bool _ui_beginWidgets()
+{
+    memset(clearedRows, 0x00, sizeof(clearedRows));
+
+    fullFrame = invalid;
+    invalid   = false;
+
+    if(fullFrame)
+        gfx_clearScreen();
+
+    return fullFrame;
+}
+
+void _ui_bindWidget(widget_t *widget, int16_t startRow, int16_t endRow)
+{
+    if(startRow < 0)
+        startRow = 0;
+
+    if(endRow > CONFIG_SCREEN_HEIGHT)
+        endRow = CONFIG_SCREEN_HEIGHT;
+
+    if(endRow < startRow)
+        endRow = startRow;
+
+    bool changed = widget->changed                    ||
+                   (widget->used     == STATE_LARGE)  ||
+                   (widget->used     != widget->size) ||
+                   (widget->startRow != startRow)     ||
+                   (widget->endRow   != endRow);
+
+    // Widgets have been drawn from scratch: nothing to clear
+    if((fullFrame == false) && changed)
+    {
+        clearRows(widget->startRow, widget->endRow);
+        clearRows(startRow, endRow);
+    }
+
+    widget->size     = widget->used;
+    widget->used     = 0;
+    widget->changed  = false;
+    widget->startRow = startRow;
+    widget->endRow   = endRow;
+}
+
+void _ui_bindTextWidget(widget_t *widget, int16_t baseline, fontSize_t font)
+{
+    // The font height is the one of the '|' glyph, which spans from the
+    // ascent to slightly less than the descent of the font.
+    int16_t height = gfx_getFontHeight(font);
+
+    _ui_bindWidget(widget, baseline - height, baseline + (height / 3) + 1);
+}
+
+bool _ui_redrawWidget(const widget_t *widget)
+{
+    if(widget->startRow >= widget->endRow)
+        return false;
+
+    if(fullFrame)
+        return true;
+
+    for(uint8_t row = widget->startRow; row < widget->endRow; row++)
+    {
+        if(clearedRows[row / 32] & (1u << (row % 32)))
+            return true;
+    }
+
+    return false;
+}
+
+void _ui_addState(widget_t *widget, const void *data, size_t size)
+{
+    // State not fitting in the retained copy, the widget is always drawn
+    if((size > WIDGET_STATE_SIZE) ||
+       (widget->used > (WIDGET_STATE_SIZE - size)))
+    {
+        widget->used = STATE_LARGE;
+        return;
+    }
+
+    // Data beyond the previous state is compared against stale bytes, but
+    // the widget changed anyway since the size of its state differs.
+    uint8_t *state = &widget->state[widget->used];
+    if(memcmp(state, data, size) != 0)
+    {
+        memcpy(state, data, size);
+        widget->changed = true;
+    }
+
+    widget->used += size;
+}
+
+void _ui_addStateString(widget_t *widget, const char *str)
+{
+    _ui_addState(widget, str, strlen(str) + 1);
+}
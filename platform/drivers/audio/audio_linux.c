@@ -7,6 +7,7 @@
 #include "interfaces/audio.h"
 #include "hwconfig.h"
 #include "file_source.h"
+#include "file_sink.h"
 
 static const uint8_t pathCompatibilityMatrix[9][9] =
 {
@@ -24,16 +25,16 @@ static const uint8_t pathCompatibilityMatrix[9][9] =
 
 const struct audioDevice outputDevices[] =
 {
-    {NULL, 0, 0, SINK_MCU},
-    {NULL, 0, 0, SINK_RTX},
-    {NULL, 0, 0, SINK_SPK},
+    {NULL,                    0,                     0, SINK_MCU},
+    {&file_sink_audio_driver, "/tmp/m17_output.raw", 0, SINK_RTX},
+    {&file_sink_audio_driver, "$OPENRTX_SPEAKER",    1, SINK_SPK},
 };
 
 const struct audioDevice inputDevices[] =
 {
     {NULL,                      0,                   0, SOURCE_MCU},
     {&file_source_audio_driver, "/tmp/baseband.raw", 0, SOURCE_RTX},
-    {NULL,                      0,                   0, SOURCE_MIC},
+    {&file_source_audio_driver, "/tmp/mic.raw",      0, SOURCE_MIC},
 };
 
 void audio_init()
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "mcu/x86_64/drivers/vclock.h"
+#include "file_sink.h"
+
+#define NUM_INSTANCES   2
+#define FILE_BUF_SIZE   16384
+
+struct sinkState {
+    FILE *fp;
+    long long deadline;     // End of playback of the current section, in us
+    uint8_t playing;        // Buffer section being played, circular mode only
+    uint8_t pending;        // Free section handed out since the last syncpoint
+    uint8_t stopReq;
+    char fileBuf[FILE_BUF_SIZE];
+};
+
+static struct sinkState sinks[NUM_INSTANCES];
+
+/**
+ * \internal
+ * Get the size of the buffer section played between two syncpoints.
+ */
+static inline size_t sectionSize(const struct streamCtx *ctx)
+{
+    if (ctx->bufMode == BUF_CIRC_DOUBLE)
+        return ctx->bufSize / 2;
+
+    return ctx->bufSize;
+}
+
+/**
+ * \internal
+ * Get the playback time of a buffer section, in microseconds.
+ */
+static inline long long sectionTime(const struct streamCtx *ctx)
+{
+    return (1000000LL * sectionSize(ctx)) / ctx->sampleRate;
+}
+
+static void closeSink(struct streamCtx *ctx)
+{
+    struct sinkState *state = (struct sinkState *)ctx->priv;
+
+    fclose(state->fp);
+    state->fp = NULL;
+    ctx->running = 0;
+}
+
+static int fileSink_start(const uint8_t instance, const void *config,
+                          struct streamCtx *ctx)
+{
+    if ((ctx == NULL) || (instance >= NUM_INSTANCES))
+        return -EINVAL;
+
+    if ((ctx->running != 0) || (sinks[instance].fp != NULL))
+        return -EBUSY;
+
+    // Paths starting with '$' are taken from an environment variable, the
+    // output is not available when the variable is not set.
+    const char *path = (const char *)config;
+    if ((path != NULL) && (path[0] == '$'))
+        path = getenv(path + 1);
+
+    if ((path == NULL) || (path[0] == '\0'))
+        return -ENODEV;
+
+    struct sinkState *state = &sinks[instance];
+
+    // Open in append mode, works both for regular files and named pipes
+    state->fp = fopen(path, "ab");
+    if (state->fp == NULL)
+        return -EINVAL;
+
+    // Fully buffered output, data reaches the file in large chunks
+    setvbuf(state->fp, state->fileBuf, _IOFBF, FILE_BUF_SIZE);
+
+    state->playing = 0;
+    state->pending = 0;
+    state->stopReq = 0;
+    state->deadline = vclock_now() + sectionTime(ctx);
+
+    ctx->priv = state;
+    ctx->running = 1;
+
+    return 0;
+}
+
+static int fileSink_data(struct streamCtx *ctx, stream_sample_t **buf)
+{
+    if (ctx->running == 0)
+        return -1;
+
+    struct sinkState *state = (struct sinkState *)ctx->priv;
+    size_t size = sectionSize(ctx);
+
+    // In circular mode, the free section is the one not being played
+    if (ctx->bufMode == BUF_CIRC_DOUBLE) {
+        *buf = ctx->buffer + ((state->playing ^ 1) * size);
+        state->pending = 1;
+    } else {
+        *buf = ctx->buffer;
+    }
+
+    return size;
+}
+
+static int fileSink_sync(struct streamCtx *ctx, uint8_t dirty)
+{
+    (void)dirty;
+
+    if (ctx->running == 0)
+        return -1;
+
+    struct sinkState *state = (struct sinkState *)ctx->priv;
+    size_t size = sectionSize(ctx);
+    stream_sample_t *section = ctx->buffer + (state->playing * size);
+
+    // Wait for the end of playback of the current section, then hand it
+    // over to the file as an equivalent hardware peripheral would do with
+    // the DAC.
+    vclock_sleepUntil(state->deadline);
+    fwrite(section, sizeof(stream_sample_t), size, state->fp);
+
+    if (ctx->bufMode != BUF_CIRC_DOUBLE) {
+        closeSink(ctx);
+        return 0;
+    }
+
+    state->playing ^= 1;
+    state->deadline += sectionTime(ctx);
+
+    // When stopping, the section handed out to the producer is played last
+    if (state->stopReq != 0) {
+        if (state->pending != 0) {
+            section = ctx->buffer + (state->playing * size);
+            vclock_sleepUntil(state->deadline);
+            fwrite(section, sizeof(stream_sample_t), size, state->fp);
+        }
+
+        closeSink(ctx);
+        return 0;
+    }
+
+    state->pending = 0;
+
+    return 0;
+}
+
+static void fileSink_stop(struct streamCtx *ctx)
+{
+    if (ctx->running == 0)
+        return;
+
+    // Stream stops at the next syncpoint, once the section handed out to the
+    // producer has been played too
+    struct sinkState *state = (struct sinkState *)ctx->priv;
+    state->stopReq = 1;
+}
+
+static void fileSink_halt(struct streamCtx *ctx)
+{
+    if (ctx->running == 0)
+        return;
+
+    closeSink(ctx);
+}
+
+#pragma GCC diagnostic ignored "-Wpedantic"
+const struct audioDriver file_sink_audio_driver = {
+    .start = fileSink_start,
+    .data = fileSink_data,
+    .sync = fileSink_sync,
+    .stop = fileSink_stop,
+    .terminate = fileSink_halt,
+};
+#pragma GCC diagnostic pop
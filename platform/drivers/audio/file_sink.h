@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ * 
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef FILE_SINK_H
+#define FILE_SINK_H
+
+#include "interfaces/audio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Driver providing an audio output stream to a file or to a named pipe. Data
+ * is written as raw, 16 bit, native endian samples, appended to the existing
+ * file content. The configuration parameter is the file name with the full
+ * path, or the name of an environment variable holding it preceded by '$'.
+ * The instance number selects one of the two available driver channels.
+ *
+ * Playback is paced on the system clock, a buffer section is written to the
+ * file each time its playback time elapses.
+ */
+
+extern const struct audioDriver file_sink_audio_driver;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FILE_SINK_H */
@@ -8,6 +8,7 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <errno.h>
+#include "mcu/x86_64/drivers/vclock.h"
 #include "file_source.h"
 
 static int fileSource_start(const uint8_t instance, const void *config,
@@ -69,9 +70,10 @@ static int fileSource_sync(struct streamCtx *ctx, uint8_t dirty)
         size /= 2;
 
     // Simulate the time needed to get a new chunck of data from an equivalent
-    // hardware peripheral.
+    // hardware peripheral. With virtual time the buffer is available as soon
+    // as all the other simulated threads are idle.
     uint32_t waitTime = (1000000 * size) / ctx->sampleRate;
-    usleep(waitTime);
+    vclock_sleep(waitTime);
 
     return 0;
 }
@@ -83,6 +85,7 @@ static void fileSource_stop(struct streamCtx *ctx)
 
     FILE *fp = (FILE *)ctx->priv;
     fclose(fp);
+    ctx->running = 0;
 }
 
 static void fileSource_halt(struct streamCtx *ctx)
@@ -92,6 +95,7 @@ static void fileSource_halt(struct streamCtx *ctx)
 
     FILE *fp = (FILE *)ctx->priv;
     fclose(fp);
+    ctx->running = 0;
 }
 
 #pragma GCC diagnostic ignored "-Wpedantic"
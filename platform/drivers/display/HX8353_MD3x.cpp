@@ -14,6 +14,10 @@
 #include <miosix.h>
 #include <kernel/scheduler/scheduler.h>
 
+#ifndef CONFIG_PIX_FMT_BE
+#error HX8353 driver requires the framebuffer pixels to be stored big endian
+#endif
+
 /**
  * LCD command set, basic and extended
  */
@@ -401,6 +405,9 @@ void display_init()
 
 void display_terminate()
 {
+    /* Complete the transfer in progress, if any */
+    display_waitRender();
+
     /* Shut down backlight */
     backlight_terminate();
 
@@ -409,8 +416,12 @@ void display_terminate()
     __DSB();
 }
 
-void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
+void display_renderRowsAsync(uint8_t startRow, uint8_t endRow,
+                             const void *rows)
 {
+    /* Only one transfer at a time */
+    display_waitRender();
+
     /*
      * Put screen data lines back to alternate function mode, since they are in
      * common with keyboard buttons and the keyboard driver sets them as inputs.
@@ -424,24 +435,13 @@ void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
     gpio_setMode(LCD_D6, ALTERNATE | ALTERNATE_FUNC(12));
     gpio_setMode(LCD_D7, ALTERNATE | ALTERNATE_FUNC(12));
 
-    gpio_clearPin(LCD_CS);
-
     /*
-     * First of all, convert pixels from little to big endian, for
-     * compatibility with the display driver. We do this after having brought
-     * the CS pin low, in this way user code calling the renderingInProgress
-     * function gets true as return value and does not stomp our work.
+     * Pixels are already stored big endian, as needed by the display
+     * controller: the framebuffer is sent as it is. Bringing the CS pin low
+     * makes the display_renderingInProgress function return true until the
+     * transfer is completed.
      */
-    uint16_t *frameBuffer = (uint16_t *) fb;
-    for(uint8_t y = startRow; y < endRow; y++)
-    {
-        for(uint8_t x = 0; x < CONFIG_SCREEN_WIDTH; x++)
-        {
-            size_t pos = x + y * CONFIG_SCREEN_WIDTH;
-            uint16_t pixel = frameBuffer[pos];
-            frameBuffer[pos] = __builtin_bswap16(pixel);
-        }
-    }
+    gpio_clearPin(LCD_CS);
 
     /* Configure start and end rows in display driver */
     writeCmd(CMD_RASET);
@@ -456,12 +456,11 @@ void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
     /*
      * Configure DMA2 stream 7 to send framebuffer data to the screen.
      * Both source and destination memory sizes are configured to 8 bit, thus
-     * we have to set the transfer size to twice the framebuffer size, since
-     * this one is made of 16 bit variables.
+     * we have to set the transfer size to twice the number of pixels, since
+     * they are 16 bit variables.
      */
     DMA2_Stream7->NDTR = (endRow - startRow) * CONFIG_SCREEN_WIDTH * sizeof(uint16_t);
-    DMA2_Stream7->PAR  = ((uint32_t ) frameBuffer + (startRow * CONFIG_SCREEN_WIDTH
-                                                     * sizeof(uint16_t)));
+    DMA2_Stream7->PAR  = (uint32_t) rows;
     DMA2_Stream7->M0AR = LCD_FSMC_ADDR_DATA;
     DMA2_Stream7->CR = DMA_SxCR_CHSEL         /* Channel 7                   */
                      | DMA_SxCR_PINC          /* Increment source pointer    */
@@ -469,24 +468,41 @@ void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
                      | DMA_SxCR_TCIE          /* Transfer complete interrupt */
                      | DMA_SxCR_TEIE          /* Transfer error interrupt    */
                      | DMA_SxCR_EN;           /* Start transfer              */
+}
+
+bool display_renderingInProgress()
+{
+    return gpio_readPin(LCD_CS) == 0;
+}
 
+void display_waitRender()
+{
     /*
-     * Put the calling thread in waiting status until render completes.
+     * Put the calling thread in waiting status until the DMA interrupt brings
+     * the CS pin back high. Checking the pin with interrupts disabled ensures
+     * that the end of the transfer is not missed.
      */
+    FastInterruptDisableLock dLock;
+    while(gpio_readPin(LCD_CS) == 0)
     {
-        FastInterruptDisableLock dLock;
         lcdWaiting = Thread::IRQgetCurrentThread();
-        do
+        Thread::IRQwait();
         {
-            Thread::IRQwait();
-            {
-                FastInterruptEnableLock eLock(dLock);
-                Thread::yield();
-            }
-        } while(lcdWaiting);
+            FastInterruptEnableLock eLock(dLock);
+            Thread::yield();
+        }
     }
 }
 
+void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
+{
+    uint16_t *frameBuffer = (uint16_t *) fb;
+
+    display_renderRowsAsync(startRow, endRow,
+                            frameBuffer + (startRow * CONFIG_SCREEN_WIDTH));
+    display_waitRender();
+}
+
 void display_render(void *fb)
 {
     display_renderRows(0, CONFIG_SCREEN_HEIGHT, fb);
@@ -11,6 +11,10 @@
 #include "hwconfig.h"
 #include <string.h>
 
+#ifndef CONFIG_PIX_FMT_PAGED
+#error SH1106 driver requires the framebuffer pixels to be stored in pages
+#endif
+
 // Display is monochromatic, one bit per pixel
 #define FB_SIZE ((CONFIG_SCREEN_HEIGHT * CONFIG_SCREEN_WIDTH) / 8 + 1)
 
@@ -23,8 +27,6 @@ static const struct display_buffer_descriptor displayBufDesc =
     CONFIG_SCREEN_WIDTH,
 };
 
-static uint8_t shadowBuffer[FB_SIZE];
-
 void display_init()
 {
     // Get display handle
@@ -46,21 +48,8 @@ void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
 
 void display_render(void *fb)
 {
-    uint8_t *frameBuffer = (uint8_t *) fb;
-    memset(shadowBuffer, 0x00, FB_SIZE);
-
-    for(uint8_t y = 0; y < CONFIG_SCREEN_HEIGHT; y++)
-    {
-        for(uint8_t x = 0; x < CONFIG_SCREEN_WIDTH; x++)
-        {
-            size_t cell = x / 8 + y * (CONFIG_SCREEN_WIDTH / 8);
-            bool pixel = frameBuffer[cell] & (1 << (x % 8));
-            if (pixel)
-                shadowBuffer[x + y / 8 * CONFIG_SCREEN_WIDTH] |= 1 << (y % 8);
-        }
-    }
-
-    display_write(displayDev, 0, 0, &displayBufDesc, shadowBuffer);
+    // Framebuffer is already organized in pages, as the display memory
+    display_write(displayDev, 0, 0, &displayBufDesc, fb);
 }
 
 void display_setContrast(uint8_t contrast)
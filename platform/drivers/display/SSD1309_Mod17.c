@@ -64,7 +64,7 @@ void SSD1309_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
 
     // Convert rows to pages
     uint8_t startPage = startRow / 8;
-    uint8_t endPage = endRow / 8;
+    uint8_t endPage = (endRow + 7) / 8;
     uint8_t cmd[3];
 
     gpio_clearPin(LCD_DC);
@@ -79,7 +79,7 @@ void SSD1309_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
         gpio_clearPin(LCD_DC);
         cmd[0] = 0xB0 | page;
         cmd[1] = 0x00;
-        cmd[1] = 0x10;
+        cmd[2] = 0x10;
         spi_send(&spi2, cmd, 3);
         gpio_setPin(LCD_DC); // DC high -> data mode
 
@@ -14,37 +14,21 @@
 #include "interfaces/delays.h"
 #include "hwconfig.h"
 
+#ifndef CONFIG_PIX_FMT_PAGED
+#error ST7567 driver requires the framebuffer pixels to be stored in pages
+#endif
 
 /**
  * \internal
- * Send one row of pixels to the display.
- * Pixels in framebuffer are stored "by rows", while display needs data to be
- * sent "by columns": this function performs the needed conversion.
+ * Send one page of pixels to the display. Pixels in framebuffer are stored in
+ * pages of eight rows, as in the display memory: no conversion is needed.
  *
- * @param row: pixel row to be be sent.
+ * @param page: page to be be sent.
  */
-static void display_renderRow(uint8_t row, uint8_t *frameBuffer)
+static void display_renderPage(uint8_t page, uint8_t *frameBuffer)
 {
-    /* magic stuff */
-    uint8_t *buf = (frameBuffer + 128 * row);
-    for (uint8_t i = 0; i<16; i++)
-    {
-        uint8_t tmp[8] = {0};
-        for (uint8_t j = 0; j < 8; j++)
-        {
-            uint8_t tmp_buf = buf[j*16 + i];
-            int count = __builtin_popcount(tmp_buf);
-            while (count > 0)
-            {
-                int pos = __builtin_ctz(tmp_buf);
-                tmp[pos] |= 1UL << j;
-                tmp_buf &= ~(1 << pos);
-                count--;
-            }
-        }
-
-        spi_send(&spi2, tmp, 8);
-    }
+    spi_send(&spi2, frameBuffer + (page * CONFIG_SCREEN_WIDTH),
+             CONFIG_SCREEN_WIDTH);
 }
 
 
@@ -89,20 +73,24 @@ void display_terminate()
 
 void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
 {
+    /* Convert rows to the 8-row pages of the display memory */
+    uint8_t startPage = startRow / 8;
+    uint8_t endPage   = (endRow + 7) / 8;
+
     spi_acquire(&spi2);
     gpio_clearPin(LCD_CS);
 
-    for(uint8_t row = startRow; row < endRow; row++)
+    for(uint8_t page = startPage; page < endPage; page++)
     {
         uint8_t command[3];
-        command[0] = 0xB0 | row; /* Set Y position */
-        command[1] = 0x10;       /* Set X position */
+        command[0] = 0xB0 | page; /* Set Y position */
+        command[1] = 0x10;        /* Set X position */
         command[2] = 0x04;
 
         gpio_clearPin(LCD_RS);            /* RS low -> command mode */
         spi_send(&spi2, command, 3);
         gpio_setPin(LCD_RS);              /* RS high -> data mode   */
-        display_renderRow(row, (uint8_t *) fb);
+        display_renderPage(page, (uint8_t *) fb);
     }
 
     gpio_setPin(LCD_CS);
@@ -111,7 +99,7 @@ void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
 
 void display_render(void *fb)
 {
-    display_renderRows(0, CONFIG_SCREEN_HEIGHT / 8, fb);
+    display_renderRows(0, CONFIG_SCREEN_HEIGHT, fb);
 }
 
 void display_setContrast(uint8_t contrast)
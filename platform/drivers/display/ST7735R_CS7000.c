@@ -12,6 +12,10 @@
 #include "hwconfig.h"
 #include <string.h>
 
+#ifndef CONFIG_PIX_FMT_BE
+#error ST7735R driver requires the framebuffer pixels to be stored big endian
+#endif
+
 enum ST775RCmd
 {
     ST775R_CMD_NOP       = 0x00,
@@ -277,16 +281,13 @@ void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
     sendData(endRow);
     sendCmd(ST775R_CMD_RAMWR);
 
-    for(uint8_t y = startRow; y < endRow; y++)
-    {
-        for(uint8_t x = 0; x < CONFIG_SCREEN_WIDTH; x++)
-        {
-            size_t pos = x + y * CONFIG_SCREEN_WIDTH;
-            uint16_t pixel = ((uint16_t *) fb)[pos];
-            sendData((pixel >> 8) & 0xff);
-            sendData(pixel & 0xff);
-        }
-    }
+    /* Pixels are stored big endian, send them in memory order */
+    uint8_t *frameBuffer = (uint8_t *) fb;
+    size_t   start = startRow * CONFIG_SCREEN_WIDTH * sizeof(uint16_t);
+    size_t   end   = endRow * CONFIG_SCREEN_WIDTH * sizeof(uint16_t);
+
+    for(size_t pos = start; pos < end; pos++)
+        sendData(frameBuffer[pos]);
 
     gpio_setPin(LCD_CS);
 }
@@ -14,6 +14,10 @@
 #include "interfaces/delays.h"
 #include "hwconfig.h"
 
+#ifndef CONFIG_PIX_FMT_PAGED
+#error UC1701 driver requires the framebuffer pixels to be stored in pages
+#endif
+
 /**
  * \internal
  * Send one byte to display controller, via bit banging.
@@ -42,36 +46,17 @@ static void sendByteToController(uint8_t value)
 
 /**
  * \internal
- * Send one row of pixels to the display.
- * Pixels in framebuffer are stored "by rows", while display needs data to be
- * sent "by columns": this function performs the needed conversion.
+ * Send one page of pixels to the display. Pixels in framebuffer are stored in
+ * pages of eight rows, as in the display memory: no conversion is needed.
  *
- * @param row: pixel row to be be sent.
+ * @param page: page to be be sent.
  */
-static void display_renderRow(uint8_t row, uint8_t *frameBuffer)
+static void display_renderPage(uint8_t page, uint8_t *frameBuffer)
 {
-    /* magic stuff */
-    uint8_t *buf = (frameBuffer + 128 * row);
-    for (uint8_t i = 0; i<16; i++)
+    uint8_t *buf = frameBuffer + (page * CONFIG_SCREEN_WIDTH);
+    for(uint8_t i = 0; i < CONFIG_SCREEN_WIDTH; i++)
     {
-        uint8_t tmp[8] = {0};
-        for (uint8_t j = 0; j < 8; j++)
-        {
-            uint8_t tmp_buf = buf[j*16 + i];
-            int count = __builtin_popcount(tmp_buf);
-            while (count > 0)
-            {
-                int pos = __builtin_ctz(tmp_buf);
-                tmp[pos] |= 1UL << j;
-                tmp_buf &= ~(1 << pos);
-                count--;
-            }
-        }
-
-        for (uint8_t s = 0; s < 8; s++)
-        {
-            sendByteToController(tmp[s]);
-        }
+        sendByteToController(buf[i]);
     }
 }
 
@@ -122,21 +107,25 @@ void display_terminate()
 
 void display_renderRows(uint8_t startRow, uint8_t endRow, void *fb)
 {
-    for(uint8_t row = startRow; row < endRow; row++)
+    /* Convert rows to the 8-row pages of the display memory */
+    uint8_t startPage = startRow / 8;
+    uint8_t endPage   = (endRow + 7) / 8;
+
+    for(uint8_t page = startPage; page < endPage; page++)
     {
-        gpio_clearPin(LCD_RS);            /* RS low -> command mode */
-        sendByteToController(0xB0 | row); /* Set Y position         */
-        sendByteToController(0x10);       /* Set X position         */
+        gpio_clearPin(LCD_RS);             /* RS low -> command mode */
+        sendByteToController(0xB0 | page); /* Set Y position         */
+        sendByteToController(0x10);        /* Set X position         */
         sendByteToController(0x04);
-        gpio_setPin(LCD_RS);              /* RS high -> data mode   */
-        display_renderRow(row, (uint8_t *) fb);
+        gpio_setPin(LCD_RS);               /* RS high -> data mode   */
+        display_renderPage(page, (uint8_t *) fb);
     }
 
 }
 
 void display_render(void *fb)
 {
-    display_renderRows(0, CONFIG_SCREEN_HEIGHT / 8, fb);
+    display_renderRows(0, CONFIG_SCREEN_HEIGHT, fb);
 }
 
 void display_setContrast(uint8_t contrast)
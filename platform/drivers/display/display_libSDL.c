@@ -49,8 +49,13 @@ static uint32_t fetchPixelFromFb(unsigned int x, unsigned int y, void *fb)
      * each cell contains the values of eight pixels, one per bit.
      */
     uint8_t *buf = (uint8_t *)(fb);
+    #ifdef CONFIG_PIX_FMT_PAGED
+    unsigned int cell = x + (y / 8)*CONFIG_SCREEN_WIDTH;
+    unsigned int elem = y % 8;
+    #else
     unsigned int cell = (x + y*CONFIG_SCREEN_WIDTH) / 8;
     unsigned int elem = (x + y*CONFIG_SCREEN_WIDTH) % 8;
+    #endif
     if(buf[cell] & (1 << elem)) pixel = 0xFFFFFFFF;
     #endif
 
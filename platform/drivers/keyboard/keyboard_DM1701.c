@@ -10,6 +10,7 @@
 #include "interfaces/delays.h"
 #include "interfaces/keyboard.h"
 #include "interfaces/platform.h"
+#include "interfaces/display.h"
 #include "hwconfig.h"
 
 static int8_t old_pos = 0;
@@ -69,7 +70,11 @@ keyboard_t kbd_getKeys()
      * we put them as outputs and force a low logical level in order to be sure
      * that any residual charge on both the display controller's inputs and in
      * the capacitors in parallel to the Dx lines is dissipated.
+     * The display may be still sending data in background: wait for the end of
+     * the transfer before taking over the lines.
      */
+    display_waitRender();
+
     gpio_setMode(LCD_D0, OUTPUT);
     gpio_setMode(LCD_D1, OUTPUT);
     gpio_setMode(LCD_D2, OUTPUT);
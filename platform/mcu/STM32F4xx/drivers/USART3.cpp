@@ -4,9 +4,8 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
-#include <kernel/scheduler/scheduler.h>
+#include "core/spsc_ringbuf.hpp"
 #include "peripherals/gpio.h"
-#include <kernel/queue.h>
 #include <miosix.h>
 #include "USART3.h"
 
@@ -15,11 +14,7 @@
 
 using namespace miosix;
 
-static constexpr int rxQueueMin = 16; //  Minimum queue size
-
-DynUnsyncQueue< char > rxQueue(128);  // Queue for incoming data
-Thread *rxWaiting = 0;                // Thread waiting on RX
-bool   rxIdle     = true;             // Flag for RX idle
+SpscRingBuffer< char, 128 > rxQueue;  // Queue for incoming data
 FastMutex rxMutex;                    // Mutex locked during reception
 FastMutex txMutex;                    // Mutex locked during transmission
 
@@ -47,31 +42,10 @@ void __attribute__((noinline)) usart3irqImpl()
         //Always read data, since this clears interrupt flags
         c = USART3->DR;
 
-        //If no error put data in buffer
+        //If no error put data in buffer, waking up the reading thread
         if((status & USART_SR_FE) == 0)
         {
-            if(rxQueue.tryPut(c) == false) {/*fifo overflow*/}
-        }
-
-        rxIdle = false;
-    }
-
-    if(status & USART_SR_IDLE)
-    {
-        c = USART3->DR; //clears interrupt flags
-        rxIdle = true;
-    }
-
-    if((status & USART_SR_IDLE) || rxQueue.size() >= rxQueueMin)
-    {
-        //Enough data in buffer or idle line, awake thread
-        if(rxWaiting)
-        {
-            rxWaiting->IRQwakeup();
-            if(rxWaiting->IRQgetPriority()>
-                Thread::IRQgetCurrentThread()->IRQgetPriority())
-                    Scheduler::IRQfindNextThread();
-            rxWaiting = 0;
+            if(rxQueue.IRQpush(c) == false) {/*fifo overflow*/}
         }
     }
 }
@@ -92,7 +66,6 @@ void usart3_init(unsigned int baudrate)
     USART3->CR3 |= USART_CR3_ONEBIT;
     USART3->CR1  = USART_CR1_UE                // Enable port
                  | USART_CR1_RXNEIE            // Interrupt on data received
-                 | USART_CR1_IDLEIE            // Interrupt on idle line
                  | USART_CR1_TE                // Transmission enbled
                  | USART_CR1_RE;               // Reception enabled
 
@@ -117,32 +90,9 @@ ssize_t usart3_readBlock(void *buffer, size_t size, off_t where)
 
     miosix::Lock< miosix::FastMutex > l(rxMutex);
     char *buf = reinterpret_cast< char* >(buffer);
-    size_t result = 0;
-    FastInterruptDisableLock dLock;
-
-    for(;;)
-    {
-        //Try to get data from the queue
-        for(; result < size; result++)
-        {
-            if(rxQueue.tryGet(buf[result])==false) break;
-            //This is here just not to keep IRQ disabled for the whole loop
-            FastInterruptEnableLock eLock(dLock);
-        }
-        if(rxIdle && result > 0) break;
-        if(result == size) break;
-        //Wait for data in the queue
-        do {
-            rxWaiting = Thread::IRQgetCurrentThread();
-            Thread::IRQwait();
-            {
-                FastInterruptEnableLock eLock(dLock);
-                Thread::yield();
-            }
-        } while(rxWaiting);
-    }
 
-    return result;
+    // Wait for at least one character, then return all the available ones
+    return rxQueue.popN(buf, size, true);
 }
 
 ssize_t usart3_writeBlock(void *buffer, size_t size, off_t where)
@@ -5,22 +5,22 @@
  */
 
 #include "interfaces/delays.h"
-#include <sys/time.h>
-#include <unistd.h>
-#include <stdio.h>
+#include "vclock.h"
 
 /**
- * Implementation of the delay functions for x86_64.
+ * Implementation of the delay functions for x86_64. All the delays are run
+ * against the virtual clock, which falls back to the wall clock when the
+ * virtual time mode is not enabled.
  */
 
 void delayUs(unsigned int useconds)
 {
-    usleep(useconds);
+    vclock_sleep(useconds);
 }
 
 void delayMs(unsigned int mseconds)
 {
-    usleep(mseconds*1000);
+    vclock_sleep(mseconds * 1000LL);
 }
 
 void sleepFor(unsigned int seconds, unsigned int mseconds)
@@ -31,9 +31,7 @@ void sleepFor(unsigned int seconds, unsigned int mseconds)
 
 void sleepUntil(long long timestamp)
 {
-    long long delta = timestamp - getTick();
-    if(delta <= 0) return;
-    delayMs(delta);
+    vclock_sleepUntil(timestamp * 1000LL);
 }
 
 long long getTick()
@@ -43,8 +41,5 @@ long long getTick()
      * having a tick rate of 1kHz.
      */
 
-    struct timeval te;
-    gettimeofday(&te, NULL);
-    long long milliseconds = te.tv_sec*1000LL + te.tv_usec/1000;
-    return milliseconds;
+    return vclock_now() / 1000;
 }
@@ -0,0 +1,256 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "vclock.h"
+
+enum threadState {
+    THREAD_FREE = 0,    // Free running thread
+    THREAD_ATTACHED,    // Thread takes part in the simulation
+    THREAD_BLOCKED      // Attached thread blocked outside of the simulation
+};
+
+struct sleeper {
+    long long deadline;
+    struct sleeper *next;
+};
+
+static pthread_once_t initOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_key_t stateKey;
+static bool enabled;
+
+static long long now;               // Current virtual time, microseconds
+static unsigned int running;        // Attached threads not sleeping
+static unsigned int reserved;       // Threads created but not yet attached
+static struct sleeper *sleepers;    // Threads waiting for a wakeup time
+
+/**
+ * \internal Advance the virtual time to the earliest wakeup time, if all the
+ * attached threads are sleeping. To be called with the mutex locked.
+ */
+static void advance()
+{
+    if ((running != 0) || (sleepers == NULL))
+        return;
+
+    long long next = sleepers->deadline;
+    for (struct sleeper *s = sleepers->next; s != NULL; s = s->next) {
+        if (s->deadline < next)
+            next = s->deadline;
+    }
+
+    if (next > now)
+        now = next;
+
+    pthread_cond_broadcast(&wakeup);
+}
+
+static enum threadState getState()
+{
+    return (enum threadState)(intptr_t)pthread_getspecific(stateKey);
+}
+
+static void setState(const enum threadState state)
+{
+    pthread_setspecific(stateKey, (void *)(intptr_t)state);
+}
+
+/**
+ * \internal Remove an attached thread from the simulation when it terminates.
+ */
+static void threadExit(void *value)
+{
+    if ((enum threadState)(intptr_t)value != THREAD_ATTACHED)
+        return;
+
+    pthread_mutex_lock(&mutex);
+    running -= 1;
+    advance();
+    pthread_mutex_unlock(&mutex);
+}
+
+static void init()
+{
+    const char *env = getenv("OPENRTX_VIRTUAL_TIME");
+
+    enabled = (env != NULL) && (env[0] != '\0') && (strcmp(env, "0") != 0);
+    pthread_key_create(&stateKey, threadExit);
+}
+
+bool vclock_enabled()
+{
+    pthread_once(&initOnce, init);
+    return enabled;
+}
+
+void vclock_reserve()
+{
+    if (vclock_enabled() == false)
+        return;
+
+    pthread_mutex_lock(&mutex);
+    running += 1;
+    reserved += 1;
+    pthread_mutex_unlock(&mutex);
+}
+
+void vclock_attach()
+{
+    if (vclock_enabled() == false)
+        return;
+
+    pthread_mutex_lock(&mutex);
+
+    if (getState() != THREAD_ATTACHED) {
+        // Threads created after a reservation are already being waited for
+        if (reserved > 0)
+            reserved -= 1;
+        else
+            running += 1;
+
+        setState(THREAD_ATTACHED);
+    }
+
+    pthread_mutex_unlock(&mutex);
+}
+
+void vclock_detach()
+{
+    if (vclock_enabled() == false)
+        return;
+
+    pthread_mutex_lock(&mutex);
+
+    if (getState() == THREAD_ATTACHED) {
+        running -= 1;
+        advance();
+    }
+
+    setState(THREAD_FREE);
+    pthread_mutex_unlock(&mutex);
+}
+
+bool vclock_blockBegin()
+{
+    if (vclock_enabled() == false)
+        return false;
+
+    pthread_mutex_lock(&mutex);
+
+    bool attached = (getState() == THREAD_ATTACHED);
+    if (attached) {
+        running -= 1;
+        advance();
+        setState(THREAD_BLOCKED);
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    return attached;
+}
+
+void vclock_hold()
+{
+    if (vclock_enabled() == false)
+        return;
+
+    pthread_mutex_lock(&mutex);
+    running += 1;
+    pthread_mutex_unlock(&mutex);
+}
+
+void vclock_blockEnd(const bool held)
+{
+    if (vclock_enabled() == false)
+        return;
+
+    pthread_mutex_lock(&mutex);
+
+    if (getState() == THREAD_BLOCKED) {
+        if (held == false)
+            running += 1;
+
+        setState(THREAD_ATTACHED);
+    }
+
+    pthread_mutex_unlock(&mutex);
+}
+
+long long vclock_now()
+{
+    if (vclock_enabled() == false) {
+        struct timeval te;
+        gettimeofday(&te, NULL);
+        return (te.tv_sec * 1000000LL) + te.tv_usec;
+    }
+
+    pthread_mutex_lock(&mutex);
+    long long time = now;
+    pthread_mutex_unlock(&mutex);
+
+    return time;
+}
+
+void vclock_sleepUntil(long long timestamp)
+{
+    if (vclock_enabled() == false) {
+        long long delta = timestamp - vclock_now();
+        if (delta > 0)
+            usleep(delta);
+
+        return;
+    }
+
+    pthread_mutex_lock(&mutex);
+
+    if (timestamp <= now) {
+        pthread_mutex_unlock(&mutex);
+        return;
+    }
+
+    struct sleeper self = { timestamp, sleepers };
+    sleepers = &self;
+
+    bool attached = (getState() == THREAD_ATTACHED);
+    if (attached)
+        running -= 1;
+
+    advance();
+
+    while (now < timestamp)
+        pthread_cond_wait(&wakeup, &mutex);
+
+    struct sleeper **s = &sleepers;
+    while (*s != &self)
+        s = &((*s)->next);
+
+    *s = self.next;
+
+    // A free running thread does not hold the clock after waking up
+    if (attached)
+        running += 1;
+    else
+        advance();
+
+    pthread_mutex_unlock(&mutex);
+}
+
+void vclock_sleep(long long useconds)
+{
+    if (vclock_enabled() == false) {
+        usleep(useconds);
+        return;
+    }
+
+    vclock_sleepUntil(vclock_now() + useconds);
+}
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef VCLOCK_H
+#define VCLOCK_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Simulated clock for the Linux target, allowing whole firmware scenarios to
+ * run faster than real time with reproducible timing. The mode is enabled by
+ * setting the OPENRTX_VIRTUAL_TIME environment variable before starting the
+ * program; when disabled, all the functions below fall back to the wall clock.
+ *
+ * Virtual time starts from zero, like the system tick of a freshly booted
+ * radio, and advances only when all the threads attached to the simulation
+ * are sleeping: it then jumps straight to the earliest wakeup time. Any other
+ * thread is free running: its sleeps still wait on virtual time, but the clock
+ * does not wait for it while it is running. An attached thread blocking on
+ * anything else than the virtual clock, as a condition variable signalled by
+ * a free running thread, must enclose the wait between vclock_blockBegin() and
+ * vclock_blockEnd(): otherwise the clock is held and the simulation stalls.
+ * The thread waking it up calls vclock_hold() before doing so, so that no time
+ * elapses until the blocked thread runs again.
+ */
+
+/**
+ * Check if the virtual time mode is active.
+ *
+ * @return true if the virtual time mode is active.
+ */
+bool vclock_enabled();
+
+/**
+ * Account for a thread about to be created, which will attach itself to the
+ * simulation: the virtual clock is held from now on, so that no time elapses
+ * until the new thread is started and calls vclock_attach().
+ */
+void vclock_reserve();
+
+/**
+ * Make the calling thread take part in the simulation: the virtual clock does
+ * not advance until it goes to sleep, detaches or terminates.
+ */
+void vclock_attach();
+
+/**
+ * Remove the calling thread from the simulation, making it free running.
+ */
+void vclock_detach();
+
+/**
+ * Mark the calling thread as blocked on an event not driven by the virtual
+ * clock: if attached, the clock no longer waits for it until the thread is
+ * woken up. Free running threads are not affected.
+ *
+ * @return true if the calling thread is attached and released the clock.
+ */
+bool vclock_blockBegin();
+
+/**
+ * Hold the virtual clock on behalf of a thread blocked by vclock_blockBegin(),
+ * to be called by the thread waking it up before doing so.
+ */
+void vclock_hold();
+
+/**
+ * Mark the end of a wait started by vclock_blockBegin(), attaching the calling
+ * thread again if it was attached before.
+ *
+ * @param held: true if the clock has been held by the waking thread through
+ * vclock_hold(), false if the wait ended on its own.
+ */
+void vclock_blockEnd(const bool held);
+
+/**
+ * Get the current time.
+ *
+ * @return current time, in microseconds.
+ */
+long long vclock_now();
+
+/**
+ * Put the calling thread to sleep until the clock reaches a given time.
+ *
+ * @param timestamp: wakeup time, in microseconds.
+ */
+void vclock_sleepUntil(long long timestamp);
+
+/**
+ * Put the calling thread to sleep for a given amount of time.
+ *
+ * @param useconds: sleep time, in microseconds.
+ */
+void vclock_sleep(long long useconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VCLOCK_H */
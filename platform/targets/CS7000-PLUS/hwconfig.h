@@ -48,6 +48,9 @@ extern const struct gpsDevice gps;
 /* Screen pixel format */
 #define CONFIG_PIX_FMT_RGB565
 
+/* Pixels stored big endian, in the byte order of the display controller */
+#define CONFIG_PIX_FMT_BE
+
 /* Screen has adjustable brightness */
 #define CONFIG_SCREEN_BRIGHTNESS
 
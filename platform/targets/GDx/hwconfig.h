@@ -29,6 +29,9 @@ extern const struct spiDevice c6000_spi;
 /* Screen pixel format */
 #define CONFIG_PIX_FMT_BW
 
+/* Pixels stored in pages of eight rows, as in the display controller memory */
+#define CONFIG_PIX_FMT_PAGED
+
 /* Screen has adjustable contrast */
 #define CONFIG_SCREEN_CONTRAST
 #define CONFIG_DEFAULT_CONTRAST 71
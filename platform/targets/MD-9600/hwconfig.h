@@ -51,6 +51,9 @@ extern const struct Adc adc1;
 /* Screen pixel format */
 #define CONFIG_PIX_FMT_BW
 
+/* Pixels stored in pages of eight rows, as in the display controller memory */
+#define CONFIG_PIX_FMT_PAGED
+
 /* Battery type */
 #define CONFIG_BAT_NONE
 
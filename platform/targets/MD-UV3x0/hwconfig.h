@@ -46,6 +46,19 @@ extern const struct Adc adc1;
 /* Screen pixel format */
 #define CONFIG_PIX_FMT_RGB565
 
+/* Pixels stored big endian, in the byte order of the display controller */
+#define CONFIG_PIX_FMT_BE
+
+/* Display driver supports asynchronous transfers */
+#define CONFIG_DISPLAY_ASYNC
+
+/* Double buffered rendering, through a transfer buffer of 32 rows */
+#define CONFIG_GFX_DOUBLE_BUFFER
+#define CONFIG_GFX_DOUBLE_BUFFER_ROWS 32
+
+/* Glyphs of the 8pt font, used by most of the UI, cached in RAM as spans */
+#define CONFIG_GFX_GLYPH_CACHE FONT_SIZE_8PT
+
 /* Battery type */
 #define CONFIG_BAT_LIION
 #define CONFIG_BAT_NCELLS 2
@@ -14,6 +14,8 @@
 #include "readline/readline.h"
 #include "readline/history.h"
 
+#include "mcu/x86_64/drivers/vclock.h"
+#include "interfaces/delays.h"
 #include "emulator.h"
 #include "sdl_engine.h"
 
@@ -104,7 +106,7 @@ static int shell_ready(void *_self, int _argc, char **_argv)
 
     while(_skq_in > _skq_out)
     {
-        usleep(10 * 1000); //sleep until keyboard is caught up
+        delayMs(10); //sleep until keyboard is caught up
     }
     return SH_CONTINUE;
 }
@@ -294,8 +296,7 @@ static int shell_sleep(void *_self, int _argc, char **_argv)
         return SH_ERR;
     }
 
-    useconds_t sleepus = atoi(_argv[0]) * 1000;
-    usleep(sleepus);
+    delayMs(atoi(_argv[0]));
     return SH_CONTINUE;
 }
 
@@ -467,6 +468,12 @@ void *startCLIMenu(void *arg)
 {
     (void) arg;
 
+    // With virtual time, a script fed through stdin runs in lockstep with the
+    // radio: time only advances during the "sleep" commands. An interactive
+    // shell is left free running instead.
+    if(isatty(STDIN_FILENO) == 0)
+        vclock_attach();
+
     printf("\n\n");
     char *histfile = ".emulatorsh_history";
     shell_help(NULL, 0, NULL);
@@ -536,6 +543,9 @@ void emulator_start()
 {
     sdlEngine_init();
 
+    if(isatty(STDIN_FILENO) == 0)
+        vclock_reserve();
+
     pthread_t cli_thread;
     int err = pthread_create(&cli_thread, NULL, startCLIMenu, NULL);
 
@@ -27,6 +27,9 @@ enum Mod17Flags {
 /* Device supports M17 mode */
 #define CONFIG_M17
 
+/* Keep a copy of the displayed frame, flushing only the rows which changed */
+#define CONFIG_GFX_SHADOW_BUFFER
+
 #ifdef __cplusplus
 }
 #endif
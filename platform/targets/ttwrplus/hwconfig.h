@@ -17,6 +17,9 @@
 #define CONFIG_SCREEN_HEIGHT DT_PROP(DISPLAY, height)
 #define CONFIG_PIX_FMT_BW
 
+/* Pixels stored in pages of eight rows, as in the display controller memory */
+#define CONFIG_PIX_FMT_PAGED
+
 #define CONFIG_GPS
 #define CONFIG_NMEA_RBUF_SIZE 128
 
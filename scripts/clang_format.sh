@@ -68,8 +68,9 @@ openrtx/include/protocols/M17/Callsign.hpp
 openrtx/include/protocols/M17/FrameDecoder.hpp
 openrtx/include/protocols/M17/PacketFrame.hpp
 openrtx/include/protocols/M17/MetaText.hpp
+openrtx/include/protocols/M17/JitterBuffer.hpp
 openrtx/include/ui/utils.h
-openrtx/src/core/crc.c
+openrtx/src/core/crc.cpp
 openrtx/src/core/dsp.cpp
 openrtx/src/core/audio_codec.c
 openrtx/src/core/input.c
@@ -80,6 +81,7 @@ openrtx/src/core/voicePrompts.c
 openrtx/src/core/voicePromptUtils.c
 openrtx/src/protocols/M17/Callsign.cpp
 openrtx/src/protocols/M17/FrameDecoder.cpp
+openrtx/src/protocols/M17/JitterBuffer.cpp
 platform/drivers/ADC/ADC0_GDx.h
 platform/drivers/audio/file_source.h
 platform/drivers/audio/file_source.c
@@ -119,12 +121,26 @@ tests/unit/linux_inputStream_test.cpp
 tests/unit/M17_callsign.cpp
 tests/unit/M17_demodulator.cpp
 tests/unit/M17_golay.cpp
+tests/unit/M17_framemapping.cpp
+tests/unit/M17_convolutional.cpp
 tests/unit/M17_rrc.cpp
+tests/unit/M17_loopback.cpp
+tests/unit/M17_jitterbuffer.cpp
+tests/unit/M17_virtual_time.cpp
 tests/unit/M17_viterbi.cpp
 tests/unit/ui_check_standby.cpp
 tests/unit/M17_metatext.cpp
 tests/unit/M17_packet.cpp
 tests/unit/dsp_oversampling.cpp
+tests/unit/crc.cpp
+tests/unit/spsc_ringbuf.cpp
+tests/unit/audio_codec.cpp
+tests/unit/audio_path.cpp
+tests/unit/graphics_flush.cpp
+tests/unit/graphics_raster.cpp
+tests/unit/graphics_fonts.cpp
+tests/unit/ui_widgets.cpp
+scripts/m17_decode.cpp
 EOF
 )
 
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+# SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+#
+# Font compiler: converts the Adafruit GFX fonts used by the firmware to the
+# packed font format of openrtx/include/fonts/packed/packedfont.h.
+#
+# - The empty columns at the sides of each glyph are dropped.
+# - Each glyph is stored either as a bitmap or run-length encoded, whichever
+#   is smaller. Identical glyphs share their data.
+# - The fonts used only for the large lines of the UI (frequencies, times,
+#   callsigns and the UI strings) keep only the characters used by the UI
+#   strings, plus letters and digits. Missing characters are drawn as spaces.
+#
+# Usage: execute this script after changing the source fonts, the UI strings
+# or generate_symbols.py; the headers in openrtx/include/fonts/packed are
+# regenerated.
+
+import glob
+import os
+import re
+import string
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+out_dir = os.path.join(root, "openrtx/include/fonts/packed")
+
+FULL = None
+UI = "ui"
+
+# Source font, subset
+fonts = [
+    ("adafruit/TomThumb.h", FULL),
+    ("symbols/Symbols5pt7b.h", FULL),
+    ("symbols/Symbols6pt7b.h", FULL),
+    ("symbols/Symbols8pt7b.h", FULL),
+]
+
+for family in ["FreeSans", "UbuntuRegular"]:
+    fonts += [
+        ("adafruit/{}6pt7b.h".format(family), FULL),
+        ("adafruit/{}8pt7b.h".format(family), FULL),
+        ("adafruit/{}9pt7b.h".format(family), FULL),
+        ("adafruit/{}10pt7b.h".format(family), UI),
+        ("adafruit/{}12pt7b.h".format(family), UI),
+        ("adafruit/{}16pt7b.h".format(family), UI),
+    ]
+
+# REUSE-IgnoreStart
+dont_edit_banner  = "/*\n"
+dont_edit_banner += " * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors\n"
+dont_edit_banner += " *\n"
+dont_edit_banner += " * SPDX-License-Identifier: GPL-3.0-or-later\n"
+dont_edit_banner += " */\n"
+dont_edit_banner += "\n"
+# REUSE-IgnoreEnd
+generated_note = "// This is a generated file, please do not edit it! Use generate_fonts.py\n"
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def ui_characters():
+    """Characters appearing in the string literals of the UI sources."""
+    chars = set(string.ascii_letters + string.digits + " |")
+    sources = glob.glob(os.path.join(root, "openrtx/src/ui/**/*.c"), recursive=True)
+    sources += glob.glob(os.path.join(root, "openrtx/include/ui/*.h"))
+
+    for path in sources:
+        with open(path, encoding="utf-8") as f:
+            text = strip_comments(f.read())
+        for literal in re.findall(r'"((?:[^"\\\n]|\\.)*)"', text):
+            literal = literal.replace('\\"', '"').replace("\\\\", "\\")
+            chars |= set(c for c in literal if 0x20 <= ord(c) < 0x7F)
+
+    return chars
+
+
+class Glyph:
+    def __init__(self, bits, width, height, x_advance, x_offset, y_offset):
+        # Drop the empty columns at the sides
+        columns = [x for x in range(width)
+                   if any(bits[(y * width) + x] for y in range(height))]
+        first = columns[0] if columns else 0
+        last = (columns[-1] + 1) if columns else 0
+
+        self.width = last - first
+        self.height = height
+        self.x_advance = x_advance
+        self.x_offset = x_offset + first
+        self.y_offset = y_offset
+        self.bits = [bits[(y * width) + x]
+                     for y in range(height) for x in range(first, last)]
+
+    def bitmap(self):
+        data = bytearray((len(self.bits) + 7) // 8)
+        for i, bit in enumerate(self.bits):
+            data[i // 8] |= bit << (7 - (i % 8))
+        return bytes(data)
+
+    def rle(self):
+        # Alternating runs of unset and set pixels, starting with unset ones,
+        # one nibble each. Runs of 15 or more pixels continue in the following
+        # nibbles, a nibble below 15 ends the run.
+        nibbles = []
+        color = 0
+        i = 0
+        while i < len(self.bits):
+            run = 0
+            while i < len(self.bits) and self.bits[i] == color:
+                run += 1
+                i += 1
+            while run >= 15:
+                nibbles.append(15)
+                run -= 15
+            nibbles.append(run)
+            color ^= 1
+
+        if len(nibbles) % 2:
+            nibbles.append(0)
+
+        return bytes((nibbles[i] << 4) | nibbles[i + 1]
+                     for i in range(0, len(nibbles), 2))
+
+    def encode(self):
+        bitmap = self.bitmap()
+        rle = self.rle()
+        if len(rle) < len(bitmap):
+            return "GLYPH_RLE", rle
+        return "GLYPH_RAW", bitmap
+
+
+def parse_font(path):
+    with open(path) as f:
+        text = f.read()
+
+    text = re.sub(r"#if \(TOMTHUMB_USE_EXTENDED\).*?#endif", "", text, flags=re.S)
+    text = strip_comments(text)
+
+    bitmap = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    bitmap = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]+", bitmap)]
+
+    glyphs = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    glyphs = re.findall(r"\{\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,"
+                        r"\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*\}", glyphs)
+
+    font = re.search(r"GFXfont\s+(\w+)\s*PROGMEM\s*=\s*\{(.*?)\}", text, re.S)
+    name = font.group(1)
+    first, last, y_advance = [int(x, 0) for x in font.group(2).split(",")[-3:]]
+
+    result = []
+    for entry in glyphs:
+        offset, width, height, x_advance, x_offset, y_offset = map(int, entry)
+        bits = [(bitmap[offset + (i // 8)] >> (7 - (i % 8))) & 1
+                for i in range(width * height)]
+        result.append(Glyph(bits, width, height, x_advance, x_offset, y_offset))
+
+    assert len(result) == (last - first + 1)
+    return name, first, last, y_advance, result
+
+
+def character_name(code):
+    if chr(code) in "\\'":
+        return "'\\{}'".format(chr(code))
+    return "'{}'".format(chr(code))
+
+
+def compile_font(source, subset):
+    name, first, last, y_advance, glyphs = parse_font(source)
+
+    codes = [c for c in range(first, last + 1)
+             if (subset is None) or (chr(c) in subset) or (c == first)]
+
+    data = bytearray()
+    shared = {}
+    entries = []
+    for code in codes:
+        glyph = glyphs[code - first]
+        encoding, payload = glyph.encode()
+        if payload not in shared:
+            shared[payload] = len(data)
+            data += payload
+        entries.append((code, glyph, encoding, shared[payload]))
+
+    assert len(data) < 65536
+
+    out = dont_edit_banner if name.startswith("Symbols") else ""
+    out += generated_note
+    out += "// Source: {}\n\n".format(os.path.relpath(source, root))
+
+    out += "static const uint8_t {}Data[] = {{\n".format(name)
+    for i in range(0, len(data), 12):
+        out += "  " + ", ".join("0x{:02X}".format(b) for b in data[i:i + 12])
+        out += ",\n" if (i + 12) < len(data) else " };\n\n"
+    if len(data) == 0:
+        out += "  0x00 };\n\n"
+
+    out += "static const packedGlyph_t {}Glyphs[] = {{\n".format(name)
+    for i, (code, glyph, encoding, offset) in enumerate(entries):
+        out += "  {{ {:5d}, {:3d}, {:3d}, {:3d}, {:4d}, {:4d}, {} }}".format(
+            offset, glyph.width, glyph.height, glyph.x_advance,
+            glyph.x_offset, glyph.y_offset, encoding)
+        out += " }; " if i == (len(entries) - 1) else ",   "
+        out += "// 0x{:02X} {}\n".format(code, character_name(code))
+    out += "\n"
+
+    index = "NULL"
+    if len(codes) < (last - first + 1):
+        index = "{}Index".format(name)
+        positions = {code: i for i, code in enumerate(codes)}
+        missing = positions[first]
+        values = [positions.get(c, missing) for c in range(first, last + 1)]
+        out += "static const uint8_t {}[] = {{\n".format(index)
+        for i in range(0, len(values), 12):
+            out += "  " + ", ".join("{:3d}".format(v) for v in values[i:i + 12])
+            out += ",\n" if (i + 12) < len(values) else " };\n\n"
+
+    out += "static const packedFont_t {} = {{\n".format(name)
+    out += "  {}Data,\n".format(name)
+    out += "  {}Glyphs,\n".format(name)
+    out += "  {},\n".format(index)
+    out += "  0x{:02X}, 0x{:02X}, {} }};\n\n".format(first, last, y_advance)
+    out += "// {} glyphs, {} bytes of glyph data\n".format(len(codes), len(data))
+
+    with open(os.path.join(out_dir, os.path.basename(source)), "w") as f:
+        f.write(out)
+
+    return len(data)
+
+
+ui_chars = ui_characters()
+
+for source, subset in fonts:
+    size = compile_font(os.path.join(root, "openrtx/include/fonts", source),
+                        ui_chars if subset == UI else None)
+    print("{:28s} {:6d} bytes".format(source, size))
@@ -0,0 +1,591 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*******************************************************************************
+ *                                                                             *
+ *  Offline M17 decoder: runs the OpenRTX demodulator and frame decoder over   *
+ *  raw or WAV baseband recordings as fast as the CPU allows, one file per     *
+ *  worker thread, and prints the decoded frames as CSV or JSON lines.         *
+ *                                                                             *
+ ******************************************************************************/
+
+#include <protocols/M17/Demodulator.hpp>
+#include <protocols/M17/FrameDecoder.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace M17;
+
+// Baseband samples fed to the demodulator at once, same size of the DMA
+// half-buffer used on the radios.
+static constexpr size_t CHUNK_SIZE = 480;
+static constexpr uint32_t RX_RATE = 24000;
+
+// Anti-alias filter for input above the demodulator rate: taps per output
+// sample and cutoff frequency, below half of the demodulator rate.
+static constexpr size_t AA_TAPS = 32;
+static constexpr double AA_CUTOFF = 10800.0;
+
+enum class OutputFormat { CSV, JSON };
+
+struct Options {
+    uint32_t sampleRate = RX_RATE;
+    OutputFormat format = OutputFormat::CSV;
+    unsigned threads = 0;
+    bool softDecision = false;
+    bool invertPhase = false;
+};
+
+struct Event {
+    uint64_t sample;    // Index of the last sample of the frame, at 24kHz
+    FrameType type;
+    std::string source;
+    std::string destination;
+    uint32_t number;
+    bool flag;          // LSF: CRC valid, stream: last frame, packet: EOF
+    std::string data;   // Hex encoded frame content
+};
+
+struct FileResult {
+    std::string error;
+    std::vector<Event> events;
+    uint64_t samples = 0;
+    uint32_t frames[6] = { 0 };
+    uint32_t badLsf = 0;
+    double seconds = 0.0;
+};
+
+/**
+ * Streaming reader for 16-bit baseband files. WAV files are recognised by
+ * their header, only the first channel is used; anything else is read as raw
+ * native-endian samples. Input above the demodulator rate is low-pass filtered
+ * and decimated down to it.
+ */
+class BasebandReader
+{
+public:
+    BasebandReader(const char *path, const uint32_t rawRate)
+        : file(fopen(path, "rb")), channels(1), sampleRate(rawRate),
+          remaining(UINT64_MAX)
+    {
+    }
+
+    ~BasebandReader()
+    {
+        if (file != nullptr)
+            fclose(file);
+    }
+
+    /**
+     * Open the file and parse the WAV header, if any.
+     *
+     * @param error: error description, set on failure.
+     * @return true on success.
+     */
+    bool open(std::string &error)
+    {
+        if (file == nullptr) {
+            error = strerror(errno);
+            return false;
+        }
+
+        char riff[12];
+        if ((fread(riff, 1, sizeof(riff), file) == sizeof(riff))
+            && (memcmp(riff, "RIFF", 4) == 0)
+            && (memcmp(riff + 8, "WAVE", 4) == 0))
+            return parseWav(error);
+
+        rewind(file);
+        return checkRate(error);
+    }
+
+    /**
+     * Read a block of samples at the demodulator rate.
+     *
+     * @param dest: destination buffer.
+     * @param count: maximum number of samples to read.
+     * @return number of samples read, zero at end of file.
+     */
+    size_t read(int16_t *dest, const size_t count)
+    {
+        size_t frames = std::min<uint64_t>(count * decimation,
+                                           remaining / channels);
+        frames -= frames % decimation;
+
+        raw.resize(frames * channels);
+        size_t got = fread(raw.data(), 2, raw.size(), file);
+        remaining -= got;
+        frames = got / channels;
+
+        if (decimation == 1) {
+            for (size_t i = 0; i < frames; i++)
+                dest[i] = raw[i * channels];
+
+            return frames;
+        }
+
+        // Append the new samples to the filter history and compute the
+        // filter output only for the samples kept by the decimation.
+        const size_t histLen = taps.size() - 1;
+        hist.resize(histLen + frames);
+        for (size_t i = 0; i < frames; i++)
+            hist[histLen + i] = raw[i * channels];
+
+        size_t out = 0;
+        for (size_t i = 0; i + decimation <= frames; i += decimation) {
+            float acc = 0.0f;
+            for (size_t j = 0; j < taps.size(); j++)
+                acc += taps[j] * hist[i + j];
+
+            acc = std::max(std::min(acc, 32767.0f), -32768.0f);
+            dest[out++] = static_cast<int16_t>(std::lrint(acc));
+        }
+
+        hist.erase(hist.begin(), hist.end() - histLen);
+        return out;
+    }
+
+private:
+    bool parseWav(std::string &error)
+    {
+        bool haveFmt = false;
+        uint8_t hdr[8];
+
+        while (fread(hdr, 1, sizeof(hdr), file) == sizeof(hdr)) {
+            uint32_t size = hdr[4] | (hdr[5] << 8) | (hdr[6] << 16)
+                          | (static_cast<uint32_t>(hdr[7]) << 24);
+
+            if (memcmp(hdr, "fmt ", 4) == 0) {
+                uint8_t fmt[16];
+                if ((size < sizeof(fmt))
+                    || (fread(fmt, 1, sizeof(fmt), file) != sizeof(fmt)))
+                    break;
+
+                uint16_t format = fmt[0] | (fmt[1] << 8);
+                uint16_t bits = fmt[14] | (fmt[15] << 8);
+                channels = fmt[2] | (fmt[3] << 8);
+                sampleRate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16)
+                           | (static_cast<uint32_t>(fmt[7]) << 24);
+
+                if ((format != 1) || (bits != 16) || (channels == 0)) {
+                    error = "unsupported WAV format, need 16-bit PCM";
+                    return false;
+                }
+
+                haveFmt = true;
+                fseek(file, (size - sizeof(fmt)) + (size & 1), SEEK_CUR);
+            } else if (memcmp(hdr, "data", 4) == 0) {
+                if (haveFmt == false)
+                    break;
+
+                remaining = size / 2;
+                return checkRate(error);
+            } else {
+                fseek(file, size + (size & 1), SEEK_CUR);
+            }
+        }
+
+        error = "malformed WAV file";
+        return false;
+    }
+
+    bool checkRate(std::string &error)
+    {
+        if ((sampleRate < RX_RATE) || ((sampleRate % RX_RATE) != 0)) {
+            error = "sample rate must be a multiple of 24000Hz";
+            return false;
+        }
+
+        decimation = sampleRate / RX_RATE;
+        if (decimation > 1)
+            designFilter();
+
+        return true;
+    }
+
+    /**
+     * Design the anti-alias low-pass filter, a Blackman windowed sinc.
+     */
+    void designFilter()
+    {
+        const size_t len = (AA_TAPS * decimation) + 1;
+        const double fc = AA_CUTOFF / sampleRate;
+        const double mid = (len - 1) / 2.0;
+        double sum = 0.0;
+
+        std::vector<double> h(len);
+        for (size_t i = 0; i < len; i++) {
+            double t = i - mid;
+            double sinc = (t == 0.0) ? 2.0 * fc
+                                     : std::sin(2.0 * M_PI * fc * t) / (M_PI * t);
+            double w = 0.42 - (0.5 * std::cos(2.0 * M_PI * i / (len - 1)))
+                     + (0.08 * std::cos(4.0 * M_PI * i / (len - 1)));
+            h[i] = sinc * w;
+            sum += h[i];
+        }
+
+        taps.resize(len);
+        for (size_t i = 0; i < len; i++)
+            taps[i] = h[i] / sum;
+
+        hist.assign(len - 1, 0.0f);
+    }
+
+    FILE *file;
+    uint16_t channels;
+    uint32_t sampleRate;
+    uint32_t decimation;
+    uint64_t remaining;
+    std::vector<int16_t> raw;
+    std::vector<float> taps;
+    std::vector<float> hist;
+};
+
+static std::string toHex(const uint8_t *data, const size_t len)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+
+    hex.reserve(2 * len);
+    for (size_t i = 0; i < len; i++) {
+        hex += digits[data[i] >> 4];
+        hex += digits[data[i] & 0x0F];
+    }
+
+    return hex;
+}
+
+static void collectEvent(FileResult &result, FrameDecoder &decoder,
+                         const FrameType type, const uint64_t sample)
+{
+    Event ev;
+    ev.sample = sample;
+    ev.type = type;
+    ev.number = 0;
+    ev.flag = false;
+
+    switch (type) {
+        case FrameType::LINK_SETUP: {
+            LinkSetupFrame lsf = decoder.getLsf();
+            Callsign src = lsf.getSource();
+            Callsign dst = lsf.getDestination();
+            ev.source = static_cast<const char *>(src);
+            ev.destination = static_cast<const char *>(dst);
+            ev.number = lsf.getType().value;
+            ev.flag = lsf.valid();
+            ev.data = toHex(lsf.getData(), sizeof(LinkSetupFrame));
+            if (ev.flag == false)
+                result.badLsf += 1;
+        } break;
+
+        case FrameType::STREAM: {
+            StreamFrame sf = decoder.getStreamFrame();
+            ev.number = sf.getFrameNumber() & 0x7FFF;
+            ev.flag = sf.isLastFrame();
+            ev.data = toHex(sf.data(), sizeof(payload_t));
+        } break;
+
+        case FrameType::PACKET: {
+            const PacketFrame &pf = decoder.getPacketFrame();
+            ev.number = pf.getCounter();
+            ev.flag = pf.isEof();
+            ev.data = toHex(pf.data(), PacketFrame::DATA_SIZE);
+        } break;
+
+        default:
+            break;
+    }
+
+    result.frames[static_cast<uint8_t>(type)] += 1;
+    result.events.push_back(std::move(ev));
+}
+
+static FileResult decodeFile(const char *path, const Options &opts)
+{
+    FileResult result;
+    BasebandReader reader(path, opts.sampleRate);
+    if (reader.open(result.error) == false)
+        return result;
+
+    Demodulator demod;
+    FrameDecoder decoder;
+    int16_t chunk[CHUNK_SIZE];
+
+    demod.init();
+    decoder.reset();
+
+    auto start = std::chrono::steady_clock::now();
+
+    size_t len;
+    while ((len = reader.read(chunk, CHUNK_SIZE)) != 0) {
+        demod.processBlock(chunk, len, opts.invertPhase);
+        result.samples += len;
+
+        // A chunk is shorter than a frame: at most one new frame per chunk
+        if (demod.frameReady() == false)
+            continue;
+
+        FrameType type;
+        if (opts.softDecision)
+            type = decoder.decodeFrame(demod.getSoftFrame());
+        else
+            type = decoder.decodeFrame(demod.getFrame());
+
+        collectEvent(result, decoder, type, result.samples);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    result.seconds = std::chrono::duration<double>(end - start).count();
+
+    return result;
+}
+
+static const char *typeName(const FrameType type)
+{
+    switch (type) {
+        case FrameType::PREAMBLE:
+            return "preamble";
+        case FrameType::LINK_SETUP:
+            return "lsf";
+        case FrameType::STREAM:
+            return "stream";
+        case FrameType::PACKET:
+            return "packet";
+        case FrameType::EOT:
+            return "eot";
+        default:
+            return "unknown";
+    }
+}
+
+static std::string jsonString(const std::string &str)
+{
+    std::string out = "\"";
+
+    for (char c : str) {
+        if ((c == '"') || (c == '\\')) {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            out += esc;
+        } else {
+            out += c;
+        }
+    }
+
+    return out + "\"";
+}
+
+static std::string csvString(const std::string &str)
+{
+    if (str.find_first_of(",\"\n") == std::string::npos)
+        return str;
+
+    std::string out = "\"";
+    for (char c : str) {
+        if (c == '"')
+            out += '"';
+        out += c;
+    }
+
+    return out + "\"";
+}
+
+static void printEvent(const std::string &file, const Event &ev,
+                       const OutputFormat format)
+{
+    double time = static_cast<double>(ev.sample) / RX_RATE;
+
+    if (format == OutputFormat::CSV) {
+        printf("%s,%.4f,%s,%s,%s,%u,%d,%s\n", csvString(file).c_str(), time,
+               typeName(ev.type), csvString(ev.source).c_str(),
+               csvString(ev.destination).c_str(), ev.number, ev.flag ? 1 : 0,
+               ev.data.c_str());
+        return;
+    }
+
+    printf("{\"file\":%s,\"time\":%.4f,\"type\":\"%s\"", jsonString(file).c_str(),
+           time, typeName(ev.type));
+
+    switch (ev.type) {
+        case FrameType::LINK_SETUP:
+            printf(",\"src\":%s,\"dst\":%s,\"stream_type\":%u,\"crc_ok\":%s",
+                   jsonString(ev.source).c_str(),
+                   jsonString(ev.destination).c_str(), ev.number,
+                   ev.flag ? "true" : "false");
+            break;
+        case FrameType::STREAM:
+            printf(",\"frame\":%u,\"last\":%s", ev.number,
+                   ev.flag ? "true" : "false");
+            break;
+        case FrameType::PACKET:
+            printf(",\"counter\":%u,\"eof\":%s", ev.number,
+                   ev.flag ? "true" : "false");
+            break;
+        default:
+            break;
+    }
+
+    if (ev.data.empty() == false)
+        printf(",\"data\":\"%s\"", ev.data.c_str());
+
+    printf("}\n");
+}
+
+static void printStats(const char *name, const FileResult &res)
+{
+    double duration = static_cast<double>(res.samples) / RX_RATE;
+    uint32_t total = 0;
+    for (auto count : res.frames)
+        total += count;
+
+    fprintf(stderr,
+            "%s: %.1fs of baseband, %u frames (lsf %u, bad lsf %u, stream %u, "
+            "packet %u, eot %u, unknown %u) in %.3fs, %.0f frames/s, %.0fx "
+            "realtime\n",
+            name, duration, total,
+            res.frames[static_cast<uint8_t>(FrameType::LINK_SETUP)], res.badLsf,
+            res.frames[static_cast<uint8_t>(FrameType::STREAM)],
+            res.frames[static_cast<uint8_t>(FrameType::PACKET)],
+            res.frames[static_cast<uint8_t>(FrameType::EOT)],
+            res.frames[static_cast<uint8_t>(FrameType::UNKNOWN)], res.seconds,
+            (res.seconds > 0.0) ? total / res.seconds : 0.0,
+            (res.seconds > 0.0) ? duration / res.seconds : 0.0);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options] file...\n"
+            "  -r rate   sample rate of raw input files (default 24000), must\n"
+            "            be a multiple of 24000Hz. WAV files use their own.\n"
+            "  -f fmt    output format: csv (default) or json\n"
+            "  -j N      number of worker threads (default: all cores)\n"
+            "  -s        use soft decision decoding\n"
+            "  -i        invert the baseband phase\n"
+            "  -q        do not print per-file statistics\n",
+            prog);
+}
+
+int main(int argc, char *argv[])
+{
+    Options opts;
+    bool quiet = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:f:j:siqh")) != -1) {
+        switch (opt) {
+            case 'r':
+                opts.sampleRate = strtoul(optarg, nullptr, 10);
+                break;
+            case 'f':
+                if (strcmp(optarg, "csv") == 0) {
+                    opts.format = OutputFormat::CSV;
+                } else if (strcmp(optarg, "json") == 0) {
+                    opts.format = OutputFormat::JSON;
+                } else {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'j':
+                opts.threads = strtoul(optarg, nullptr, 10);
+                break;
+            case 's':
+                opts.softDecision = true;
+                break;
+            case 'i':
+                opts.invertPhase = true;
+                break;
+            case 'q':
+                quiet = true;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const size_t numFiles = argc - optind;
+    char **files = &argv[optind];
+
+    if (opts.threads == 0)
+        opts.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    opts.threads = std::min<size_t>(opts.threads, numFiles);
+
+    // Each worker takes the next pending file, results are printed in input
+    // order once all the files have been decoded.
+    std::vector<FileResult> results(numFiles);
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned i = 0; i < opts.threads; i++) {
+        workers.emplace_back([&]() {
+            size_t idx;
+            while ((idx = next.fetch_add(1)) < numFiles)
+                results[idx] = decodeFile(files[idx], opts);
+        });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    auto end = std::chrono::steady_clock::now();
+    double wall = std::chrono::duration<double>(end - start).count();
+
+    if (opts.format == OutputFormat::CSV)
+        printf("file,time,type,source,destination,number,flag,data\n");
+
+    FileResult total;
+    int ret = 0;
+
+    for (size_t i = 0; i < numFiles; i++) {
+        const FileResult &res = results[i];
+        if (res.error.empty() == false) {
+            fprintf(stderr, "%s: %s\n", files[i], res.error.c_str());
+            ret = 1;
+            continue;
+        }
+
+        for (const auto &ev : res.events)
+            printEvent(files[i], ev, opts.format);
+
+        if (quiet == false)
+            printStats(files[i], res);
+
+        total.samples += res.samples;
+        total.badLsf += res.badLsf;
+        for (size_t j = 0; j < 6; j++)
+            total.frames[j] += res.frames[j];
+    }
+
+    // Overall throughput is measured on wall clock time
+    total.seconds = wall;
+    printStats("total", total);
+
+    return ret;
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ * 
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <array>
+#include "protocols/M17/ConvolutionalEncoder.hpp"
+#include "protocols/M17/FrameEncoder.hpp"
+
+using namespace std;
+using namespace M17;
+
+static default_random_engine rng;
+
+/**
+ * Bit by bit convolutional encoder, as implemented before the introduction of
+ * the lookup tables.
+ */
+class ReferenceEncoder
+{
+public:
+    void encode(const uint8_t *data, uint8_t *convolved, const size_t len)
+    {
+        for (size_t i = 0; i < len; i++) {
+            uint16_t result = convolveByte(data[i]);
+            convolved[2 * i] = result >> 8;
+            convolved[2 * i + 1] = result & 0xFF;
+        }
+    }
+
+    uint16_t convolveByte(uint8_t value)
+    {
+        uint16_t result = 0;
+
+        for (uint8_t i = 0; i < 8; i++) {
+            memory = (memory << 1) | ((value & 0x80) >> 7);
+            memory &= 0x1F;
+            result = (result << 1) | (__builtin_popcount(memory & 0x19) & 0x01);
+            result = (result << 1) | (__builtin_popcount(memory & 0x17) & 0x01);
+            value <<= 1;
+        }
+
+        return result;
+    }
+
+    uint8_t memory = 0;
+};
+
+TEST_CASE("Convolutional encoder matches the bitwise encoder for all states",
+          "[m17][convolutional]")
+{
+    // The encoder state is set by the byte preceding the one under test
+    for (uint16_t prev = 0; prev < 256; prev++) {
+        for (uint16_t value = 0; value < 256; value++) {
+            ConvolutionalEncoder encoder;
+            ReferenceEncoder reference;
+            uint8_t input[2] = { static_cast<uint8_t>(prev),
+                                 static_cast<uint8_t>(value) };
+            uint8_t expected[6];
+            array<uint8_t, 6> encoded;
+
+            reference.encode(input, expected, 2);
+            uint16_t tail = reference.convolveByte(0x00);
+            expected[4] = tail >> 8;
+            expected[5] = tail & 0xFF;
+
+            encoder.reset();
+            encoder.encode(input, encoded.data(), 2);
+            uint16_t flush = encoder.flush();
+            memcpy(&encoded[4], &flush, sizeof(flush));
+
+            INFO("Previous: " << prev << " Value: " << value);
+            REQUIRE(equal(encoded.begin(), encoded.end(), expected));
+        }
+    }
+}
+
+TEST_CASE("Convolutional encoder matches the bitwise encoder on long blocks",
+          "[m17][convolutional]")
+{
+    uniform_int_distribution<uint16_t> rndByte(0, 255);
+    array<uint8_t, 30> data;
+    array<uint8_t, 60> encoded;
+    array<uint8_t, 60> expected;
+    ConvolutionalEncoder encoder;
+
+    for (size_t i = 0; i < 64; i++) {
+        for (auto &byte : data)
+            byte = rndByte(rng);
+
+        ReferenceEncoder reference;
+        reference.encode(data.data(), expected.data(), data.size());
+
+        encoder.reset();
+        encoder.encode(data.data(), encoded.data(), data.size());
+        REQUIRE(encoded == expected);
+        REQUIRE((encoder.flush() & 0xFF) == (reference.convolveByte(0) >> 8));
+    }
+}
+
+TEST_CASE("M17 TX chain throughput", "[m17][convolutional][.][benchmark]")
+{
+    uniform_int_distribution<uint16_t> rndByte(0, 255);
+    FrameEncoder frameEncoder;
+    LinkSetupFrame lsf;
+    PacketFrame packet;
+    payload_t payload;
+    frame_t frame;
+
+    lsf.clear();
+    lsf.setSource("N0CALL");
+    lsf.setDestination("ALL");
+    packet.clear();
+    for (auto &byte : payload)
+        byte = rndByte(rng);
+
+    array<uint8_t, sizeof(StreamFrame)> data;
+    array<uint8_t, 2 * sizeof(StreamFrame)> encoded;
+    for (auto &byte : data)
+        byte = rndByte(rng);
+
+    BENCHMARK("Convolutional encoding, bitwise (stream frame)")
+    {
+        ReferenceEncoder reference;
+        reference.encode(data.data(), encoded.data(), data.size());
+        return encoded[0];
+    };
+
+    BENCHMARK("Convolutional encoding, table driven (stream frame)")
+    {
+        ConvolutionalEncoder encoder;
+        encoder.encode(data.data(), encoded.data(), data.size());
+        return encoded[0];
+    };
+
+    BENCHMARK("Link setup frame encode")
+    {
+        frameEncoder.encodeLsf(lsf, frame);
+        return frame[2];
+    };
+
+    BENCHMARK("Stream frame encode")
+    {
+        frameEncoder.encodeStreamFrame(payload, frame);
+        return frame[2];
+    };
+
+    BENCHMARK("Packet frame encode")
+    {
+        frameEncoder.encodePacketFrame(packet, frame);
+        return frame[2];
+    };
+}
@@ -5,16 +5,24 @@
  */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "protocols/M17/Correlator.hpp"
 #include "protocols/M17/Constants.hpp"
 #include "protocols/M17/Demodulator.hpp"
 #include "protocols/M17/DSP.hpp"
+#include "protocols/M17/FrameDecoder.hpp"
 #include "protocols/M17/Synchronizer.hpp"
 #include "core/fir.hpp"
 
@@ -77,6 +85,33 @@ TEST_CASE("Correlator convolution is proportional to syncword sum for DC signal"
     REQUIRE(conv == EXPECTED);
 }
 
+TEST_CASE("Correlator multi-syncword convolution matches single convolutions",
+          "[m17][demodulator]")
+{
+    static constexpr std::array<int8_t, N> LSF_SYNC = { +3, +3, +3, +3,
+                                                        -3, -3, +3, -3 };
+    static constexpr std::array<int8_t, N> PACKET_SYNC = { +3, -3, +3, +3,
+                                                           -3, -3, -3, -3 };
+    static constexpr std::array<std::array<int8_t, N>, 2> SYNCWORDS = {
+        { LSF_SYNC, PACKET_SYNC }
+    };
+
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int16_t> rndSample(-20000, 20000);
+    Correlator<N, SAMPLES_PER_SYM> corr;
+
+    // Run for more than two times the correlator memory, to cover wrapping
+    for (size_t i = 0; i < 5 * N * SAMPLES_PER_SYM; i++) {
+        corr.sample(rndSample(rng));
+
+        auto conv = corr.convolve(SYNCWORDS);
+        INFO("Sample " << i);
+        REQUIRE(conv[0] == corr.convolve(LSF_SYNC));
+        REQUIRE(conv[1] == corr.convolve(PACKET_SYNC));
+        REQUIRE(-conv[0] == corr.convolve(STREAM_SYNC));
+    }
+}
+
 TEST_CASE(
     "Synchronizer detects M17 stream syncword and returns valid sampling point",
     "[m17][demodulator]")
@@ -289,3 +324,327 @@ TEST_CASE("Demodulator maintains lock across multiple consecutive stream frames"
                                 << " samples after lock)");
     REQUIRE_FALSE(lostLock);
 }
+
+// ---------------------------------------------------------------------------
+// Block processing
+// ---------------------------------------------------------------------------
+
+// Recorded baseband, sampled at 48kHz. Paths are relative to the source root.
+static constexpr const char *TEST_BASEBAND = "tests/unit/assets/M17_test_baseband.raw";
+
+// Number of samples processed by each call to Demodulator::update()
+static constexpr size_t RX_BLOCK_SIZE = M17::FRAME_SYMBOLS * SAMPLES_PER_SYM / 2;
+
+// Load a 48kHz baseband recording, decimating it to the 24kHz demodulator rate.
+static std::vector<int16_t> loadBaseband(const char *path)
+{
+    std::vector<int16_t> samples;
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return samples;
+
+    int16_t buf[2];
+    while (fread(buf, sizeof(int16_t), 2, file) == 2)
+        samples.push_back(buf[0]);
+
+    fclose(file);
+    return samples;
+}
+
+// Lock status and last ready frame, sampled at the end of each RX block
+struct BlockResult {
+    bool locked;
+    M17::frame_t frame;
+
+    bool operator==(const BlockResult &other) const
+    {
+        return (locked == other.locked) && (frame == other.frame);
+    }
+};
+
+static std::vector<BlockResult> runDemodulator(const std::vector<int16_t> &bb,
+                                               bool blockMode)
+{
+    std::vector<BlockResult> results;
+    M17::Demodulator demod;
+    demod.init();
+
+    for (size_t pos = 0; pos < bb.size(); pos += RX_BLOCK_SIZE) {
+        size_t len = std::min(RX_BLOCK_SIZE, bb.size() - pos);
+
+        if (blockMode) {
+            demod.processBlock(&bb[pos], len);
+        } else {
+            for (size_t i = 0; i < len; i++)
+                demod.sample(bb[pos + i]);
+        }
+
+        results.push_back({ demod.isLocked(), demod.getFrame() });
+    }
+
+    return results;
+}
+
+TEST_CASE("Demodulator block processing matches per-sample processing",
+          "[m17][demodulator]")
+{
+    auto baseband = loadBaseband(TEST_BASEBAND);
+    REQUIRE_FALSE(baseband.empty());
+
+    auto perSample = runDemodulator(baseband, false);
+    auto perBlock = runDemodulator(baseband, true);
+
+    REQUIRE(perSample.size() == perBlock.size());
+
+    size_t lockedBlocks = 0;
+    for (size_t i = 0; i < perSample.size(); i++) {
+        INFO("Block " << i);
+        REQUIRE(perSample[i] == perBlock[i]);
+        if (perBlock[i].locked)
+            lockedBlocks++;
+    }
+
+    // Sanity check: the recording actually contains an M17 transmission
+    REQUIRE(lockedBlocks > 0);
+}
+
+// ---------------------------------------------------------------------------
+// Idle gate
+// ---------------------------------------------------------------------------
+
+// Index of the first RX block at the end of which the demodulator is locked
+static size_t firstLockedBlock(const std::vector<int16_t> &bb, float gateLevel)
+{
+    M17::Demodulator demod;
+    demod.init();
+    demod.setIdleGateLevel(gateLevel);
+
+    for (size_t pos = 0; pos < bb.size(); pos += RX_BLOCK_SIZE) {
+        size_t len = std::min(RX_BLOCK_SIZE, bb.size() - pos);
+        demod.processBlock(&bb[pos], len);
+        if (demod.isLocked())
+            return pos / RX_BLOCK_SIZE;
+    }
+
+    return SIZE_MAX;
+}
+
+TEST_CASE("Demodulator idle gate suspends sync search on a quiet channel",
+          "[m17][demodulator]")
+{
+    // One second of low level noise
+    std::default_random_engine rng;
+    std::normal_distribution<float> noise(0.0f, 30.0f);
+    std::vector<int16_t> baseband(24000);
+    for (auto &s : baseband)
+        s = static_cast<int16_t>(noise(rng));
+
+    M17::Demodulator demod;
+    demod.init();
+
+    for (size_t pos = 0; pos < baseband.size(); pos += RX_BLOCK_SIZE)
+        demod.processBlock(&baseband[pos], RX_BLOCK_SIZE);
+
+    // Only the blocks covering the initialisation time are not gated
+    REQUIRE(demod.processedBlocks() > 0);
+    REQUIRE(demod.gatedBlocks() >= demod.processedBlocks() - 16);
+    REQUIRE_FALSE(demod.isLocked());
+
+    // With the gate disabled, no block is gated
+    M17::Demodulator ungated;
+    ungated.init();
+    ungated.setIdleGateLevel(0.0f);
+
+    for (size_t pos = 0; pos < baseband.size(); pos += RX_BLOCK_SIZE)
+        ungated.processBlock(&baseband[pos], RX_BLOCK_SIZE);
+
+    REQUIRE(ungated.gatedBlocks() == 0);
+}
+
+TEST_CASE("Demodulator idle gate does not delay lock on a real transmission",
+          "[m17][demodulator]")
+{
+    auto baseband = loadBaseband(TEST_BASEBAND);
+    REQUIRE_FALSE(baseband.empty());
+
+    size_t gated = firstLockedBlock(baseband, 256.0f);
+    size_t ungated = firstLockedBlock(baseband, 0.0f);
+
+    REQUIRE(gated != SIZE_MAX);
+    REQUIRE(gated == ungated);
+}
+
+// ---------------------------------------------------------------------------
+// Soft decision decoding
+// ---------------------------------------------------------------------------
+
+using stream_data_t = std::array<uint8_t, sizeof(M17::StreamFrame)>;
+
+// Add white gaussian noise to a baseband signal, saturating to int16_t range
+static std::vector<int16_t> addNoise(const std::vector<int16_t> &bb,
+                                     float sigma)
+{
+    std::default_random_engine rng;
+    std::normal_distribution<float> noise(0.0f, sigma);
+    std::vector<int16_t> out(bb.size());
+
+    for (size_t i = 0; i < bb.size(); i++) {
+        float value = static_cast<float>(bb[i]) + noise(rng);
+        value = std::min(value, 32767.0f);
+        value = std::max(value, -32768.0f);
+        out[i] = static_cast<int16_t>(value);
+    }
+
+    return out;
+}
+
+// Decode a baseband signal, collecting the distinct stream frames obtained
+static std::set<stream_data_t>
+decodeStreamFrames(const std::vector<int16_t> &bb, bool softDecision)
+{
+    std::set<stream_data_t> frames;
+    M17::Demodulator demod;
+    M17::FrameDecoder decoder;
+    M17::frame_t lastFrame = {};
+
+    demod.init();
+    decoder.reset();
+
+    for (size_t pos = 0; pos < bb.size(); pos += RX_BLOCK_SIZE) {
+        size_t len = std::min(RX_BLOCK_SIZE, bb.size() - pos);
+        demod.processBlock(&bb[pos], len);
+
+        // Frames are double buffered, a new one is ready when the content
+        // of the hard decision buffer changes.
+        const M17::frame_t &frame = demod.getFrame();
+        if (frame == lastFrame)
+            continue;
+
+        lastFrame = frame;
+
+        M17::FrameType type;
+        if (softDecision)
+            type = decoder.decodeFrame(demod.getSoftFrame());
+        else
+            type = decoder.decodeFrame(frame);
+
+        if (type == M17::FrameType::STREAM) {
+            stream_data_t data;
+            memcpy(data.data(), &decoder.getStreamFrame(), data.size());
+            frames.insert(data);
+        }
+    }
+
+    return frames;
+}
+
+// Number of frames in a set which are also present in the reference one
+static size_t countCorrect(const std::set<stream_data_t> &frames,
+                           const std::set<stream_data_t> &reference)
+{
+    size_t count = 0;
+    for (auto &frame : frames) {
+        if (reference.count(frame) != 0)
+            count++;
+    }
+
+    return count;
+}
+
+TEST_CASE("Soft decision decoding recovers more frames on a noisy baseband",
+          "[m17][demodulator]")
+{
+    auto baseband = loadBaseband(TEST_BASEBAND);
+    REQUIRE_FALSE(baseband.empty());
+
+    // Without noise both paths decode the same stream frames
+    auto reference = decodeStreamFrames(baseband, false);
+    auto softClean = decodeStreamFrames(baseband, true);
+    REQUIRE(reference.size() > 0);
+    REQUIRE(countCorrect(softClean, reference) == reference.size());
+
+    // With noise the soft decision path loses fewer frames
+    auto noisy = addNoise(baseband, 2500.0f);
+    size_t hard = countCorrect(decodeStreamFrames(noisy, false), reference);
+    size_t soft = countCorrect(decodeStreamFrames(noisy, true), reference);
+
+    INFO("Hard decision: " << hard << "/" << reference.size());
+    INFO("Soft decision: " << soft << "/" << reference.size());
+    REQUIRE(soft > hard);
+}
+
+TEST_CASE("Demodulator throughput on recorded baseband",
+          "[m17][demodulator][.][benchmark]")
+{
+    auto baseband = loadBaseband(TEST_BASEBAND);
+    REQUIRE_FALSE(baseband.empty());
+
+    M17::Demodulator demod;
+    demod.init();
+
+    std::string suffix = " (" + std::to_string(baseband.size()) + " samples)";
+
+    BENCHMARK("Demodulator::sample()" + suffix)
+    {
+        for (auto s : baseband)
+            demod.sample(s);
+
+        return demod.isLocked();
+    };
+
+    BENCHMARK("Demodulator::processBlock()" + suffix)
+    {
+        for (size_t pos = 0; pos < baseband.size(); pos += RX_BLOCK_SIZE) {
+            size_t len = std::min(RX_BLOCK_SIZE, baseband.size() - pos);
+            demod.processBlock(&baseband[pos], len);
+        }
+
+        return demod.isLocked();
+    };
+}
+
+TEST_CASE("Frame decoder throughput with hard and soft decisions",
+          "[m17][demodulator][.][benchmark]")
+{
+    auto baseband = addNoise(loadBaseband(TEST_BASEBAND), 2000.0f);
+    REQUIRE_FALSE(baseband.empty());
+
+    // Collect one second of demodulated frames
+    std::vector<M17::frame_t> frames;
+    std::vector<M17::soft_frame_t> softFrames;
+    M17::Demodulator demod;
+    demod.init();
+
+    for (size_t pos = 0; pos < baseband.size() && frames.size() < 25;
+         pos += RX_BLOCK_SIZE) {
+        size_t len = std::min(RX_BLOCK_SIZE, baseband.size() - pos);
+        demod.processBlock(&baseband[pos], len);
+
+        if (demod.isLocked() && (frames.empty()
+                                 || (frames.back() != demod.getFrame()))) {
+            frames.push_back(demod.getFrame());
+            softFrames.push_back(demod.getSoftFrame());
+        }
+    }
+
+    REQUIRE(frames.size() == 25);
+
+    M17::FrameDecoder decoder;
+    decoder.reset();
+
+    BENCHMARK("FrameDecoder, hard decision (25 frames)")
+    {
+        for (auto &frame : frames)
+            decoder.decodeFrame(frame);
+
+        return decoder.getStreamFrame().data()[0];
+    };
+
+    BENCHMARK("FrameDecoder, soft decision (25 frames)")
+    {
+        for (auto &frame : softFrames)
+            decoder.decodeFrame(frame);
+
+        return decoder.getStreamFrame().data()[0];
+    };
+}
@@ -0,0 +1,373 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ * 
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <array>
+#include "protocols/M17/FrameMapping.hpp"
+#include "protocols/M17/FrameEncoder.hpp"
+#include "protocols/M17/FrameDecoder.hpp"
+#include "protocols/M17/Viterbi.hpp"
+#include "protocols/M17/Utils.hpp"
+
+using namespace std;
+using namespace M17;
+
+static default_random_engine rng;
+
+template <size_t N> static void randomize(array<uint8_t, N> &data)
+{
+    uniform_int_distribution<uint16_t> rndByte(0, 255);
+    for (auto &byte : data)
+        byte = rndByte(rng);
+}
+
+template <size_t N> static void randomize(array<uint16_t, N> &data)
+{
+    uniform_int_distribution<uint16_t> rndSoft(0, 0xFFFF);
+    for (auto &value : data)
+        value = rndSoft(rng);
+}
+
+/**
+ * Interleaving computing the permutation polynomial on each bit, as done
+ * before the introduction of the permutation tables.
+ */
+template <size_t N> static void refInterleave(array<uint8_t, N> &data)
+{
+    array<uint8_t, N> interleaved;
+
+    for (size_t i = 0; i < N * 8; i++) {
+        size_t index = ((45 * i) + (92 * i * i)) % (N * 8);
+        setBit(interleaved, index, getBit(data, i));
+    }
+
+    data = interleaved;
+}
+
+template <size_t N> static void refDeinterleave(array<uint8_t, N> &data)
+{
+    array<uint8_t, N> deinterleaved;
+
+    for (size_t i = 0; i < N * 8; i++) {
+        size_t index = ((45 * i) + (92 * i * i)) % (N * 8);
+        setBit(deinterleaved, i, getBit(data, index));
+    }
+
+    data = deinterleaved;
+}
+
+template <size_t N> static void refDeinterleave(array<uint16_t, N> &data)
+{
+    array<uint16_t, N> deinterleaved;
+
+    for (size_t i = 0; i < N; i++)
+        deinterleaved[i] = data[((45 * i) + (92 * i * i)) % N];
+
+    data = deinterleaved;
+}
+
+/**
+ * Payload of a received frame, decorrelated and deinterleaved.
+ */
+static array<uint8_t, 46> refPayload(const frame_t &frame)
+{
+    array<uint8_t, 46> data;
+
+    copy(frame.begin() + 2, frame.end(), data.begin());
+    decorrelate(data);
+    refDeinterleave(data);
+
+    return data;
+}
+
+static array<uint16_t, 368> refPayload(const soft_frame_t &frame)
+{
+    array<uint16_t, 368> data;
+
+    copy(frame.begin() + 16, frame.end(), data.begin());
+    decorrelate(data);
+    refDeinterleave(data);
+
+    return data;
+}
+
+/**
+ * Build a frame payload with the puncture, interleave and decorrelate chain.
+ */
+template <size_t N, size_t P>
+static array<uint8_t, 46> refTxPayload(const array<uint8_t, N> &encoded,
+                                       const array<uint8_t, P> &matrix)
+{
+    array<uint8_t, 46> payload;
+
+    puncture(encoded, payload, matrix);
+    refInterleave(payload);
+    decorrelate(payload);
+
+    return payload;
+}
+
+/**
+ * Check a receive bit map against the depuncturing of the deinterleaved and
+ * decorrelated payload.
+ */
+template <size_t S, size_t P>
+static void checkRxMap(const frame_t &frame, const array<uint16_t, S> &map,
+                       const array<uint8_t, P> &matrix, const size_t offset)
+{
+    auto payload = refPayload(frame);
+    size_t index = offset;
+    size_t punctIndex = 0;
+
+    for (size_t i = 0; i < S; i++) {
+        INFO("Symbol: " << i);
+        if (matrix[punctIndex] && index < 368) {
+            REQUIRE(map[i] != MAP_PUNCTURED);
+            REQUIRE(getMappedBit(frame, map[i]) == getBit(payload, index));
+            index++;
+        } else {
+            REQUIRE(map[i] == MAP_PUNCTURED);
+        }
+
+        punctIndex = (punctIndex + 1) % P;
+    }
+
+    REQUIRE(index == 368);
+}
+
+TEST_CASE("Interleaver tables match the permutation polynomial",
+          "[m17][framemapping]")
+{
+    for (size_t i = 0; i < 16; i++) {
+        array<uint8_t, 46> data;
+        randomize(data);
+
+        auto ref = data;
+        auto test = data;
+        refInterleave(ref);
+        interleave(test);
+        REQUIRE(test == ref);
+
+        refDeinterleave(ref);
+        deinterleave(test);
+        REQUIRE(test == ref);
+        REQUIRE(test == data);
+
+        array<uint16_t, 368> soft;
+        randomize(soft);
+
+        auto softRef = soft;
+        refDeinterleave(softRef);
+        deinterleave(soft);
+        REQUIRE(soft == softRef);
+    }
+}
+
+TEST_CASE("Transmit bit maps match puncture, interleave and decorrelate",
+          "[m17][framemapping]")
+{
+    frame_t frame;
+
+    for (size_t i = 0; i < 16; i++) {
+        array<uint8_t, 61> lsf;
+        randomize(lsf);
+        mapFrame(lsf, LSF_TX_MAP, frame);
+        REQUIRE(equal(frame.begin() + 2, frame.end(),
+                      refTxPayload(lsf, LSF_PUNCTURE).begin()));
+
+        array<uint8_t, 53> packet;
+        randomize(packet);
+        mapFrame(packet, PACKET_TX_MAP, frame);
+        REQUIRE(equal(frame.begin() + 2, frame.end(),
+                      refTxPayload(packet, PACKET_PUNCTURE).begin()));
+
+        // LICH segment followed by the encoded stream data
+        array<uint8_t, 49> stream;
+        array<uint8_t, 37> encoded;
+        array<uint8_t, 46> payload;
+        randomize(stream);
+        copy(stream.begin() + 12, stream.end(), encoded.begin());
+        copy(stream.begin(), stream.begin() + 12, payload.begin());
+
+        array<uint8_t, 34> punctured;
+        puncture(encoded, punctured, DATA_PUNCTURE);
+        copy(punctured.begin(), punctured.end(), payload.begin() + 12);
+        refInterleave(payload);
+        decorrelate(payload);
+
+        mapFrame(stream, STREAM_TX_MAP, frame);
+        REQUIRE(equal(frame.begin() + 2, frame.end(), payload.begin()));
+    }
+}
+
+TEST_CASE("Receive bit maps match decorrelate, deinterleave and depuncture",
+          "[m17][framemapping]")
+{
+    REQUIRE(LSF_RX_MAP.size() == 488);
+    REQUIRE(STREAM_RX_MAP.size() == 296);
+    REQUIRE(PACKET_RX_MAP.size() == 420);
+
+    for (size_t i = 0; i < 16; i++) {
+        frame_t frame;
+        randomize(frame);
+
+        checkRxMap(frame, LSF_RX_MAP, LSF_PUNCTURE, 0);
+        checkRxMap(frame, STREAM_RX_MAP, DATA_PUNCTURE, 96);
+        checkRxMap(frame, PACKET_RX_MAP, PACKET_PUNCTURE, 0);
+
+        auto payload = refPayload(frame);
+        for (size_t j = 0; j < LICH_RX_MAP.size(); j++)
+            REQUIRE(getMappedBit(frame, LICH_RX_MAP[j]) == getBit(payload, j));
+
+        soft_frame_t soft;
+        randomize(soft);
+
+        auto softPayload = refPayload(soft);
+        for (size_t j = 0; j < LICH_RX_MAP.size(); j++)
+            REQUIRE(getMappedBit(soft, LICH_RX_MAP[j]) == softPayload[j]);
+    }
+}
+
+TEST_CASE("Mapped Viterbi decoding matches punctured decoding",
+          "[m17][framemapping]")
+{
+    HardViterbi hard;
+    SoftViterbi soft;
+
+    for (size_t i = 0; i < 16; i++) {
+        frame_t frame;
+        randomize(frame);
+        auto payload = refPayload(frame);
+
+        array<uint8_t, 30> lsf, lsfRef;
+        uint16_t errs = hard.decodeMapped(frame, lsf, LSF_RX_MAP);
+        REQUIRE(errs == hard.decodePunctured(payload, lsfRef, LSF_PUNCTURE));
+        REQUIRE(lsf == lsfRef);
+
+        array<uint8_t, 34> punctured;
+        copy(payload.begin() + 12, payload.end(), punctured.begin());
+
+        array<uint8_t, 18> stream, streamRef;
+        errs = hard.decodeMapped(frame, stream, STREAM_RX_MAP);
+        REQUIRE(errs
+                == hard.decodePunctured(punctured, streamRef, DATA_PUNCTURE));
+        REQUIRE(stream == streamRef);
+
+        soft_frame_t softFrame;
+        randomize(softFrame);
+        auto softPayload = refPayload(softFrame);
+
+        errs = soft.decodeMapped(softFrame, lsf, LSF_RX_MAP);
+        REQUIRE(errs
+                == soft.decodePunctured(softPayload, lsfRef, LSF_PUNCTURE));
+        REQUIRE(lsf == lsfRef);
+
+        array<uint8_t, 26> packet, packetRef;
+        errs = soft.decodeMapped(softFrame, packet, PACKET_RX_MAP);
+        REQUIRE(errs
+                == soft.decodePunctured(softPayload, packetRef,
+                                        PACKET_PUNCTURE));
+        REQUIRE(packet == packetRef);
+    }
+}
+
+TEST_CASE("Stream frames survive an encode and decode round trip",
+          "[m17][framemapping]")
+{
+    FrameEncoder encoder;
+    FrameDecoder decoder;
+    LinkSetupFrame lsf;
+    frame_t frame;
+    soft_frame_t softFrame;
+
+    lsf.clear();
+    lsf.setSource("N0CALL");
+    lsf.setDestination("ALL");
+    encoder.encodeLsf(lsf, frame);
+    REQUIRE(decoder.decodeFrame(frame) == FrameType::LINK_SETUP);
+
+    LinkSetupFrame decodedLsf = decoder.getLsf();
+    REQUIRE(memcmp(decodedLsf.getData(), lsf.getData(), sizeof(lsf)) == 0);
+
+    decoder.reset();
+    for (size_t i = 0; i < 6; i++) {
+        payload_t payload;
+        randomize(payload);
+        encoder.encodeStreamFrame(payload, frame);
+
+        for (size_t j = 0; j < softFrame.size(); j++)
+            softFrame[j] = getBit(frame, j) ? 0xC000 : 0x4000;
+
+        REQUIRE(decoder.decodeFrame(frame) == FrameType::STREAM);
+        StreamFrame hardDecoded = decoder.getStreamFrame();
+        REQUIRE(decoder.decodeFrame(softFrame) == FrameType::STREAM);
+        StreamFrame softDecoded = decoder.getStreamFrame();
+
+        REQUIRE(hardDecoded.getFrameNumber() == i);
+        REQUIRE(softDecoded.getFrameNumber() == i);
+        REQUIRE(memcmp(hardDecoded.data(), payload.data(), payload.size())
+                == 0);
+        REQUIRE(memcmp(softDecoded.data(), payload.data(), payload.size())
+                == 0);
+    }
+
+    // Link setup data reassembled from the six LICH segments
+    decodedLsf = decoder.getLsf();
+    REQUIRE(memcmp(decodedLsf.getData(), lsf.getData(), sizeof(lsf)) == 0);
+}
+
+TEST_CASE("Frame mapping throughput", "[m17][framemapping][.][benchmark]")
+{
+    FrameEncoder encoder;
+    FrameDecoder decoder;
+    HardViterbi viterbi;
+    LinkSetupFrame lsf;
+    payload_t payload;
+    frame_t frame;
+    soft_frame_t softFrame;
+
+    lsf.clear();
+    encoder.encodeLsf(lsf, frame);
+    randomize(payload);
+    encoder.encodeStreamFrame(payload, frame);
+    for (size_t i = 0; i < softFrame.size(); i++)
+        softFrame[i] = getBit(frame, i) ? 0xC000 : 0x4000;
+
+    BENCHMARK("Stream frame encode")
+    {
+        encoder.encodeStreamFrame(payload, frame);
+        return frame[2];
+    };
+
+    BENCHMARK("Stream frame decode, hard decision")
+    {
+        return decoder.decodeFrame(frame);
+    };
+
+    BENCHMARK("Stream frame decode, soft decision")
+    {
+        return decoder.decodeFrame(softFrame);
+    };
+
+    array<uint8_t, 18> stream;
+
+    BENCHMARK("Stream data, separate deinterleave and depuncture")
+    {
+        auto payload = refPayload(frame);
+        array<uint8_t, 34> punctured;
+        copy(payload.begin() + 12, payload.end(), punctured.begin());
+        return viterbi.decodePunctured(punctured, stream, DATA_PUNCTURE);
+    };
+
+    BENCHMARK("Stream data, mapped decoding")
+    {
+        return viterbi.decodeMapped(frame, stream, STREAM_RX_MAP);
+    };
+}
@@ -5,8 +5,10 @@
  */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <cstdint>
 #include <random>
+#include <vector>
 #include "protocols/M17/Golay.hpp"
 
 using namespace std;
@@ -109,3 +111,135 @@ TEST_CASE("Golay24 with 4+ bit errors returns 0xFFFF or incorrect correction",
         CHECK((decoded == 0xFFFF || decoded != value || decoded == value));
     }
 }
+
+// ---------------------------------------------------------------------------
+// Regression against the original syndrome search algorithm
+// ---------------------------------------------------------------------------
+
+static constexpr uint16_t ENCODE_MATRIX[12] = { 0x8eb, 0x93e, 0xa97, 0xdc6,
+                                                0x367, 0x6cd, 0xd99, 0x3da,
+                                                0x7b4, 0xf68, 0x63b, 0xc75 };
+
+static constexpr uint16_t DECODE_MATRIX[12] = { 0xc75, 0x49f, 0x93e, 0x6e3,
+                                                0xdc6, 0xf13, 0xab9, 0x1ed,
+                                                0x3da, 0x7b4, 0xf68, 0xa4f };
+
+static uint16_t referenceProduct(uint16_t value, const uint16_t (&matrix)[12])
+{
+    uint16_t result = 0;
+    for (uint8_t i = 0; i < 12; i++) {
+        if (value & (1 << i))
+            result ^= matrix[i];
+    }
+
+    return result;
+}
+
+/**
+ * Error detection by syndrome search, as done before the introduction of the
+ * syndrome lookup table.
+ */
+static uint32_t referenceDetectErrors(uint32_t codeword)
+{
+    uint16_t data = codeword >> 12;
+    uint16_t parity = codeword & 0xFFF;
+    uint16_t syndrome = parity ^ referenceProduct(data, ENCODE_MATRIX);
+
+    if (__builtin_popcount(syndrome) <= 3)
+        return syndrome;
+
+    for (uint8_t i = 0; i < 12; i++) {
+        uint16_t e = 1 << i;
+        uint16_t coded_error = ENCODE_MATRIX[i];
+        if (__builtin_popcount(syndrome ^ coded_error) <= 2)
+            return (e << 12) | (syndrome ^ coded_error);
+    }
+
+    uint16_t inv_syndrome = referenceProduct(syndrome, DECODE_MATRIX);
+    if (__builtin_popcount(inv_syndrome) <= 3)
+        return inv_syndrome << 12;
+
+    for (uint8_t i = 0; i < 12; i++) {
+        uint16_t e = 1 << i;
+        uint16_t coding_error = DECODE_MATRIX[i];
+        if (__builtin_popcount(inv_syndrome ^ coding_error) <= 2)
+            return ((inv_syndrome ^ coding_error) << 12) | e;
+    }
+
+    return 0xFFFFFFFF;
+}
+
+TEST_CASE("Golay24 checksum matches the encoding matrix", "[m17][golay]")
+{
+    for (uint16_t value = 0; value < 4096; value++) {
+        INFO("Value: " << value);
+        REQUIRE(M17::Golay24::calcChecksum(value)
+                == referenceProduct(value, ENCODE_MATRIX));
+    }
+}
+
+TEST_CASE("Golay24 error detection matches syndrome search for all syndromes",
+          "[m17][golay]")
+{
+    // With zero data the syndrome is equal to the parity bits
+    for (uint32_t syndrome = 0; syndrome < 4096; syndrome++) {
+        INFO("Syndrome: " << syndrome);
+        REQUIRE(M17::Golay24::detectErrors(syndrome)
+                == referenceDetectErrors(syndrome));
+    }
+}
+
+TEST_CASE("Golay24 corrects all error patterns up to three bits",
+          "[m17][golay]")
+{
+    uniform_int_distribution<uint16_t> rndValue(0, 4095);
+    size_t numPatterns = 0;
+
+    for (uint32_t emask = 0; emask < (1 << 24); emask++) {
+        if (__builtin_popcount(emask) > 3)
+            continue;
+
+        uint16_t value = rndValue(rng);
+        uint32_t cword = M17::golay24_encode(value) ^ emask;
+
+        INFO("Value: " << value << " Error mask: " << emask);
+        REQUIRE(M17::Golay24::detectErrors(cword) == emask);
+        REQUIRE(M17::Golay24::detectErrors(cword)
+                == referenceDetectErrors(cword));
+        REQUIRE(M17::golay24_decode(cword) == value);
+        numPatterns++;
+    }
+
+    // 1 + 24 + 276 + 2024 patterns
+    REQUIRE(numPatterns == 2325);
+}
+
+TEST_CASE("Golay24 decode throughput", "[m17][golay][.][benchmark]")
+{
+    uniform_int_distribution<uint16_t> rndValue(0, 4095);
+    vector<uint32_t> valid(1024);
+    vector<uint32_t> corrupted(1024);
+
+    for (size_t i = 0; i < valid.size(); i++) {
+        valid[i] = M17::golay24_encode(rndValue(rng));
+        corrupted[i] = valid[i] ^ generateErrorMask(3);
+    }
+
+    BENCHMARK("golay24_decode, no errors (1024 codewords)")
+    {
+        uint32_t acc = 0;
+        for (auto cword : valid)
+            acc += M17::golay24_decode(cword);
+
+        return acc;
+    };
+
+    BENCHMARK("golay24_decode, three errors (1024 codewords)")
+    {
+        uint32_t acc = 0;
+        for (auto cword : corrupted)
+            acc += M17::golay24_decode(cword);
+
+        return acc;
+    };
+}
@@ -0,0 +1,383 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "protocols/M17/JitterBuffer.hpp"
+
+using namespace M17;
+
+static constexpr uint32_t START_TIME = 1000;
+static constexpr int CONCEALED = -1;
+
+struct Arrival {
+    uint16_t frameNum;
+    uint32_t time;
+};
+
+/**
+ * Get the energy index of a codec2 3200 bit/s frame, stored Gray coded.
+ */
+static uint8_t energy(const uint8_t *frame)
+{
+    uint8_t index = (frame[1] >> 2) & 0x1F;
+
+    for (uint8_t shift = 1; shift < 5; shift++)
+        index ^= (frame[1] >> (2 + shift)) & (0x1F >> shift);
+
+    return index;
+}
+
+/**
+ * Set the energy index of a codec2 3200 bit/s frame.
+ */
+static void setEnergy(uint8_t *frame, const uint8_t index)
+{
+    uint8_t gray = index ^ (index >> 1);
+    frame[1] = (frame[1] & 0x83) | (gray << 2);
+}
+
+/**
+ * Build a stream frame payload identifying the frame. The two codec2 frames
+ * differ in the first byte and have the maximum energy.
+ */
+static void makePayload(uint8_t *payload, const uint16_t frameNum)
+{
+    for (size_t i = 0; i < 16; i++)
+        payload[i] = 0x55;
+
+    payload[0] = frameNum & 0xFF;
+    payload[8] = (frameNum & 0xFF) ^ 0x80;
+    setEnergy(&payload[0], 31);
+    setEnergy(&payload[8], 31);
+}
+
+/**
+ * Regular arrivals, one frame every 40ms starting from a given frame number.
+ */
+static std::vector<Arrival> regularArrivals(const uint16_t first,
+                                            const size_t count,
+                                            const uint32_t offset)
+{
+    std::vector<Arrival> arrivals;
+
+    for (size_t i = 0; i < count; i++) {
+        uint16_t num = (first + i) & 0x7FFF;
+        uint32_t time = START_TIME + offset + (i * JitterBuffer::FRAME_TIME);
+        arrivals.push_back({ num, time });
+    }
+
+    return arrivals;
+}
+
+/**
+ * Run the playout of the jitter buffer every 40ms, pushing the frames as
+ * they arrive. Returns the low byte of the frame number played at each
+ * playout, CONCEALED for a concealed frame.
+ */
+static std::vector<int> playout(JitterBuffer &jb,
+                                std::vector<Arrival> arrivals,
+                                const size_t ticks,
+                                const uint32_t start = START_TIME)
+{
+    std::stable_sort(arrivals.begin(), arrivals.end(),
+                     [](const Arrival &a, const Arrival &b) {
+                         return a.time < b.time;
+                     });
+
+    std::vector<int> played;
+    size_t next = 0;
+
+    for (size_t tick = 0; tick < ticks; tick++) {
+        uint32_t now = start + (tick * JitterBuffer::FRAME_TIME);
+        uint8_t payload[16];
+
+        while ((next < arrivals.size()) && (arrivals[next].time <= now)) {
+            makePayload(payload, arrivals[next].frameNum);
+            jb.push(arrivals[next].frameNum, payload, arrivals[next].time);
+            next++;
+        }
+
+        if (jb.pop(payload, now, 0) == false)
+            continue;
+
+        if ((payload[0] ^ payload[8]) == 0x80)
+            played.push_back(payload[0]);
+        else
+            played.push_back(CONCEALED);
+    }
+
+    return played;
+}
+
+/**
+ * Remove the concealed frames from a playout sequence.
+ */
+static std::vector<int> framesOnly(const std::vector<int> &played)
+{
+    std::vector<int> frames;
+
+    for (int frame : played) {
+        if (frame != CONCEALED)
+            frames.push_back(frame);
+    }
+
+    return frames;
+}
+
+/**
+ * Expected sequence of frame numbers, low byte only.
+ */
+static std::vector<int> sequence(const uint16_t first, const size_t count)
+{
+    std::vector<int> frames;
+
+    for (size_t i = 0; i < count; i++)
+        frames.push_back((first + i) & 0xFF);
+
+    return frames;
+}
+
+TEST_CASE("Frames received in order are played in order", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+
+    auto played = playout(jb, regularArrivals(0, 100, 5), 100);
+    jb.getStats(stats);
+
+    REQUIRE(framesOnly(played) == sequence(0, 99));
+    REQUIRE(stats.received == 99);
+    REQUIRE(stats.played == 99);
+    REQUIRE(stats.concealed == 0);
+    REQUIRE(stats.jitter == 0);
+    REQUIRE(stats.target == JitterBuffer::MIN_DEPTH);
+
+    // Each frame waits 35ms in the buffer after a frame time on air
+    REQUIRE(stats.latencyMin == 75);
+    REQUIRE(stats.latencyMax == 75);
+    REQUIRE(stats.latencyAvg == 75);
+}
+
+TEST_CASE("Late frames stretch the playout", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+
+    // Frame 10 arrives after frame 11, too late for its playout time
+    auto arrivals = regularArrivals(0, 40, 5);
+    arrivals[10].time += 50;
+
+    auto played = playout(jb, arrivals, 42);
+    jb.getStats(stats);
+
+    REQUIRE(framesOnly(played) == sequence(0, 40));
+    REQUIRE(stats.concealed == 1);
+    REQUIRE(stats.underruns == 1);
+    REQUIRE(stats.late == 0);
+    REQUIRE(stats.latencyMax == 115);
+}
+
+TEST_CASE("Frames received after their playout are discarded", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+    uint8_t payload[16];
+
+    makePayload(payload, 0);
+    REQUIRE(jb.push(0, payload, 0));
+    REQUIRE(jb.push(0, payload, 1) == false);
+
+    makePayload(payload, 1);
+    REQUIRE(jb.push(1, payload, 40));
+    REQUIRE(jb.pop(payload, 40, 0));
+    REQUIRE(jb.pop(payload, 80, 0));
+
+    makePayload(payload, 0);
+    REQUIRE(jb.push(0, payload, 100) == false);
+
+    jb.getStats(stats);
+    REQUIRE(stats.duplicates == 1);
+    REQUIRE(stats.late == 1);
+    REQUIRE(stats.received == 2);
+}
+
+TEST_CASE("Missing frames are concealed and faded out", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+
+    // Frame 20 is lost, frames 30 to 39 are lost
+    auto arrivals = regularArrivals(0, 60, 5);
+    arrivals.erase(arrivals.begin() + 30, arrivals.begin() + 40);
+    arrivals.erase(arrivals.begin() + 20);
+
+    auto played = playout(jb, arrivals, 61);
+    jb.getStats(stats);
+
+    auto expected = sequence(0, 60);
+    expected.erase(expected.begin() + 30, expected.begin() + 40);
+    expected.erase(expected.begin() + 20);
+
+    REQUIRE(framesOnly(played) == expected);
+    REQUIRE(stats.played == 49);
+    REQUIRE(stats.concealed == 11);
+    REQUIRE(stats.late == 0);
+
+    // The playout resumes without extra latency after the losses
+    REQUIRE(stats.latencyMax == 75);
+
+    // Concealment payloads repeat the last codec2 frame received, lowering
+    // its energy after the first 40ms.
+    JitterBuffer plc;
+    uint8_t last[16];
+    uint8_t payload[16];
+
+    makePayload(last, 0);
+    REQUIRE(plc.push(0, last, 0));
+    REQUIRE(plc.pop(payload, 40, 0));
+
+    uint8_t prevEnergy = energy(&last[8]);
+    for (int i = 0; i < 10; i++) {
+        REQUIRE(plc.pop(payload, 80 + (40 * i), 0));
+
+        for (size_t half = 0; half < 2; half++) {
+            const uint8_t *frame = &payload[8 * half];
+            REQUIRE(frame[0] == last[8]);
+            REQUIRE(std::equal(&frame[2], &frame[8], &last[10]));
+
+            if (i == 0)
+                REQUIRE(energy(frame) == energy(&last[8]));
+            else if (prevEnergy > 0)
+                REQUIRE(energy(frame) < prevEnergy);
+            else
+                REQUIRE(energy(frame) == 0);
+
+            prevEnergy = energy(frame);
+        }
+    }
+
+    REQUIRE(prevEnergy == 0);
+    plc.getStats(stats);
+    REQUIRE(stats.concealed == 10);
+    REQUIRE(stats.underruns == 10);
+}
+
+TEST_CASE("Concealment fades out every energy index", "[m17][jitter]")
+{
+    // The energy index is Gray coded: fading the raw field would make some
+    // frames louder, as index 16 (raw 24) going to index 24 (raw 20).
+    for (uint8_t start = 0; start < 32; start++) {
+        JitterBuffer plc;
+        uint8_t last[16];
+        uint8_t payload[16];
+
+        makePayload(last, 0);
+        setEnergy(&last[8], start);
+        REQUIRE(plc.push(0, last, 0));
+        REQUIRE(plc.pop(payload, 40, 0));
+
+        uint8_t prevEnergy = start;
+        for (int i = 0; i < 10; i++) {
+            REQUIRE(plc.pop(payload, 80 + (40 * i), 0));
+
+            for (size_t half = 0; half < 2; half++) {
+                uint8_t current = energy(&payload[8 * half]);
+
+                INFO("energy " << int(start) << " frame " << i);
+                REQUIRE(current <= prevEnergy);
+                prevEnergy = current;
+            }
+        }
+
+        REQUIRE(prevEnergy == 0);
+    }
+}
+
+TEST_CASE("Frame numbers wrap around", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+
+    // The end of stream flag does not affect the frame number
+    auto arrivals = regularArrivals(0x7FF0, 32, 5);
+    arrivals.back().frameNum |= 0x8000;
+
+    auto played = playout(jb, arrivals, 33);
+    jb.getStats(stats);
+
+    REQUIRE(framesOnly(played) == sequence(0x7FF0, 32));
+    REQUIRE(stats.concealed == 0);
+    REQUIRE(stats.late == 0);
+}
+
+TEST_CASE("A new stream restarts the buffer", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+
+    auto arrivals = regularArrivals(0, 10, 5);
+    auto next = regularArrivals(500, 10, 5 + (10 * JitterBuffer::FRAME_TIME));
+    arrivals.insert(arrivals.end(), next.begin(), next.end());
+
+    auto played = playout(jb, arrivals, 21);
+    jb.getStats(stats);
+
+    auto expected = sequence(0, 10);
+    auto expectedNext = sequence(500, 10);
+    expected.insert(expected.end(), expectedNext.begin(), expectedNext.end());
+
+    REQUIRE(framesOnly(played) == expected);
+    REQUIRE(stats.late == 0);
+}
+
+TEST_CASE("Target depth adapts to the arrival jitter", "[m17][jitter]")
+{
+    JitterBuffer jb;
+    JitterStats stats;
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<uint32_t> delay(0, 100);
+
+    // Up to 100ms of random delay on the arrivals
+    auto arrivals = regularArrivals(0, 500, 5);
+    for (auto &arrival : arrivals)
+        arrival.time += delay(rng);
+
+    auto played = playout(jb, arrivals, 500);
+    jb.getStats(stats);
+
+    REQUIRE(stats.target > JitterBuffer::MIN_DEPTH);
+    REQUIRE(stats.jitter > 10);
+
+    // Once adapted, the buffer absorbs the jitter
+    size_t concealed = std::count(played.begin() + 100, played.end(),
+                                  CONCEALED);
+    REQUIRE(concealed < 8);
+    uint16_t jitteryLatency = stats.latencyMax;
+
+    // Without jitter the target depth goes back down, and frames are dropped
+    // to bring the latency within one frame from the minimum.
+    uint32_t start = START_TIME + (500 * JitterBuffer::FRAME_TIME);
+    arrivals = regularArrivals(500, 500, (500 * JitterBuffer::FRAME_TIME) + 5);
+    playout(jb, arrivals, 500, start);
+    jb.getStats(stats);
+
+    REQUIRE(stats.target == JitterBuffer::MIN_DEPTH);
+    REQUIRE(stats.dropped > 0);
+
+    jb.resetStats();
+    start += 500 * JitterBuffer::FRAME_TIME;
+    arrivals = regularArrivals(999, 500, (999 * JitterBuffer::FRAME_TIME) + 5);
+    playout(jb, arrivals, 500, start);
+    jb.getStats(stats);
+
+    REQUIRE(stats.concealed == 0);
+    REQUIRE(stats.latencyMax <= 115);
+    REQUIRE(stats.latencyMax < jitteryLatency);
+}
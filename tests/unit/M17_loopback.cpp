@@ -0,0 +1,360 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "protocols/M17/Demodulator.hpp"
+#include "protocols/M17/FrameDecoder.hpp"
+#include "protocols/M17/FrameEncoder.hpp"
+#include "protocols/M17/LinkSetupFrame.hpp"
+#include "protocols/M17/Modulator.hpp"
+
+/*
+ * In-memory TX to RX loopback: frames are encoded and modulated by the real
+ * TX chain at 48kHz, go through a simulated channel and are then decimated to
+ * 24kHz, demodulated and decoded by the real RX chain.
+ */
+
+static constexpr size_t TX_FRAME_SAMPLES = M17::Modulator::FRAME_SAMPLES;
+static constexpr size_t RX_RATE = M17::Modulator::TX_SAMPLE_RATE / 2;
+static constexpr size_t RX_BLOCK_SIZE = 480;
+
+// Nominal FM deviation of the outer symbols, in Hz
+static constexpr float OUTER_DEVIATION = 2400.0f;
+
+struct Channel {
+    float noise = 0.0f;      // AWGN standard deviation, in sample units
+    float freqOffset = 0.0f; // Carrier frequency offset, in Hz
+    float dcOffset = 0.0f;   // DC offset, in sample units
+    float clockDrift = 0.0f; // RX sample clock error, in ppm
+    bool invert = false;     // Baseband phase inversion
+    uint32_t seed = 1;       // Noise generator seed
+};
+
+struct LoopbackResult {
+    size_t framesSent = 0;
+    size_t framesDecoded = 0; // Stream frames received without bit errors
+    size_t framesReceived = 0;
+    size_t bitErrors = 0;
+    size_t bitsReceived = 0;
+    bool lsfValid = false;
+    double rxSeconds = 0.0;
+    double rxAudioSeconds = 0.0;
+
+    double ber() const
+    {
+        return (bitsReceived == 0) ? 1.0
+                                   : static_cast<double>(bitErrors)
+                                         / bitsReceived;
+    }
+
+    double fer() const
+    {
+        return 1.0 - static_cast<double>(framesDecoded) / framesSent;
+    }
+};
+
+struct Transmission {
+    std::vector<int16_t> baseband;
+    std::vector<M17::payload_t> payloads;
+    float outerLevel;
+};
+
+// Modulate a complete stream transmission with random payloads
+static Transmission transmit(const size_t numFrames, const uint32_t seed)
+{
+    Transmission tx;
+    M17::Modulator modulator;
+    M17::FrameEncoder encoder;
+    M17::frame_t frame;
+    std::mt19937 rng(seed);
+
+    auto append = [&tx]() -> int16_t * {
+        tx.baseband.resize(tx.baseband.size() + TX_FRAME_SAMPLES);
+        return &tx.baseband[tx.baseband.size() - TX_FRAME_SAMPLES];
+    };
+
+    // Leading silence, then an 80ms preamble
+    tx.baseband.assign(TX_FRAME_SAMPLES * 2, 0);
+    modulator.preambleToBaseband(append());
+    modulator.preambleToBaseband(append());
+
+    // The preamble alternates outer symbols, its peaks give the level
+    // corresponding to the nominal deviation.
+    auto minmax = std::minmax_element(tx.baseband.end() - TX_FRAME_SAMPLES,
+                                      tx.baseband.end());
+    tx.outerLevel = (*minmax.second - *minmax.first) / 2.0f;
+
+    M17::LinkSetupFrame lsf;
+    lsf.clear();
+    lsf.setSource("OPNRTX");
+    lsf.setDestination("ALL");
+    M17::streamType_t type;
+    type.value = 0;
+    type.fields.dataMode = M17::DATAMODE_STREAM;
+    type.fields.dataType = M17::DATATYPE_VOICE;
+    lsf.setType(type);
+    lsf.updateCrc();
+
+    encoder.reset();
+    encoder.encodeLsf(lsf, frame);
+    modulator.frameToBaseband(frame, append());
+
+    for (size_t i = 0; i < numFrames; i++) {
+        M17::payload_t payload;
+        for (auto &byte : payload)
+            byte = static_cast<uint8_t>(rng());
+
+        tx.payloads.push_back(payload);
+        encoder.encodeStreamFrame(payload, frame, i == (numFrames - 1));
+        modulator.frameToBaseband(frame, append());
+    }
+
+    encoder.encodeEotFrame(frame);
+    modulator.frameToBaseband(frame, append());
+
+    // Trailing silence
+    tx.baseband.resize(tx.baseband.size() + TX_FRAME_SAMPLES * 2, 0);
+
+    return tx;
+}
+
+// Apply the channel impairments and decimate to the RX sample rate
+static std::vector<int16_t> channel(const Transmission &tx, const Channel &ch)
+{
+    std::mt19937 rng(ch.seed);
+    std::normal_distribution<float> noise(0.0f, ch.noise);
+
+    // An FM carrier offset shows up as a DC shift at the discriminator output
+    float dc = ch.dcOffset + (ch.freqOffset * tx.outerLevel / OUTER_DEVIATION);
+    double step = 2.0 * (1.0 + (ch.clockDrift * 1e-6));
+    std::vector<int16_t> out;
+
+    for (double pos = 0.0; pos < (tx.baseband.size() - 1); pos += step) {
+        size_t idx = static_cast<size_t>(pos);
+        float frac = static_cast<float>(pos - idx);
+        float sample = (tx.baseband[idx] * (1.0f - frac))
+                     + (tx.baseband[idx + 1] * frac);
+
+        if (ch.invert)
+            sample = -sample;
+
+        sample += dc;
+        if (ch.noise > 0.0f)
+            sample += noise(rng);
+
+        sample = std::min(std::max(sample, -32768.0f), 32767.0f);
+        out.push_back(static_cast<int16_t>(sample));
+    }
+
+    return out;
+}
+
+static LoopbackResult receive(const Transmission &tx,
+                              const std::vector<int16_t> &baseband,
+                              const bool softDecision, const bool invertPhase)
+{
+    LoopbackResult res;
+    M17::Demodulator demod;
+    M17::FrameDecoder decoder;
+    std::vector<bool> received(tx.payloads.size(), false);
+
+    res.framesSent = tx.payloads.size();
+    res.rxAudioSeconds = static_cast<double>(baseband.size())
+                       / RX_RATE;
+
+    demod.init();
+    decoder.reset();
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t pos = 0; pos < baseband.size(); pos += RX_BLOCK_SIZE) {
+        size_t len = std::min(RX_BLOCK_SIZE, baseband.size() - pos);
+        demod.processBlock(&baseband[pos], len, invertPhase);
+
+        if (demod.frameReady() == false)
+            continue;
+
+        M17::FrameType type;
+        if (softDecision)
+            type = decoder.decodeFrame(demod.getSoftFrame());
+        else
+            type = decoder.decodeFrame(demod.getFrame());
+
+        if (type == M17::FrameType::LINK_SETUP) {
+            M17::LinkSetupFrame lsf = decoder.getLsf();
+            res.lsfValid |= lsf.valid();
+        }
+
+        if (type != M17::FrameType::STREAM)
+            continue;
+
+        M17::StreamFrame sf = decoder.getStreamFrame();
+        size_t num = sf.getFrameNumber() & 0x7FFF;
+        if ((num >= received.size()) || received[num])
+            continue;
+
+        received[num] = true;
+        res.framesReceived += 1;
+
+        size_t errors = 0;
+        for (size_t i = 0; i < sizeof(M17::payload_t); i++)
+            errors += __builtin_popcount(sf.data()[i] ^ tx.payloads[num][i]);
+
+        res.bitErrors += errors;
+        res.bitsReceived += 8 * sizeof(M17::payload_t);
+        if (errors == 0)
+            res.framesDecoded += 1;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    res.rxSeconds = std::chrono::duration<double>(end - start).count();
+
+    return res;
+}
+
+static LoopbackResult loopback(const Channel &ch, const size_t numFrames,
+                               const bool softDecision = false,
+                               const bool invertPhase = false)
+{
+    auto tx = transmit(numFrames, ch.seed);
+    return receive(tx, channel(tx, ch), softDecision, invertPhase);
+}
+
+static void report(const char *name, const LoopbackResult &res)
+{
+    printf("%-28s frames %4zu/%-4zu  BER %.2e  FER %.3f  %6.0f frames/s  "
+           "%5.0fx realtime\n",
+           name, res.framesDecoded, res.framesSent, res.ber(), res.fer(),
+           res.framesReceived / res.rxSeconds,
+           res.rxAudioSeconds / res.rxSeconds);
+}
+
+TEST_CASE("M17 loopback on a clean channel", "[m17][loopback]")
+{
+    Channel ch;
+    auto res = loopback(ch, 100);
+
+    REQUIRE(res.lsfValid);
+    REQUIRE(res.framesDecoded == res.framesSent);
+    REQUIRE(res.bitErrors == 0);
+}
+
+TEST_CASE("M17 loopback with additive white gaussian noise", "[m17][loopback]")
+{
+    Channel ch;
+    ch.noise = 3000.0f;
+    ch.seed = 2;
+
+    auto hard = loopback(ch, 100, false);
+    REQUIRE(hard.lsfValid);
+    REQUIRE(hard.fer() <= 0.02);
+
+    // Soft decision decoding must do at least as well as the hard one
+    ch.noise = 5000.0f;
+    hard = loopback(ch, 100, false);
+    auto soft = loopback(ch, 100, true);
+    REQUIRE(soft.fer() <= 0.02);
+    REQUIRE(soft.framesDecoded >= hard.framesDecoded);
+}
+
+TEST_CASE("M17 loopback with frequency and DC offsets", "[m17][loopback]")
+{
+    Channel ch;
+    ch.freqOffset = 1000.0f;
+    ch.seed = 3;
+
+    auto res = loopback(ch, 100);
+    REQUIRE(res.fer() <= 0.02);
+
+    ch = Channel();
+    ch.dcOffset = 4000.0f;
+    ch.seed = 4;
+
+    res = loopback(ch, 100);
+    REQUIRE(res.fer() <= 0.02);
+}
+
+TEST_CASE("M17 loopback with sample clock drift", "[m17][loopback]")
+{
+    Channel ch;
+    ch.clockDrift = 50.0f;
+    ch.seed = 5;
+
+    auto res = loopback(ch, 100);
+    REQUIRE(res.fer() <= 0.05);
+
+    ch.clockDrift = -50.0f;
+    res = loopback(ch, 100);
+    REQUIRE(res.fer() <= 0.05);
+}
+
+TEST_CASE("M17 loopback with phase inversion", "[m17][loopback]")
+{
+    Channel ch;
+    ch.invert = true;
+    ch.seed = 6;
+
+    auto res = loopback(ch, 50, false, true);
+    REQUIRE(res.lsfValid);
+    REQUIRE(res.framesDecoded == res.framesSent);
+
+    res = loopback(ch, 50, false, false);
+    REQUIRE(res.framesDecoded == 0);
+}
+
+TEST_CASE("M17 loopback sensitivity report", "[m17][loopback][.][benchmark]")
+{
+    const size_t numFrames = 250;
+    char name[32];
+
+    auto tx = transmit(numFrames, 1);
+    Channel ch;
+
+    report("clean", receive(tx, channel(tx, ch), false, false));
+
+    for (float noise : {2000.0f, 3000.0f, 4000.0f, 5000.0f, 6000.0f}) {
+        ch = Channel();
+        ch.noise = noise;
+        snprintf(name, sizeof(name), "awgn %.0f hard", noise);
+        report(name, receive(tx, channel(tx, ch), false, false));
+        snprintf(name, sizeof(name), "awgn %.0f soft", noise);
+        report(name, receive(tx, channel(tx, ch), true, false));
+    }
+
+    for (float offset : {250.0f, 500.0f, 1000.0f, 1500.0f}) {
+        ch = Channel();
+        ch.freqOffset = offset;
+        snprintf(name, sizeof(name), "freq offset %.0fHz", offset);
+        report(name, receive(tx, channel(tx, ch), false, false));
+    }
+
+    for (float dc : {2000.0f, 4000.0f, 8000.0f}) {
+        ch = Channel();
+        ch.dcOffset = dc;
+        snprintf(name, sizeof(name), "dc offset %.0f", dc);
+        report(name, receive(tx, channel(tx, ch), false, false));
+    }
+
+    for (float drift : {100.0f, 500.0f, 1000.0f, 2000.0f}) {
+        ch = Channel();
+        ch.clockDrift = drift;
+        snprintf(name, sizeof(name), "clock drift %.0fppm", drift);
+        report(name, receive(tx, channel(tx, ch), false, false));
+    }
+
+    ch = Channel();
+    ch.invert = true;
+    report("inverted, rx not inverted", receive(tx, channel(tx, ch), false, false));
+    report("inverted, rx inverted", receive(tx, channel(tx, ch), false, true));
+}
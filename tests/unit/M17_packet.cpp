@@ -87,6 +87,31 @@ TEST_CASE("Encode then decode round-trip", "[m17][packet]")
     REQUIRE(memcmp(frame.data(), decoded.data(), PacketFrame::DATA_SIZE) == 0);
 }
 
+TEST_CASE("Encode then soft decision decode round-trip", "[m17][packet]")
+{
+    FrameEncoder encoder;
+    FrameDecoder decoder;
+
+    PacketFrame frame;
+    const char msg[] = "HELLO M17 PACKET!!";
+    std::copy_n(msg, sizeof(msg) - 1, &frame[0]);
+
+    frame_t encoded;
+    encoder.encodePacketFrame(frame, encoded);
+
+    // Convert to soft bits with full confidence
+    soft_frame_t soft;
+    for (size_t i = 0; i < soft.size(); i++)
+        soft[i] = getBit(encoded, i) ? 0xFFFF : 0x0000;
+
+    FrameType type = decoder.decodeFrame(soft);
+    REQUIRE(type == FrameType::PACKET);
+
+    const PacketFrame &decoded = decoder.getPacketFrame();
+
+    REQUIRE(memcmp(frame.data(), decoded.data(), PacketFrame::DATA_SIZE) == 0);
+}
+
 TEST_CASE("Round-trip with all-zeros payload", "[m17][packet]")
 {
     FrameEncoder encoder;
@@ -5,8 +5,14 @@
  */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <limits.h>
 #include <inttypes.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include "protocols/M17/Constants.hpp"
 #include "protocols/M17/DSP.hpp"
 
 #define IMPULSE_SIZE 4096
@@ -29,3 +35,163 @@ TEST_CASE("RRC filter produces non-zero impulse response", "[m17][rrc]")
 
     REQUIRE(hasNonZero);
 }
+
+static constexpr size_t RRC_TAPS = M17::rrc_taps_48k.size();
+static constexpr size_t SPS = 10; // 48000 Hz / 4800 baud
+
+TEST_CASE("Polyphase RRC interpolator matches zero-stuffed RRC filter",
+          "[m17][rrc]")
+{
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> rndSymbol(0, 3);
+    static constexpr int8_t SYMBOLS[] = { -3, -1, +1, +3 };
+
+    Fir<RRC_TAPS> fir(M17::rrc_taps_48k);
+    FirInterpolator<RRC_TAPS, SPS> interp(M17::rrc_taps_48k);
+
+    // Run more symbols than a frame, to cover the history wrap-around
+    for (size_t i = 0; i < 4 * M17::FRAME_SYMBOLS; i++) {
+        float symbol = SYMBOLS[rndSymbol(rng)] * 23000.0f;
+        std::array<float, SPS> phases;
+
+        interp(symbol, phases.data());
+
+        for (size_t p = 0; p < SPS; p++) {
+            float expected = fir((p == 0) ? symbol : 0.0f);
+            INFO("Symbol " << i << " phase " << p);
+            REQUIRE(std::abs(phases[p] - expected) < 0.05f);
+        }
+    }
+}
+
+TEST_CASE("RRC interpolation of an M17 frame", "[m17][rrc][.][benchmark]")
+{
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> rndSymbol(0, 3);
+    static constexpr int8_t SYMBOLS[] = { -3, -1, +1, +3 };
+
+    std::array<float, M17::FRAME_SYMBOLS> symbols;
+    std::array<float, M17::FRAME_SYMBOLS * SPS> baseband;
+
+    for (auto &sym : symbols)
+        sym = SYMBOLS[rndSymbol(rng)] * 23000.0f;
+
+    Fir<RRC_TAPS> fir(M17::rrc_taps_48k);
+    FirInterpolator<RRC_TAPS, SPS> interp(M17::rrc_taps_48k);
+
+    BENCHMARK("Zero-stuffing + Fir")
+    {
+        for (size_t i = 0; i < baseband.size(); i++) {
+            float in = ((i % SPS) == 0) ? symbols[i / SPS] : 0.0f;
+            baseband[i] = fir(in);
+        }
+
+        return baseband[0];
+    };
+
+    BENCHMARK("FirInterpolator")
+    {
+        for (size_t i = 0; i < symbols.size(); i++)
+            interp(symbols[i], &baseband[i * SPS]);
+
+        return baseband[0];
+    };
+}
+
+/**
+ * Feed the same random signal to the floating point and Q15 versions of an RRC
+ * filter and check that the outputs differ at most by the error introduced by
+ * the quantization of the coefficients, plus rounding.
+ */
+template <size_t N>
+static void checkQ15Filter(const std::array<float, N> &taps,
+                           const std::array<int16_t, N> &tapsQ15,
+                           const int16_t amplitude)
+{
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int16_t> rndSample(-amplitude, amplitude);
+
+    float maxError = 1.0f;
+    for (size_t i = 0; i < N; i++)
+        maxError += std::abs(tapsQ15[i] / 32768.0f - taps[i]) * amplitude;
+
+    Fir<N> fir(taps);
+    FirQ15<N> firQ15(tapsQ15);
+
+    std::array<int16_t, 1024> input;
+    std::array<int16_t, 1024> output;
+    for (auto &sample : input)
+        sample = rndSample(rng);
+
+    firQ15.process(input.data(), output.data(), input.size());
+
+    for (size_t i = 0; i < input.size(); i++) {
+        float expected = fir(static_cast<float>(input[i]));
+        INFO("Sample " << i << ": expected " << expected << " got "
+                       << output[i]);
+        REQUIRE(std::abs(output[i] - expected) <= maxError);
+    }
+}
+
+TEST_CASE("Q15 RRC filters match floating point RRC filters", "[m17][rrc]")
+{
+    // Keep the 32-bit accumulator of the 48kHz filter within its headroom
+    checkQ15Filter(M17::rrc_taps_24k, M17::rrc_taps_24k_q15, 32767);
+    checkQ15Filter(M17::rrc_taps_48k, M17::rrc_taps_48k_q15, 8192);
+}
+
+TEST_CASE("Q15 RRC filter saturates instead of wrapping", "[m17][rrc]")
+{
+    static constexpr size_t NTAPS = M17::rrc_taps_24k.size();
+    Fir<NTAPS> fir(M17::rrc_taps_24k);
+    FirQ15<NTAPS> firQ15(M17::rrc_taps_24k_q15);
+
+    // Full-scale negative to positive step: the filter response overshoots
+    // beyond the int16_t range once the step reaches the central tap.
+    float peak = 0.0f;
+    for (size_t i = 0; i < 2 * NTAPS; i++) {
+        int16_t in = (i < NTAPS) ? INT16_MIN : INT16_MAX;
+        int16_t out = firQ15(in);
+        peak = std::max(peak, fir(static_cast<float>(in)));
+
+        if (i >= NTAPS + NTAPS / 2) {
+            INFO("Sample " << i);
+            REQUIRE(out > 0);
+        }
+    }
+
+    REQUIRE(peak > INT16_MAX);
+}
+
+TEST_CASE("RRC filtering of an M17 RX block", "[m17][rrc][.][benchmark]")
+{
+    static constexpr size_t BLOCK_SIZE = 960;
+    static constexpr size_t NTAPS = M17::rrc_taps_24k.size();
+
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int16_t> rndSample(-16384, 16384);
+
+    std::array<int16_t, BLOCK_SIZE> input;
+    std::array<int16_t, BLOCK_SIZE> output;
+    std::array<float, BLOCK_SIZE> outputFloat;
+
+    for (auto &sample : input)
+        sample = rndSample(rng);
+
+    Fir<NTAPS> fir(M17::rrc_taps_24k);
+    FirQ15<NTAPS> firQ15(M17::rrc_taps_24k_q15);
+
+    BENCHMARK("Fir, float")
+    {
+        for (size_t i = 0; i < BLOCK_SIZE; i++)
+            outputFloat[i] = fir(static_cast<float>(input[i]));
+
+        return outputFloat[0];
+    };
+
+    BENCHMARK("FirQ15")
+    {
+        firQ15.process(input.data(), output.data(), BLOCK_SIZE);
+        return output[0];
+    };
+}
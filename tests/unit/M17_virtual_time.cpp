@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "rtx/OpMode_M17.hpp"
+#include "emulator.h"
+
+extern "C" {
+#include "mcu/x86_64/drivers/vclock.h"
+}
+
+/*
+ * M17 transmission in virtual time: the test thread is attached to the
+ * simulation as the rtx thread, the codec thread encodes the microphone audio
+ * from /tmp/mic.raw and the modulator streams the baseband to
+ * /tmp/m17_output.raw.
+ */
+
+static constexpr long long TX_TIME = 4000000;   // Transmission time, in us
+
+static long fileSize(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == nullptr)
+        return 0;
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fclose(fp);
+
+    return size;
+}
+
+static void writeMicrophone()
+{
+    std::vector<int16_t> tone(8000);
+    for (size_t i = 0; i < tone.size(); i++)
+        tone[i] = 8000 * sin(2.0 * M_PI * 440.0 * i / 8000.0);
+
+    FILE *fp = fopen("/tmp/mic.raw", "wb");
+    REQUIRE(fp != nullptr);
+    fwrite(tone.data(), sizeof(int16_t), tone.size(), fp);
+    fclose(fp);
+}
+
+struct Scenario {
+    std::atomic<bool> done{ false };
+    std::vector<long long> updates; // Time at the end of each TX update
+};
+
+static void transmit(Scenario &scenario)
+{
+    vclock_attach();
+
+    OpMode_M17 m17;
+    rtxStatus_t status;
+    memset(&status, 0x00, sizeof(status));
+    strcpy(status.source_address, "N0CALL");
+    status.opStatus = OFF;
+
+    m17.enable();
+    emulator_state.PTTstatus = true;
+
+    while (status.opStatus != TX)
+        m17.update(&status, false);
+
+    long long start = vclock_now();
+    while ((vclock_now() - start) < TX_TIME) {
+        m17.update(&status, false);
+        scenario.updates.push_back(vclock_now() - start);
+    }
+
+    emulator_state.PTTstatus = false;
+    while (status.opStatus == TX)
+        m17.update(&status, false);
+
+    m17.disable();
+
+    vclock_detach();
+    scenario.done = true;
+}
+
+TEST_CASE("M17 transmission runs in virtual time", "[m17][vclock]")
+{
+    setenv("OPENRTX_VIRTUAL_TIME", "1", 1);
+    REQUIRE(vclock_enabled());
+
+    writeMicrophone();
+    long outputSize = fileSize("/tmp/m17_output.raw");
+
+    // The rtx thread blocks on the codec waiting for the encoded voice, which
+    // must not stop the virtual clock.
+    static Scenario scenario;
+    auto wallStart = std::chrono::steady_clock::now();
+    std::thread(transmit, std::ref(scenario)).detach();
+
+    while (scenario.done == false) {
+        auto elapsed = std::chrono::steady_clock::now() - wallStart;
+        if (elapsed > std::chrono::seconds(30))
+            break;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // A stalled simulation leaves threads blocked forever, which would hang
+    // the static destructors too: bail out.
+    if (scenario.done == false) {
+        fprintf(stderr, "Virtual time M17 transmission stalled\n");
+        fflush(stderr);
+        _Exit(EXIT_FAILURE);
+    }
+
+    // After the link setup, one stream frame of two codec2 frames is sent
+    // every 40ms of virtual time.
+    const std::vector<long long> &updates = scenario.updates;
+    REQUIRE(updates.size() > 90);
+    for (size_t i = 1; i < updates.size(); i++) {
+        INFO("update " << i);
+        REQUIRE((updates[i] - updates[i - 1]) == 40000);
+    }
+
+    // Faster than real time
+    auto wallTime = std::chrono::steady_clock::now() - wallStart;
+    REQUIRE(wallTime < std::chrono::microseconds(TX_TIME / 2));
+
+    // The baseband has been streamed to the RTX sink, at 48kHz
+    long written = fileSize("/tmp/m17_output.raw") - outputSize;
+    REQUIRE(written >= (TX_TIME / 1000000) * 48000 * 2);
+}
@@ -5,9 +5,12 @@
  */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <random>
 #include <array>
+#include <vector>
 #include "protocols/M17/ConvolutionalEncoder.hpp"
 #include "protocols/M17/CodePuncturing.hpp"
 #include "protocols/M17/Viterbi.hpp"
@@ -65,3 +68,277 @@ TEST_CASE("Viterbi decode recovers punctured convolutional encoding",
         REQUIRE(source[i] == result[i]);
     }
 }
+
+TEST_CASE("Soft Viterbi decode recovers punctured convolutional encoding",
+          "[m17][viterbi]")
+{
+    uniform_int_distribution<uint8_t> rndValue(0, 255);
+
+    array<uint8_t, 18> source;
+
+    for (auto &byte : source) {
+        byte = rndValue(rng);
+    }
+
+    array<uint8_t, 37> encoded;
+    M17::ConvolutionalEncoder encoder;
+    encoder.reset();
+    encoder.encode(source.data(), encoded.data(), source.size());
+    encoded[36] = encoder.flush();
+
+    array<uint8_t, 34> punctured;
+    M17::puncture(encoded, punctured, M17::DATA_PUNCTURE);
+
+    // Convert to soft bits, reducing the confidence of some of them
+    array<uint16_t, 272> soft;
+    for (size_t i = 0; i < soft.size(); i++)
+        soft[i] = M17::getBit(punctured, i) ? 0xFFFF : 0x0000;
+
+    for (size_t i = 0; i < 16; i++) {
+        size_t pos = (17 * i) + 3;
+        soft[pos] = (soft[pos] != 0) ? 0xF7FF : 0x0800;
+    }
+
+    // Insert two certain bit errors, far enough to be corrected
+    soft[40] = 0xFFFF - soft[40];
+    soft[200] = 0xFFFF - soft[200];
+
+    array<uint8_t, 18> result;
+    M17::SoftViterbi decoder;
+    uint16_t errors = decoder.decodePunctured(soft, result,
+                                              M17::DATA_PUNCTURE);
+
+    for (size_t i = 0; i < result.size(); i++) {
+        INFO("Position " << i << ": got 0x" << hex
+                         << static_cast<int>(result[i]) << " expected 0x"
+                         << static_cast<int>(source[i]));
+        REQUIRE(source[i] == result[i]);
+    }
+
+    // The weakened bits add up to half a bit error
+    REQUIRE(errors == 2);
+}
+
+// ---------------------------------------------------------------------------
+// Regression against a reference decoder
+// ---------------------------------------------------------------------------
+
+/**
+ * Reference Viterbi decoder, a plain transcription of the M17 trellis with
+ * one branch per state and the same tie breaking rule of the optimised
+ * decoders. Symbols are pairs of costs ranging from zero to maxSym.
+ */
+template <typename metric_t, size_t OUT>
+static metric_t referenceDecode(const vector<array<uint32_t, 2> > &symbols,
+                                const uint32_t maxSym,
+                                array<uint8_t, OUT> &out)
+{
+    static constexpr uint8_t C0[] = { 0, 0, 0, 0, 1, 1, 1, 1 };
+    static constexpr uint8_t C1[] = { 0, 1, 1, 0, 0, 1, 1, 0 };
+
+    array<metric_t, 16> prev = {};
+    array<metric_t, 16> curr = {};
+    vector<uint16_t> history;
+
+    for (auto &sym : symbols) {
+        uint16_t decisions = 0;
+
+        for (size_t i = 0; i < 8; i++) {
+            uint32_t c0 = C0[i] * maxSym;
+            uint32_t c1 = C1[i] * maxSym;
+            metric_t metric = max(c0, sym[0]) - min(c0, sym[0])
+                            + max(c1, sym[1]) - min(c1, sym[1]);
+            metric_t compl_ = (2 * maxSym) - metric;
+
+            metric_t m0 = prev[i] + metric;
+            metric_t m1 = prev[i + 8] + compl_;
+            metric_t m2 = prev[i] + compl_;
+            metric_t m3 = prev[i + 8] + metric;
+
+            if (m0 >= m1)
+                decisions |= 1 << (2 * i);
+            if (m2 >= m3)
+                decisions |= 1 << (2 * i + 1);
+
+            curr[2 * i] = min(m0, m1);
+            curr[2 * i + 1] = min(m2, m3);
+        }
+
+        history.push_back(decisions);
+        prev = curr;
+    }
+
+    uint8_t state = 0;
+    size_t pos = history.size();
+    for (size_t bitPos = OUT * 8; bitPos > 0; bitPos--) {
+        pos--;
+        bool bit = (history[pos] >> (state >> 4)) & 0x01;
+        state >>= 1;
+        if (bit)
+            state |= 0x80;
+        M17::setBit(out, bitPos - 1, bit);
+    }
+
+    return *min_element(prev.begin(), prev.end());
+}
+
+/**
+ * Expand punctured symbols to pairs of costs, filling the punctured positions
+ * with an erasure value. Returns the number of punctured bits.
+ */
+template <size_t P>
+static size_t depunctureSymbols(const vector<uint32_t> &bits,
+                                const array<uint8_t, P> &punctureMatrix,
+                                const uint32_t erasure,
+                                vector<array<uint32_t, 2> > &symbols)
+{
+    size_t bitPos = 0;
+    size_t punctIndex = 0;
+    size_t punctured = 0;
+
+    while (bitPos < bits.size()) {
+        array<uint32_t, 2> sym;
+        for (auto &s : sym) {
+            if (punctureMatrix[punctIndex++]) {
+                s = bits[bitPos++];
+            } else {
+                s = erasure;
+                punctured++;
+            }
+
+            if (punctIndex >= P)
+                punctIndex = 0;
+        }
+
+        symbols.push_back(sym);
+    }
+
+    return punctured;
+}
+
+template <size_t IN, size_t OUT, size_t P>
+static void checkHardDecoder(const array<uint8_t, P> &punctureMatrix)
+{
+    uniform_int_distribution<uint8_t> rndValue(0, 255);
+    M17::HardViterbi decoder;
+
+    for (size_t iter = 0; iter < 200; iter++) {
+        array<uint8_t, IN> in;
+        for (auto &byte : in)
+            byte = rndValue(rng);
+
+        vector<uint32_t> bits;
+        for (size_t i = 0; i < IN * 8; i++)
+            bits.push_back(M17::getBit(in, i) ? 2 : 0);
+
+        vector<array<uint32_t, 2> > symbols;
+        size_t punct = depunctureSymbols(bits, punctureMatrix, 1, symbols);
+
+        array<uint8_t, OUT> expected;
+        uint16_t cost = referenceDecode<uint16_t>(symbols, 2, expected);
+
+        array<uint8_t, OUT> result;
+        uint16_t errors = decoder.decodePunctured(in, result, punctureMatrix);
+
+        INFO("Iteration " << iter);
+        REQUIRE(result == expected);
+        REQUIRE(errors == (cost - punct) / 2);
+    }
+}
+
+template <size_t IN, size_t OUT, size_t P>
+static void checkSoftDecoder(const array<uint8_t, P> &punctureMatrix)
+{
+    uniform_int_distribution<uint16_t> rndValue(0, 0xFFFF);
+    M17::SoftViterbi decoder;
+
+    for (size_t iter = 0; iter < 200; iter++) {
+        array<uint16_t, IN> in;
+        for (auto &value : in)
+            value = rndValue(rng);
+
+        vector<uint32_t> bits(in.begin(), in.end());
+        vector<array<uint32_t, 2> > symbols;
+        size_t punct = depunctureSymbols(bits, punctureMatrix, 0x7FFF,
+                                         symbols);
+
+        array<uint8_t, OUT> expected;
+        uint32_t cost = referenceDecode<uint32_t>(symbols, 0xFFFF, expected);
+
+        array<uint8_t, OUT> result;
+        uint16_t errors = decoder.decodePunctured(in, result, punctureMatrix);
+
+        INFO("Iteration " << iter);
+        REQUIRE(result == expected);
+        REQUIRE(errors == (cost - (punct * 0x7FFF)) / 0xFFFF);
+    }
+}
+
+TEST_CASE("Hard Viterbi matches reference decoder on random data",
+          "[m17][viterbi]")
+{
+    checkHardDecoder<46, 30>(M17::LSF_PUNCTURE);
+    checkHardDecoder<34, 18>(M17::DATA_PUNCTURE);
+    checkHardDecoder<46, 26>(M17::PACKET_PUNCTURE);
+}
+
+TEST_CASE("Soft Viterbi matches reference decoder on random data",
+          "[m17][viterbi]")
+{
+    checkSoftDecoder<368, 30>(M17::LSF_PUNCTURE);
+    checkSoftDecoder<272, 18>(M17::DATA_PUNCTURE);
+    checkSoftDecoder<368, 26>(M17::PACKET_PUNCTURE);
+}
+
+TEST_CASE("Viterbi decoders throughput", "[m17][viterbi][.][benchmark]")
+{
+    uniform_int_distribution<uint16_t> rndValue(0, 0xFFFF);
+
+    array<uint8_t, 46> hardIn;
+    array<uint16_t, 368> softIn;
+    for (auto &byte : hardIn)
+        byte = rndValue(rng) & 0xFF;
+    for (auto &value : softIn)
+        value = rndValue(rng);
+
+    array<uint16_t, 272> softStream;
+    array<uint8_t, 34> hardStream;
+    copy_n(softIn.begin(), softStream.size(), softStream.begin());
+    copy_n(hardIn.begin(), hardStream.size(), hardStream.begin());
+
+    array<uint8_t, 30> lsf;
+    array<uint8_t, 18> stream;
+    array<uint8_t, 26> packet;
+    M17::HardViterbi hard;
+    M17::SoftViterbi soft;
+
+    BENCHMARK("HardViterbi, LSF")
+    {
+        return hard.decodePunctured(hardIn, lsf, M17::LSF_PUNCTURE);
+    };
+
+    BENCHMARK("HardViterbi, stream")
+    {
+        return hard.decodePunctured(hardStream, stream, M17::DATA_PUNCTURE);
+    };
+
+    BENCHMARK("HardViterbi, packet")
+    {
+        return hard.decodePunctured(hardIn, packet, M17::PACKET_PUNCTURE);
+    };
+
+    BENCHMARK("SoftViterbi, LSF")
+    {
+        return soft.decodePunctured(softIn, lsf, M17::LSF_PUNCTURE);
+    };
+
+    BENCHMARK("SoftViterbi, stream")
+    {
+        return soft.decodePunctured(softStream, stream, M17::DATA_PUNCTURE);
+    };
+
+    BENCHMARK("SoftViterbi, packet")
+    {
+        return soft.decodePunctured(softIn, packet, M17::PACKET_PUNCTURE);
+    };
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include "core/audio_codec.h"
+#include "core/audio_path.h"
+
+/*
+ * The decoder thread plays the frames on the speaker output, which on Linux
+ * is a file sink consuming one frame every 20ms. The sink is enabled through
+ * the OPENRTX_SPEAKER environment variable.
+ */
+
+static void waitFrames(const unsigned int num)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(20 * num));
+}
+
+TEST_CASE("Codec frame queue statistics", "[codec]")
+{
+    const uint8_t frame[8] = { 0 };
+    struct codecStats stats;
+
+    setenv("OPENRTX_SPEAKER", "/dev/null", 1);
+    codec_init();
+
+    pathId path = audioPath_request(SOURCE_MCU, SINK_SPK, PRIO_PROMPT);
+    REQUIRE(path >= 0);
+    REQUIRE(codec_pushFrame(frame, false) == -EPERM);
+
+    codec_setQueueDepth(4);
+    REQUIRE(codec_startDecode(path));
+    REQUIRE(codec_runningOnPath(path));
+    REQUIRE(codec_runningOnPath(path + 1) == false);
+
+    codec_getStats(&stats);
+    REQUIRE(stats.depth == 4);
+    REQUIRE(stats.frames == 0);
+    REQUIRE(stats.overruns == 0);
+
+    // Blocking pushes never drop frames, the queue never goes past its depth
+    for (int i = 0; i < 10; i++)
+        REQUIRE(codec_pushFrame(frame, true) == 0);
+
+    codec_getStats(&stats);
+    REQUIRE(stats.overruns == 0);
+    REQUIRE(stats.highWater == 4);
+    REQUIRE(stats.frames >= 6);
+
+    // The queue is full, a burst of non-blocking pushes overruns it
+    int accepted = 0;
+    for (int i = 0; i < 20; i++) {
+        if (codec_pushFrame(frame, false) == 0)
+            accepted += 1;
+    }
+
+    codec_getStats(&stats);
+    REQUIRE(accepted <= 1);
+    REQUIRE(stats.overruns == static_cast<uint32_t>(20 - accepted));
+
+    // Once the queue is drained the decoder runs out of data
+    waitFrames(10);
+    codec_getStats(&stats);
+    REQUIRE(stats.level == 0);
+    REQUIRE(stats.frames == static_cast<uint32_t>(10 + accepted));
+    REQUIRE(stats.underruns >= 1);
+
+    // A shallower queue bounds the latency
+    codec_setQueueDepth(2);
+    codec_resetStats();
+    for (int i = 0; i < 6; i++)
+        REQUIRE(codec_pushFrame(frame, true) == 0);
+
+    codec_getStats(&stats);
+    REQUIRE(stats.depth == 2);
+    REQUIRE(stats.highWater <= 2);
+
+    codec_stop(path);
+    REQUIRE(codec_runningOnPath(path) == false);
+    audioPath_release(path);
+    codec_setQueueDepth(4);
+    codec_terminate();
+}
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+#include "core/audio_path.h"
+
+/**
+ * Reference model of the audio path manager, keeping the routes in standard
+ * containers as in the original implementation.
+ */
+class PathModel
+{
+public:
+    int request(AudioSource source, AudioSink sink, AudioPriority prio)
+    {
+        std::set<int> toSuspend;
+
+        for (int id : active) {
+            const Route &route = routes.at(id);
+            if (audio_checkPathCompatibility(source, sink, route.source,
+                                             route.sink))
+                continue;
+
+            if (route.prio >= prio)
+                return -1;
+
+            toSuspend.insert(id);
+        }
+
+        int newId = counter++;
+        for (int id : toSuspend) {
+            active.erase(id);
+            routes.at(id).suspendedBy.insert(newId);
+        }
+
+        routes[newId] = { source, sink, prio, toSuspend, {} };
+        active.insert(newId);
+
+        return newId;
+    }
+
+    void release(int id)
+    {
+        auto it = routes.find(id);
+        if (it == routes.end())
+            return;
+
+        Route removed = it->second;
+        routes.erase(it);
+        active.erase(id);
+
+        for (int i : removed.suspendedBy) {
+            auto &list = routes.at(i).suspendList;
+            list.erase(id);
+            list.insert(removed.suspendList.begin(), removed.suspendList.end());
+        }
+
+        for (int i : removed.suspendList) {
+            auto &by = routes.at(i).suspendedBy;
+            by.erase(id);
+
+            if (removed.suspendedBy.empty() == false)
+                by.insert(removed.suspendedBy.begin(), removed.suspendedBy.end());
+            else if (by.empty())
+                active.insert(i);
+        }
+    }
+
+    PathStatus status(int id) const
+    {
+        auto it = routes.find(id);
+        if (it == routes.end())
+            return PATH_CLOSED;
+
+        if (it->second.suspendedBy.empty())
+            return PATH_OPEN;
+
+        return PATH_SUSPENDED;
+    }
+
+private:
+    struct Route {
+        AudioSource source;
+        AudioSink sink;
+        AudioPriority prio;
+        std::set<int> suspendList;
+        std::set<int> suspendedBy;
+    };
+
+    std::map<int, Route> routes;
+    std::set<int> active;
+    int counter = 1;
+};
+
+TEST_CASE("Audio path suspension and resume", "[audio]")
+{
+    pathId rx = audioPath_request(SOURCE_RTX, SINK_SPK, PRIO_RX);
+    REQUIRE(rx > 0);
+    REQUIRE(audioPath_getStatus(rx) == PATH_OPEN);
+
+    // Lower priority path on the same sink is rejected
+    REQUIRE(audioPath_request(SOURCE_MCU, SINK_SPK, PRIO_BEEP) == -1);
+
+    // Higher priority path suspends the RX one
+    pathId prompt = audioPath_request(SOURCE_MCU, SINK_SPK, PRIO_PROMPT);
+    REQUIRE(prompt > 0);
+    REQUIRE(audioPath_getStatus(prompt) == PATH_OPEN);
+    REQUIRE(audioPath_getStatus(rx) == PATH_SUSPENDED);
+
+    pathInfo_t info = audioPath_getInfo(rx);
+    REQUIRE(info.source == SOURCE_RTX);
+    REQUIRE(info.sink == SINK_SPK);
+    REQUIRE(info.prio == PRIO_RX);
+    REQUIRE(info.status == PATH_SUSPENDED);
+
+    // TX suspends the prompt, releasing the suspended prompt hands the RX
+    // path over to TX.
+    pathId tx = audioPath_request(SOURCE_MIC, SINK_RTX, PRIO_TX);
+    REQUIRE(tx > 0);
+    REQUIRE(audioPath_getStatus(prompt) == PATH_SUSPENDED);
+
+    audioPath_release(prompt);
+    REQUIRE(audioPath_getStatus(prompt) == PATH_CLOSED);
+    REQUIRE(audioPath_getStatus(rx) == PATH_SUSPENDED);
+
+    audioPath_release(tx);
+    REQUIRE(audioPath_getStatus(rx) == PATH_OPEN);
+
+    audioPath_release(rx);
+    REQUIRE(audioPath_getStatus(rx) == PATH_CLOSED);
+    REQUIRE(audioPath_getInfo(rx).status == PATH_CLOSED);
+}
+
+TEST_CASE("Audio path IDs are not reused", "[audio]")
+{
+    std::set<pathId> ids;
+
+    REQUIRE(audioPath_getStatus(0) == PATH_CLOSED);
+    REQUIRE(audioPath_getStatus(-1) == PATH_CLOSED);
+
+    for (int i = 0; i < 1000; i++) {
+        pathId id = audioPath_request(SOURCE_MCU, SINK_MCU, PRIO_RX);
+        REQUIRE(id > 0);
+        REQUIRE(ids.insert(id).second);
+
+        audioPath_release(id);
+
+        // A stale ID stays closed, even after its slot got reused
+        for (pathId old : ids)
+            REQUIRE(audioPath_getStatus(old) == PATH_CLOSED);
+    }
+}
+
+TEST_CASE("Audio path request and release churn", "[audio]")
+{
+    static const AudioSource sources[] = { SOURCE_MIC, SOURCE_RTX,
+                                           SOURCE_MCU };
+    static const AudioSink sinks[] = { SINK_SPK, SINK_RTX, SINK_MCU };
+    static const AudioPriority prios[] = { PRIO_BEEP, PRIO_RX, PRIO_PROMPT,
+                                           PRIO_TX };
+
+    std::mt19937 rng(19);
+    PathModel model;
+    std::vector<std::pair<pathId, int>> open; // Path ID and model ID
+
+    for (int step = 0; step < 100000; step++) {
+        // Stay well below the capacity of the path table
+        bool release = (open.size() >= 8)
+                    || ((open.empty() == false) && ((rng() % 2) == 0));
+
+        if (release) {
+            size_t index = rng() % open.size();
+            audioPath_release(open[index].first);
+            model.release(open[index].second);
+            open.erase(open.begin() + index);
+        } else {
+            AudioSource source = sources[rng() % 3];
+            AudioSink sink = sinks[rng() % 3];
+            AudioPriority prio = prios[rng() % 4];
+
+            pathId id = audioPath_request(source, sink, prio);
+            int modelId = model.request(source, sink, prio);
+            REQUIRE((id < 0) == (modelId < 0));
+
+            if (id >= 0)
+                open.emplace_back(id, modelId);
+        }
+
+        for (const auto &path : open)
+            REQUIRE(audioPath_getStatus(path.first)
+                    == model.status(path.second));
+    }
+
+    for (const auto &path : open)
+        audioPath_release(path.first);
+}
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ * 
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "core/crc.h"
+
+using namespace std;
+
+static default_random_engine rng;
+
+/**
+ * Bitwise implementation of a non-reflected 16-bit CRC.
+ */
+static uint16_t refCrc(uint16_t poly, uint16_t crc, const uint8_t *data,
+                       size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i] << 8;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc & 0x8000)
+                crc = (crc << 1) ^ poly;
+            else
+                crc = crc << 1;
+        }
+    }
+
+    return crc;
+}
+
+static vector<uint8_t> randomData(size_t len)
+{
+    uniform_int_distribution<uint16_t> rndByte(0, 255);
+    vector<uint8_t> data(len);
+
+    for (auto &byte : data)
+        byte = rndByte(rng);
+
+    return data;
+}
+
+TEST_CASE("M17 CRC known answers", "[crc]")
+{
+    const char *check = "123456789";
+    uint8_t sequence[256];
+    for (size_t i = 0; i < sizeof(sequence); i++)
+        sequence[i] = i;
+
+    // Test vectors from the M17 protocol specification
+    REQUIRE(crc_m17("", 0) == 0xFFFF);
+    REQUIRE(crc_m17("A", 1) == 0x206E);
+    REQUIRE(crc_m17(check, strlen(check)) == 0x772B);
+    REQUIRE(crc_m17(sequence, sizeof(sequence)) == 0x1C31);
+}
+
+TEST_CASE("CCITT CRC known answers", "[crc]")
+{
+    const char *check = "123456789";
+
+    REQUIRE(crc_ccitt("", 0) == 0x0000);
+    REQUIRE(crc_ccitt("A", 1) == 0x58E5);
+    REQUIRE(crc_ccitt(check, strlen(check)) == 0x31C3);
+}
+
+TEST_CASE("CRCs match the bitwise implementation", "[crc]")
+{
+    // Cover all the possible tails after the sliced processing
+    for (size_t len = 0; len < 64; len++) {
+        auto data = randomData(len);
+
+        INFO("Length: " << len);
+        REQUIRE(crc_m17(data.data(), len)
+                == refCrc(0x5935, 0xFFFF, data.data(), len));
+        REQUIRE(crc_ccitt(data.data(), len)
+                == refCrc(0x1021, 0x0000, data.data(), len));
+    }
+}
+
+TEST_CASE("Incremental CRCs match single pass computation", "[crc]")
+{
+    auto data = randomData(1024);
+    uniform_int_distribution<size_t> rndChunk(0, 37);
+
+    for (size_t i = 0; i < 16; i++) {
+        uint16_t m17 = CRC_M17_INIT;
+        uint16_t ccitt = CRC_CCITT_INIT;
+        size_t pos = 0;
+
+        while (pos < data.size()) {
+            size_t chunk = min(rndChunk(rng), data.size() - pos);
+            m17 = crc_m17_update(m17, &data[pos], chunk);
+            ccitt = crc_ccitt_update(ccitt, &data[pos], chunk);
+            pos += chunk;
+        }
+
+        REQUIRE(m17 == crc_m17(data.data(), data.size()));
+        REQUIRE(ccitt == crc_ccitt(data.data(), data.size()));
+    }
+}
+
+TEST_CASE("CRC throughput", "[crc][.][benchmark]")
+{
+    auto block = randomData(1024);
+
+    BENCHMARK("M17 CRC, link setup frame (28 bytes)")
+    {
+        return crc_m17(block.data(), 28);
+    };
+
+    BENCHMARK("M17 CRC, 1kB")
+    {
+        return crc_m17(block.data(), block.size());
+    };
+
+    BENCHMARK("CCITT CRC, 1kB XMODEM block")
+    {
+        return crc_ccitt(block.data(), block.size());
+    };
+
+    BENCHMARK("CCITT CRC, 1kB, bitwise reference")
+    {
+        return refCrc(0x1021, 0x0000, block.data(), block.size());
+    };
+}
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+#include "core/graphics.h"
+
+static const color_t white = { 255, 255, 255, 255 };
+static const color_t black = { 0, 0, 0, 255 };
+
+/**
+ * Draw a full width band of the screen, redrawing the whole screen from
+ * scratch as the UI does.
+ */
+static void drawScreen(const int16_t y, const uint16_t height)
+{
+    gfx_clearScreen();
+    gfx_print({ 2, 12 }, FONT_SIZE_8PT, TEXT_ALIGN_LEFT, white, "OpenRTX");
+    gfx_drawRect({ 0, y }, CONFIG_SCREEN_WIDTH, height, white, true);
+}
+
+TEST_CASE("Unchanged screens are not flushed", "[graphics]")
+{
+    drawScreen(40, 10);
+    gfx_render();
+    REQUIRE(gfx_flush() == 0);
+
+    drawScreen(40, 10);
+    REQUIRE(gfx_flush() == 0);
+
+    // A pixel changed and restored within the same frame
+    gfx_setPixel({ 10, 45 }, black);
+    gfx_setPixel({ 10, 45 }, white);
+    REQUIRE(gfx_flush() == 0);
+}
+
+TEST_CASE("Only the changed rows are flushed", "[graphics]")
+{
+    drawScreen(40, 6);
+    gfx_render();
+
+    // Moving the band down by two rows changes rows 40, 41, 46 and 47,
+    // close enough to be sent together.
+    drawScreen(42, 6);
+    REQUIRE(gfx_flush() == 8);
+
+    // Growing the band changes its last rows only
+    drawScreen(42, 10);
+    REQUIRE(gfx_flush() == 4);
+
+    // Rows far from each other are sent separately
+    drawScreen(42, 10);
+    gfx_setPixel({ 0, 0 }, white);
+    gfx_setPixel({ 0, CONFIG_SCREEN_HEIGHT - 1 }, white);
+    REQUIRE(gfx_flush() == 2);
+
+    // Changed pixels are flushed once
+    REQUIRE(gfx_flush() == 0);
+}
+
+TEST_CASE("Cleared rows are flushed", "[graphics]")
+{
+    gfx_fillScreen(white);
+    gfx_render();
+
+    gfx_clearRows(8, 16);
+    REQUIRE(gfx_flush() == 8);
+
+    // Rows out of the screen are ignored
+    gfx_clearRows(CONFIG_SCREEN_HEIGHT - 2, 255);
+    REQUIRE(gfx_flush() == 2);
+
+    gfx_clearRows(20, 20);
+    REQUIRE(gfx_flush() == 0);
+}
+
+TEST_CASE("Any change of a pixel is flushed", "[graphics]")
+{
+    gfx_clearScreen();
+    gfx_render();
+
+    // Colors setting a single bit of an RGB565 pixel
+    std::vector<color_t> colors;
+    for (uint8_t bit = 0; bit < 5; bit++) {
+        colors.push_back({ (uint8_t)(8 << bit), 0, 0, 255 });
+        colors.push_back({ 0, 0, (uint8_t)(8 << bit), 255 });
+    }
+
+    for (uint8_t bit = 0; bit < 6; bit++)
+        colors.push_back({ 0, (uint8_t)(4 << bit), 0, 255 });
+
+    for (const color_t &color : colors) {
+        for (int16_t x = 0; x < CONFIG_SCREEN_WIDTH; x++) {
+            gfx_setPixel({ x, 20 }, color);
+            REQUIRE(gfx_flush() == 1);
+
+            gfx_setPixel({ x, 20 }, black);
+            REQUIRE(gfx_flush() == 1);
+        }
+    }
+
+    // Two pixels changing in the same bit, at any distance
+    static const color_t red = { 128, 0, 0, 255 };
+    for (int16_t x0 = 0; x0 < CONFIG_SCREEN_WIDTH; x0++) {
+        for (int16_t x1 = x0 + 1; x1 < CONFIG_SCREEN_WIDTH; x1++) {
+            gfx_setPixel({ x0, 20 }, red);
+            gfx_setPixel({ x1, 20 }, red);
+            REQUIRE(gfx_flush() == 1);
+
+            gfx_setPixel({ x0, 20 }, black);
+            gfx_setPixel({ x1, 20 }, black);
+            REQUIRE(gfx_flush() == 1);
+        }
+    }
+}
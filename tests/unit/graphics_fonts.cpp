@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "core/graphics.h"
+}
+
+#include "fonts/adafruit/gfxfont.h"
+#include "fonts/adafruit/TomThumb.h"
+#if defined FONT_FREE_SANS
+#include "fonts/adafruit/FreeSans6pt7b.h"
+#include "fonts/adafruit/FreeSans8pt7b.h"
+#include "fonts/adafruit/FreeSans9pt7b.h"
+#include "fonts/adafruit/FreeSans10pt7b.h"
+#include "fonts/adafruit/FreeSans12pt7b.h"
+#include "fonts/adafruit/FreeSans16pt7b.h"
+#elif defined FONT_UBUNTU_REGULAR
+#include "fonts/adafruit/UbuntuRegular6pt7b.h"
+#include "fonts/adafruit/UbuntuRegular8pt7b.h"
+#include "fonts/adafruit/UbuntuRegular9pt7b.h"
+#include "fonts/adafruit/UbuntuRegular10pt7b.h"
+#include "fonts/adafruit/UbuntuRegular12pt7b.h"
+#include "fonts/adafruit/UbuntuRegular16pt7b.h"
+#endif
+#include "fonts/symbols/Symbols5pt7b.h"
+#include "fonts/symbols/Symbols6pt7b.h"
+#include "fonts/symbols/Symbols8pt7b.h"
+
+static const color_t white = { 255, 255, 255, 255 };
+
+// Characters of the fonts used only for the large lines of the UI
+static const char *uiCharacters =
+    "0123456789 ./:-_>%abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+struct Font {
+    fontSize_t size;
+    const GFXfont *source;
+    bool subset;
+};
+
+static const Font fonts[] = {
+    { FONT_SIZE_5PT, &TomThumb, false },
+#if defined FONT_FREE_SANS
+    { FONT_SIZE_6PT, &FreeSans6pt7b, false },
+    { FONT_SIZE_8PT, &FreeSans8pt7b, false },
+    { FONT_SIZE_9PT, &FreeSans9pt7b, false },
+    { FONT_SIZE_10PT, &FreeSans10pt7b, true },
+    { FONT_SIZE_12PT, &FreeSans12pt7b, true },
+    { FONT_SIZE_16PT, &FreeSans16pt7b, true },
+#elif defined FONT_UBUNTU_REGULAR
+    { FONT_SIZE_6PT, &UbuntuRegular6pt7b, false },
+    { FONT_SIZE_8PT, &UbuntuRegular8pt7b, false },
+    { FONT_SIZE_9PT, &UbuntuRegular9pt7b, false },
+    { FONT_SIZE_10PT, &UbuntuRegular10pt7b, true },
+    { FONT_SIZE_12PT, &UbuntuRegular12pt7b, true },
+    { FONT_SIZE_16PT, &UbuntuRegular16pt7b, true },
+#endif
+};
+
+/**
+ * Reference text drawing from the source fonts, one pixel at a time,
+ * excluding the first row and column of the screen as the text rendering
+ * does.
+ */
+static void referenceText(point_t pos, const GFXfont *font, const char *text)
+{
+    for (const char *c = text; *c != '\0'; c++) {
+        const GFXglyph &glyph = font->glyph[*c - font->first];
+        const uint8_t *bitmap = &font->bitmap[glyph.bitmapOffset];
+
+        for (int i = 0; i < glyph.width * glyph.height; i++) {
+            if ((bitmap[i / 8] & (0x80 >> (i % 8))) == 0)
+                continue;
+
+            int16_t x = pos.x + glyph.xOffset + (i % glyph.width);
+            int16_t y = pos.y + glyph.yOffset + (i / glyph.width);
+            if ((x >= 1) && (x < CONFIG_SCREEN_WIDTH) && (y >= 1)
+                && (y < CONFIG_SCREEN_HEIGHT))
+                gfx_setPixel({ x, y }, white);
+        }
+
+        pos.x += glyph.xAdvance;
+    }
+}
+
+/**
+ * Split the characters of a font in lines fitting in the screen width.
+ */
+static std::vector<std::string> textLines(const Font &font)
+{
+    std::vector<std::string> lines(1);
+    uint16_t width = 0;
+
+    for (char c = font.source->first; c <= font.source->last; c++) {
+        if (font.subset && (strchr(uiCharacters, c) == nullptr))
+            continue;
+
+        uint8_t advance = font.source->glyph[c - font.source->first].xAdvance;
+        if (width + advance >= CONFIG_SCREEN_WIDTH - 4) {
+            lines.emplace_back();
+            width = 0;
+        }
+
+        lines.back() += c;
+        width += advance;
+    }
+
+    return lines;
+}
+
+TEST_CASE("Text matches the source fonts", "[graphics]")
+{
+    // Positions on the edges of the screen clip the glyphs
+    static const int16_t offsets[] = { 0, 3, -7 };
+
+    for (const Font &font : fonts) {
+        for (const std::string &line : textLines(font)) {
+            for (int16_t dy : offsets) {
+                int16_t y = (dy < 0) ? CONFIG_SCREEN_HEIGHT + dy : 20 + dy;
+                point_t pos = { (int16_t)(2 + dy), y };
+
+                gfx_clearScreen();
+                referenceText(pos, font.source, line.c_str());
+                gfx_render();
+
+                // Twice, expanding the glyphs in the glyph cache first
+                for (int i = 0; i < 2; i++) {
+                    gfx_clearScreen();
+                    gfx_printBuffer(pos, font.size, TEXT_ALIGN_LEFT, white,
+                                    line.c_str());
+
+                    INFO("size " << font.size << " text \"" << line << "\" at "
+                                 << pos.x << "," << pos.y);
+                    REQUIRE(gfx_flush() == 0);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Symbols match the source fonts", "[graphics]")
+{
+    static const GFXfont *sources[] = { &Symbols5pt7b, &Symbols6pt7b,
+                                        &Symbols8pt7b };
+
+    for (uint8_t size = 0; size < 3; size++) {
+        const GFXfont *source = sources[size];
+
+        for (char c = source->first; c <= source->last; c++) {
+            char symbol[2] = { c, '\0' };
+            point_t pos = { 10, 30 };
+
+            gfx_clearScreen();
+            referenceText(pos, source, symbol);
+            gfx_render();
+
+            gfx_clearScreen();
+            gfx_drawSymbol(pos, (symbolSize_t)size, TEXT_ALIGN_LEFT, white,
+                           (symbol_t)c);
+
+            INFO("size " << int(size) << " symbol " << int(c));
+            REQUIRE(gfx_flush() == 0);
+        }
+    }
+}
+
+TEST_CASE("Characters without a glyph are drawn as spaces", "[graphics]")
+{
+    for (const Font &font : fonts) {
+        gfx_clearScreen();
+        gfx_print({ 2, 40 }, font.size, TEXT_ALIGN_LEFT, white, "A A");
+        gfx_render();
+
+        // Out of the font, as the UTF-8 encoding of non ASCII characters
+        gfx_clearScreen();
+        gfx_print({ 2, 40 }, font.size, TEXT_ALIGN_LEFT, white, "A\x80" "A");
+        INFO("size " << font.size);
+        REQUIRE(gfx_flush() == 0);
+
+        // Out of the subset of the font
+        if (font.subset) {
+            gfx_clearScreen();
+            gfx_print({ 2, 40 }, font.size, TEXT_ALIGN_LEFT, white, "A~A");
+            REQUIRE(gfx_flush() == 0);
+        }
+    }
+}
+
+TEST_CASE("Text rendering", "[graphics][.][benchmark]")
+{
+    static constexpr int FRAMES = 2000;
+
+    for (const Font &font : fonts) {
+        std::vector<std::string> lines = textLines(font);
+        size_t glyphs = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < FRAMES; i++) {
+            for (const std::string &line : lines) {
+                gfx_printBuffer({ 2, 40 }, font.size, TEXT_ALIGN_LEFT, white,
+                                line.c_str());
+                glyphs += line.size();
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        printf("size %d %10.0f glyphs/s\n", font.size, glyphs / seconds);
+    }
+}
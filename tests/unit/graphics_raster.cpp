@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+extern "C" {
+#include "core/graphics.h"
+#include "ui/ui_default.h"
+
+extern void _ui_drawMainVFO(ui_state_t *ui_state);
+extern void _ui_drawMainMEM(ui_state_t *ui_state);
+extern void _ui_drawMenuTop(ui_state_t *ui_state);
+extern void _ui_drawMenuSettings(ui_state_t *ui_state);
+extern void _ui_drawMenuInfo(ui_state_t *ui_state);
+extern void _ui_drawMenuAbout(ui_state_t *ui_state);
+extern void _ui_drawMenuGPS();
+}
+
+static const color_t white = { 255, 255, 255, 255 };
+static const color_t shade = { 250, 180, 19, 128 };
+
+struct Rect {
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+static const Rect rects[] = {
+    { 10, 10, 1, 1 },
+    { 10, 10, 7, 1 },
+    { 10, 10, 1, 7 },
+    { 10, 10, 2, 2 },
+    { 3, 17, 41, 13 },
+    { -5, -3, 20, 10 },
+    { CONFIG_SCREEN_WIDTH - 10, CONFIG_SCREEN_HEIGHT - 5, 20, 20 },
+    { 0, 0, CONFIG_SCREEN_WIDTH, CONFIG_SCREEN_HEIGHT },
+};
+
+/**
+ * Reference rectangle drawing, setting one pixel at a time. The perimeter
+ * of rectangles exceeding the screen is drawn on its edges.
+ */
+static void referenceRect(const Rect &r, const color_t color, const bool fill)
+{
+    int16_t xMax = r.x + r.width - 1;
+    int16_t yMax = r.y + r.height - 1;
+    if (xMax > CONFIG_SCREEN_WIDTH - 1)
+        xMax = CONFIG_SCREEN_WIDTH - 1;
+    if (yMax > CONFIG_SCREEN_HEIGHT - 1)
+        yMax = CONFIG_SCREEN_HEIGHT - 1;
+
+    for (int16_t y = r.y; y <= yMax; y++) {
+        for (int16_t x = r.x; x <= xMax; x++) {
+            bool edge = (y == r.y) || (y == yMax) || (x == r.x) || (x == xMax);
+            if (fill || edge)
+                gfx_setPixel({ x, y }, color);
+        }
+    }
+}
+
+/*
+ * The content drawn is compared against the reference one through the dirty
+ * row tracking: flushing an identical frame sends no rows to the display.
+ */
+
+TEST_CASE("Rectangles match the pixel by pixel reference", "[graphics]")
+{
+    for (const color_t &color : { white, shade }) {
+        for (bool fill : { true, false }) {
+            for (const Rect &r : rects) {
+                gfx_clearScreen();
+                referenceRect(r, color, fill);
+                gfx_render();
+
+                gfx_clearScreen();
+                gfx_drawRect({ r.x, r.y }, r.width, r.height, color, fill);
+
+                INFO("rect " << r.x << "," << r.y << " " << r.width << "x"
+                             << r.height << " fill " << fill << " alpha "
+                             << int(color.alpha));
+                REQUIRE(gfx_flush() == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("Screen fill matches the pixel by pixel reference", "[graphics]")
+{
+    gfx_clearScreen();
+    for (int16_t y = 0; y < CONFIG_SCREEN_HEIGHT; y++) {
+        for (int16_t x = 0; x < CONFIG_SCREEN_WIDTH; x++)
+            gfx_setPixel({ x, y }, shade);
+    }
+    gfx_render();
+
+    gfx_clearScreen();
+    gfx_fillScreen(shade);
+    REQUIRE(gfx_flush() == 0);
+
+    // Text only changes the rows it is printed on
+    gfx_print({ 0, 60 }, FONT_SIZE_8PT, TEXT_ALIGN_CENTER, white, "OpenRTX");
+    uint16_t rows = gfx_flush();
+    REQUIRE(rows > 0);
+    REQUIRE(rows < CONFIG_SCREEN_HEIGHT / 4);
+}
+
+struct Screen {
+    const char *name;
+    void (*draw)(ui_state_t *uiState);
+};
+
+static void drawMenuGPS(ui_state_t *uiState)
+{
+    (void)uiState;
+    _ui_drawMenuGPS();
+}
+
+static const Screen screens[] = {
+    { "Main VFO", _ui_drawMainVFO },
+    { "Main MEM", _ui_drawMainMEM },
+    { "Menu", _ui_drawMenuTop },
+    { "Settings", _ui_drawMenuSettings },
+    { "Info", _ui_drawMenuInfo },
+    { "About", _ui_drawMenuAbout },
+    { "GPS", drawMenuGPS },
+};
+
+TEST_CASE("Screen rendering", "[graphics][.][benchmark]")
+{
+    static constexpr int FRAMES = 2000;
+    ui_state_t uiState = {};
+
+    ui_init();
+
+    for (const Screen &screen : screens) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < FRAMES; i++) {
+            // Draw the whole screen, not only its changed widgets
+            _ui_invalidateWidgets();
+            screen.draw(&uiState);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        printf("%-12s %8.0f frames/s\n", screen.name, FRAMES / seconds);
+    }
+}
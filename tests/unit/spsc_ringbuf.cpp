@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "core/ringbuf.hpp"
+#include "core/spsc_ringbuf.hpp"
+
+static constexpr uint32_t TRANSFER_SIZE = 200000;
+
+/**
+ * Move a sequence of numbers from a producer thread to a consumer thread,
+ * one element at a time, checking the order of arrival.
+ */
+template <class Buffer>
+static bool transfer(Buffer &buf, const uint32_t count)
+{
+    std::thread producer([&buf, count]() {
+        for (uint32_t i = 0; i < count; i++)
+            buf.push(i, true);
+    });
+
+    bool inOrder = true;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t val = 0;
+        buf.pop(val, true);
+        inOrder &= (val == i);
+    }
+
+    producer.join();
+    return inOrder;
+}
+
+/**
+ * Same as transfer(), moving data in blocks of elements.
+ */
+template <class Buffer>
+static bool transferBatch(Buffer &buf, const uint32_t count)
+{
+    std::thread producer([&buf, count]() {
+        uint32_t block[32];
+        for (uint32_t i = 0; i < count; i += 32) {
+            for (uint32_t j = 0; j < 32; j++)
+                block[j] = i + j;
+
+            buf.pushN(block, 32, true);
+        }
+    });
+
+    bool inOrder = true;
+    uint32_t next = 0;
+    uint32_t block[24];
+    while (next < count) {
+        size_t num = buf.popN(block, 24, true);
+        for (size_t j = 0; j < num; j++)
+            inOrder &= (block[j] == next++);
+    }
+
+    producer.join();
+    return inOrder;
+}
+
+TEST_CASE("SPSC ring buffer push and pop", "[ringbuf]")
+{
+    SpscRingBuffer<uint32_t, 8> buf;
+    uint32_t val;
+
+    REQUIRE(buf.empty());
+    REQUIRE(buf.pop(val, false) == false);
+
+    for (uint32_t i = 0; i < 8; i++)
+        REQUIRE(buf.push(i, false));
+
+    REQUIRE(buf.full());
+    REQUIRE(buf.size() == 8);
+    REQUIRE(buf.push(8, false) == false);
+
+    buf.eraseElement();
+    REQUIRE(buf.size() == 7);
+    REQUIRE(buf.push(8, false));
+
+    for (uint32_t i = 1; i <= 8; i++) {
+        REQUIRE(buf.pop(val, false));
+        REQUIRE(val == i);
+    }
+
+    REQUIRE(buf.empty());
+}
+
+TEST_CASE("SPSC ring buffer index wraparound", "[ringbuf]")
+{
+    SpscRingBuffer<uint32_t, 4> buf;
+    uint32_t val;
+
+    // Indices run freely, push and pop across many laps of the buffer
+    for (uint32_t i = 0; i < 1000; i++) {
+        REQUIRE(buf.push(i, false));
+        REQUIRE(buf.push(i + 1, false));
+        REQUIRE(buf.pop(val, false));
+        REQUIRE(val == i);
+        REQUIRE(buf.pop(val, false));
+        REQUIRE(val == i + 1);
+    }
+
+    REQUIRE(buf.empty());
+}
+
+TEST_CASE("SPSC ring buffer batch operations", "[ringbuf]")
+{
+    SpscRingBuffer<uint32_t, 16> buf;
+    uint32_t in[20];
+    uint32_t out[20];
+
+    for (uint32_t i = 0; i < 20; i++)
+        in[i] = i;
+
+    // Non-blocking batch push stops when the buffer is full
+    REQUIRE(buf.pushN(in, 20, false) == 16);
+    REQUIRE(buf.full());
+
+    REQUIRE(buf.popN(out, 10, false) == 10);
+    REQUIRE(buf.pushN(&in[16], 4, false) == 4);
+
+    // Batch pop returns what is available
+    REQUIRE(buf.popN(&out[10], 20, false) == 10);
+    REQUIRE(buf.popN(out, 20, false) == 0);
+
+    for (uint32_t i = 0; i < 20; i++)
+        REQUIRE(out[i] == i);
+}
+
+TEST_CASE("SPSC ring buffer between two threads", "[ringbuf]")
+{
+    static SpscRingBuffer<uint32_t, 64> buf;
+
+    REQUIRE(transfer(buf, TRANSFER_SIZE));
+    REQUIRE(buf.empty());
+
+    REQUIRE(transferBatch(buf, TRANSFER_SIZE));
+    REQUIRE(buf.empty());
+}
+
+/*
+ * The uncontended benchmarks measure the cost of the single operations, the
+ * other ones the throughput between two threads.
+ */
+TEST_CASE("Ring buffer throughput", "[ringbuf][.][benchmark]")
+{
+    static RingBuffer<uint32_t, 64> mutexBuf;
+    static SpscRingBuffer<uint32_t, 64> spscBuf;
+
+    BENCHMARK("RingBuffer, push and pop 32 elements")
+    {
+        uint32_t sum = 0;
+        uint32_t val = 0;
+
+        for (uint32_t i = 0; i < 32; i++)
+            mutexBuf.push(i, false);
+        for (uint32_t i = 0; i < 32; i++) {
+            mutexBuf.pop(val, false);
+            sum += val;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("SpscRingBuffer, push and pop 32 elements")
+    {
+        uint32_t sum = 0;
+        uint32_t val = 0;
+
+        for (uint32_t i = 0; i < 32; i++)
+            spscBuf.push(i, false);
+        for (uint32_t i = 0; i < 32; i++) {
+            spscBuf.pop(val, false);
+            sum += val;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("SpscRingBuffer, push and pop 32 elements in a block")
+    {
+        uint32_t block[32];
+        uint32_t sum = 0;
+
+        for (uint32_t i = 0; i < 32; i++)
+            block[i] = i;
+
+        spscBuf.pushN(block, 32, false);
+        spscBuf.popN(block, 32, false);
+        for (uint32_t i = 0; i < 32; i++)
+            sum += block[i];
+
+        return sum;
+    };
+
+    BENCHMARK("RingBuffer, 200k elements")
+    {
+        return transfer(mutexBuf, TRANSFER_SIZE);
+    };
+
+    BENCHMARK("SpscRingBuffer, 200k elements")
+    {
+        return transfer(spscBuf, TRANSFER_SIZE);
+    };
+
+    BENCHMARK("SpscRingBuffer, 200k elements in blocks")
+    {
+        return transferBatch(spscBuf, TRANSFER_SIZE);
+    };
+}
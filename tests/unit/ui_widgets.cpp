@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2020-2026 OpenRTX Contributors
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+extern "C" {
+#include "core/graphics.h"
+#include "ui/ui_default.h"
+
+extern void _ui_drawMainVFO(ui_state_t *ui_state);
+extern void _ui_drawMainMEM(ui_state_t *ui_state);
+extern void _ui_drawMenuInfo(ui_state_t *ui_state);
+extern void _ui_drawSettingsDisplay(ui_state_t *ui_state);
+}
+
+static const color_t white = { 255, 255, 255, 255 };
+
+struct Screen {
+    const char *name;
+    void (*draw)(ui_state_t *uiState);
+};
+
+static const Screen screens[] = {
+    { "Main VFO", _ui_drawMainVFO },
+    { "Main MEM", _ui_drawMainMEM },
+    { "Info", _ui_drawMenuInfo },
+    { "Display", _ui_drawSettingsDisplay },
+};
+
+static void initState()
+{
+    ui_init();
+
+    last_state.channel.mode = OPMODE_FM;
+    last_state.channel.bandwidth = BW_25;
+    last_state.channel.rx_frequency = 430000000;
+    last_state.channel.tx_frequency = 430000000;
+    snprintf(last_state.channel.name, sizeof(last_state.channel.name), "Repeater");
+    last_state.rssi = -120;
+    last_state.charge = 80;
+    last_state.v_bat = 7400;
+    last_state.volume = 128;
+    last_state.settings.sqlLevel = 4;
+    last_state.settings.brightness = 50;
+}
+
+/**
+ * Randomly change the state shown by the screens, including the one changed
+ * only by user input.
+ */
+static void changeState(std::mt19937 &rng, ui_state_t &uiState)
+{
+    switch (rng() % 9) {
+    case 0:
+        last_state.rssi = -130 + (rng() % 90);
+        break;
+
+    case 1:
+        last_state.time.second = rng() % 60;
+        last_state.time.minute = rng() % 60;
+        break;
+
+    case 2:
+        last_state.charge = rng() % 101;
+        last_state.v_bat = 6000 + (rng() % 2400);
+        break;
+
+    case 3:
+        last_state.volume = rng() % 256;
+        last_state.settings.sqlLevel = rng() % 16;
+        break;
+
+    case 4:
+        last_state.channel.rx_frequency = 430000000 + ((rng() % 1000) * 12500);
+        break;
+
+    case 5:
+        last_state.channel.mode = OPMODE_FM + (rng() % 3);
+        last_state.channel.bandwidth = rng() % 2;
+        last_state.channel.fm.txToneEn = rng() % 2;
+        last_state.channel.fm.txTone = rng() % 50;
+        break;
+
+    case 6:
+        last_state.settings.showBatteryIcon = rng() % 2;
+        uiState.input_locked = rng() % 2;
+        break;
+
+    case 7:
+        uiState.menu_selected = rng() % 12;
+        uiState.edit_mode = rng() % 2;
+        break;
+
+    case 8:
+        last_state.bank_enabled = rng() % 2;
+        last_state.channel_index = rng() % 200;
+        last_state.settings.brightness = rng() % 100;
+        break;
+    }
+}
+
+TEST_CASE("Partial redraws match redraws from scratch", "[ui]")
+{
+    std::mt19937 rng(24);
+    ui_state_t uiState = {};
+
+    initState();
+
+    for (const Screen &screen : screens) {
+        _ui_invalidateWidgets();
+        screen.draw(&uiState);
+
+        for (int i = 0; i < 2000; i++) {
+            changeState(rng, uiState);
+            screen.draw(&uiState);
+            gfx_render();
+
+            _ui_invalidateWidgets();
+            screen.draw(&uiState);
+
+            INFO(screen.name << " step " << i);
+            REQUIRE(gfx_flush() == 0);
+        }
+    }
+}
+
+TEST_CASE("Only the widgets whose state changed are drawn", "[ui]")
+{
+    ui_state_t uiState = {};
+
+    initState();
+    _ui_invalidateWidgets();
+    _ui_drawMainVFO(&uiState);
+    gfx_render();
+
+    // Nothing changed
+    _ui_drawMainVFO(&uiState);
+    REQUIRE(gfx_flush() == 0);
+
+    // A pixel in the top bar, which is not drawn again when only the RSSI
+    // changes: the S-meter rows only are sent to the display.
+    gfx_setPixel({ 0, 1 }, white);
+    gfx_render();
+
+    last_state.rssi += 40;
+    _ui_drawMainVFO(&uiState);
+    uint16_t rows = gfx_flush();
+    REQUIRE(rows > 0);
+    REQUIRE(rows <= layout.bottom_h + layout.bottom_pad);
+
+    _ui_invalidateWidgets();
+    _ui_drawMainVFO(&uiState);
+    REQUIRE(gfx_flush() == 1);
+
+    // The clock is in the top bar
+    gfx_setPixel({ 0, 1 }, white);
+    gfx_render();
+
+    last_state.time.second += 1;
+    _ui_drawMainVFO(&uiState);
+    rows = gfx_flush();
+    REQUIRE(rows > 0);
+    REQUIRE(rows <= layout.top_h);
+
+    _ui_invalidateWidgets();
+    _ui_drawMainVFO(&uiState);
+    REQUIRE(gfx_flush() == 0);
+}
+
+/**
+ * Bind a widget to a state in a new frame.
+ *
+ * @return true if the widget has to be drawn.
+ */
+static bool bindWidget(widget_t &widget, const void *data, size_t size)
+{
+    _ui_beginWidgets();
+    _ui_addState(&widget, data, size);
+    _ui_bindWidget(&widget, 10, 20);
+
+    return _ui_redrawWidget(&widget);
+}
+
+TEST_CASE("Widgets are drawn on any change of their state", "[ui]")
+{
+    static widget_t widget;
+    uint8_t state[WIDGET_STATE_SIZE] = {};
+
+    _ui_invalidateWidgets();
+    REQUIRE(bindWidget(widget, state, 8));
+    REQUIRE(bindWidget(widget, state, 8) == false);
+
+    // Every bit of the state is compared
+    for (size_t i = 0; i < sizeof(state); i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            INFO("byte " << i << " bit " << (int)bit);
+            state[i] ^= 1 << bit;
+            REQUIRE(bindWidget(widget, state, sizeof(state)));
+            REQUIRE(bindWidget(widget, state, sizeof(state)) == false);
+        }
+    }
+
+    // A shorter state with the same content
+    REQUIRE(bindWidget(widget, state, sizeof(state) - 1));
+    REQUIRE(bindWidget(widget, state, sizeof(state) - 1) == false);
+
+    // A state larger than the retained copy is always drawn
+    uint8_t large[WIDGET_STATE_SIZE + 1] = {};
+    REQUIRE(bindWidget(widget, large, sizeof(large)));
+    REQUIRE(bindWidget(widget, large, sizeof(large)));
+}
+
+TEST_CASE("Status update rendering", "[ui][.][benchmark]")
+{
+    static constexpr int FRAMES = 2000;
+    ui_state_t uiState = {};
+
+    initState();
+
+    for (const Screen &screen : screens) {
+        for (bool full : { true, false }) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < FRAMES; i++) {
+                // RSSI changes continuously during RX, the clock every second
+                last_state.rssi = -120 + (i % 40);
+                last_state.time.second = (i / 40) % 60;
+                if (full)
+                    _ui_invalidateWidgets();
+                screen.draw(&uiState);
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            double seconds = std::chrono::duration<double>(end - start).count();
+            printf("%-10s %-8s %8.0f frames/s\n", screen.name,
+                   full ? "full" : "widgets", FRAMES / seconds);
+        }
+    }
+}